@@ -25,14 +25,75 @@
 
 #include <RendererToolkit/Public/RendererToolkitInstance.h>
 
+#include <Renderer/Public/Context.h>
+#include <Renderer/Public/RendererInstance.h>
+#include <Renderer/Public/Core/NullProfiler.h>
+#include <Renderer/Public/Core/NullGraphicsDebugger.h>
 #include <Renderer/Public/Core/File/FileSystemHelper.h>
 #include <Renderer/Public/Core/File/DefaultFileManager.h>
 
+#include <Rhi/Public/RhiInstance.h>
 #include <Rhi/Public/DefaultLog.h>
 #include <Rhi/Public/DefaultAssert.h>
 #include <Rhi/Public/DefaultAllocator.h>
 
 
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		void compilePipelineStateObjectCache(Rhi::ILog& log, Rhi::IAssert& assert, Rhi::IAllocator& allocator, const std::string& absoluteRootDirectory, RendererToolkit::IProject& project, const char* rhiTarget)
+		{
+			// The precompiled pipeline state object cache is RHI implementation specific, so we need an instance of the RHI implementation the RHI target is for
+			const std::string rhiName = project.getRhiName(rhiTarget);
+			Rhi::Context rhiContext(log, assert, allocator);
+			Rhi::RhiInstance rhiInstance(rhiName.c_str(), rhiContext);
+			Rhi::IRhi* rhi = rhiInstance.getRhi();
+			if (nullptr == rhi || !rhi->isInitialized())
+			{
+				RHI_LOG(rhiContext, WARNING, "The RHI implementation \"%s\" is not available, the asset package will be shipped without precompiled pipeline state object cache", rhiName.c_str())
+				return;
+			}
+
+			// Renderer instance with its own file manager, the asset package mount point must not be shared across RHI targets
+			Renderer::DefaultFileManager defaultFileManager(log, assert, allocator, absoluteRootDirectory);
+			#if defined(RENDERER_GRAPHICS_DEBUGGER) && defined(RENDERER_PROFILER)
+				Renderer::NullGraphicsDebugger nullGraphicsDebugger;
+				Renderer::NullProfiler nullProfiler;
+				Renderer::Context rendererContext(*rhi, defaultFileManager, nullGraphicsDebugger, nullProfiler);
+			#elif defined RENDERER_GRAPHICS_DEBUGGER
+				Renderer::NullGraphicsDebugger nullGraphicsDebugger;
+				Renderer::Context rendererContext(*rhi, defaultFileManager, nullGraphicsDebugger);
+			#elif defined RENDERER_PROFILER
+				Renderer::NullProfiler nullProfiler;
+				Renderer::Context rendererContext(*rhi, defaultFileManager, nullProfiler);
+			#else
+				Renderer::Context rendererContext(*rhi, defaultFileManager);
+			#endif
+			Renderer::RendererInstance rendererInstance(rendererContext);
+			Renderer::IRenderer* renderer = rendererInstance.getRenderer();
+			if (nullptr != renderer)
+			{
+				project.compilePipelineStateObjectCache(*renderer, rhiTarget);
+			}
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
 //[-------------------------------------------------------]
 //[ Platform independent program entry point              ]
 //[-------------------------------------------------------]
@@ -41,7 +102,8 @@
 	Rhi::DefaultLog defaultLog;
 	Rhi::DefaultAssert defaultAssert;
 	Rhi::DefaultAllocator defaultAllocator;
-	Renderer::DefaultFileManager defaultFileManager(defaultLog, defaultAssert, defaultAllocator, std_filesystem::canonical(std_filesystem::current_path() / "..").generic_string());
+	const std::string absoluteRootDirectory = std_filesystem::canonical(std_filesystem::current_path() / "..").generic_string();
+	Renderer::DefaultFileManager defaultFileManager(defaultLog, defaultAssert, defaultAllocator, absoluteRootDirectory);
 	RendererToolkit::Context rendererToolkitContext(defaultLog, defaultAssert, defaultAllocator, defaultFileManager);
 	RendererToolkit::RendererToolkitInstance rendererToolkitInstance(rendererToolkitContext);
 	RendererToolkit::IRendererToolkit* rendererToolkit = rendererToolkitInstance.getRendererToolkit();
@@ -58,6 +120,7 @@
 			{
 				//	project->compileAllAssets("Direct3D9_30");
 					project->compileAllAssets("Direct3D11_50");
+					::detail::compilePipelineStateObjectCache(defaultLog, defaultAssert, defaultAllocator, absoluteRootDirectory, *project, "Direct3D11_50");
 				//	project->compileAllAssets("Direct3D12_50");
 				//	project->compileAllAssets("OpenGLES3_300");
 				//	project->compileAllAssets("OpenGL_440");
@@ -70,6 +133,7 @@
 					const std::string renderTargetString(renderTarget);
 					RHI_LOG(rendererToolkitContext, INFORMATION, "Compiling for target: \"%s\"", renderTargetString.c_str())
 					project->compileAllAssets(renderTargetString.c_str());
+					::detail::compilePipelineStateObjectCache(defaultLog, defaultAssert, defaultAllocator, absoluteRootDirectory, *project, renderTargetString.c_str());
 					RHI_LOG(rendererToolkitContext, INFORMATION, "Compilation done")
 				}
 			}
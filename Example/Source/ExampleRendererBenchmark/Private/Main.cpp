@@ -0,0 +1,425 @@
+/*********************************************************\
+ * Copyright (c) 2012-2021 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <Renderer/Public/Context.h>
+#include <Renderer/Public/RendererInstance.h>
+#include <Renderer/Public/Asset/AssetManager.h>
+#include <Renderer/Public/Core/Math/Transform.h>
+#include <Renderer/Public/Core/Time/Stopwatch.h>
+#include <Renderer/Public/Core/File/FileSystemHelper.h>
+#include <Renderer/Public/Core/File/DefaultFileManager.h>
+#include <Renderer/Public/RenderQueue/RenderQueue.h>
+#include <Renderer/Public/RenderQueue/RenderableManager.h>
+#include <Renderer/Public/Resource/Mesh/MeshResourceManager.h>
+#include <Renderer/Public/Resource/Material/MaterialResource.h>
+#include <Renderer/Public/Resource/Material/MaterialResourceManager.h>
+#include <Renderer/Public/Resource/MaterialBlueprint/MaterialBlueprintResource.h>
+#include <Renderer/Public/Resource/MaterialBlueprint/MaterialBlueprintResourceManager.h>
+#include <Renderer/Public/Resource/MaterialBlueprint/BufferManager/PassBufferManager.h>
+#include <Renderer/Public/Resource/MaterialBlueprint/Cache/GraphicsPipelineStateCompiler.h>
+#include <Renderer/Public/Resource/CompositorWorkspace/CompositorContextData.h>
+#include <Renderer/Public/Core/NullProfiler.h>
+#include <Renderer/Public/Core/NullGraphicsDebugger.h>
+
+#include <Rhi/Public/RhiInstance.h>
+#include <Rhi/Public/DefaultLog.h>
+#include <Rhi/Public/DefaultAssert.h>
+#include <Rhi/Public/DefaultAllocator.h>
+
+#include <cmath>
+#include <vector>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr uint32_t NUMBER_OF_RENDERABLE_MANAGERS		= 10000;
+		static constexpr uint32_t NUMBER_OF_MATERIALS				= 256;		// Cloned material resources, each one has its own slot inside the material uniform buffer
+		static constexpr uint32_t CHANGED_MATERIALS_PERCENTAGE		= 10;		// Percentage of material resources getting a new property value between two frames
+		static constexpr uint32_t NUMBER_OF_FRAMES					= 100;		// The first frame creates the pipeline states and buffers and isn't measured
+		static constexpr uint32_t MAXIMUM_NUMBER_OF_LOADING_UPDATES = 1000;
+		static constexpr double	  GRID_SPACING						= 2.0;		// Renderable managers are placed on a grid in front of the origin
+		static constexpr uint32_t RENDER_TARGET_WIDTH				= 1920;
+		static constexpr uint32_t RENDER_TARGET_HEIGHT				= 1080;
+
+
+		//[-------------------------------------------------------]
+		//[ Structures                                            ]
+		//[-------------------------------------------------------]
+		struct BenchmarkCase final
+		{
+			const char*					  name;
+			Renderer::AssetId			  materialAssetId;
+			Renderer::MaterialTechniqueId materialTechniqueId;
+			Renderer::MaterialPropertyId  changedMaterialPropertyId;	// Material property changed between two frames, invalid if the material blueprint has no material uniform buffer
+			bool						  transparentPass;
+		};
+		// Only material blueprints whose pass uniform buffer can be filled without compositor workspace instance, e.g. "Forward" needs the light buffer and shadow map
+		static const BenchmarkCase BENCHMARK_CASES[] =
+		{
+			{ "Mesh depth only: Material buffer manager and texture instance buffer manager", ASSET_ID("Example/Mesh/Imrod/M_Imrod"),			  STRING_ID("DepthOnly"),   STRING_ID("AlphaReference"),				   false },
+			{ "Particles transparent: Uniform instance buffer manager",						  ASSET_ID("Example/Blueprint/Particles/M_Particles"), STRING_ID("Transparent"), Renderer::getInvalid<Renderer::MaterialPropertyId>(), true }
+		};
+
+
+		//[-------------------------------------------------------]
+		//[ Classes                                               ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Allocator forwarding to another allocator while counting the allocations
+		*/
+		class CountingAllocator final : public Rhi::IAllocator
+		{
+		public:
+			inline explicit CountingAllocator(Rhi::IAllocator& allocator) :
+				IAllocator(&CountingAllocator::countingReallocate),
+				mAllocator(allocator),
+				mNumberOfAllocations(0)
+			{}
+
+			inline virtual ~CountingAllocator() override
+			{}
+
+			[[nodiscard]] inline uint32_t getNumberOfAllocations() const
+			{
+				return mNumberOfAllocations;
+			}
+
+		private:
+			explicit CountingAllocator(const CountingAllocator&) = delete;
+			CountingAllocator& operator=(const CountingAllocator&) = delete;
+
+			[[nodiscard]] static void* countingReallocate(Rhi::IAllocator& allocator, void* oldPointer, size_t oldNumberOfBytes, size_t newNumberOfBytes, size_t alignment)
+			{
+				CountingAllocator& countingAllocator = static_cast<CountingAllocator&>(allocator);
+				if (0 != newNumberOfBytes)
+				{
+					++countingAllocator.mNumberOfAllocations;
+				}
+				return countingAllocator.mAllocator.reallocate(oldPointer, oldNumberOfBytes, newNumberOfBytes, alignment);
+			}
+
+		private:
+			Rhi::IAllocator& mAllocator;
+			uint32_t		 mNumberOfAllocations;	///< Number of allocations and reallocations
+		};
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] bool loadMaterialResource(Renderer::IRenderer& renderer, Renderer::AssetId materialAssetId, Renderer::MaterialResourceId& materialResourceId)
+		{
+			// Material resource loading is asynchronous, flush the queues until the material resource and everything it depends on has been loaded
+			Renderer::MaterialResourceManager& materialResourceManager = renderer.getMaterialResourceManager();
+			materialResourceManager.loadMaterialResourceByAssetId(materialAssetId, materialResourceId);
+			for (uint32_t i = 0; i < MAXIMUM_NUMBER_OF_LOADING_UPDATES; ++i)
+			{
+				renderer.flushAllQueues();
+				renderer.update();
+				const Renderer::MaterialResource* materialResource = materialResourceManager.tryGetById(materialResourceId);
+				if (nullptr == materialResource || Renderer::IResource::LoadingState::FAILED == materialResource->getLoadingState())
+				{
+					return false;
+				}
+				if (Renderer::IResource::LoadingState::LOADED == materialResource->getLoadingState())
+				{
+					// Finish the loading of resources the material resource depends on, e.g. textures
+					renderer.flushAllQueues();
+					renderer.update();
+					return true;
+				}
+			}
+			return false;
+		}
+
+		[[nodiscard]] uint32_t getNumberOfCommands(const Rhi::CommandBuffer& commandBuffer)
+		{
+			// "Rhi::CommandBuffer::getNumberOfCommands()" is only available in debug builds
+			uint32_t numberOfCommands = 0;
+			for (Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket(); nullptr != constCommandPacket; constCommandPacket = Rhi::CommandPacketHelper::getNextCommandPacket(constCommandPacket))
+			{
+				++numberOfCommands;
+			}
+			return numberOfCommands;
+		}
+
+		[[nodiscard]] bool runBenchmarkCase(Renderer::IRenderer& renderer, const CountingAllocator& countingAllocator, Rhi::IRenderTarget& renderTarget, const BenchmarkCase& benchmarkCase)
+		{
+			const Rhi::Context& context = renderer.getRhi().getContext();
+			Renderer::MaterialResourceManager& materialResourceManager = renderer.getMaterialResourceManager();
+			Renderer::MaterialBlueprintResourceManager& materialBlueprintResourceManager = renderer.getMaterialBlueprintResourceManager();
+
+			// Load the material resource and clone it, the clones get different property values so each one needs its own material buffer slot
+			Renderer::MaterialResourceId parentMaterialResourceId = Renderer::getInvalid<Renderer::MaterialResourceId>();
+			if (!loadMaterialResource(renderer, benchmarkCase.materialAssetId, parentMaterialResourceId))
+			{
+				RHI_LOG(context, CRITICAL, "%s: Failed to load the material resource, the example project might not have been compiled", benchmarkCase.name)
+				return false;
+			}
+			std::vector<Renderer::MaterialResourceId> materialResourceIds(NUMBER_OF_MATERIALS);
+			for (uint32_t i = 0; i < NUMBER_OF_MATERIALS; ++i)
+			{
+				materialResourceIds[i] = materialResourceManager.createMaterialResourceByCloning(parentMaterialResourceId);
+				if (Renderer::isValid(benchmarkCase.changedMaterialPropertyId))
+				{
+					materialResourceManager.getById(materialResourceIds[i]).setPropertyById(benchmarkCase.changedMaterialPropertyId, Renderer::MaterialPropertyValue::fromFloat(static_cast<float>(i) / static_cast<float>(NUMBER_OF_MATERIALS)));
+				}
+			}
+
+			// Renderable managers placed on a grid, each one with a single renderable using the draw ID vertex array so no mesh asset is needed
+			const Rhi::IVertexArrayPtr& drawIdVertexArrayPtr = renderer.getMeshResourceManager().getDrawIdVertexArrayPtr();
+			const uint32_t gridSize = static_cast<uint32_t>(std::ceil(std::sqrt(static_cast<float>(NUMBER_OF_RENDERABLE_MANAGERS))));
+			std::vector<Renderer::Transform> transforms;
+			transforms.reserve(NUMBER_OF_RENDERABLE_MANAGERS);
+			std::vector<Renderer::RenderableManager> renderableManagers(NUMBER_OF_RENDERABLE_MANAGERS);
+			std::vector<Renderer::RenderableManager*> renderableManagerPointers;
+			renderableManagerPointers.reserve(NUMBER_OF_RENDERABLE_MANAGERS);
+			for (uint32_t i = 0; i < NUMBER_OF_RENDERABLE_MANAGERS; ++i)
+			{
+				const glm::dvec3 position((static_cast<double>(i % gridSize) - static_cast<double>(gridSize) * 0.5) * GRID_SPACING, 0.0, static_cast<double>(i / gridSize + 1) * GRID_SPACING);
+				transforms.emplace_back(position);
+				Renderer::RenderableManager& renderableManager = renderableManagers[i];
+				renderableManager.getRenderables().emplace_back(renderableManager, drawIdVertexArrayPtr, materialResourceManager, materialResourceIds[i % NUMBER_OF_MATERIALS], Renderer::getInvalid<Renderer::SkeletonResourceId>(), false, 0, 6, 1 RHI_RESOURCE_DEBUG_NAME("Renderer benchmark"));
+				renderableManager.updateCachedRenderablesData();
+				renderableManager.setTransform(&transforms.back());
+				renderableManager.setCachedDistanceToCamera(static_cast<float>(glm::length(position)));
+				renderableManager.setVisible(true);
+				renderableManagerPointers.push_back(&renderableManager);
+			}
+
+			// Frames: Change a few material properties, fill the render queue, record and submit the command buffer like "Renderer::CompositorWorkspaceInstance::execute()" does
+			Renderer::RenderQueue renderQueue(materialBlueprintResourceManager.getIndirectBufferManager(), 0, 255, false, benchmarkCase.transparentPass, true);
+			const Renderer::CompositorContextData compositorContextData;
+			Rhi::CommandBuffer commandBuffer;
+			float changeMilliseconds = 0.0f;
+			float fillMilliseconds = 0.0f;
+			float recordMilliseconds = 0.0f;
+			float submitMilliseconds = 0.0f;
+			uint32_t numberOfDrawCalls = 0;
+			uint32_t numberOfCommands = 0;
+			uint32_t numberOfFirstFrameAllocations = 0;
+			uint32_t numberOfLaterFrameAllocations = 0;
+			const uint32_t numberOfChangedMaterials = Renderer::isValid(benchmarkCase.changedMaterialPropertyId) ? (NUMBER_OF_MATERIALS / 100 * CHANGED_MATERIALS_PERCENTAGE) : 0;
+			for (uint32_t frame = 0; frame < NUMBER_OF_FRAMES; ++frame)
+			{
+				renderer.update();
+				const uint32_t numberOfAllocationsBeforeFrame = countingAllocator.getNumberOfAllocations();
+
+				// Stage: Material property changes, each one marks a material buffer slot dirty
+				Renderer::Stopwatch stopwatch(true);
+				for (uint32_t i = 0; i < numberOfChangedMaterials; ++i)
+				{
+					const uint32_t materialIndex = (frame * numberOfChangedMaterials + i) % NUMBER_OF_MATERIALS;
+					materialResourceManager.getById(materialResourceIds[materialIndex]).setPropertyById(benchmarkCase.changedMaterialPropertyId, Renderer::MaterialPropertyValue::fromFloat(static_cast<float>((frame + materialIndex) % NUMBER_OF_MATERIALS) / static_cast<float>(NUMBER_OF_MATERIALS)));
+				}
+				const float frameChangeMilliseconds = stopwatch.getMilliseconds();
+
+				// Stage: Fill the render queue
+				stopwatch.start();
+				renderQueue.addRenderablesFromRenderableManagers(renderableManagerPointers, benchmarkCase.materialTechniqueId, compositorContextData);
+				const float frameFillMilliseconds = stopwatch.getMilliseconds();
+
+				// Stage: Record, this is filling the pass, material and instance buffers
+				stopwatch.start();
+				Rhi::Command::SetGraphicsRenderTarget::create(commandBuffer, &renderTarget);
+				if (renderQueue.getNumberOfDrawCalls() > 0)
+				{
+					renderQueue.fillGraphicsCommandBuffer(renderTarget, compositorContextData, commandBuffer);
+				}
+				const float frameRecordMilliseconds = stopwatch.getMilliseconds();
+
+				// Stage: Submit
+				stopwatch.start();
+				materialBlueprintResourceManager.onPreCommandBufferDispatch();
+				commandBuffer.dispatchToRhi(renderer.getRhi());
+				const float frameSubmitMilliseconds = stopwatch.getMilliseconds();
+
+				// The command buffer has been dispatched, inform everyone who cares about this
+				const uint32_t numberOfMaterialBlueprintResources = materialBlueprintResourceManager.getNumberOfResources();
+				for (uint32_t i = 0; i < numberOfMaterialBlueprintResources; ++i)
+				{
+					Renderer::PassBufferManager* passBufferManager = materialBlueprintResourceManager.getByIndex(i).getPassBufferManager();
+					if (nullptr != passBufferManager)
+					{
+						passBufferManager->onPostCommandBufferDispatch();
+					}
+				}
+
+				// Gather the stage timings and allocations, the first frame is a warm-up
+				numberOfDrawCalls = renderQueue.getNumberOfDrawCalls();
+				numberOfCommands = getNumberOfCommands(commandBuffer);
+				renderQueue.clear();
+				commandBuffer.clear();
+				const uint32_t numberOfFrameAllocations = countingAllocator.getNumberOfAllocations() - numberOfAllocationsBeforeFrame;
+				if (0 == frame)
+				{
+					numberOfFirstFrameAllocations = numberOfFrameAllocations;
+				}
+				else
+				{
+					changeMilliseconds += frameChangeMilliseconds;
+					fillMilliseconds += frameFillMilliseconds;
+					recordMilliseconds += frameRecordMilliseconds;
+					submitMilliseconds += frameSubmitMilliseconds;
+					numberOfLaterFrameAllocations += numberOfFrameAllocations;
+				}
+			}
+
+			// Release the renderables before the material resources they're using
+			renderableManagerPointers.clear();
+			renderableManagers.clear();
+			for (const Renderer::MaterialResourceId materialResourceId : materialResourceIds)
+			{
+				materialResourceManager.destroyMaterialResource(materialResourceId);
+			}
+
+			// Report per frame stage timings
+			if (0 == numberOfDrawCalls)
+			{
+				RHI_LOG(context, CRITICAL, "%s: The render queue is empty, the material technique might be missing", benchmarkCase.name)
+				return false;
+			}
+			if (0 != numberOfLaterFrameAllocations)
+			{
+				RHI_LOG(context, PERFORMANCE_WARNING, "%s: %u RHI allocations after the first frame, the buffer managers are supposed to recycle their buffers", benchmarkCase.name, numberOfLaterFrameAllocations)
+			}
+			const float numberOfMeasuredFrames = static_cast<float>(NUMBER_OF_FRAMES - 1);
+			RHI_LOG(context, INFORMATION, "%s: %u renderables, %u materials with %u changed per frame, %u draw calls and %u commands per frame, material changes %.3f ms, fill %.3f ms, record %.3f ms, submit %.3f ms, RHI allocations %u in the first frame and %u in later frames",
+				benchmarkCase.name, NUMBER_OF_RENDERABLE_MANAGERS, NUMBER_OF_MATERIALS, numberOfChangedMaterials, numberOfDrawCalls, numberOfCommands, changeMilliseconds / numberOfMeasuredFrames, fillMilliseconds / numberOfMeasuredFrames,
+				recordMilliseconds / numberOfMeasuredFrames, submitMilliseconds / numberOfMeasuredFrames, numberOfFirstFrameAllocations, numberOfLaterFrameAllocations)
+
+			// Done
+			return true;
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Platform independent program entry point              ]
+//[-------------------------------------------------------]
+[[nodiscard]] int programEntryPoint()
+{
+	Rhi::DefaultLog defaultLog;
+	Rhi::DefaultAssert defaultAssert;
+	Rhi::DefaultAllocator defaultAllocator;
+	::detail::CountingAllocator countingAllocator(defaultAllocator);
+
+	// Null RHI instance with its own context so the allocations made by the RHI and the renderer can be counted
+	Rhi::Context rhiContext(defaultLog, defaultAssert, countingAllocator);
+	Rhi::RhiInstance rhiInstance("Null", rhiContext);
+	Rhi::IRhi* rhi = rhiInstance.getRhi();
+	if (nullptr == rhi || !rhi->isInitialized())
+	{
+		RHI_LOG(rhiContext, CRITICAL, "Failed to create the null RHI instance")
+		return 1;
+	}
+
+	// Renderer instance: Shippable executable binaries are inside e.g. "unrimp/Binary/Windows_x64_Static" while the compiled example project is inside e.g. "unrimp/Binary/DataPc/Example"
+	Renderer::DefaultFileManager defaultFileManager(defaultLog, defaultAssert, defaultAllocator, std_filesystem::canonical(std_filesystem::current_path() / "..").generic_string());
+	#if defined(RENDERER_GRAPHICS_DEBUGGER) && defined(RENDERER_PROFILER)
+		Renderer::NullGraphicsDebugger nullGraphicsDebugger;
+		Renderer::NullProfiler nullProfiler;
+		Renderer::Context rendererContext(*rhi, defaultFileManager, nullGraphicsDebugger, nullProfiler);
+	#elif defined RENDERER_GRAPHICS_DEBUGGER
+		Renderer::NullGraphicsDebugger nullGraphicsDebugger;
+		Renderer::Context rendererContext(*rhi, defaultFileManager, nullGraphicsDebugger);
+	#elif defined RENDERER_PROFILER
+		Renderer::NullProfiler nullProfiler;
+		Renderer::Context rendererContext(*rhi, defaultFileManager, nullProfiler);
+	#else
+		Renderer::Context rendererContext(*rhi, defaultFileManager);
+	#endif
+	Renderer::RendererInstance rendererInstance(rendererContext);
+	Renderer::IRenderer* renderer = rendererInstance.getRenderer();
+	if (nullptr == renderer)
+	{
+		RHI_LOG(rhiContext, CRITICAL, "Failed to create the renderer instance")
+		return 1;
+	}
+	if (nullptr == renderer->getAssetManager().mountAssetPackage("../DataPc/Example/Content", "Example"))
+	{
+		RHI_LOG(rhiContext, CRITICAL, "Please start \"ExampleProjectCompiler\" before starting \"ExampleRendererBenchmark\" for the first time")
+		return 1;
+	}
+
+	// Pipeline states must be ready when recording, else the render queue skips the renderables
+	renderer->getGraphicsPipelineStateCompiler().setAsynchronousCompilationEnabled(false);
+
+	// Run all benchmark cases into a null RHI framebuffer
+	bool passed = true;
+	{
+		const Rhi::TextureFormat::Enum textureFormat = Rhi::TextureFormat::R8G8B8A8;
+		Rhi::ITexture* texture2D = renderer->getTextureManager().createTexture2D(::detail::RENDER_TARGET_WIDTH, ::detail::RENDER_TARGET_HEIGHT, textureFormat, nullptr, Rhi::TextureFlag::SHADER_RESOURCE | Rhi::TextureFlag::RENDER_TARGET);
+		const Rhi::FramebufferAttachment colorFramebufferAttachment(texture2D);
+		Rhi::IFramebufferPtr framebuffer(rhi->createFramebuffer(*rhi->createRenderPass(1, &textureFormat), &colorFramebufferAttachment));
+		for (const ::detail::BenchmarkCase& benchmarkCase : ::detail::BENCHMARK_CASES)
+		{
+			passed = ::detail::runBenchmarkCase(*renderer, countingAllocator, *framebuffer, benchmarkCase) && passed;
+		}
+	}
+
+	// Done
+	return passed ? 0 : 1;
+}
+
+
+//[-------------------------------------------------------]
+//[ Platform dependent program entry point                ]
+//[-------------------------------------------------------]
+// Windows implementation
+#ifdef _WIN32
+	#ifdef UNICODE
+		int wmain(int, wchar_t**)
+	#else
+		int main(int, char**)
+	#endif
+		{
+			// Call the platform independent program entry point
+			return programEntryPoint();
+		}
+
+// Linux implementation
+#elif LINUX
+	int main(int, char**)
+	{
+		// Call the platform independent program entry point
+		return programEntryPoint();
+	}
+#endif
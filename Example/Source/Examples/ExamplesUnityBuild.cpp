@@ -63,4 +63,5 @@
 	#ifdef RENDERER_OPENVR
 		#include "Private/Renderer/Scene/VrController.cpp"
 	#endif
+	#include "Private/Renderer/Benchmark/Benchmark.cpp"
 #endif
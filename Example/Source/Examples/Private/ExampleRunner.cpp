@@ -55,6 +55,7 @@
 	#include "Examples/Private/Renderer/Mesh/Mesh.h"
 	#include "Examples/Private/Renderer/Compositor/Compositor.h"
 	#include "Examples/Private/Renderer/Scene/Scene.h"
+	#include "Examples/Private/Renderer/Benchmark/Benchmark.h"
 #endif
 
 // "ini.h"-library implementation in here since the tiny external library is used by multiple examples
@@ -183,6 +184,7 @@ ExampleRunner::ExampleRunner() :
 		addExample("Mesh",						&runRenderExample<Mesh>,					supportsAllRhi);
 		addExample("Compositor",				&runRenderExample<Compositor>,				supportsAllRhi);
 		addExample("Scene",						&runRenderExample<Scene>,					supportsAllRhi);
+		addExample("Benchmark",					&runBasicExample<Benchmark>,				supportsAllRhi);
 		mDefaultExampleName = "ImGuiExampleSelector";
 	#else
 		mDefaultExampleName = "Triangle";
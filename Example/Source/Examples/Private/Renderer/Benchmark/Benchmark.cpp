@@ -0,0 +1,1170 @@
+/*********************************************************\
+ * Copyright (c) 2012-2021 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Examples/Private/Renderer/Benchmark/Benchmark.h"
+
+#include <Rhi/Public/Rhi.h>
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4201)	// warning C4201: nonstandard extension used: nameless struct/union
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	PRAGMA_WARNING_DISABLE_MSVC(4324)	// warning C4324: '<x>': structure was padded due to alignment specifier
+	#include <glm/gtc/matrix_transform.hpp>
+PRAGMA_WARNING_POP
+
+#include <Renderer/Public/Core/Math/Frustum.h>
+#include <Renderer/Public/Core/Thread/JobSystem.h>
+#include <Renderer/Public/Core/Time/Stopwatch.h>
+#include <Renderer/Public/Core/File/FileSystemHelper.h>
+#include <Renderer/Public/RenderQueue/RenderQueue.h>
+#include <Renderer/Public/Resource/AssetIdIndex.h>
+#include <Renderer/Public/Resource/Scene/Culling/SceneItemSet.h>
+#include <Renderer/Public/Resource/Scene/Culling/SceneCullingManager.h>
+#include <Renderer/Public/Resource/ShaderBlueprint/Cache/ShaderBuilder.h>
+
+#include <Rhi/Public/DefaultLog.h>
+#include <Rhi/Public/DefaultAssert.h>
+#include <Rhi/Public/DefaultAllocator.h>
+
+#include <thread>
+#include <future>
+#include <vector>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <iterator>
+#include <algorithm>
+#include <unordered_map>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace BenchmarkDetail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr uint32_t MINIMUM_NUMBER_OF_JOB_THREADS		= 4;
+		static constexpr uint32_t NUMBER_OF_PARALLEL_FOR_ITEMS		= 100000;
+		static constexpr uint32_t NUMBER_OF_PARALLEL_FOR_REPETITIONS = 100;
+		static constexpr uint32_t NUMBER_OF_NESTED_JOBS				= 64;	// Number of jobs per nesting level, each job of the first level creates this number of child jobs while running
+		static constexpr uint32_t NUMBER_OF_DISPATCHED_TASKS		= 10000;
+		static constexpr uint32_t NUMBER_OF_CULLING_REPETITIONS		= 10;
+		static constexpr float	  SCENE_HALF_SIZE					= 1000.0f;	// Synthetic scene items are spread inside a world space cube of this half size around the camera
+		static constexpr uint32_t NUMBER_OF_STEREO_SCENE_ITEMS		= 100000;
+		static constexpr float	  STEREO_SCENE_HALF_SIZE			= 100.0f;
+		static constexpr float	  HMD_INTERPUPILLARY_DISTANCE		= 0.064f;	// In meter
+		static constexpr float	  HMD_NEAR_Z						= 0.1f;
+		static constexpr float	  HMD_FAR_Z							= 100.0f;
+		static constexpr float	  HMD_LATE_HEAD_ROTATION			= 4.5f;		// In degrees, has to stay below the culling widen angle
+		static constexpr uint32_t NUMBER_OF_SORT_REPETITIONS		= 3;
+		static constexpr uint32_t TEMPORAL_SORT_CHANGED_PERCENTAGE	= 1;		// Percentage of renderables getting a new depth between two frames
+		static constexpr uint32_t NUMBER_OF_ASSETS					= 50000;
+		static constexpr uint32_t NUMBER_OF_LINEAR_SCAN_LOOKUPS		= 1000;		// The linear scan is too slow to look up all assets
+		static constexpr uint32_t NUMBER_OF_RECORDED_COMMANDS		= 100000;
+		static constexpr uint32_t LARGE_COMMAND_INTERVAL			= 10000;	// Every n-th recorded command has more auxiliary bytes than a command packet chunk can hold
+		static constexpr uint32_t LARGE_NUMBER_OF_AUXILIARY_BYTES	= 100 * 1024;
+		static constexpr uint32_t NUMBER_OF_RECORDING_REPETITIONS	= 10;
+		static constexpr uint32_t NUMBER_OF_SHADER_PROPERTY_SETS	= 1000;		// Number of random shader permutations per shader source code
+		static constexpr int32_t  MAXIMUM_SHADER_PROPERTY_VALUE		= 8;		// Maximum random value of shader properties used by "@value" or "@foreach", the other ones are boolean
+		static constexpr const char* SHADER_BLUEPRINT_DIRECTORY		= "../../Example/DataSource/Example/Content/Blueprint";	// Binaries are inside e.g. "unrimp/Binary/Windows_x64_Shared", same as the renderer toolkit project
+
+
+		//[-------------------------------------------------------]
+		//[ Structures                                            ]
+		//[-------------------------------------------------------]
+		struct ShaderSourceCode final
+		{
+			std::string filename;		// Relative to the shader blueprint directory, for logging
+			std::string sourceCode;
+		};
+
+		struct ReferencedShaderProperty final
+		{
+			std::string name;
+			int32_t		maximumValue;	// Random values are between zero and this value, both inclusive
+		};
+
+
+		//[-------------------------------------------------------]
+		//[ Classes                                               ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Allocator forwarding to another allocator while counting the allocations
+		*/
+		class CountingAllocator final : public Rhi::IAllocator
+		{
+		public:
+			inline explicit CountingAllocator(Rhi::IAllocator& allocator) :
+				IAllocator(&CountingAllocator::countingReallocate),
+				mAllocator(allocator),
+				mNumberOfAllocations(0)
+			{}
+
+			inline virtual ~CountingAllocator() override
+			{}
+
+			[[nodiscard]] inline uint32_t getNumberOfAllocations() const
+			{
+				return mNumberOfAllocations;
+			}
+
+		private:
+			explicit CountingAllocator(const CountingAllocator&) = delete;
+			CountingAllocator& operator=(const CountingAllocator&) = delete;
+
+			[[nodiscard]] static void* countingReallocate(Rhi::IAllocator& allocator, void* oldPointer, size_t oldNumberOfBytes, size_t newNumberOfBytes, size_t alignment)
+			{
+				CountingAllocator& countingAllocator = static_cast<CountingAllocator&>(allocator);
+				if (0 != newNumberOfBytes)
+				{
+					++countingAllocator.mNumberOfAllocations;
+				}
+				return countingAllocator.mAllocator.reallocate(oldPointer, oldNumberOfBytes, newNumberOfBytes, alignment);
+			}
+
+		private:
+			Rhi::IAllocator& mAllocator;
+			uint32_t		 mNumberOfAllocations;	///< Number of allocations and reallocations
+		};
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] float getMicrosecondsPerTask(const Renderer::Stopwatch& stopwatch, uint32_t numberOfTasks)
+		{
+			return static_cast<float>(stopwatch.getMicroseconds()) / static_cast<float>(numberOfTasks);
+		}
+
+		void fillSyntheticSceneItemSet(Renderer::SceneItemSet& sceneItemSet, uint32_t numberOfSceneItems)
+		{
+			// Uniformly scaled unit boxes at random positions, the default object space bounding box is the unit box
+			std::mt19937 randomGenerator(numberOfSceneItems);
+			std::uniform_real_distribution<float> positionDistribution(-SCENE_HALF_SIZE, SCENE_HALF_SIZE);
+			std::uniform_real_distribution<float> scaleDistribution(0.5f, 10.0f);
+			sceneItemSet.resize(numberOfSceneItems);
+			for (uint32_t i = 0; i < numberOfSceneItems; ++i)
+			{
+				const glm::vec3 position(positionDistribution(randomGenerator), positionDistribution(randomGenerator), positionDistribution(randomGenerator));
+				const float scale = scaleDistribution(randomGenerator);
+				sceneItemSet.worldXX[i] = sceneItemSet.worldYY[i] = sceneItemSet.worldZZ[i] = scale;
+				sceneItemSet.worldXW[i] = position.x;
+				sceneItemSet.worldYW[i] = position.y;
+				sceneItemSet.worldZW[i] = position.z;
+				sceneItemSet.spherePositionX[i] = position.x;
+				sceneItemSet.spherePositionY[i] = position.y;
+				sceneItemSet.spherePositionZ[i] = position.z;
+				sceneItemSet.negativeRadius[i] = -scale * 0.8660254f;	// Half unit box diagonal = sqrt(3) / 2
+			}
+		}
+
+		[[nodiscard]] bool isSphereIntersectingFrustum(const Renderer::Frustum& frustum, const glm::vec3& position, float radius)
+		{
+			for (const Renderer::Plane& plane : frustum.planes)
+			{
+				// Tolerance for the SIMD implementation using a different order of floating point operations
+				if ((glm::dot(plane.normal, position) + plane.d) / glm::length(plane.normal) < -radius - 0.01f)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		[[nodiscard]] uint64_t getSyntheticOpaqueSortingKey(std::mt19937& randomGenerator)
+		{
+			// Same layout as the opaque render queue sorting key: 16 bit pipeline state, 16 bit vertex array, 11 bit resource group and 21 bit depth
+			// -> Only a few pipeline states and vertex arrays are used, like in a real scene
+			return (static_cast<uint64_t>(randomGenerator() % 128) << 48) | (static_cast<uint64_t>(randomGenerator() % 1024) << 32) | (static_cast<uint64_t>(randomGenerator() % 2048) << 21) | (randomGenerator() & 0x1FFFFF);
+		}
+
+		[[nodiscard]] bool isSortedLikeStableSort(const std::vector<uint64_t>& sortingKeys, const std::vector<uint32_t>& sortedIndices, const std::vector<std::pair<uint64_t, uint32_t>>& referenceSortingKeys)
+		{
+			// The reference is sorted by key and index, so equal keys have to keep their original index order
+			for (size_t i = 0; i < referenceSortingKeys.size(); ++i)
+			{
+				if (sortingKeys[i] != referenceSortingKeys[i].first || sortedIndices[i] != referenceSortingKeys[i].second)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		[[nodiscard]] Renderer::AssetId getSyntheticAssetId(const char* assetDirectory, uint32_t index)
+		{
+			// Same string ID scheme as real asset IDs: "<project name>/<asset directory>/<asset name>"
+			char assetIdAsString[64];
+			snprintf(assetIdAsString, sizeof(assetIdAsString), "Benchmark/%s/Asset%u", assetDirectory, index);
+			return Renderer::AssetId(Renderer::StringId::calculateFNV(assetIdAsString));
+		}
+
+		[[nodiscard]] uint32_t getRecordedNumberOfAuxiliaryBytes(uint32_t commandIndex)
+		{
+			// Auxiliary byte counts which aren't a multiple of the command packet alignment, now and then one which needs a dedicated chunk
+			return (0 == commandIndex % LARGE_COMMAND_INTERVAL) ? LARGE_NUMBER_OF_AUXILIARY_BYTES : commandIndex % 61;
+		}
+
+		void recordCommands(Rhi::CommandBuffer& commandBuffer)
+		{
+			for (uint32_t i = 0; i < NUMBER_OF_RECORDED_COMMANDS; ++i)
+			{
+				const uint32_t numberOfAuxiliaryBytes = getRecordedNumberOfAuxiliaryBytes(i);
+				Rhi::Command::CopyUniformBufferData* copyUniformBufferData = commandBuffer.addCommand<Rhi::Command::CopyUniformBufferData>(numberOfAuxiliaryBytes);
+				copyUniformBufferData->uniformBuffer = nullptr;
+				copyUniformBufferData->numberOfBytes = numberOfAuxiliaryBytes;
+				uint8_t* auxiliaryMemory = Rhi::CommandPacketHelper::getAuxiliaryMemory(copyUniformBufferData);
+				for (uint32_t byteIndex = 0; byteIndex < numberOfAuxiliaryBytes; ++byteIndex)
+				{
+					auxiliaryMemory[byteIndex] = static_cast<uint8_t>(i * 7 + byteIndex);
+				}
+			}
+		}
+
+		[[nodiscard]] bool isCommandPacketChainIntact(const Rhi::CommandBuffer& commandBuffer, uint32_t numberOfRecordings)
+		{
+			// Each command packet must be aligned, in recording order and have untouched auxiliary memory
+			uint32_t numberOfCommandPackets = 0;
+			for (Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket(); nullptr != constCommandPacket; constCommandPacket = Rhi::CommandPacketHelper::getNextCommandPacket(constCommandPacket))
+			{
+				const uint32_t i = numberOfCommandPackets % NUMBER_OF_RECORDED_COMMANDS;
+				const Rhi::Command::CopyUniformBufferData* copyUniformBufferData = static_cast<const Rhi::Command::CopyUniformBufferData*>(Rhi::CommandPacketHelper::loadCommand(constCommandPacket));
+				if (0 != reinterpret_cast<uintptr_t>(constCommandPacket) % Rhi::CommandPacketHelper::COMMAND_PACKET_ALIGNMENT || numberOfCommandPackets >= NUMBER_OF_RECORDED_COMMANDS * numberOfRecordings ||
+					Rhi::CommandPacketHelper::loadCommandDispatchFunctionIndex(constCommandPacket) != Rhi::Command::CopyUniformBufferData::COMMAND_DISPATCH_FUNCTION_INDEX ||
+					copyUniformBufferData->numberOfBytes != getRecordedNumberOfAuxiliaryBytes(i))
+				{
+					return false;
+				}
+				const uint8_t* auxiliaryMemory = Rhi::CommandPacketHelper::getAuxiliaryMemory(copyUniformBufferData);
+				for (uint32_t byteIndex = 0; byteIndex < copyUniformBufferData->numberOfBytes; ++byteIndex)
+				{
+					if (auxiliaryMemory[byteIndex] != static_cast<uint8_t>(i * 7 + byteIndex))
+					{
+						return false;
+					}
+				}
+				++numberOfCommandPackets;
+			}
+			return (numberOfCommandPackets == NUMBER_OF_RECORDED_COMMANDS * numberOfRecordings);
+		}
+
+		[[nodiscard]] bool isPointClearlyInsideFrustum(const glm::mat4& worldSpaceToClipSpaceMatrix, const glm::vec3& position)
+		{
+			// Margin so points on the frustum border don't depend on floating point rounding, the far plane margin is tiny since clip space depth is nonlinear
+			const glm::vec4 clipSpacePosition = worldSpaceToClipSpaceMatrix * glm::vec4(position, 1.0f);
+			const float w = clipSpacePosition.w * 0.99f;
+			return (clipSpacePosition.x > -w && clipSpacePosition.x < w && clipSpacePosition.y > -w && clipSpacePosition.y < w && clipSpacePosition.z > clipSpacePosition.w * 0.01f && clipSpacePosition.z < clipSpacePosition.w * 0.9999f);
+		}
+
+		void loadShaderSourceCodes(std::vector<ShaderSourceCode>& shaderSourceCodes)
+		{
+			std::error_code errorCode;
+			if (!std_filesystem::is_directory(SHADER_BLUEPRINT_DIRECTORY, errorCode))
+			{
+				return;
+			}
+			const size_t numberOfSkippedBytes = std_filesystem::path(SHADER_BLUEPRINT_DIRECTORY).generic_string().length() + 1;	// +1 for '/'-slash at the end of the directory name
+			for (const std_filesystem::directory_entry& iterator : std_filesystem::recursive_directory_iterator(SHADER_BLUEPRINT_DIRECTORY))
+			{
+				const std_filesystem::path& path = iterator.path();
+				if (std_filesystem::is_regular_file(iterator) && (path.extension() == ".shader_blueprint" || path.extension() == ".shader_piece"))
+				{
+					std::ifstream inputFileStream(path.generic_string(), std::ios::binary);
+					ShaderSourceCode shaderSourceCode;
+					shaderSourceCode.filename = path.generic_string().erase(0, numberOfSkippedBytes);
+					shaderSourceCode.sourceCode.assign(std::istreambuf_iterator<char>(inputFileStream), std::istreambuf_iterator<char>());
+
+					// Blank "@includepiece(<asset ID>)" like the shader blueprint asset compiler does, so the shader builder sees what it sees at runtime
+					size_t includePiecePosition = shaderSourceCode.sourceCode.find("@includepiece");
+					while (std::string::npos != includePiecePosition)
+					{
+						const size_t closingPosition = shaderSourceCode.sourceCode.find(')', includePiecePosition);
+						if (std::string::npos == closingPosition)
+						{
+							break;
+						}
+						std::fill(shaderSourceCode.sourceCode.begin() + static_cast<std::ptrdiff_t>(includePiecePosition), shaderSourceCode.sourceCode.begin() + static_cast<std::ptrdiff_t>(closingPosition + 1), ' ');
+						includePiecePosition = shaderSourceCode.sourceCode.find("@includepiece", closingPosition);
+					}
+					shaderSourceCodes.push_back(std::move(shaderSourceCode));
+				}
+			}
+
+			// The directory iteration order is unspecified, sort for reproducible random shader property sets and logs
+			std::sort(shaderSourceCodes.begin(), shaderSourceCodes.end(), [](const ShaderSourceCode& left, const ShaderSourceCode& right) { return (left.filename < right.filename); });
+		}
+
+		void gatherReferencedShaderProperties(const std::string& sourceCode, std::vector<ReferencedShaderProperty>& referencedShaderProperties)
+		{
+			// Gather the identifiers of "@property(<expression>)", "@value(<name>)" and the first "@foreach(<count>, ...)" argument
+			static constexpr std::pair<const char*, int32_t> KEYWORDS[] = { { "@property(", 1 }, { "@value(", MAXIMUM_SHADER_PROPERTY_VALUE }, { "@foreach(", MAXIMUM_SHADER_PROPERTY_VALUE } };
+			for (const std::pair<const char*, int32_t>& keyword : KEYWORDS)
+			{
+				const size_t keywordLength = strlen(keyword.first);
+				size_t position = sourceCode.find(keyword.first);
+				while (std::string::npos != position)
+				{
+					// Expressions might contain parentheses, "@foreach" arguments end at the first comma
+					size_t endPosition = position + keywordLength;
+					for (uint32_t depth = 1; endPosition < sourceCode.length() && (depth > 1 || (')' != sourceCode[endPosition] && ',' != sourceCode[endPosition])); ++endPosition)
+					{
+						if ('(' == sourceCode[endPosition])
+						{
+							++depth;
+						}
+						else if (')' == sourceCode[endPosition])
+						{
+							--depth;
+						}
+					}
+
+					// Identifiers starting with a digit are numbers
+					for (size_t i = position + keywordLength; i < endPosition; ++i)
+					{
+						if (isalpha(static_cast<unsigned char>(sourceCode[i])) || '_' == sourceCode[i])
+						{
+							const size_t identifierStart = i;
+							while (i < endPosition && (isalnum(static_cast<unsigned char>(sourceCode[i])) || '_' == sourceCode[i]))
+							{
+								++i;
+							}
+							const std::string name = sourceCode.substr(identifierStart, i - identifierStart);
+							std::vector<ReferencedShaderProperty>::iterator iterator = std::find_if(referencedShaderProperties.begin(), referencedShaderProperties.end(), [&name](const ReferencedShaderProperty& referencedShaderProperty) { return (referencedShaderProperty.name == name); });
+							if (referencedShaderProperties.end() == iterator)
+							{
+								referencedShaderProperties.push_back({ name, keyword.second });
+							}
+							else
+							{
+								iterator->maximumValue = std::max(iterator->maximumValue, keyword.second);
+							}
+						}
+						else if (isdigit(static_cast<unsigned char>(sourceCode[i])))
+						{
+							while (i + 1 < endPosition && isalnum(static_cast<unsigned char>(sourceCode[i + 1])))
+							{
+								++i;
+							}
+						}
+					}
+
+					// Next
+					position = sourceCode.find(keyword.first, endPosition);
+				}
+			}
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // BenchmarkDetail
+}
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+int Benchmark::run()
+{
+	// The RHI context is only used for logging, each check reports its results into the log
+	Rhi::DefaultLog defaultLog;
+	Rhi::DefaultAssert defaultAssert;
+	Rhi::DefaultAllocator defaultAllocator;
+	const Rhi::Context rhiContext(defaultLog, defaultAssert, defaultAllocator);
+
+	// At least a few worker threads so there's something to steal even on machines with less hardware threads
+	Renderer::JobSystem jobSystem(std::max(std::thread::hardware_concurrency(), BenchmarkDetail::MINIMUM_NUMBER_OF_JOB_THREADS) - 1);
+
+	// Run all checks, a failed check doesn't stop the following checks
+	bool passed = true;
+	passed = checkJobSystem(rhiContext, jobSystem) && passed;
+	passed = checkSceneCulling(rhiContext, jobSystem) && passed;
+	passed = checkStereoCulling(rhiContext, jobSystem) && passed;
+	passed = checkRenderQueueSorting(rhiContext) && passed;
+	passed = checkAssetIdIndex(rhiContext) && passed;
+	passed = checkCommandBuffer(rhiContext) && passed;
+	passed = checkShaderTemplate(rhiContext) && passed;
+
+	// Done
+	if (passed)
+	{
+		RHI_LOG(rhiContext, INFORMATION, "Benchmark: All checks have been passed")
+	}
+	return passed ? 0 : 1;
+}
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+bool Benchmark::checkJobSystem(const Rhi::Context& context, Renderer::JobSystem& jobSystem) const
+{
+	bool passed = true;
+
+	{ // Work-stealing: Each item must be processed exactly once, no matter which thread processed or stole the range it's part of
+		std::vector<uint32_t> numberOfProcessings(BenchmarkDetail::NUMBER_OF_PARALLEL_FOR_ITEMS, 0);
+		for (uint32_t repetition = 0; repetition < BenchmarkDetail::NUMBER_OF_PARALLEL_FOR_REPETITIONS; ++repetition)
+		{
+			jobSystem.parallelFor(BenchmarkDetail::NUMBER_OF_PARALLEL_FOR_ITEMS, 1, [&numberOfProcessings](uint32_t startIndex, uint32_t endIndex)
+			{
+				for (uint32_t i = startIndex; i < endIndex; ++i)
+				{
+					++numberOfProcessings[i];
+				}
+			});
+		}
+		for (uint32_t i = 0; i < BenchmarkDetail::NUMBER_OF_PARALLEL_FOR_ITEMS; ++i)
+		{
+			if (numberOfProcessings[i] != BenchmarkDetail::NUMBER_OF_PARALLEL_FOR_REPETITIONS)
+			{
+				RHI_LOG(context, CRITICAL, "Job system: Parallel for item %u has been processed %u times instead of %u times", i, numberOfProcessings[i], BenchmarkDetail::NUMBER_OF_PARALLEL_FOR_REPETITIONS)
+				passed = false;
+				break;
+			}
+		}
+	}
+
+	{ // Parent/child: Child jobs created by running jobs, the root job must not be finished before all of them are finished
+		std::atomic<uint32_t> numberOfExecutedJobs(0);
+		Renderer::Job& rootJob = jobSystem.createEmptyJob();
+		for (uint32_t i = 0; i < BenchmarkDetail::NUMBER_OF_NESTED_JOBS; ++i)
+		{
+			Renderer::JobSystem* jobSystemPointer = &jobSystem;
+			std::atomic<uint32_t>* numberOfExecutedJobsPointer = &numberOfExecutedJobs;
+			jobSystem.run(jobSystem.createJob([jobSystemPointer, numberOfExecutedJobsPointer](Renderer::Job& job)
+			{
+				for (uint32_t j = 0; j < BenchmarkDetail::NUMBER_OF_NESTED_JOBS; ++j)
+				{
+					jobSystemPointer->run(jobSystemPointer->createJob([numberOfExecutedJobsPointer]() { numberOfExecutedJobsPointer->fetch_add(1); }, &job));
+				}
+				numberOfExecutedJobsPointer->fetch_add(1);
+			}, &rootJob));
+		}
+		jobSystem.runAndWait(rootJob);
+		const uint32_t expectedNumberOfExecutedJobs = BenchmarkDetail::NUMBER_OF_NESTED_JOBS * (BenchmarkDetail::NUMBER_OF_NESTED_JOBS + 1);
+		if (numberOfExecutedJobs.load() != expectedNumberOfExecutedJobs)
+		{
+			RHI_LOG(context, CRITICAL, "Job system: The root job has been finished after %u instead of %u executed child jobs", numberOfExecutedJobs.load(), expectedNumberOfExecutedJobs)
+			passed = false;
+		}
+	}
+
+	{ // Continuations: A continuation job must see the result of its ancestor job
+		uint32_t ancestorResult = 0;
+		uint32_t continuationResult = 0;
+		uint32_t* ancestorResultPointer = &ancestorResult;
+		uint32_t* continuationResultPointer = &continuationResult;
+		Renderer::Job& rootJob = jobSystem.createEmptyJob();
+		Renderer::Job& ancestorJob = jobSystem.createJob([ancestorResultPointer]() { *ancestorResultPointer = 42; }, &rootJob);
+		Renderer::Job& continuationJob = jobSystem.createJob([ancestorResultPointer, continuationResultPointer]() { *continuationResultPointer = *ancestorResultPointer + 1; }, &rootJob);
+		jobSystem.addContinuation(ancestorJob, continuationJob);
+		jobSystem.run(ancestorJob);
+		jobSystem.runAndWait(rootJob);
+		if (43 != continuationResult)
+		{
+			RHI_LOG(context, CRITICAL, "Job system: The continuation job has been run before its ancestor job was finished")
+			passed = false;
+		}
+	}
+
+	{ // Job handle: Waiting for a finished job must return even if the job has been recycled and the recycled job isn't finished, yet
+		const Renderer::JobHandle jobHandle = jobSystem.run(jobSystem.createEmptyJob());
+		jobSystem.wait(jobHandle);
+		Renderer::Job& holdJob = jobSystem.createEmptyJob();
+		std::vector<Renderer::Job*> jobs;
+		const uint32_t maximumNumberOfJobs = Renderer::JobSystem::NUMBER_OF_JOBS_PER_THREAD * jobSystem.getNumberOfThreads() * 2;
+		bool recycled = (&holdJob == jobHandle.job);
+		while (!recycled && jobs.size() < maximumNumberOfJobs)
+		{
+			jobs.push_back(&jobSystem.createEmptyJob(&holdJob));
+			recycled = (jobs.back() == jobHandle.job);
+		}
+		if (recycled)
+		{
+			// The job is recycled and in-flight, the wait must return at once instead of waiting for the hold job
+			jobSystem.wait(jobHandle);
+		}
+		else
+		{
+			RHI_LOG(context, CRITICAL, "Job system: A finished job hasn't been recycled")
+			passed = false;
+		}
+		for (Renderer::Job* job : jobs)
+		{
+			jobSystem.run(*job);
+		}
+		jobSystem.runAndWait(holdJob);
+	}
+
+	{ // Job ring buffer: More in-flight jobs than the initial job ring buffer size must neither deadlock nor hand out in-flight jobs twice
+		const uint32_t numberOfJobs = Renderer::JobSystem::NUMBER_OF_JOBS_PER_THREAD * jobSystem.getNumberOfThreads() * 4;
+		std::atomic<uint32_t> numberOfExecutedJobs(0);
+		std::atomic<uint32_t>* numberOfExecutedJobsPointer = &numberOfExecutedJobs;
+		std::vector<Renderer::Job*> jobs;
+		jobs.reserve(numberOfJobs);
+		Renderer::Job& rootJob = jobSystem.createEmptyJob();
+		for (uint32_t i = 0; i < numberOfJobs; ++i)
+		{
+			jobs.push_back(&jobSystem.createJob([numberOfExecutedJobsPointer]() { numberOfExecutedJobsPointer->fetch_add(1); }, &rootJob));
+		}
+		std::vector<Renderer::Job*> sortedJobs = jobs;
+		sortedJobs.push_back(&rootJob);
+		std::sort(sortedJobs.begin(), sortedJobs.end());
+		if (std::adjacent_find(sortedJobs.begin(), sortedJobs.end()) != sortedJobs.end())
+		{
+			RHI_LOG(context, CRITICAL, "Job system: An in-flight job has been handed out twice")
+			passed = false;
+		}
+		for (Renderer::Job* job : jobs)
+		{
+			jobSystem.run(*job);
+		}
+		jobSystem.runAndWait(rootJob);
+		if (numberOfExecutedJobs.load() != numberOfJobs)
+		{
+			RHI_LOG(context, CRITICAL, "Job system: %u instead of %u in-flight jobs have been executed", numberOfExecutedJobs.load(), numberOfJobs)
+			passed = false;
+		}
+	}
+
+	{ // Dispatch latency: Many tiny tasks, compared with one "std::async()" per task as it was done before there was a job system
+		std::atomic<uint32_t> numberOfExecutedTasks(0);
+		std::atomic<uint32_t>* numberOfExecutedTasksPointer = &numberOfExecutedTasks;
+		const Renderer::Stopwatch jobSystemStopwatch(true);
+		Renderer::Job& rootJob = jobSystem.createEmptyJob();
+		for (uint32_t i = 0; i < BenchmarkDetail::NUMBER_OF_DISPATCHED_TASKS; ++i)
+		{
+			jobSystem.run(jobSystem.createJob([numberOfExecutedTasksPointer]() { numberOfExecutedTasksPointer->fetch_add(1); }, &rootJob));
+		}
+		jobSystem.runAndWait(rootJob);
+		const float jobSystemMicrosecondsPerTask = BenchmarkDetail::getMicrosecondsPerTask(jobSystemStopwatch, BenchmarkDetail::NUMBER_OF_DISPATCHED_TASKS);
+
+		const Renderer::Stopwatch asyncStopwatch(true);
+		std::vector<std::future<void>> futures;
+		futures.reserve(BenchmarkDetail::NUMBER_OF_DISPATCHED_TASKS);
+		for (uint32_t i = 0; i < BenchmarkDetail::NUMBER_OF_DISPATCHED_TASKS; ++i)
+		{
+			futures.push_back(std::async(std::launch::async, [numberOfExecutedTasksPointer]() { numberOfExecutedTasksPointer->fetch_add(1); }));
+		}
+		for (std::future<void>& future : futures)
+		{
+			future.get();
+		}
+		const float asyncMicrosecondsPerTask = BenchmarkDetail::getMicrosecondsPerTask(asyncStopwatch, BenchmarkDetail::NUMBER_OF_DISPATCHED_TASKS);
+
+		if (numberOfExecutedTasks.load() != BenchmarkDetail::NUMBER_OF_DISPATCHED_TASKS * 2)
+		{
+			RHI_LOG(context, CRITICAL, "Job system: %u instead of %u dispatched tasks have been executed", numberOfExecutedTasks.load(), BenchmarkDetail::NUMBER_OF_DISPATCHED_TASKS * 2)
+			passed = false;
+		}
+		RHI_LOG(context, INFORMATION, "Job system: %u threads, dispatch latency %.3f us per job, std::async %.3f us per task", jobSystem.getNumberOfThreads(), jobSystemMicrosecondsPerTask, asyncMicrosecondsPerTask)
+	}
+
+	// Done
+	return passed;
+}
+
+bool Benchmark::checkSceneCulling(const Rhi::Context& context, Renderer::JobSystem& jobSystem) const
+{
+	// Camera at the world space origin looking along the positive z-axis, so camera relative world space is view space
+	const glm::mat4 viewSpaceToClipSpaceMatrix = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, BenchmarkDetail::SCENE_HALF_SIZE);
+	const Renderer::Frustum frustum(viewSpaceToClipSpaceMatrix);
+	const glm::vec3 worldSpaceCameraPosition(0.0f);
+	bool passed = true;
+
+	for (uint32_t numberOfSceneItems = 1000; numberOfSceneItems <= 1000000; numberOfSceneItems *= 10)
+	{
+		Renderer::SceneCullingManager sceneCullingManager;
+		Renderer::SceneItemSet& sceneItemSet = sceneCullingManager.getCullableSceneItemSet();
+		BenchmarkDetail::fillSyntheticSceneItemSet(sceneItemSet, numberOfSceneItems);
+
+		// Brute force culling
+		uint32_t numberOfVisibleSceneItems = sceneCullingManager.cullSceneItems(jobSystem, frustum, worldSpaceCameraPosition, &viewSpaceToClipSpaceMatrix);
+		std::vector<uint32_t> visibleSceneItemIndices(sceneCullingManager.getVisibleSceneItemIndices(), sceneCullingManager.getVisibleSceneItemIndices() + numberOfVisibleSceneItems);
+		std::sort(visibleSceneItemIndices.begin(), visibleSceneItemIndices.end());
+		const Renderer::Stopwatch bruteForceStopwatch(true);
+		for (uint32_t repetition = 0; repetition < BenchmarkDetail::NUMBER_OF_CULLING_REPETITIONS; ++repetition)
+		{
+			numberOfVisibleSceneItems = sceneCullingManager.cullSceneItems(jobSystem, frustum, worldSpaceCameraPosition, &viewSpaceToClipSpaceMatrix);
+		}
+		const float bruteForceMilliseconds = bruteForceStopwatch.getMilliseconds() / BenchmarkDetail::NUMBER_OF_CULLING_REPETITIONS;
+
+		{ // No false negatives: Scene items whose center is inside the frustum must be visible, and no scene item whose bounding sphere is outside of the frustum may be visible
+			std::vector<bool> visible(numberOfSceneItems, false);
+			for (uint32_t sceneItemIndex : visibleSceneItemIndices)
+			{
+				visible[sceneItemIndex] = true;
+			}
+			for (uint32_t i = 0; i < numberOfSceneItems; ++i)
+			{
+				const glm::vec3 position(sceneItemSet.spherePositionX[i], sceneItemSet.spherePositionY[i], sceneItemSet.spherePositionZ[i]);
+				if (visible[i] ? !BenchmarkDetail::isSphereIntersectingFrustum(frustum, position, -sceneItemSet.negativeRadius[i]) : BenchmarkDetail::isPointClearlyInsideFrustum(viewSpaceToClipSpaceMatrix, position))
+				{
+					RHI_LOG(context, CRITICAL, "Scene culling: Scene item %u of %u scene items has wrongly been culled as %s", i, numberOfSceneItems, visible[i] ? "visible" : "invisible")
+					passed = false;
+					break;
+				}
+			}
+		}
+
+		// Loose octree culling, the first culling fills the loose octree
+		const Renderer::Stopwatch octreeBuildStopwatch(true);
+		sceneCullingManager.setSceneItemOctreeEnabled(true, BenchmarkDetail::SCENE_HALF_SIZE);
+		numberOfVisibleSceneItems = sceneCullingManager.cullSceneItems(jobSystem, frustum, worldSpaceCameraPosition, &viewSpaceToClipSpaceMatrix);
+		const float octreeBuildMilliseconds = octreeBuildStopwatch.getMilliseconds();
+		std::vector<uint32_t> octreeVisibleSceneItemIndices(sceneCullingManager.getVisibleSceneItemIndices(), sceneCullingManager.getVisibleSceneItemIndices() + numberOfVisibleSceneItems);
+		std::sort(octreeVisibleSceneItemIndices.begin(), octreeVisibleSceneItemIndices.end());
+		const Renderer::Stopwatch octreeStopwatch(true);
+		for (uint32_t repetition = 0; repetition < BenchmarkDetail::NUMBER_OF_CULLING_REPETITIONS; ++repetition)
+		{
+			numberOfVisibleSceneItems = sceneCullingManager.cullSceneItems(jobSystem, frustum, worldSpaceCameraPosition, &viewSpaceToClipSpaceMatrix);
+		}
+		const float octreeMilliseconds = octreeStopwatch.getMilliseconds() / BenchmarkDetail::NUMBER_OF_CULLING_REPETITIONS;
+		if (octreeVisibleSceneItemIndices != visibleSceneItemIndices)
+		{
+			RHI_LOG(context, CRITICAL, "Scene culling: The loose octree culling result of %u scene items differs from the brute force culling result (%u instead of %u visible scene items)", numberOfSceneItems, static_cast<uint32_t>(octreeVisibleSceneItemIndices.size()), static_cast<uint32_t>(visibleSceneItemIndices.size()))
+			passed = false;
+		}
+
+		RHI_LOG(context, INFORMATION, "Scene culling: %u scene items, %u visible, brute force %.3f ms, loose octree %.3f ms (%.3f ms including the loose octree filling)", numberOfSceneItems, static_cast<uint32_t>(visibleSceneItemIndices.size()), bruteForceMilliseconds, octreeMilliseconds, octreeBuildMilliseconds)
+	}
+
+	// Done
+	return passed;
+}
+
+bool Benchmark::checkStereoCulling(const Rhi::Context& context, Renderer::JobSystem& jobSystem) const
+{
+	// Synthetic HMD with asymmetric eye projections like the ones reported by OpenVR, the outer eye field of view is the larger one
+	// -> The head is rotated and positioned at the camera relative world space origin, the camera relative world space is the culling space
+	const glm::mat4 headSpaceToCameraRelativeWorldSpaceMatrix = glm::rotate(glm::rotate(glm::mat4(1.0f), glm::radians(30.0f), glm::vec3(0.0f, 1.0f, 0.0f)), glm::radians(-10.0f), glm::vec3(1.0f, 0.0f, 0.0f));
+	const glm::mat4 eyeSpaceToCameraRelativeWorldSpaceMatrices[2] =
+	{
+		glm::translate(headSpaceToCameraRelativeWorldSpaceMatrix, glm::vec3(-BenchmarkDetail::HMD_INTERPUPILLARY_DISTANCE * 0.5f, 0.0f, 0.0f)),
+		glm::translate(headSpaceToCameraRelativeWorldSpaceMatrix, glm::vec3(BenchmarkDetail::HMD_INTERPUPILLARY_DISTANCE * 0.5f, 0.0f, 0.0f))
+	};
+	const glm::mat4 viewSpaceToClipSpaceMatrices[2] =
+	{
+		glm::frustum(-1.39f * BenchmarkDetail::HMD_NEAR_Z, 1.25f * BenchmarkDetail::HMD_NEAR_Z, -1.47f * BenchmarkDetail::HMD_NEAR_Z, 1.47f * BenchmarkDetail::HMD_NEAR_Z, BenchmarkDetail::HMD_NEAR_Z, BenchmarkDetail::HMD_FAR_Z),
+		glm::frustum(-1.25f * BenchmarkDetail::HMD_NEAR_Z, 1.39f * BenchmarkDetail::HMD_NEAR_Z, -1.47f * BenchmarkDetail::HMD_NEAR_Z, 1.47f * BenchmarkDetail::HMD_NEAR_Z, BenchmarkDetail::HMD_NEAR_Z, BenchmarkDetail::HMD_FAR_Z)
+	};
+	const Renderer::Frustum frustum = Renderer::SceneCullingManager::getConservativeStereoFrustum(eyeSpaceToCameraRelativeWorldSpaceMatrices, viewSpaceToClipSpaceMatrices);
+
+	// Eye space to clip space matrices of each eye for the head pose at culling time as well as for late head poses rotated around the eye position
+	static constexpr float LATE_HEAD_ROTATIONS[][2] =
+	{
+		{ 0.0f, 0.0f },
+		{ BenchmarkDetail::HMD_LATE_HEAD_ROTATION, 0.0f }, { -BenchmarkDetail::HMD_LATE_HEAD_ROTATION, 0.0f },
+		{ 0.0f, BenchmarkDetail::HMD_LATE_HEAD_ROTATION }, { 0.0f, -BenchmarkDetail::HMD_LATE_HEAD_ROTATION },
+		{ BenchmarkDetail::HMD_LATE_HEAD_ROTATION * 0.7f, BenchmarkDetail::HMD_LATE_HEAD_ROTATION * 0.7f }, { -BenchmarkDetail::HMD_LATE_HEAD_ROTATION * 0.7f, -BenchmarkDetail::HMD_LATE_HEAD_ROTATION * 0.7f },
+		{ BenchmarkDetail::HMD_LATE_HEAD_ROTATION * 0.7f, -BenchmarkDetail::HMD_LATE_HEAD_ROTATION * 0.7f }, { -BenchmarkDetail::HMD_LATE_HEAD_ROTATION * 0.7f, BenchmarkDetail::HMD_LATE_HEAD_ROTATION * 0.7f }
+	};
+	std::vector<glm::mat4> cameraRelativeWorldSpaceToClipSpaceMatrices;
+	for (const float* lateHeadRotation : LATE_HEAD_ROTATIONS)
+	{
+		for (uint32_t eyeIndex = 0; eyeIndex < 2; ++eyeIndex)
+		{
+			const glm::mat4 lateEyeSpaceToCameraRelativeWorldSpaceMatrix = glm::rotate(glm::rotate(eyeSpaceToCameraRelativeWorldSpaceMatrices[eyeIndex], glm::radians(lateHeadRotation[0]), glm::vec3(0.0f, 1.0f, 0.0f)), glm::radians(lateHeadRotation[1]), glm::vec3(1.0f, 0.0f, 0.0f));
+			cameraRelativeWorldSpaceToClipSpaceMatrices.push_back(viewSpaceToClipSpaceMatrices[eyeIndex] * glm::inverse(lateEyeSpaceToCameraRelativeWorldSpaceMatrix));
+		}
+	}
+
+	// Cull small synthetic scene items around the head, single pass stereo rendering only uses the frustum-sphere culling
+	Renderer::SceneCullingManager sceneCullingManager;
+	Renderer::SceneItemSet& sceneItemSet = sceneCullingManager.getCullableSceneItemSet();
+	std::mt19937 randomGenerator(BenchmarkDetail::NUMBER_OF_STEREO_SCENE_ITEMS);
+	std::uniform_real_distribution<float> positionDistribution(-BenchmarkDetail::STEREO_SCENE_HALF_SIZE, BenchmarkDetail::STEREO_SCENE_HALF_SIZE);
+	sceneItemSet.resize(BenchmarkDetail::NUMBER_OF_STEREO_SCENE_ITEMS);
+	for (uint32_t i = 0; i < BenchmarkDetail::NUMBER_OF_STEREO_SCENE_ITEMS; ++i)
+	{
+		sceneItemSet.spherePositionX[i] = positionDistribution(randomGenerator);
+		sceneItemSet.spherePositionY[i] = positionDistribution(randomGenerator);
+		sceneItemSet.spherePositionZ[i] = positionDistribution(randomGenerator);
+		sceneItemSet.negativeRadius[i] = -0.01f;
+	}
+	const uint32_t numberOfVisibleSceneItems = sceneCullingManager.cullSceneItems(jobSystem, frustum, glm::vec3(0.0f), nullptr);
+	std::vector<bool> visible(BenchmarkDetail::NUMBER_OF_STEREO_SCENE_ITEMS, false);
+	for (uint32_t i = 0; i < numberOfVisibleSceneItems; ++i)
+	{
+		visible[sceneCullingManager.getVisibleSceneItemIndices()[i]] = true;
+	}
+
+	// No false negatives: Scene items inside one of the eye frustums must be visible, no matter which late head pose is used
+	bool passed = true;
+	uint32_t numberOfReferenceVisibleSceneItems = 0;
+	for (uint32_t i = 0; i < BenchmarkDetail::NUMBER_OF_STEREO_SCENE_ITEMS && passed; ++i)
+	{
+		const glm::vec3 position(sceneItemSet.spherePositionX[i], sceneItemSet.spherePositionY[i], sceneItemSet.spherePositionZ[i]);
+		for (size_t matrixIndex = 0; matrixIndex < cameraRelativeWorldSpaceToClipSpaceMatrices.size(); ++matrixIndex)
+		{
+			if (BenchmarkDetail::isPointClearlyInsideFrustum(cameraRelativeWorldSpaceToClipSpaceMatrices[matrixIndex], position))
+			{
+				++numberOfReferenceVisibleSceneItems;
+				if (!visible[i])
+				{
+					RHI_LOG(context, CRITICAL, "Stereo culling: Scene item %u at (%f, %f, %f) visible to eye %u with late head rotation (%f, %f) degrees has been culled", i, position.x, position.y, position.z, static_cast<uint32_t>(matrixIndex % 2), LATE_HEAD_ROTATIONS[matrixIndex / 2][0], LATE_HEAD_ROTATIONS[matrixIndex / 2][1])
+					passed = false;
+				}
+				break;
+			}
+		}
+	}
+
+	// The conservative frustum must still cull something, else the check above is meaningless
+	if (passed && (0 == numberOfReferenceVisibleSceneItems || numberOfVisibleSceneItems >= BenchmarkDetail::NUMBER_OF_STEREO_SCENE_ITEMS))
+	{
+		RHI_LOG(context, CRITICAL, "Stereo culling: The conservative frustum doesn't cull anything")
+		passed = false;
+	}
+	RHI_LOG(context, INFORMATION, "Stereo culling: %u scene items, %u visible to the eyes including late head rotations, %u visible using the conservative frustum", BenchmarkDetail::NUMBER_OF_STEREO_SCENE_ITEMS, numberOfReferenceVisibleSceneItems, numberOfVisibleSceneItems)
+
+	// Done
+	return passed;
+}
+
+bool Benchmark::checkRenderQueueSorting(const Rhi::Context& context) const
+{
+	bool passed = true;
+	std::vector<uint64_t> originalSortingKeys;
+	std::vector<std::pair<uint64_t, uint32_t>> referenceSortingKeys;
+	std::vector<uint64_t> sortingKeys;
+	std::vector<uint32_t> sortedIndices;
+	std::vector<uint64_t> scratchSortingKeys;
+	std::vector<uint32_t> scratchSortedIndices;
+
+	// Empty render queues are sorted as well
+	Renderer::RenderQueue::radixSortSortingKeys(sortingKeys, sortedIndices, scratchSortingKeys, scratchSortedIndices);
+
+	for (uint32_t numberOfRenderables = 10000; numberOfRenderables <= 1000000 && passed; numberOfRenderables *= 10)
+	{
+		// Synthetic sorting keys, not unique so the stability matters
+		std::mt19937 randomGenerator(numberOfRenderables);
+		originalSortingKeys.resize(numberOfRenderables);
+		for (uint64_t& sortingKey : originalSortingKeys)
+		{
+			sortingKey = BenchmarkDetail::getSyntheticOpaqueSortingKey(randomGenerator);
+		}
+
+		// Reference: "std::sort()" of key and index pairs, timed since this is what a sort by key moving only keys and indices costs
+		float referenceMilliseconds = 0.0f;
+		for (uint32_t repetition = 0; repetition < BenchmarkDetail::NUMBER_OF_SORT_REPETITIONS; ++repetition)
+		{
+			referenceSortingKeys.resize(numberOfRenderables);
+			for (uint32_t i = 0; i < numberOfRenderables; ++i)
+			{
+				referenceSortingKeys[i] = std::make_pair(originalSortingKeys[i], i);
+			}
+			const Renderer::Stopwatch stopwatch(true);
+			std::sort(referenceSortingKeys.begin(), referenceSortingKeys.end());
+			referenceMilliseconds += stopwatch.getMilliseconds();
+		}
+		referenceMilliseconds /= BenchmarkDetail::NUMBER_OF_SORT_REPETITIONS;
+
+		// Radix sort
+		float radixSortMilliseconds = 0.0f;
+		for (uint32_t repetition = 0; repetition < BenchmarkDetail::NUMBER_OF_SORT_REPETITIONS; ++repetition)
+		{
+			sortingKeys = originalSortingKeys;
+			sortedIndices.resize(numberOfRenderables);
+			for (uint32_t i = 0; i < numberOfRenderables; ++i)
+			{
+				sortedIndices[i] = i;
+			}
+			const Renderer::Stopwatch stopwatch(true);
+			Renderer::RenderQueue::radixSortSortingKeys(sortingKeys, sortedIndices, scratchSortingKeys, scratchSortedIndices);
+			radixSortMilliseconds += stopwatch.getMilliseconds();
+		}
+		radixSortMilliseconds /= BenchmarkDetail::NUMBER_OF_SORT_REPETITIONS;
+		if (!BenchmarkDetail::isSortedLikeStableSort(sortingKeys, sortedIndices, referenceSortingKeys))
+		{
+			RHI_LOG(context, CRITICAL, "Render queue sorting: Radix sort of %u renderables differs from stable sort", numberOfRenderables)
+			passed = false;
+			break;
+		}
+
+		// Next frame: A few renderables got a new depth, the sorted indices of the previous frame are used as starting point like the render queue does
+		const uint32_t numberOfChangedRenderables = numberOfRenderables / 100 * BenchmarkDetail::TEMPORAL_SORT_CHANGED_PERCENTAGE;
+		for (uint32_t i = 0; i < numberOfChangedRenderables; ++i)
+		{
+			uint64_t& sortingKey = originalSortingKeys[randomGenerator() % numberOfRenderables];
+			sortingKey = (sortingKey & ~static_cast<uint64_t>(0x1FFFFF)) | (randomGenerator() & 0x1FFFFF);
+		}
+		referenceSortingKeys.resize(numberOfRenderables);
+		for (uint32_t i = 0; i < numberOfRenderables; ++i)
+		{
+			referenceSortingKeys[i] = std::make_pair(originalSortingKeys[i], i);
+		}
+		std::sort(referenceSortingKeys.begin(), referenceSortingKeys.end());
+		const std::vector<uint32_t> previousSortedIndices = sortedIndices;
+		float insertionSortMilliseconds = 0.0f;
+		bool insertionSortFinished = false;
+		for (uint32_t repetition = 0; repetition < BenchmarkDetail::NUMBER_OF_SORT_REPETITIONS; ++repetition)
+		{
+			sortedIndices = previousSortedIndices;
+			for (uint32_t i = 0; i < numberOfRenderables; ++i)
+			{
+				sortingKeys[i] = originalSortingKeys[sortedIndices[i]];
+			}
+			const Renderer::Stopwatch stopwatch(true);
+			insertionSortFinished = Renderer::RenderQueue::insertionSortSortingKeys(sortingKeys, sortedIndices);
+			insertionSortMilliseconds += stopwatch.getMilliseconds();
+		}
+		insertionSortMilliseconds /= BenchmarkDetail::NUMBER_OF_SORT_REPETITIONS;
+
+		// The insertion sort isn't stable regarding the original indices, equal keys keep the order of the previous frame instead, so only compare the keys
+		// -> The sorted indices must still be a permutation pointing to the right keys
+		if (insertionSortFinished)
+		{
+			std::vector<bool> usedIndices(numberOfRenderables, false);
+			for (uint32_t i = 0; i < numberOfRenderables && passed; ++i)
+			{
+				const uint32_t index = sortedIndices[i];
+				if (sortingKeys[i] != referenceSortingKeys[i].first || sortingKeys[i] != originalSortingKeys[index] || usedIndices[index])
+				{
+					RHI_LOG(context, CRITICAL, "Render queue sorting: Temporal coherence insertion sort of %u renderables is wrong at position %u", numberOfRenderables, i)
+					passed = false;
+				}
+				usedIndices[index] = true;
+			}
+		}
+		RHI_LOG(context, INFORMATION, "Render queue sorting: %u renderables, std::sort %.3f ms, radix sort %.3f ms, next frame with %u%% new depths %s %.3f ms", numberOfRenderables, referenceMilliseconds, radixSortMilliseconds, BenchmarkDetail::TEMPORAL_SORT_CHANGED_PERCENTAGE, insertionSortFinished ? "insertion sort" : "insertion sort gave up after", insertionSortMilliseconds)
+	}
+
+	// Done
+	return passed;
+}
+
+bool Benchmark::checkAssetIdIndex(const Rhi::Context& context) const
+{
+	bool passed = true;
+
+	// Synthetic unique asset IDs, 32 bit FNV-1a hashes of 50k strings might collide so skip duplicates, the reference knows all of them
+	std::unordered_map<uint32_t, Renderer::ResourceId> referenceIndex;
+	std::vector<Renderer::AssetId> assetIds;
+	referenceIndex.reserve(BenchmarkDetail::NUMBER_OF_ASSETS);
+	assetIds.reserve(BenchmarkDetail::NUMBER_OF_ASSETS);
+	for (uint32_t i = 0; assetIds.size() < BenchmarkDetail::NUMBER_OF_ASSETS; ++i)
+	{
+		const Renderer::AssetId assetId = BenchmarkDetail::getSyntheticAssetId("Texture", i);
+		if (Renderer::isValid(assetId) && referenceIndex.emplace(assetId, static_cast<Renderer::ResourceId>(assetIds.size())).second)
+		{
+			assetIds.push_back(assetId);
+		}
+	}
+	std::vector<Renderer::AssetId> unknownAssetIds;
+	unknownAssetIds.reserve(BenchmarkDetail::NUMBER_OF_ASSETS);
+	for (uint32_t i = 0; unknownAssetIds.size() < BenchmarkDetail::NUMBER_OF_ASSETS; ++i)
+	{
+		const Renderer::AssetId assetId = BenchmarkDetail::getSyntheticAssetId("Unknown", i);
+		if (Renderer::isValid(assetId) && referenceIndex.find(assetId) == referenceIndex.cend())
+		{
+			unknownAssetIds.push_back(assetId);
+		}
+	}
+
+	// Add all assets, the resource ID is the asset index
+	Renderer::AssetIdIndex assetIdIndex;
+	const Renderer::Stopwatch addStopwatch(true);
+	for (uint32_t i = 0; i < BenchmarkDetail::NUMBER_OF_ASSETS; ++i)
+	{
+		assetIdIndex.addResourceId(assetIds[i], i);
+	}
+	const float addMilliseconds = addStopwatch.getMilliseconds();
+	if (assetIdIndex.getNumberOfEntries() != BenchmarkDetail::NUMBER_OF_ASSETS)
+	{
+		RHI_LOG(context, CRITICAL, "Asset ID index: %u entries after adding %u assets", assetIdIndex.getNumberOfEntries(), BenchmarkDetail::NUMBER_OF_ASSETS)
+		return false;
+	}
+
+	// Lookup of known and unknown asset IDs, unknown asset IDs are common since every load request checks whether or not the resource already exists
+	const Renderer::Stopwatch lookupStopwatch(true);
+	uint32_t numberOfWrongResourceIds = 0;
+	for (uint32_t i = 0; i < BenchmarkDetail::NUMBER_OF_ASSETS; ++i)
+	{
+		numberOfWrongResourceIds += (assetIdIndex.getResourceId(assetIds[i]) != i);
+		numberOfWrongResourceIds += Renderer::isValid(assetIdIndex.getResourceId(unknownAssetIds[i]));
+	}
+	const float lookupMicroseconds = static_cast<float>(lookupStopwatch.getMicroseconds());
+	if (0 != numberOfWrongResourceIds)
+	{
+		RHI_LOG(context, CRITICAL, "Asset ID index: %u of %u lookups returned the wrong resource ID", numberOfWrongResourceIds, BenchmarkDetail::NUMBER_OF_ASSETS * 2)
+		return false;
+	}
+
+	// Reference lookup using "std::unordered_map"
+	const Renderer::Stopwatch referenceStopwatch(true);
+	uint32_t numberOfReferenceHits = 0;
+	for (uint32_t i = 0; i < BenchmarkDetail::NUMBER_OF_ASSETS; ++i)
+	{
+		numberOfReferenceHits += (referenceIndex.find(assetIds[i]) != referenceIndex.cend());
+		numberOfReferenceHits += (referenceIndex.find(unknownAssetIds[i]) != referenceIndex.cend());
+	}
+	const float referenceMicroseconds = static_cast<float>(referenceStopwatch.getMicroseconds());
+
+	// Former linear scan over all resources, only a few lookups since it's quadratic when loading a whole scene
+	const Renderer::Stopwatch linearScanStopwatch(true);
+	uint32_t numberOfLinearScanHits = 0;
+	for (uint32_t i = 0; i < BenchmarkDetail::NUMBER_OF_LINEAR_SCAN_LOOKUPS; ++i)
+	{
+		const Renderer::AssetId assetId = (i % 2) ? unknownAssetIds[i] : assetIds[BenchmarkDetail::NUMBER_OF_ASSETS - 1 - i];
+		numberOfLinearScanHits += (std::find(assetIds.cbegin(), assetIds.cend(), assetId) != assetIds.cend());
+	}
+	const float linearScanMicroseconds = static_cast<float>(linearScanStopwatch.getMicroseconds());
+	if (numberOfReferenceHits != BenchmarkDetail::NUMBER_OF_ASSETS || numberOfLinearScanHits != BenchmarkDetail::NUMBER_OF_LINEAR_SCAN_LOOKUPS / 2)
+	{
+		RHI_LOG(context, CRITICAL, "Asset ID index: The reference lookups are inconsistent")
+		return false;
+	}
+
+	// Remove every second asset, the backward shift deletion must keep all other assets reachable
+	for (uint32_t i = 0; i < BenchmarkDetail::NUMBER_OF_ASSETS; i += 2)
+	{
+		if (assetIdIndex.removeResourceId(assetIds[i], i))
+		{
+			RHI_LOG(context, CRITICAL, "Asset ID index: Removing the only resource of an asset requested a replacement")
+			passed = false;
+		}
+	}
+	for (uint32_t i = 0; i < BenchmarkDetail::NUMBER_OF_ASSETS && passed; ++i)
+	{
+		const Renderer::ResourceId expectedResourceId = (i % 2) ? i : Renderer::getInvalid<Renderer::ResourceId>();
+		if (assetIdIndex.getResourceId(assetIds[i]) != expectedResourceId)
+		{
+			RHI_LOG(context, CRITICAL, "Asset ID index: Asset %u has the wrong resource ID after removing every second asset", i)
+			passed = false;
+		}
+	}
+	if (assetIdIndex.getNumberOfEntries() != BenchmarkDetail::NUMBER_OF_ASSETS / 2)
+	{
+		RHI_LOG(context, CRITICAL, "Asset ID index: %u entries after removing half of %u assets", assetIdIndex.getNumberOfEntries(), BenchmarkDetail::NUMBER_OF_ASSETS)
+		passed = false;
+	}
+
+	// Several resources sharing an asset ID, like cloned materials: Removing the indexed one requests a replacement
+	{
+		const Renderer::AssetId assetId = assetIds[1];
+		const Renderer::ResourceId cloneResourceId = BenchmarkDetail::NUMBER_OF_ASSETS;
+		assetIdIndex.addResourceId(assetId, cloneResourceId);
+		if (assetIdIndex.getResourceId(assetId) != 1 || !assetIdIndex.removeResourceId(assetId, 1))
+		{
+			RHI_LOG(context, CRITICAL, "Asset ID index: Removing the indexed one of two resources sharing an asset ID didn't request a replacement")
+			passed = false;
+		}
+		assetIdIndex.setResourceId(assetId, cloneResourceId);
+		if (assetIdIndex.getResourceId(assetId) != cloneResourceId || assetIdIndex.removeResourceId(assetId, cloneResourceId) || Renderer::isValid(assetIdIndex.getResourceId(assetId)))
+		{
+			RHI_LOG(context, CRITICAL, "Asset ID index: The replacement of a removed shared resource is wrong")
+			passed = false;
+		}
+	}
+
+	// Report microseconds per lookup
+	RHI_LOG(context, INFORMATION, "Asset ID index: %u assets, adding %.3f ms, per lookup asset ID index %.4f us, std::unordered_map %.4f us, linear scan %.4f us", BenchmarkDetail::NUMBER_OF_ASSETS, addMilliseconds,
+		lookupMicroseconds / (BenchmarkDetail::NUMBER_OF_ASSETS * 2), referenceMicroseconds / (BenchmarkDetail::NUMBER_OF_ASSETS * 2), linearScanMicroseconds / BenchmarkDetail::NUMBER_OF_LINEAR_SCAN_LOOKUPS)
+
+	// Done
+	return passed;
+}
+
+bool Benchmark::checkCommandBuffer(const Rhi::Context& context) const
+{
+	bool passed = true;
+	BenchmarkDetail::CountingAllocator countingAllocator(context.getAllocator());
+
+	{ // Command packet chain integrity
+		Rhi::CommandBuffer commandBuffer(&countingAllocator);
+		BenchmarkDetail::recordCommands(commandBuffer);
+		if (!BenchmarkDetail::isCommandPacketChainIntact(commandBuffer, 1))
+		{
+			RHI_LOG(context, CRITICAL, "Command buffer: The command packet chain of %u recorded commands is broken", BenchmarkDetail::NUMBER_OF_RECORDED_COMMANDS)
+			passed = false;
+		}
+
+		// Appending copies the chunks in bursts and has to relink the copied command packets, append twice so the second copy has to link to the first one
+		Rhi::CommandBuffer appendedCommandBuffer(&countingAllocator);
+		commandBuffer.appendToCommandBuffer(appendedCommandBuffer);
+		commandBuffer.appendToCommandBuffer(appendedCommandBuffer);
+		if (!BenchmarkDetail::isCommandPacketChainIntact(appendedCommandBuffer, 2))
+		{
+			RHI_LOG(context, CRITICAL, "Command buffer: The command packet chain of an appended command buffer is broken")
+			passed = false;
+		}
+
+		// Recording again after clearing must recycle the chunks without allocating
+		const uint32_t numberOfAllocations = countingAllocator.getNumberOfAllocations();
+		commandBuffer.clear();
+		if (!commandBuffer.isEmpty() || nullptr != commandBuffer.getFirstCommandPacket())
+		{
+			RHI_LOG(context, CRITICAL, "Command buffer: A cleared command buffer isn't empty")
+			passed = false;
+		}
+		BenchmarkDetail::recordCommands(commandBuffer);
+		if (!BenchmarkDetail::isCommandPacketChainIntact(commandBuffer, 1))
+		{
+			RHI_LOG(context, CRITICAL, "Command buffer: The command packet chain of a recycled command buffer is broken")
+			passed = false;
+		}
+		if (countingAllocator.getNumberOfAllocations() != numberOfAllocations)
+		{
+			RHI_LOG(context, CRITICAL, "Command buffer: Recording a recycled command buffer allocated memory %u times", countingAllocator.getNumberOfAllocations() - numberOfAllocations)
+			passed = false;
+		}
+	}
+
+	{ // Recording throughput of small commands, into a new command buffer per frame and into a recycled one
+		float newCommandBufferMilliseconds = 0.0f;
+		const uint32_t numberOfAllocations = countingAllocator.getNumberOfAllocations();
+		for (uint32_t repetition = 0; repetition < BenchmarkDetail::NUMBER_OF_RECORDING_REPETITIONS; ++repetition)
+		{
+			const Renderer::Stopwatch stopwatch(true);
+			Rhi::CommandBuffer commandBuffer(&countingAllocator);
+			for (uint32_t i = 0; i < BenchmarkDetail::NUMBER_OF_RECORDED_COMMANDS; ++i)
+			{
+				Rhi::Command::SetDebugMarker::create(commandBuffer, "Benchmark");
+			}
+			newCommandBufferMilliseconds += stopwatch.getMilliseconds();
+		}
+		const uint32_t numberOfAllocationsPerNewCommandBuffer = (countingAllocator.getNumberOfAllocations() - numberOfAllocations) / BenchmarkDetail::NUMBER_OF_RECORDING_REPETITIONS;
+
+		Rhi::CommandBuffer recycledCommandBuffer(&countingAllocator);
+		float recycledCommandBufferMilliseconds = 0.0f;
+		for (uint32_t repetition = 0; repetition <= BenchmarkDetail::NUMBER_OF_RECORDING_REPETITIONS; ++repetition)
+		{
+			// The first recording allocates the chunks and isn't measured
+			const Renderer::Stopwatch stopwatch(true);
+			recycledCommandBuffer.clear();
+			for (uint32_t i = 0; i < BenchmarkDetail::NUMBER_OF_RECORDED_COMMANDS; ++i)
+			{
+				Rhi::Command::SetDebugMarker::create(recycledCommandBuffer, "Benchmark");
+			}
+			if (repetition > 0)
+			{
+				recycledCommandBufferMilliseconds += stopwatch.getMilliseconds();
+			}
+		}
+
+		// Report million commands per second
+		const float numberOfRecordedCommands = static_cast<float>(BenchmarkDetail::NUMBER_OF_RECORDED_COMMANDS) * BenchmarkDetail::NUMBER_OF_RECORDING_REPETITIONS;
+		RHI_LOG(context, INFORMATION, "Command buffer: Recording %u commands per frame, new command buffer %.1f million commands/s with %u allocations per frame, recycled command buffer %.1f million commands/s without allocations", BenchmarkDetail::NUMBER_OF_RECORDED_COMMANDS,
+			numberOfRecordedCommands / (newCommandBufferMilliseconds * 1000.0f), numberOfAllocationsPerNewCommandBuffer, numberOfRecordedCommands / (recycledCommandBufferMilliseconds * 1000.0f))
+	}
+
+	// Done
+	return passed;
+}
+
+bool Benchmark::checkShaderTemplate(const Rhi::Context& context) const
+{
+	bool passed = true;
+	Renderer::ShaderBuilder shaderBuilder(context);
+	std::string templateSourceCode;
+	std::string referenceSourceCode;
+
+	// Example shader blueprints and shader pieces, read from the development data source so the example assets don't need to be compiled
+	std::vector<BenchmarkDetail::ShaderSourceCode> shaderSourceCodes;
+	BenchmarkDetail::loadShaderSourceCodes(shaderSourceCodes);
+	if (shaderSourceCodes.empty())
+	{
+		RHI_LOG(context, CRITICAL, "Shader template: No shader blueprint or shader piece found inside \"%s\"", BenchmarkDetail::SHADER_BLUEPRINT_DIRECTORY)
+		return false;
+	}
+
+	std::mt19937 randomGenerator(BenchmarkDetail::NUMBER_OF_SHADER_PROPERTY_SETS);
+	std::vector<Renderer::ShaderProperties> shaderPropertiesSets(BenchmarkDetail::NUMBER_OF_SHADER_PROPERTY_SETS);
+	std::vector<BenchmarkDetail::ReferencedShaderProperty> referencedShaderProperties;
+	for (const BenchmarkDetail::ShaderSourceCode& shaderSourceCodeEntry : shaderSourceCodes)
+	{
+		// Random shader property sets using the shader properties referenced by the shader source code
+		const std::string& shaderSourceCode = shaderSourceCodeEntry.sourceCode;
+		const char* filename = shaderSourceCodeEntry.filename.c_str();
+		referencedShaderProperties.clear();
+		BenchmarkDetail::gatherReferencedShaderProperties(shaderSourceCode, referencedShaderProperties);
+		for (Renderer::ShaderProperties& shaderProperties : shaderPropertiesSets)
+		{
+			shaderProperties.clear();
+			for (const BenchmarkDetail::ReferencedShaderProperty& referencedShaderProperty : referencedShaderProperties)
+			{
+				const int32_t value = static_cast<int32_t>(randomGenerator() % static_cast<uint32_t>(referencedShaderProperty.maximumValue + 1));
+				if (0 != value)
+				{
+					shaderProperties.setPropertyValue(Renderer::StringId::calculateFNV(referencedShaderProperty.name.c_str()), value);
+				}
+			}
+		}
+
+		// Compile the shader template once, a shader template which isn't compiled makes the shader builder use the string-rewriting passes
+		Renderer::ShaderTemplate shaderTemplate;
+		Renderer::ShaderTemplate uncompiledShaderTemplate;
+		const Renderer::Stopwatch compileStopwatch(true);
+		Renderer::ShaderBuilder::compileShaderTemplate(context, shaderSourceCode, shaderTemplate);
+		const float compileMicroseconds = static_cast<float>(compileStopwatch.getMicroseconds());
+		if (!shaderTemplate.isCompiled())
+		{
+			RHI_LOG(context, CRITICAL, "Shader template: \"%s\" wasn't compiled into a shader template", filename)
+			passed = false;
+			continue;
+		}
+
+		// Each shader permutation must be identical to the one of the string-rewriting passes
+		for (uint32_t i = 0; i < BenchmarkDetail::NUMBER_OF_SHADER_PROPERTY_SETS; ++i)
+		{
+			const bool templateSyntaxError = shaderBuilder.evaluateShaderSourceCode(shaderSourceCode, shaderTemplate, shaderPropertiesSets[i], templateSourceCode);
+			const bool referenceSyntaxError = shaderBuilder.evaluateShaderSourceCode(shaderSourceCode, uncompiledShaderTemplate, shaderPropertiesSets[i], referenceSourceCode);
+			if (templateSyntaxError || referenceSyntaxError || templateSourceCode != referenceSourceCode)
+			{
+				RHI_LOG(context, CRITICAL, "Shader template: \"%s\" differs from the string-rewriting passes for shader property set %u", filename, i)
+				passed = false;
+				break;
+			}
+		}
+
+		// Measure shader permutations per second
+		const Renderer::Stopwatch templateStopwatch(true);
+		for (const Renderer::ShaderProperties& shaderProperties : shaderPropertiesSets)
+		{
+			shaderBuilder.evaluateShaderSourceCode(shaderSourceCode, shaderTemplate, shaderProperties, templateSourceCode);
+		}
+		const float templateSeconds = templateStopwatch.getSeconds();
+		const Renderer::Stopwatch referenceStopwatch(true);
+		for (const Renderer::ShaderProperties& shaderProperties : shaderPropertiesSets)
+		{
+			shaderBuilder.evaluateShaderSourceCode(shaderSourceCode, uncompiledShaderTemplate, shaderProperties, referenceSourceCode);
+		}
+		const float referenceSeconds = referenceStopwatch.getSeconds();
+		RHI_LOG(context, INFORMATION, "Shader template: \"%s\" with %u shader properties, compiling %.3f us, shader template %.0f permutations/s, string-rewriting passes %.0f permutations/s", filename, static_cast<uint32_t>(referencedShaderProperties.size()), compileMicroseconds,
+			BenchmarkDetail::NUMBER_OF_SHADER_PROPERTY_SETS / std::max(templateSeconds, 1e-6f), BenchmarkDetail::NUMBER_OF_SHADER_PROPERTY_SETS / std::max(referenceSeconds, 1e-6f))
+	}
+
+	// Done
+	return passed;
+}
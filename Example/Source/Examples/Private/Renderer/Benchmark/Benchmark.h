@@ -0,0 +1,211 @@
+/*********************************************************\
+ * Copyright (c) 2012-2021 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include <string_view>
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace Rhi
+{
+	class Context;
+}
+namespace Renderer
+{
+	class JobSystem;
+}
+class ExampleRunner;
+
+
+//[-------------------------------------------------------]
+//[ Classes                                               ]
+//[-------------------------------------------------------]
+/**
+*  @brief
+*    Headless example checking and measuring renderer building blocks without having any output window
+*
+*  @remarks
+*    Demonstrates:
+*    - Job system: Work-stealing correctness and job dispatch latency
+*    - Scene culling: Culling correctness and culling time for 1k up to 1M scene items, with and without loose octree
+*    - Single pass stereo culling: No false negatives using synthetic head-mounted display (HMD) matrices, so no HMD is needed
+*    - Render queue sorting: Radix sort and temporal coherence insertion sort compared with "std::sort()" for 10k up to 1M renderables
+*    - Asset ID index: Resource lookup by asset ID for 50k assets compared with "std::unordered_map" and the former linear scan
+*    - Command buffer: Command packet chain integrity across chunks, appending and recycling, and the recording throughput
+*    - Shader template: Compiled shader template evaluation compared with the string-rewriting shader builder passes, in shader permutations per second
+*
+*  @note
+*    - Each check validates its results first and measures afterwards, the results are written into the log
+*    - The program return code is not zero in case a check failed, so the example can be used by automated tests
+*/
+class Benchmark final
+{
+
+
+//[-------------------------------------------------------]
+//[ Public methods                                        ]
+//[-------------------------------------------------------]
+public:
+	/**
+	*  @brief
+	*    Constructor
+	*
+	*  @param[in] exampleRunner
+	*    Example runner, unused
+	*  @param[in] rhiName
+	*    Case sensitive ASCII name of the RHI to instance, unused since none of the checks needs an RHI
+	*  @param[in] exampleName
+	*    Example name, unused
+	*/
+	inline Benchmark(ExampleRunner&, const char*, const std::string_view&)
+	{
+		// Nothing here
+	}
+
+	/**
+	*  @brief
+	*    Destructor
+	*/
+	inline ~Benchmark()
+	{
+		// Nothing here
+	}
+
+	/**
+	*  @brief
+	*    Run the application
+	*
+	*  @return
+	*    Program return code, 0 to indicate that no error has occurred and all checks have been passed
+	*/
+	[[nodiscard]] int run();
+
+
+//[-------------------------------------------------------]
+//[ Private methods                                       ]
+//[-------------------------------------------------------]
+private:
+	/**
+	*  @brief
+	*    Check the job system and compare its dispatch latency with one "std::async()" per task
+	*
+	*  @param[in] context
+	*    RHI context used for logging
+	*  @param[in] jobSystem
+	*    Job system to check
+	*
+	*  @return
+	*    "true" if all checks have been passed, else "false"
+	*/
+	[[nodiscard]] bool checkJobSystem(const Rhi::Context& context, Renderer::JobSystem& jobSystem) const;
+
+	/**
+	*  @brief
+	*    Check the scene culling against a scalar reference and measure the culling time of synthetic scenes
+	*
+	*  @param[in] context
+	*    RHI context used for logging
+	*  @param[in] jobSystem
+	*    Job system to use for the culling jobs
+	*
+	*  @return
+	*    "true" if all checks have been passed, else "false"
+	*/
+	[[nodiscard]] bool checkSceneCulling(const Rhi::Context& context, Renderer::JobSystem& jobSystem) const;
+
+	/**
+	*  @brief
+	*    Check that the conservative single pass stereo frustum culling never culls scene items visible to one of the eyes
+	*
+	*  @param[in] context
+	*    RHI context used for logging
+	*  @param[in] jobSystem
+	*    Job system to use for the culling jobs
+	*
+	*  @return
+	*    "true" if all checks have been passed, else "false"
+	*/
+	[[nodiscard]] bool checkStereoCulling(const Rhi::Context& context, Renderer::JobSystem& jobSystem) const;
+
+	/**
+	*  @brief
+	*    Check that the render queue sorting produces the same order as a stable "std::sort()" and measure the sorting time
+	*
+	*  @param[in] context
+	*    RHI context used for logging
+	*
+	*  @return
+	*    "true" if all checks have been passed, else "false"
+	*/
+	[[nodiscard]] bool checkRenderQueueSorting(const Rhi::Context& context) const;
+
+	/**
+	*  @brief
+	*    Check the asset ID index used by the resource managers against "std::unordered_map" and measure the lookup time for 50k assets
+	*
+	*  @param[in] context
+	*    RHI context used for logging
+	*
+	*  @return
+	*    "true" if all checks have been passed, else "false"
+	*/
+	[[nodiscard]] bool checkAssetIdIndex(const Rhi::Context& context) const;
+
+	/**
+	*  @brief
+	*    Check the command packet chain of recorded, appended and recycled command buffers and measure the recording throughput
+	*
+	*  @param[in] context
+	*    RHI context used for logging and as source of the command packet chunk memory
+	*
+	*  @return
+	*    "true" if all checks have been passed, else "false"
+	*/
+	[[nodiscard]] bool checkCommandBuffer(const Rhi::Context& context) const;
+
+	/**
+	*  @brief
+	*    Check that compiled shader templates produce the same shader permutations as the string-rewriting shader builder passes and measure both
+	*
+	*  @param[in] context
+	*    RHI context used for logging
+	*
+	*  @return
+	*    "true" if all checks have been passed, else "false"
+	*
+	*  @note
+	*    - The example shader blueprints and shader pieces are read from "Example/DataSource/Example/Content/Blueprint", the example assets don't need to be compiled
+	*    - The random shader property sets use the shader properties referenced by each shader source code
+	*/
+	[[nodiscard]] bool checkShaderTemplate(const Rhi::Context& context) const;
+
+
+};
@@ -30,6 +30,14 @@
 #include "Renderer/Public/Core/File/IFile.h"
 #include "Renderer/Public/Core/File/IFileManager.h"
 #include "Renderer/Public/Core/File/FileSystemHelper.h"
+#ifdef _WIN32
+	#include "Renderer/Public/Core/Platform/WindowsHeader.h"
+#elif defined LINUX
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+#endif
 
 // Disable warnings in external headers, we can't fix them
 PRAGMA_WARNING_PUSH
@@ -41,8 +49,11 @@ PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
 	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
 	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#include <atomic>
 	#include <string>
+	#include <cstring>	// For "memcpy()"
 	#include <fstream>
+	#include <algorithm>	// For "std::find()"
 	#include <unordered_map>
 PRAGMA_WARNING_POP
 
@@ -197,6 +208,184 @@ namespace
 			#endif
 
 
+		};
+
+		/**
+		*  @brief
+		*    Memory mapped read-only file
+		*
+		*  @remarks
+		*    The file is mapped into the address space as a whole, so reading doesn't involve any system calls and bulk data can be
+		*    directly processed from the mapped memory region via "Renderer::IFile::tryReadWithoutCopy()" without an intermediate copy.
+		*
+		*  @note
+		*    - Memory mapping can fail, e.g. for empty files, "Renderer::DefaultFileManager" falls back to "DefaultReadFile" in this case
+		*/
+		class DefaultMappedReadFile final : public DefaultFile
+		{
+
+
+		//[-------------------------------------------------------]
+		//[ Public methods                                        ]
+		//[-------------------------------------------------------]
+		public:
+			inline explicit DefaultMappedReadFile(const std::string& absoluteFilename) :
+				mData(nullptr),
+				mNumberOfBytes(0),
+				mCurrentPosition(0)
+				#ifdef RHI_DEBUG
+					, mDebugName(absoluteFilename)
+				#endif
+			{
+				#ifdef _WIN32
+					const HANDLE fileHandle = ::CreateFileW(std_filesystem::u8path(absoluteFilename).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+					if (INVALID_HANDLE_VALUE != fileHandle)
+					{
+						LARGE_INTEGER fileSize;
+						if (::GetFileSizeEx(fileHandle, &fileSize) && fileSize.QuadPart > 0)
+						{
+							const HANDLE fileMappingHandle = ::CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+							if (nullptr != fileMappingHandle)
+							{
+								mData = static_cast<const uint8_t*>(::MapViewOfFile(fileMappingHandle, FILE_MAP_READ, 0, 0, 0));
+								if (nullptr != mData)
+								{
+									mNumberOfBytes = static_cast<size_t>(fileSize.QuadPart);
+								}
+
+								// The view keeps the file mapping alive
+								::CloseHandle(fileMappingHandle);
+							}
+						}
+						::CloseHandle(fileHandle);
+					}
+				#elif defined LINUX
+					const int fileDescriptor = ::open(absoluteFilename.c_str(), O_RDONLY | O_CLOEXEC);
+					if (-1 != fileDescriptor)
+					{
+						struct stat fileStatus;
+						if (0 == ::fstat(fileDescriptor, &fileStatus) && fileStatus.st_size > 0)
+						{
+							void* data = ::mmap(nullptr, static_cast<size_t>(fileStatus.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+							if (MAP_FAILED != data)
+							{
+								// Asset files are usually read from front to back, let the kernel read ahead
+								::madvise(data, static_cast<size_t>(fileStatus.st_size), MADV_SEQUENTIAL);
+								mData = static_cast<const uint8_t*>(data);
+								mNumberOfBytes = static_cast<size_t>(fileStatus.st_size);
+							}
+						}
+
+						// The mapping keeps the file alive
+						::close(fileDescriptor);
+					}
+				#else
+					#error "Unsupported platform"
+				#endif
+			}
+
+			inline virtual ~DefaultMappedReadFile() override
+			{
+				if (nullptr != mData)
+				{
+					#ifdef _WIN32
+						::UnmapViewOfFile(mData);
+					#elif defined LINUX
+						::munmap(const_cast<uint8_t*>(mData), mNumberOfBytes);
+					#else
+						#error "Unsupported platform"
+					#endif
+				}
+			}
+
+
+		//[-------------------------------------------------------]
+		//[ Public virtual DefaultFile methods                    ]
+		//[-------------------------------------------------------]
+		public:
+			[[nodiscard]] inline virtual bool isInvalid() const override
+			{
+				return (nullptr == mData);
+			}
+
+
+		//[-------------------------------------------------------]
+		//[ Public virtual Renderer::IFile methods                ]
+		//[-------------------------------------------------------]
+		public:
+			[[nodiscard]] inline virtual size_t getNumberOfBytes() override
+			{
+				ASSERT(nullptr != mData, "Invalid default file access")
+
+				// Same behaviour as "DefaultReadFile": Rewind to the beginning of the file
+				mCurrentPosition = 0;
+				return mNumberOfBytes;
+			}
+
+			inline virtual void read(void* destinationBuffer, size_t numberOfBytes) override
+			{
+				ASSERT(nullptr != destinationBuffer, "Letting a file read into a null destination buffer is not allowed")
+				ASSERT(0 != numberOfBytes, "Letting a file read zero bytes is not allowed")
+				ASSERT(nullptr != mData, "Invalid default file access")
+				ASSERT(mCurrentPosition + numberOfBytes <= mNumberOfBytes, "Invalid number of bytes")
+				memcpy(destinationBuffer, mData + mCurrentPosition, numberOfBytes);
+				mCurrentPosition += numberOfBytes;
+			}
+
+			inline virtual void skip(size_t numberOfBytes) override
+			{
+				ASSERT(0 != numberOfBytes, "Letting a file skip zero bytes is not allowed")
+				ASSERT(nullptr != mData, "Invalid default file access")
+				ASSERT(mCurrentPosition + numberOfBytes <= mNumberOfBytes, "Invalid number of bytes")
+				mCurrentPosition += numberOfBytes;
+			}
+
+			[[nodiscard]] inline virtual const uint8_t* tryReadWithoutCopy(size_t numberOfBytes) override
+			{
+				ASSERT(0 != numberOfBytes, "Letting a file read zero bytes is not allowed")
+				ASSERT(nullptr != mData, "Invalid default file access")
+				ASSERT(mCurrentPosition + numberOfBytes <= mNumberOfBytes, "Invalid number of bytes")
+				const uint8_t* data = mData + mCurrentPosition;
+				mCurrentPosition += numberOfBytes;
+				return data;
+			}
+
+			inline virtual void write([[maybe_unused]] const void* sourceBuffer, [[maybe_unused]] size_t numberOfBytes) override
+			{
+				ASSERT(nullptr != sourceBuffer, "Letting a file write from a null source buffer is not allowed")
+				ASSERT(0 != numberOfBytes, "Letting a file write zero bytes is not allowed")
+				ASSERT(nullptr != mData, "Invalid default file access")
+				ASSERT(false, "File write method not supported by the default implementation")
+			}
+
+			#ifdef RHI_DEBUG
+				[[nodiscard]] inline virtual const char* getDebugFilename() const override
+				{
+					return mDebugName.c_str();
+				}
+			#endif
+
+
+		//[-------------------------------------------------------]
+		//[ Protected methods                                     ]
+		//[-------------------------------------------------------]
+		protected:
+			explicit DefaultMappedReadFile(const DefaultMappedReadFile&) = delete;
+			DefaultMappedReadFile& operator=(const DefaultMappedReadFile&) = delete;
+
+
+		//[-------------------------------------------------------]
+		//[ Private data                                          ]
+		//[-------------------------------------------------------]
+		private:
+			const uint8_t* mData;				///< Memory mapped file content, null pointer on error
+			size_t		   mNumberOfBytes;
+			size_t		   mCurrentPosition;
+			#ifdef RHI_DEBUG
+				std::string mDebugName;	///< Debug name for easier file identification when debugging
+			#endif
+
+
 		};
 
 		class DefaultWriteFile final : public DefaultFile
@@ -517,7 +706,13 @@ namespace Renderer
 			{
 				if (FileMode::READ == fileMode)
 				{
-					file = new ::detail::DefaultReadFile(absoluteFilename);
+					// Prefer memory mapped files for zero-copy reads, fall back to a file stream if memory mapping isn't possible (e.g. empty file)
+					file = new ::detail::DefaultMappedReadFile(absoluteFilename);
+					if (file->isInvalid())
+					{
+						delete file;
+						file = new ::detail::DefaultReadFile(absoluteFilename);
+					}
 				}
 				else
 				{
@@ -664,7 +859,7 @@ namespace Renderer
 		AbsoluteDirectoryNames mAbsoluteBaseDirectory;	///< Absolute UTF-8 base directory, without "/" at the end
 		MountedDirectories	   mMountedDirectories;
 		#ifdef RHI_DEBUG
-			mutable int mNumberOfCurrentlyOpenedFiles = 0;	///< For leak detection
+			mutable std::atomic<int> mNumberOfCurrentlyOpenedFiles{0};	///< For leak detection, atomic since the resource streamer opens files from multiple threads
 		#endif
 
 
@@ -89,6 +89,24 @@ namespace Renderer
 		*/
 		virtual void skip(size_t numberOfBytes) = 0;
 
+		/**
+		*  @brief
+		*    Try to read a requested number of bytes from the file without copying them
+		*
+		*  @param[in] numberOfBytes
+		*    Number of bytes to read, it's the callers responsibility that this number of byte is correct
+		*
+		*  @return
+		*    Pointer to the requested bytes which stays valid until the file is closed, do not free the memory, null pointer if the file implementation doesn't support zero-copy reads in which case nothing was read and "read()" must be used instead
+		*
+		*  @note
+		*    - Meant for e.g. memory mapped files, so bulk data can be decompressed directly into its destination
+		*/
+		[[nodiscard]] inline virtual const uint8_t* tryReadWithoutCopy([[maybe_unused]] size_t numberOfBytes)
+		{
+			return nullptr;
+		}
+
 		//[-------------------------------------------------------]
 		//[ Write                                                 ]
 		//[-------------------------------------------------------]
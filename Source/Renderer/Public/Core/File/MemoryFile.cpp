@@ -125,15 +125,27 @@ namespace Renderer
 		mNumberOfDecompressedBytes = numberOfDecompressedBytes;
 		mDecompressedData.clear();
 		mCurrentDataPointer = nullptr;
-		mCompressedData.resize(numberOfCompressedBytes);
-		file.read(mCompressedData.data(), numberOfCompressedBytes);
+		const uint8_t* compressedData = file.tryReadWithoutCopy(numberOfCompressedBytes);
+		if (nullptr != compressedData)
+		{
+			// Zero-copy: Decompress directly from the source file, there's no need to keep a copy of the compressed data
+			mCompressedData.clear();
+			decompressLz4(compressedData, numberOfCompressedBytes);
+		}
+		else
+		{
+			mCompressedData.resize(numberOfCompressedBytes);
+			file.read(mCompressedData.data(), numberOfCompressedBytes);
+		}
 	}
 
 	void MemoryFile::decompress()
 	{
-		mDecompressedData.resize(mNumberOfDecompressedBytes);
-		[[maybe_unused]] const int numberOfDecompressedBytes = LZ4_decompress_safe(reinterpret_cast<const char*>(mCompressedData.data()), reinterpret_cast<char*>(mDecompressedData.data()), static_cast<int>(mCompressedData.size()), static_cast<int>(mNumberOfDecompressedBytes));
-		ASSERT(mNumberOfDecompressedBytes == static_cast<uint32_t>(numberOfDecompressedBytes), "Invalid number of decompressed bytes")
+		// In case the data has already been decompressed directly from the source file, there's nothing left to do in here
+		if (!mCompressedData.empty())
+		{
+			decompressLz4(mCompressedData.data(), static_cast<uint32_t>(mCompressedData.size()));
+		}
 		mCurrentDataPointer = mDecompressedData.data();
 	}
 
@@ -175,6 +187,17 @@ namespace Renderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	void MemoryFile::decompressLz4(const uint8_t* compressedData, uint32_t numberOfCompressedBytes)
+	{
+		mDecompressedData.resize(mNumberOfDecompressedBytes);
+		[[maybe_unused]] const int numberOfDecompressedBytes = LZ4_decompress_safe(reinterpret_cast<const char*>(compressedData), reinterpret_cast<char*>(mDecompressedData.data()), static_cast<int>(numberOfCompressedBytes), static_cast<int>(mNumberOfDecompressedBytes));
+		ASSERT(mNumberOfDecompressedBytes == static_cast<uint32_t>(numberOfDecompressedBytes), "Invalid number of decompressed bytes")
+	}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -79,6 +79,7 @@ namespace Renderer
 	*  @note
 	*    - Supports LZ4 compression ( http://lz4.github.io/lz4/ )
 	*    - Designed for instance re-usage
+	*    - If the source file supports zero-copy reads (e.g. memory mapped files), the LZ4 compressed data is directly decompressed from the source file without an intermediate copy and "decompress()" has nothing left to do
 	*/
 	class MemoryFile final : public IFile
 	{
@@ -157,6 +158,15 @@ namespace Renderer
 			mCurrentDataPointer += numberOfBytes;
 		}
 
+		[[nodiscard]] inline virtual const uint8_t* tryReadWithoutCopy(size_t numberOfBytes) override
+		{
+			ASSERT(0 != numberOfBytes, "Letting a file read zero bytes is not allowed")
+			ASSERT((mCurrentDataPointer - mDecompressedData.data()) + numberOfBytes <= mDecompressedData.size(), "Invalid number of bytes")
+			const uint8_t* data = mCurrentDataPointer;
+			mCurrentDataPointer += numberOfBytes;
+			return data;
+		}
+
 		inline virtual void write(const void* sourceBuffer, size_t numberOfBytes) override
 		{
 			ASSERT(nullptr != sourceBuffer, "Letting a file write from a null source buffer is not allowed")
@@ -180,11 +190,18 @@ namespace Renderer
 		MemoryFile& operator=(const MemoryFile&) = delete;
 
 
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		void decompressLz4(const uint8_t* compressedData, uint32_t numberOfCompressedBytes);
+
+
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		ByteVector mCompressedData;		///< Owns the data
+		ByteVector mCompressedData;		///< Owns the data, empty if the data has already been decompressed directly from the source file
 		ByteVector mDecompressedData;	///< Owns the data
 		uint32_t   mNumberOfDecompressedBytes;
 		uint8_t*   mCurrentDataPointer;	///< Pointer to the current uncompressed data position, doesn't own the data
@@ -50,6 +50,7 @@ PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
 	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
 	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#include <atomic>
 	#include <string>
 PRAGMA_WARNING_POP
 
@@ -653,7 +654,7 @@ namespace Renderer
 		Rhi::ILog& mLog;
 		bool	   mOwnsPhysicsFSInstance;
 		#ifdef RHI_DEBUG
-			mutable int mNumberOfCurrentlyOpenedFiles = 0;	///< For leak detection
+			mutable std::atomic<int> mNumberOfCurrentlyOpenedFiles{0};	///< For leak detection, atomic since the resource streamer opens files from multiple threads
 		#endif
 
 
@@ -23,6 +23,9 @@
 //[-------------------------------------------------------]
 #include "Renderer/Public/Core/Math/Frustum.h"
 
+#include <cmath>
+#include <algorithm>
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -54,6 +57,117 @@ namespace Renderer
 		}
 	}
 
+	Frustum::Frustum(const Frustum& frustum0, const Frustum& frustum1) :
+		planes
+		{
+			frustum0.planes[PLANE_LEFT],
+			frustum0.planes[PLANE_RIGHT],
+			frustum0.planes[PLANE_TOP],
+			frustum0.planes[PLANE_BOTTOM],
+			frustum0.planes[PLANE_NEAR],
+			frustum0.planes[PLANE_FAR]
+		}
+	{
+		glm::vec3 corners0[8];
+		glm::vec3 corners1[8];
+		frustum0.getCorners(corners0);
+		frustum1.getCorners(corners1);
+		for (int i = 0; i < NUMBER_OF_PLANES; ++i)
+		{
+			// Get the distance each plane needs to be moved outwards to enclose all corners of the other frustum, a convex frustum is enclosed if all of its corners are
+			const Plane& plane0 = frustum0.planes[i];
+			const Plane& plane1 = frustum1.planes[i];
+			float distance0 = 0.0f;
+			float distance1 = 0.0f;
+			for (int cornerIndex = 0; cornerIndex < 8; ++cornerIndex)
+			{
+				distance0 = std::max(distance0, -(glm::dot(plane0.normal, corners1[cornerIndex]) + plane0.d));
+				distance1 = std::max(distance1, -(glm::dot(plane1.normal, corners0[cornerIndex]) + plane1.d));
+			}
+
+			// Use the plane which needs to be moved the least, the planes are normalized so the distance can be directly added
+			if (distance0 <= distance1)
+			{
+				planes[i] = plane0;
+				planes[i].d += distance0;
+			}
+			else
+			{
+				planes[i] = plane1;
+				planes[i].d += distance1;
+			}
+		}
+	}
+
+	void Frustum::widen(const glm::vec3& apex, float angle)
+	{
+		// The near plane normal is pointing into the viewing direction
+		const glm::vec3 forward = glm::normalize(planes[PLANE_NEAR].normal);
+
+		// A frustum rotated around its apex reaches at most as far as the far corner most distant to the apex
+		glm::vec3 corners[8];
+		getCorners(corners);
+		float farDistance = 0.0f;
+		for (int i = 4; i < 8; ++i)
+		{
+			farDistance = std::max(farDistance, glm::length(corners[i] - apex));
+		}
+
+		// Far corners on the left, right, top and bottom plane, see "Renderer::Frustum::getCorners()"
+		static constexpr int PLANE_FAR_CORNERS[4][2] = { { 4, 6 }, { 5, 7 }, { 4, 5 }, { 6, 7 } };
+		const float tanAngle = std::tan(angle);
+		for (int i = PLANE_LEFT; i <= PLANE_BOTTOM; ++i)
+		{
+			// Rotate the plane normal towards the viewing direction, this rotates the plane itself outwards
+			Plane& plane = planes[i];
+			const glm::vec3 normal = glm::normalize(plane.normal);
+			glm::vec3 tangent = forward - glm::dot(normal, forward) * normal;
+			const float tangentLength = glm::length(tangent);
+			if (tangentLength > 1e-6f)
+			{
+				// A rotation by "angle" moves directions at most "angle" out of the plane, along the frustum edges this needs a larger plane rotation
+				// -> Rotating the plane by "beta" passes a direction within the plane at "gamma" from the tangent "angle" out of the plane for tan(beta) = tan(angle) / cos(gamma)
+				// -> The rotated frustum edges are up to "gamma + angle" away from the tangent
+				tangent /= tangentLength;
+				float cosGamma = 1.0f;
+				for (int cornerIndex : PLANE_FAR_CORNERS[i])
+				{
+					cosGamma = std::min(cosGamma, glm::dot(glm::normalize(corners[cornerIndex] - apex), tangent));
+				}
+				const float gamma = std::acos(std::clamp(cosGamma, -1.0f, 1.0f)) + angle;
+				const float beta = std::atan(tanAngle / std::cos(std::min(gamma, glm::radians(85.0f))));
+				plane.normal = normal * std::cos(beta) + tangent * std::sin(beta);
+				plane.d = -glm::dot(plane.normal, apex);
+			}
+		}
+
+		// Move the near plane into the apex and the far plane outwards so the depth range encloses the rotated frustums as well
+		planes[PLANE_NEAR].normal = forward;
+		planes[PLANE_NEAR].d = -glm::dot(forward, apex);
+		planes[PLANE_FAR].normal = -forward;
+		planes[PLANE_FAR].d = glm::dot(forward, apex) + farDistance;
+	}
+
+	void Frustum::getCorners(glm::vec3 corners[8]) const
+	{
+		// Intersection point of three planes, see e.g. "Real-Time Rendering", "Intersection of three planes"
+		const auto getIntersectionPoint = [](const Plane& plane0, const Plane& plane1, const Plane& plane2)
+		{
+			const glm::vec3 cross12 = glm::cross(plane1.normal, plane2.normal);
+			const glm::vec3 cross20 = glm::cross(plane2.normal, plane0.normal);
+			const glm::vec3 cross01 = glm::cross(plane0.normal, plane1.normal);
+			return (cross12 * -plane0.d + cross20 * -plane1.d + cross01 * -plane2.d) / glm::dot(plane0.normal, cross12);
+		};
+		for (int i = 0; i < 2; ++i)
+		{
+			const Plane& depthPlane = planes[(0 == i) ? PLANE_NEAR : PLANE_FAR];
+			corners[i * 4 + 0] = getIntersectionPoint(depthPlane, planes[PLANE_LEFT],  planes[PLANE_TOP]);		// Top left
+			corners[i * 4 + 1] = getIntersectionPoint(depthPlane, planes[PLANE_RIGHT], planes[PLANE_TOP]);		// Top right
+			corners[i * 4 + 2] = getIntersectionPoint(depthPlane, planes[PLANE_LEFT],  planes[PLANE_BOTTOM]);	// Bottom left
+			corners[i * 4 + 3] = getIntersectionPoint(depthPlane, planes[PLANE_RIGHT], planes[PLANE_BOTTOM]);	// Bottom right
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -92,6 +92,22 @@ namespace Renderer
 		*/
 		RENDERER_API_EXPORT explicit Frustum(const glm::mat4& matrix);
 
+		/**
+		*  @brief
+		*    Constructor creating a conservative frustum enclosing two frustums
+		*
+		*  @param[in] frustum0
+		*    First frustum to enclose, usually the left eye frustum of single pass stereo rendering
+		*  @param[in] frustum1
+		*    Second frustum to enclose, usually the right eye frustum of single pass stereo rendering
+		*
+		*  @remarks
+		*    For each plane, the plane of the frustum which needs to be moved the least to enclose the other frustum is used.
+		*    Intended for frustums with roughly the same orientation, for frustums with very different orientations the result
+		*    is still enclosing both frustums but isn't tight.
+		*/
+		RENDERER_API_EXPORT Frustum(const Frustum& frustum0, const Frustum& frustum1);
+
 		/**
 		*  @brief
 		*    Destructor
@@ -101,6 +117,30 @@ namespace Renderer
 			// Nothing here
 		}
 
+		/**
+		*  @brief
+		*    Widen the frustum so it encloses the frustum rotated around its apex by up to the given angle
+		*
+		*  @param[in] apex
+		*    Apex of the perspective frustum, for example the camera position, the rotated planes keep passing through it
+		*  @param[in] angle
+		*    Maximum rotation angle in radians
+		*
+		*  @note
+		*    - The left, right, top and bottom planes are rotated outwards by at least "angle", more for wide fields of view since rotations move the frustum corners further
+		*    - The near plane is moved into the apex and the far plane outwards
+		*/
+		RENDERER_API_EXPORT void widen(const glm::vec3& apex, float angle);
+
+		/**
+		*  @brief
+		*    Return the eight frustum corners
+		*
+		*  @param[out] corners
+		*    Receives the four near plane corners followed by the four far plane corners
+		*/
+		RENDERER_API_EXPORT void getCorners(glm::vec3 corners[8]) const;
+
 
 	};
 
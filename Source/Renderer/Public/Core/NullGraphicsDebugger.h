@@ -0,0 +1,109 @@
+/*********************************************************\
+ * Copyright (c) 2012-2021 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+#ifdef RENDERER_GRAPHICS_DEBUGGER
+
+
+	//[-------------------------------------------------------]
+	//[ Includes                                              ]
+	//[-------------------------------------------------------]
+	#include "Renderer/Public/Core/IGraphicsDebugger.h"
+
+
+	//[-------------------------------------------------------]
+	//[ Namespace                                             ]
+	//[-------------------------------------------------------]
+	namespace Renderer
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Classes                                               ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Null graphics debugger implementation doing nothing
+		*
+		*  @remarks
+		*    For tools without a window to capture, e.g. offline pipeline state object cache generation or benchmarks
+		*/
+		class NullGraphicsDebugger final : public IGraphicsDebugger
+		{
+
+
+		//[-------------------------------------------------------]
+		//[ Public methods                                        ]
+		//[-------------------------------------------------------]
+		public:
+			inline NullGraphicsDebugger()
+			{
+				// Nothing here
+			}
+
+			inline virtual ~NullGraphicsDebugger() override
+			{
+				// Nothing here
+			}
+
+
+		//[-------------------------------------------------------]
+		//[ Public virtual Renderer::IGraphicsDebugger methods    ]
+		//[-------------------------------------------------------]
+		public:
+			[[nodiscard]] inline virtual bool isInitialized() const override
+			{
+				return false;
+			}
+
+			inline virtual void startFrameCapture(Rhi::handle) override
+			{
+				// Nothing here
+			}
+
+			inline virtual void endFrameCapture(Rhi::handle) override
+			{
+				// Nothing here
+			}
+
+
+		//[-------------------------------------------------------]
+		//[ Private methods                                       ]
+		//[-------------------------------------------------------]
+		private:
+			explicit NullGraphicsDebugger(const NullGraphicsDebugger&) = delete;
+			NullGraphicsDebugger& operator=(const NullGraphicsDebugger&) = delete;
+
+
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Namespace                                             ]
+	//[-------------------------------------------------------]
+	} // Renderer
+
+
+#endif
@@ -0,0 +1,114 @@
+/*********************************************************\
+ * Copyright (c) 2012-2021 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+#ifdef RENDERER_PROFILER
+
+
+	//[-------------------------------------------------------]
+	//[ Includes                                              ]
+	//[-------------------------------------------------------]
+	#include "Renderer/Public/Core/IProfiler.h"
+
+
+	//[-------------------------------------------------------]
+	//[ Namespace                                             ]
+	//[-------------------------------------------------------]
+	namespace Renderer
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Classes                                               ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Null profiler implementation doing nothing
+		*
+		*  @remarks
+		*    For tools which don't want to pull in a profiler backend or which don't want profiler samples to end up inside their measurements
+		*/
+		class NullProfiler final : public IProfiler
+		{
+
+
+		//[-------------------------------------------------------]
+		//[ Public methods                                        ]
+		//[-------------------------------------------------------]
+		public:
+			inline NullProfiler()
+			{
+				// Nothing here
+			}
+
+			inline virtual ~NullProfiler() override
+			{
+				// Nothing here
+			}
+
+
+		//[-------------------------------------------------------]
+		//[ Public virtual Renderer::IProfiler methods            ]
+		//[-------------------------------------------------------]
+		public:
+			inline virtual void beginCpuSample(const char*, uint32_t*) override
+			{
+				// Nothing here
+			}
+
+			inline virtual void endCpuSample() override
+			{
+				// Nothing here
+			}
+
+			inline virtual void beginGpuSample(const char*, uint32_t*) override
+			{
+				// Nothing here
+			}
+
+			inline virtual void endGpuSample() override
+			{
+				// Nothing here
+			}
+
+
+		//[-------------------------------------------------------]
+		//[ Private methods                                       ]
+		//[-------------------------------------------------------]
+		private:
+			explicit NullProfiler(const NullProfiler&) = delete;
+			NullProfiler& operator=(const NullProfiler&) = delete;
+
+
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Namespace                                             ]
+	//[-------------------------------------------------------]
+	} // Renderer
+
+
+#endif
@@ -30,6 +30,14 @@
 #include "Renderer/Public/Core/Manager.h"
 #include "Renderer/Public/Core/GetInvalid.h"
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#include <vector>
+PRAGMA_WARNING_POP
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -45,10 +53,16 @@ namespace Renderer
 	*  @brief
 	*    Packed element manager template
 	*
+	*  @remarks
+	*    The elements are tightly packed for fast iteration, removing an element moves the last element into the gap. Elements are stored
+	*    inside pages of "NUMBER_OF_ELEMENTS_PER_PAGE" elements which are allocated on demand, so growing never moves elements around and
+	*    memory usage is proportional to the number of elements. An ID consists of a 24 bit index into the index table and an 8 bit
+	*    generation which is incremented each time an index table slot is reused, so stale IDs are detected.
+	*
 	*  @note
 	*    - Basing on "Managing Decoupling Part 4 -- The ID Lookup Table" https://github.com/niklasfrykholm/blog/blob/master/2011/managing-decoupling-4.md by Niklas Frykholm ( http://www.frykholm.se/ )
 	*/
-	template <class ELEMENT_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS>
+	template <class ELEMENT_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_PAGE>
 	class PackedElementManager final : private Manager
 	{
 
@@ -59,22 +73,23 @@ namespace Renderer
 	public:
 		inline PackedElementManager() :
 			mNumberOfElements(0),
-			mFreeListEnqueue(MAXIMUM_NUMBER_OF_ELEMENTS - 1),
-			mFreeListDequeue(0)
+			mFreeListEnqueue(INVALID_INDEX),
+			mFreeListDequeue(INVALID_INDEX),
+			mNumberOfFreeIndices(0)
 		{
-			for (uint32_t i = 0; i < MAXIMUM_NUMBER_OF_ELEMENTS; ++i)
-			{
-				mIndices[i].id = i;
-				mIndices[i].next = static_cast<uint16_t>(i + 1);
-			}
+			static_assert(NUMBER_OF_ELEMENTS_PER_PAGE > 0 && (NUMBER_OF_ELEMENTS_PER_PAGE & (NUMBER_OF_ELEMENTS_PER_PAGE - 1)) == 0, "The number of elements per page must be a power of two");
 		}
 
 		inline ~PackedElementManager()
 		{
 			// If there are any elements left alive, smash them
-			for (size_t i = 0; i < mNumberOfElements; ++i)
+			for (uint32_t i = 0; i < mNumberOfElements; ++i)
+			{
+				getElementByIndex(i).deinitializeElement();
+			}
+			for (ELEMENT_TYPE* page : mPages)
 			{
-				mElements[i].deinitializeElement();
+				delete [] page;
 			}
 		}
 
@@ -85,15 +100,15 @@ namespace Renderer
 
 		[[nodiscard]] inline ELEMENT_TYPE& getElementByIndex(uint32_t index) const
 		{
-			return mElements[index];
+			return mPages[index / NUMBER_OF_ELEMENTS_PER_PAGE][index % NUMBER_OF_ELEMENTS_PER_PAGE];
 		}
 
 		[[nodiscard]] inline bool isElementIdValid(ID_TYPE id) const
 		{
-			if (isValid(id))
+			if (isValid(id) && (id & INDEX_MASK) < mIndices.size())
 			{
 				const Index& index = mIndices[id & INDEX_MASK];
-				return (index.id == id && index.index != USHRT_MAX);
+				return (index.id == id && index.index != INVALID_INDEX);
 			}
 			return false;
 		}
@@ -101,41 +116,59 @@ namespace Renderer
 		[[nodiscard]] inline ELEMENT_TYPE& getElementById(ID_TYPE id) const
 		{
 			ASSERT(isElementIdValid(id), "Invalid ID")
-			return mElements[mIndices[id & INDEX_MASK].index];
+			return getElementByIndex(mIndices[id & INDEX_MASK].index);
 		}
 
 		[[nodiscard]] inline ELEMENT_TYPE* tryGetElementById(ID_TYPE id) const
 		{
-			if (isValid(id))
-			{
-				const Index& index = mIndices[id & INDEX_MASK];
-				return (index.id == id && index.index != USHRT_MAX) ? &mElements[index.index] : nullptr;
-			}
-			return nullptr;
+			return isElementIdValid(id) ? &getElementByIndex(mIndices[id & INDEX_MASK].index) : nullptr;
 		}
 
-		[[nodiscard]] inline ELEMENT_TYPE& addElement()
+		[[nodiscard]] ELEMENT_TYPE& addElement()
 		{
-			ASSERT((mNumberOfElements + 1) < MAXIMUM_NUMBER_OF_ELEMENTS, "Fixed build in packed element manager capacity exceeded")
-			Index& index = mIndices[mFreeListDequeue];
-			mFreeListDequeue = index.next;
+			// Reuse an index table slot only if there are enough free ones, this delays the reuse of a slot so the generation doesn't wrap around too fast
+			uint32_t indexTableSlot = INVALID_INDEX;
+			if (mNumberOfFreeIndices > MINIMUM_NUMBER_OF_FREE_INDICES)
+			{
+				indexTableSlot = mFreeListDequeue;
+				mFreeListDequeue = mIndices[indexTableSlot].next;
+				if (INVALID_INDEX == mFreeListDequeue)
+				{
+					mFreeListEnqueue = INVALID_INDEX;
+				}
+				--mNumberOfFreeIndices;
+			}
+			else
+			{
+				ASSERT(mIndices.size() < INDEX_MASK, "Packed element manager capacity exceeded")
+				indexTableSlot = static_cast<uint32_t>(mIndices.size());
+				mIndices.push_back({ static_cast<ID_TYPE>(indexTableSlot), INVALID_INDEX, INVALID_INDEX });
+			}
+			Index& index = mIndices[indexTableSlot];
 			index.id += NEW_OBJECT_ID_ADD;
-			index.index = static_cast<uint16_t>(mNumberOfElements++);
+			index.index = mNumberOfElements++;
+
+			// Allocate a new page, if necessary
+			if (index.index / NUMBER_OF_ELEMENTS_PER_PAGE == mPages.size())
+			{
+				mPages.push_back(new ELEMENT_TYPE[NUMBER_OF_ELEMENTS_PER_PAGE]);
+			}
 
 			// Initialize the added element
 			// -> "placement new" ("new (static_cast<void*>(&element)) ELEMENT_TYPE(index.id);") is not used by intent to avoid some nasty STL issues
-			ELEMENT_TYPE& element = mElements[index.index];
+			ELEMENT_TYPE& element = getElementByIndex(index.index);
 			element.initializeElement(index.id);
 
 			// Return the added element
 			return element;
 		}
 
-		inline void removeElement(ID_TYPE id)
+		void removeElement(ID_TYPE id)
 		{
 			ASSERT(isElementIdValid(id), "Invalid ID")
-			Index& index = mIndices[id & INDEX_MASK];
-			ELEMENT_TYPE& element = mElements[index.index];
+			const uint32_t indexTableSlot = (id & INDEX_MASK);
+			Index& index = mIndices[indexTableSlot];
+			ELEMENT_TYPE& element = getElementByIndex(index.index);
 
 			// Deinitialize the removed element
 			// -> Calling the destructor ("element.~ELEMENT_TYPE();") is not used by intent to avoid some nasty STL issues
@@ -145,14 +178,30 @@ namespace Renderer
 			// If this is the last element, there's no need to swap it with itself
 			if (index.index != mNumberOfElements)
 			{
-				element = std::move(mElements[mNumberOfElements]);
+				element = std::move(getElementByIndex(mNumberOfElements));
 				mIndices[element.getId() & INDEX_MASK].index = index.index;
 			}
 
 			// Update free list
-			index.index = USHRT_MAX;
-			mIndices[mFreeListEnqueue].next = (id & INDEX_MASK);
-			mFreeListEnqueue = (id & INDEX_MASK);
+			index.index = INVALID_INDEX;
+			index.next = INVALID_INDEX;
+			if (INVALID_INDEX == mFreeListEnqueue)
+			{
+				mFreeListDequeue = indexTableSlot;
+			}
+			else
+			{
+				mIndices[mFreeListEnqueue].next = indexTableSlot;
+			}
+			mFreeListEnqueue = indexTableSlot;
+			++mNumberOfFreeIndices;
+
+			// Release the last page as soon as the last two pages are unused, keeping one spare page avoids page allocation ping-pong
+			while (mPages.size() > 1 && mNumberOfElements <= (mPages.size() - 2) * NUMBER_OF_ELEMENTS_PER_PAGE)
+			{
+				delete [] mPages.back();
+				mPages.pop_back();
+			}
 		}
 
 
@@ -168,26 +217,31 @@ namespace Renderer
 	//[ Private definitions                                   ]
 	//[-------------------------------------------------------]
 	private:
-		static constexpr uint32_t INDEX_MASK		= 0xffff;
-		static constexpr uint32_t NEW_OBJECT_ID_ADD	= 0x10000;
+		static constexpr uint32_t INDEX_MASK					 = 0x00ffffff;	///< Lower 24 bit of an ID are the index table slot, the maximum value is reserved so an ID can never be invalid
+		static constexpr uint32_t NEW_OBJECT_ID_ADD				 = 0x01000000;	///< Upper 8 bit of an ID are the generation
+		static constexpr uint32_t INVALID_INDEX					 = ~0u;
+		static constexpr uint32_t MINIMUM_NUMBER_OF_FREE_INDICES = 1024;
 
 		struct Index final
 		{
 			ID_TYPE  id;
-			uint16_t index;
-			uint16_t next;
+			uint32_t index;	///< Index of the element, "INVALID_INDEX" if the index table slot is free
+			uint32_t next;	///< Next free index table slot
 		};
+		typedef std::vector<Index>		   Indices;
+		typedef std::vector<ELEMENT_TYPE*> Pages;
 
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		uint32_t			 mNumberOfElements;
-		mutable ELEMENT_TYPE mElements[MAXIMUM_NUMBER_OF_ELEMENTS];
-		Index				 mIndices[MAXIMUM_NUMBER_OF_ELEMENTS];
-		uint16_t			 mFreeListEnqueue;
-		uint16_t			 mFreeListDequeue;
+		uint32_t mNumberOfElements;
+		Pages	 mPages;				///< Element pages, each page holds "NUMBER_OF_ELEMENTS_PER_PAGE" elements
+		Indices	 mIndices;
+		uint32_t mFreeListEnqueue;
+		uint32_t mFreeListDequeue;
+		uint32_t mNumberOfFreeIndices;
 
 
 	};
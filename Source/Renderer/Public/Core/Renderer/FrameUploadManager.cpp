@@ -0,0 +1,196 @@
+/*********************************************************\
+ * Copyright (c) 2012-2021 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/Core/Renderer/FrameUploadManager.h"
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	FrameUploadManager::~FrameUploadManager()
+	{
+		// Sanity check
+		RHI_ASSERT(mRhi.getContext(), !mDeferred, "Frame upload manager destroyed while uploads are deferred")
+
+		// Release the references of uploads which haven't been released, yet
+		for (uint32_t frameIndex = 0; frameIndex < NUMBER_OF_FRAMES; ++frameIndex)
+		{
+			releaseUploads(frameIndex);
+		}
+	}
+
+	bool FrameUploadManager::map(Rhi::IResource& resource, uint32_t numberOfBytes, Rhi::MapType mapType, Rhi::MappedSubresource& mappedSubresource)
+	{
+		std::lock_guard<std::mutex> mutexLock(mMutex);
+
+		// Map the RHI resource directly?
+		if (!mDeferred)
+		{
+			return mRhi.map(resource, 0, mapType, 0, mappedSubresource);
+		}
+
+		// Sanity check
+		RHI_ASSERT(mRhi.getContext(), Rhi::MapType::WRITE == mapType || Rhi::MapType::WRITE_DISCARD == mapType || Rhi::MapType::WRITE_NO_OVERWRITE == mapType, "Only write map types are supported while uploads are deferred")
+
+		// Get an upload of the current frame, staging memory of previous frames is reused
+		// -> Growing the uploads vector moves the staging memory vectors, this doesn't change the staging memory addresses handed out for still mapped uploads
+		Uploads& uploads = mUploads[mCurrentFrameIndex];
+		uint32_t& numberOfUploads = mNumberOfUploads[mCurrentFrameIndex];
+		if (uploads.size() == numberOfUploads)
+		{
+			uploads.push_back(Upload{nullptr, mapType, false, 0, {}});
+		}
+		Upload& upload = uploads[numberOfUploads];
+		++numberOfUploads;
+		upload.resource = &resource;
+		upload.mapType = mapType;
+		upload.mapped = true;
+		upload.numberOfBytes = numberOfBytes;
+		if (upload.data.size() < numberOfBytes)
+		{
+			upload.data.resize(numberOfBytes);
+		}
+		resource.addReference();
+
+		// Hand out the staging memory
+		mappedSubresource.data		 = upload.data.data();
+		mappedSubresource.rowPitch	 = 0;
+		mappedSubresource.depthPitch = 0;
+
+		// Done
+		return true;
+	}
+
+	void FrameUploadManager::unmap(Rhi::IResource& resource, uint32_t numberOfWrittenBytes)
+	{
+		std::lock_guard<std::mutex> mutexLock(mMutex);
+
+		// Unmap the RHI resource directly?
+		if (!mDeferred)
+		{
+			mRhi.unmap(resource, 0);
+			return;
+		}
+
+		// Search backwards since usually the most recently mapped RHI resource is unmapped
+		Uploads& uploads = mUploads[mCurrentFrameIndex];
+		for (uint32_t i = mNumberOfUploads[mCurrentFrameIndex]; i > 0; --i)
+		{
+			Upload& upload = uploads[i - 1];
+			if (upload.mapped && upload.resource == &resource)
+			{
+				RHI_ASSERT(mRhi.getContext(), isInvalid(numberOfWrittenBytes) || numberOfWrittenBytes <= upload.numberOfBytes, "Invalid number of written bytes")
+				if (isValid(numberOfWrittenBytes))
+				{
+					upload.numberOfBytes = numberOfWrittenBytes;
+				}
+				upload.mapped = false;
+				return;
+			}
+		}
+
+		// Error!
+		RHI_ASSERT(mRhi.getContext(), false, "The RHI resource to unmap isn't mapped")
+	}
+
+	void FrameUploadManager::beginDeferredUploads()
+	{
+		// Sanity checks
+		RHI_ASSERT(mRhi.getContext(), !mDeferred, "Uploads are already deferred")
+		RHI_ASSERT(mRhi.getContext(), !mPendingFrames[mCurrentFrameIndex], "The uploads of the current frame haven't been released, yet")
+
+		// Collect uploads inside the staging memory of the current frame
+		mDeferred = true;
+	}
+
+	uint32_t FrameUploadManager::endDeferredUploads()
+	{
+		// Sanity checks
+		RHI_ASSERT(mRhi.getContext(), mDeferred, "Uploads aren't deferred")
+		#ifdef RHI_DEBUG
+			for (uint32_t i = 0; i < mNumberOfUploads[mCurrentFrameIndex]; ++i)
+			{
+				RHI_ASSERT(mRhi.getContext(), !mUploads[mCurrentFrameIndex][i].mapped, "There's still a mapped RHI resource")
+			}
+		#endif
+
+		// The collected uploads are pending until they have been released, switch to the staging memory of the next frame
+		const uint32_t frameIndex = mCurrentFrameIndex;
+		mPendingFrames[frameIndex] = true;
+		mCurrentFrameIndex = (frameIndex + 1) % NUMBER_OF_FRAMES;
+		mDeferred = false;
+
+		// Done
+		return frameIndex;
+	}
+
+	void FrameUploadManager::performUploads(uint32_t frameIndex) const
+	{
+		// Sanity check
+		RHI_ASSERT(mRhi.getContext(), frameIndex < NUMBER_OF_FRAMES && mPendingFrames[frameIndex], "Invalid frame index")
+
+		// Upload the staging memory in the order the RHI resources were mapped
+		const Uploads& uploads = mUploads[frameIndex];
+		const uint32_t numberOfUploads = mNumberOfUploads[frameIndex];
+		for (uint32_t i = 0; i < numberOfUploads; ++i)
+		{
+			const Upload& upload = uploads[i];
+			Rhi::MappedSubresource mappedSubresource;
+			if (mRhi.map(*upload.resource, 0, upload.mapType, 0, mappedSubresource))
+			{
+				memcpy(mappedSubresource.data, upload.data.data(), upload.numberOfBytes);
+				mRhi.unmap(*upload.resource, 0);
+			}
+		}
+	}
+
+	void FrameUploadManager::releaseUploads(uint32_t frameIndex)
+	{
+		// Sanity check
+		RHI_ASSERT(mRhi.getContext(), frameIndex < NUMBER_OF_FRAMES, "Invalid frame index")
+
+		// Release the RHI resource references, keep the staging memory for the next frames
+		Uploads& uploads = mUploads[frameIndex];
+		const uint32_t numberOfUploads = mNumberOfUploads[frameIndex];
+		for (uint32_t i = 0; i < numberOfUploads; ++i)
+		{
+			Upload& upload = uploads[i];
+			upload.resource->releaseReference();
+			upload.resource = nullptr;
+		}
+		mNumberOfUploads[frameIndex] = 0;
+		mPendingFrames[frameIndex] = false;
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
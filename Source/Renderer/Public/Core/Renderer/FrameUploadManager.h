@@ -0,0 +1,210 @@
+/*********************************************************\
+ * Copyright (c) 2012-2021 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/Core/Manager.h"
+#include "Renderer/Public/Core/GetInvalid.h"
+
+#include <Rhi/Public/Rhi.h>
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#include <mutex>
+	#include <vector>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Frame upload manager, maps RHI resources for writing either directly or by using frame-indexed staging memory
+	*
+	*  @remarks
+	*    Dynamic per-frame data like pass, instance, indirect or light buffers is written through this manager instead of directly through "Rhi::IRhi::map()".
+	*    By default the RHI resource is mapped directly. With pipelined rendering the calling thread fills the command buffer of frame N+1 while the
+	*    render thread is still dispatching frame N, so the RHI context mustn't be used for mapping by the calling thread. In this case the written data
+	*    is collected in staging memory of the current frame and the render thread performs the real uploads just before dispatching the command buffer.
+	*    Usage example:
+	*    @code
+	*    frameUploadManager.beginDeferredUploads();
+	*    // ... fill the command buffer, the buffer managers use "Renderer::FrameUploadManager::map()" and "Renderer::FrameUploadManager::unmap()"...
+	*    const uint32_t frameIndex = frameUploadManager.endDeferredUploads();
+	*    // Render thread: "frameUploadManager.performUploads(frameIndex)" followed by the command buffer dispatch
+	*    // Calling thread, after the render thread has finished: "frameUploadManager.releaseUploads(frameIndex)"
+	*    @endcode
+	*
+	*  @note
+	*    - There's staging memory for two frames: One frame is filled by the calling thread while the render thread uploads the other one
+	*    - Each RHI resource must be mapped at most once per frame, all deferred uploads are performed before the command buffer is dispatched
+	*    - Only write map types are supported while uploads are deferred, deferred mapped subresources have no row and depth pitch (tightly packed data)
+	*    - Mapping and unmapping is thread-safe so render queue command recording jobs can fill their own buffers, the other methods must be called by a single thread
+	*/
+	class FrameUploadManager final : private Manager
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static constexpr uint32_t NUMBER_OF_FRAMES = 2;	///< Number of frames with staging memory
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		inline explicit FrameUploadManager(Rhi::IRhi& rhi) :
+			mRhi(rhi),
+			mDeferred(false),
+			mCurrentFrameIndex(0),
+			mNumberOfUploads{},
+			mPendingFrames{}
+		{
+			// Nothing here
+		}
+
+		~FrameUploadManager();
+		explicit FrameUploadManager(const FrameUploadManager&) = delete;
+		FrameUploadManager& operator=(const FrameUploadManager&) = delete;
+
+		[[nodiscard]] inline bool isDeferred() const
+		{
+			return mDeferred;
+		}
+
+		/**
+		*  @brief
+		*    Map a RHI resource for writing
+		*
+		*  @param[in] resource
+		*    RHI resource to map, while uploads are deferred we keep a reference to it until the upload has been released
+		*  @param[in] numberOfBytes
+		*    Number of bytes which will be written, starting at the beginning of the resource
+		*  @param[in] mapType
+		*    Map type, must be a write map type while uploads are deferred
+		*  @param[out] mappedSubresource
+		*    Receives the mapped subresource information
+		*
+		*  @return
+		*    "true" if all went fine, else "false"
+		*/
+		[[nodiscard]] bool map(Rhi::IResource& resource, uint32_t numberOfBytes, Rhi::MapType mapType, Rhi::MappedSubresource& mappedSubresource);
+
+		/**
+		*  @brief
+		*    Unmap a RHI resource previously mapped by "Renderer::FrameUploadManager::map()"
+		*
+		*  @param[in] resource
+		*    RHI resource to unmap
+		*  @param[in] numberOfWrittenBytes
+		*    Number of bytes which were actually written, starting at the beginning of the resource, "Renderer::getInvalid<uint32_t>()" if all mapped bytes were written, only used while uploads are deferred
+		*/
+		void unmap(Rhi::IResource& resource, uint32_t numberOfWrittenBytes = getInvalid<uint32_t>());
+
+		/**
+		*  @brief
+		*    Start collecting the uploads of the current frame inside staging memory instead of mapping RHI resources directly
+		*/
+		void beginDeferredUploads();
+
+		/**
+		*  @brief
+		*    Stop collecting uploads and switch to the staging memory of the next frame
+		*
+		*  @return
+		*    Index of the frame containing the collected uploads, to be passed to "Renderer::FrameUploadManager::performUploads()" and "Renderer::FrameUploadManager::releaseUploads()"
+		*/
+		[[nodiscard]] uint32_t endDeferredUploads();
+
+		/**
+		*  @brief
+		*    Perform the collected uploads of a frame by using the RHI, must be called by the thread which dispatches the command buffer of the frame
+		*
+		*  @param[in] frameIndex
+		*    Frame index returned by "Renderer::FrameUploadManager::endDeferredUploads()"
+		*/
+		void performUploads(uint32_t frameIndex) const;
+
+		/**
+		*  @brief
+		*    Release the collected uploads of a frame, must be called by the calling thread after the uploads have been performed
+		*
+		*  @param[in] frameIndex
+		*    Frame index returned by "Renderer::FrameUploadManager::endDeferredUploads()"
+		*/
+		void releaseUploads(uint32_t frameIndex);
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		struct Upload final
+		{
+			Rhi::IResource*		 resource;		///< We keep a reference to it, can be a null pointer if the upload is unused
+			Rhi::MapType		 mapType;
+			bool				 mapped;
+			uint32_t			 numberOfBytes;	///< Number of bytes to upload
+			std::vector<uint8_t> data;			///< Staging memory, only grows so the staging memory is reused in later frames
+		};
+		typedef std::vector<Upload> Uploads;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		Rhi::IRhi& mRhi;
+		bool	   mDeferred;							///< Are uploads currently collected inside staging memory?
+		uint32_t   mCurrentFrameIndex;					///< Index of the frame whose staging memory is used while uploads are deferred
+		Uploads	   mUploads[NUMBER_OF_FRAMES];			///< Per frame uploads, only the first "mNumberOfUploads" uploads are used
+		uint32_t   mNumberOfUploads[NUMBER_OF_FRAMES];
+		bool	   mPendingFrames[NUMBER_OF_FRAMES];	///< Frames whose uploads haven't been released yet
+		std::mutex mMutex;								///< Serializes mapping and unmapping, the RHI context used for direct mapping isn't thread-safe
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
@@ -152,77 +152,21 @@ namespace Renderer
 				// Do we need to create the RHI texture instance right now?
 				if (nullptr == renderTargetTextureElement.texture)
 				{
-					// Get the texture width and height and apply resolution scale in case the main compositor workspace render target is used
-					uint32_t width = renderTargetTextureSignature.getWidth();
-					uint32_t height = renderTargetTextureSignature.getHeight();
-					if (isInvalid(width) || isInvalid(height))
+					if (isValid(renderTargetTextureElement.aliasedIndex))
 					{
-						uint32_t renderTargetWidth = 1;
-						uint32_t renderTargetHeight = 1;
-						renderTarget.getWidthAndHeight(renderTargetWidth, renderTargetHeight);
-						if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::ALLOW_RESOLUTION_SCALE) == 0)
+						// Share the RHI texture of the aliased render target texture, create it if required
+						RenderTargetTextureElement& aliasedRenderTargetTextureElement = mSortedRenderTargetTextureVector[renderTargetTextureElement.aliasedIndex];
+						if (nullptr == aliasedRenderTargetTextureElement.texture)
 						{
-							resolutionScale = 1.0f;
+							createRhiTexture(aliasedRenderTargetTextureElement, renderTarget, numberOfMultisamples, resolutionScale);
 						}
-						if (isInvalid(width))
-						{
-							width = static_cast<uint32_t>(static_cast<float>(renderTargetWidth) * resolutionScale * renderTargetTextureSignature.getWidthScale());
-							if (width < 1)
-							{
-								width = 1;
-							}
-						}
-						if (isInvalid(height))
-						{
-							height = static_cast<uint32_t>(static_cast<float>(renderTargetHeight) * resolutionScale * renderTargetTextureSignature.getHeightScale());
-							if (height < 1)
-							{
-								height = 1;
-							}
-						}
-					}
-
-					// Get texture flags
-					uint32_t textureFlags = 0;
-					if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::UNORDERED_ACCESS) != 0)
-					{
-						textureFlags |= Rhi::TextureFlag::UNORDERED_ACCESS;
-					}
-					if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::SHADER_RESOURCE) != 0)
-					{
-						textureFlags |= Rhi::TextureFlag::SHADER_RESOURCE;
+						renderTargetTextureElement.texture = aliasedRenderTargetTextureElement.texture;
+						renderTargetTextureElement.texture->addReference();
+						setTextureResource(assetId, *renderTargetTextureElement.texture);
 					}
-					if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::RENDER_TARGET) != 0)
+					else
 					{
-						textureFlags |= Rhi::TextureFlag::RENDER_TARGET;
-					}
-					if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::GENERATE_MIPMAPS) != 0)
-					{
-						textureFlags |= Rhi::TextureFlag::GENERATE_MIPMAPS;
-						textureFlags |= Rhi::TextureFlag::RENDER_TARGET;	// Needed when generating mipmaps
-					}
-
-					// Create the texture instance, but without providing texture data (we use the texture as render target)
-					// -> Use the "Rhi::TextureFlag::RENDER_TARGET"-flag to mark this texture as a render target
-					// -> Required for Vulkan, Direct3D 9, Direct3D 10, Direct3D 11 and Direct3D 12
-					// -> Not required for OpenGL and OpenGL ES 3
-					// -> The optimized texture clear value is a Direct3D 12 related option
-					renderTargetTextureElement.texture = mRenderer.getTextureManager().createTexture2D(width, height, renderTargetTextureSignature.getTextureFormat(), nullptr, textureFlags, Rhi::TextureUsage::DEFAULT, (((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::ALLOW_MULTISAMPLE) != 0) ? numberOfMultisamples : 1u), nullptr RHI_RESOURCE_DEBUG_NAME("Render target texture manager"));
-					renderTargetTextureElement.texture->addReference();
-
-					{ // Tell the texture resource manager about our render target texture so it can be referenced inside e.g. compositor nodes
-						TextureResourceManager& textureResourceManager = mRenderer.getTextureResourceManager();
-						TextureResource* textureResource = textureResourceManager.getTextureResourceByAssetId(assetId);
-						if (nullptr == textureResource)
-						{
-							// Create texture resource
-							textureResourceManager.createTextureResourceByAssetId(assetId, *renderTargetTextureElement.texture);
-						}
-						else
-						{
-							// Update texture resource
-							textureResource->setTexture(renderTargetTextureElement.texture);
-						}
+						createRhiTexture(renderTargetTextureElement, renderTarget, numberOfMultisamples, resolutionScale);
 					}
 				}
 				texture = renderTargetTextureElement.texture;
@@ -244,6 +188,29 @@ namespace Renderer
 		return texture;
 	}
 
+	void RenderTargetTextureManager::setRenderTargetTextureAlias(AssetId assetId, AssetId aliasedAssetId)
+	{
+		AssetIdToIndex::const_iterator iterator = mAssetIdToIndex.find(assetId);
+		AssetIdToIndex::const_iterator aliasedIterator = mAssetIdToIndex.find(aliasedAssetId);
+		if (mAssetIdToIndex.cend() != iterator && mAssetIdToIndex.cend() != aliasedIterator)
+		{
+			// Sanity checks
+			RenderTargetTextureElement& renderTargetTextureElement = mSortedRenderTargetTextureVector[iterator->second];
+			ASSERT(iterator->second != aliasedIterator->second, "A render target texture can't alias itself")
+			ASSERT(nullptr == renderTargetTextureElement.texture, "The RHI texture of the render target texture has already been created")
+			ASSERT(renderTargetTextureElement.renderTargetTextureSignature.getRenderTargetTextureSignatureId() == mSortedRenderTargetTextureVector[aliasedIterator->second].renderTargetTextureSignature.getRenderTargetTextureSignatureId(), "Render target textures with different signatures can't be aliased")
+			ASSERT(isInvalid(mSortedRenderTargetTextureVector[aliasedIterator->second].aliasedIndex), "The aliased render target texture must own its RHI texture")
+
+			// Remember the aliased render target texture
+			renderTargetTextureElement.aliasedIndex = aliasedIterator->second;
+		}
+		else
+		{
+			// Error!
+			ASSERT(false, "Unknown asset ID, this shouldn't have happened")
+		}
+	}
+
 	void RenderTargetTextureManager::releaseRenderTargetTextureBySignature(const RenderTargetTextureSignature& renderTargetTextureSignature)
 	{
 		const RenderTargetTextureElement renderTargetTextureElement(renderTargetTextureSignature);
@@ -283,6 +250,93 @@ namespace Renderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	void RenderTargetTextureManager::createRhiTexture(RenderTargetTextureElement& renderTargetTextureElement, const Rhi::IRenderTarget& renderTarget, uint8_t numberOfMultisamples, float resolutionScale)
+	{
+		const RenderTargetTextureSignature& renderTargetTextureSignature = renderTargetTextureElement.renderTargetTextureSignature;
+
+		// Get the texture width and height and apply resolution scale in case the main compositor workspace render target is used
+		uint32_t width = renderTargetTextureSignature.getWidth();
+		uint32_t height = renderTargetTextureSignature.getHeight();
+		if (isInvalid(width) || isInvalid(height))
+		{
+			uint32_t renderTargetWidth = 1;
+			uint32_t renderTargetHeight = 1;
+			renderTarget.getWidthAndHeight(renderTargetWidth, renderTargetHeight);
+			if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::ALLOW_RESOLUTION_SCALE) == 0)
+			{
+				resolutionScale = 1.0f;
+			}
+			if (isInvalid(width))
+			{
+				width = static_cast<uint32_t>(static_cast<float>(renderTargetWidth) * resolutionScale * renderTargetTextureSignature.getWidthScale());
+				if (width < 1)
+				{
+					width = 1;
+				}
+			}
+			if (isInvalid(height))
+			{
+				height = static_cast<uint32_t>(static_cast<float>(renderTargetHeight) * resolutionScale * renderTargetTextureSignature.getHeightScale());
+				if (height < 1)
+				{
+					height = 1;
+				}
+			}
+		}
+
+		// Get texture flags
+		uint32_t textureFlags = 0;
+		if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::UNORDERED_ACCESS) != 0)
+		{
+			textureFlags |= Rhi::TextureFlag::UNORDERED_ACCESS;
+		}
+		if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::SHADER_RESOURCE) != 0)
+		{
+			textureFlags |= Rhi::TextureFlag::SHADER_RESOURCE;
+		}
+		if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::RENDER_TARGET) != 0)
+		{
+			textureFlags |= Rhi::TextureFlag::RENDER_TARGET;
+		}
+		if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::GENERATE_MIPMAPS) != 0)
+		{
+			textureFlags |= Rhi::TextureFlag::GENERATE_MIPMAPS;
+			textureFlags |= Rhi::TextureFlag::RENDER_TARGET;	// Needed when generating mipmaps
+		}
+
+		// Create the texture instance, but without providing texture data (we use the texture as render target)
+		// -> Use the "Rhi::TextureFlag::RENDER_TARGET"-flag to mark this texture as a render target
+		// -> Required for Vulkan, Direct3D 9, Direct3D 10, Direct3D 11 and Direct3D 12
+		// -> Not required for OpenGL and OpenGL ES 3
+		// -> The optimized texture clear value is a Direct3D 12 related option
+		renderTargetTextureElement.texture = mRenderer.getTextureManager().createTexture2D(width, height, renderTargetTextureSignature.getTextureFormat(), nullptr, textureFlags, Rhi::TextureUsage::DEFAULT, (((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::ALLOW_MULTISAMPLE) != 0) ? numberOfMultisamples : 1u), nullptr RHI_RESOURCE_DEBUG_NAME("Render target texture manager"));
+		renderTargetTextureElement.texture->addReference();
+
+
+		// Tell the texture resource manager about our render target texture so it can be referenced inside e.g. compositor nodes
+		setTextureResource(renderTargetTextureElement.assetId, *renderTargetTextureElement.texture);
+	}
+
+	void RenderTargetTextureManager::setTextureResource(AssetId assetId, Rhi::ITexture& texture)
+	{
+		TextureResourceManager& textureResourceManager = mRenderer.getTextureResourceManager();
+		TextureResource* textureResource = textureResourceManager.getTextureResourceByAssetId(assetId);
+		if (nullptr == textureResource)
+		{
+			// Create texture resource
+			textureResourceManager.createTextureResourceByAssetId(assetId, texture);
+		}
+		else
+		{
+			// Update texture resource
+			textureResource->setTexture(&texture);
+		}
+	}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -80,11 +80,13 @@ namespace Renderer
 			RenderTargetTextureSignature renderTargetTextureSignature;
 			Rhi::ITexture*				 texture;				///< Can be a null pointer, no "Rhi::ITexturePtr" to not have overhead when internally reallocating
 			uint32_t					 numberOfReferences;	///< Number of texture references (don't misuse the RHI texture reference counter for this)
+			uint32_t					 aliasedIndex;			///< Index of the render target texture element whose RHI texture is shared, "Renderer::getInvalid<uint32_t>()" if the element owns its RHI texture
 
 			inline RenderTargetTextureElement() :
 				assetId(getInvalid<AssetId>()),
 				texture(nullptr),
-				numberOfReferences(0)
+				numberOfReferences(0),
+				aliasedIndex(getInvalid<uint32_t>())
 			{
 				// Nothing here
 			}
@@ -93,7 +95,8 @@ namespace Renderer
 				assetId(getInvalid<AssetId>()),
 				renderTargetTextureSignature(_renderTargetTextureSignature),
 				texture(nullptr),
-				numberOfReferences(0)
+				numberOfReferences(0),
+				aliasedIndex(getInvalid<uint32_t>())
 			{
 				// Nothing here
 			}
@@ -102,7 +105,8 @@ namespace Renderer
 				assetId(_assetId),
 				renderTargetTextureSignature(_renderTargetTextureSignature),
 				texture(nullptr),
-				numberOfReferences(0)
+				numberOfReferences(0),
+				aliasedIndex(getInvalid<uint32_t>())
 			{
 				// Nothing here
 			}
@@ -111,7 +115,8 @@ namespace Renderer
 				assetId(_assetId),
 				renderTargetTextureSignature(_renderTargetTextureSignature),
 				texture(&_texture),
-				numberOfReferences(0)
+				numberOfReferences(0),
+				aliasedIndex(getInvalid<uint32_t>())
 			{
 				// Nothing here
 			}
@@ -145,9 +150,32 @@ namespace Renderer
 		void clearRhiResources();
 		void addRenderTargetTexture(AssetId assetId, const RenderTargetTextureSignature& renderTargetTextureSignature);
 		[[nodiscard]] Rhi::ITexture* getTextureByAssetId(AssetId assetId, const Rhi::IRenderTarget& renderTarget, uint8_t numberOfMultisamples, float resolutionScale, const RenderTargetTextureSignature** outRenderTargetTextureSignature);
+
+		/**
+		*  @brief
+		*    Let a render target texture share the RHI texture of another render target texture
+		*
+		*  @param[in] assetId
+		*    Asset ID of the render target texture which should use the RHI texture of the other render target texture
+		*  @param[in] aliasedAssetId
+		*    Asset ID of the render target texture owning the shared RHI texture, must have the same render target texture signature
+		*
+		*  @note
+		*    - Used by the compositor workspace instance for transient render target textures whose lifetimes inside a frame don't overlap
+		*    - Must be called before the RHI textures are created, the aliasing survives "Renderer::RenderTargetTextureManager::clearRhiResources()"
+		*/
+		void setRenderTargetTextureAlias(AssetId assetId, AssetId aliasedAssetId);
 		void releaseRenderTargetTextureBySignature(const RenderTargetTextureSignature& renderTargetTextureSignature);
 
 
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		void createRhiTexture(RenderTargetTextureElement& renderTargetTextureElement, const Rhi::IRenderTarget& renderTarget, uint8_t numberOfMultisamples, float resolutionScale);
+		void setTextureResource(AssetId assetId, Rhi::ITexture& texture);
+
+
 	//[-------------------------------------------------------]
 	//[ Private definitions                                   ]
 	//[-------------------------------------------------------]
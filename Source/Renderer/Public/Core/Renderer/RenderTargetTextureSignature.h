@@ -68,7 +68,8 @@ namespace Renderer
 				RENDER_TARGET          = 1u << 2u,	///< This texture can be used as framebuffer object (FBO) attachment render target
 				ALLOW_MULTISAMPLE      = 1u << 3u,	///< Allow multisample
 				GENERATE_MIPMAPS       = 1u << 4u,	///< Generate mipmaps
-				ALLOW_RESOLUTION_SCALE = 1u << 5u	///< Allow resolution scale
+				ALLOW_RESOLUTION_SCALE = 1u << 5u,	///< Allow resolution scale
+				TRANSIENT              = 1u << 6u	///< The content is only needed inside a frame and only referenced by compositor passes (framebuffers, compute pass material properties, copy, generate mipmaps and resolve multisample passes), allows the compositor workspace to share the texture with other transient render target textures whose lifetimes don't overlap
 			};
 		};
 
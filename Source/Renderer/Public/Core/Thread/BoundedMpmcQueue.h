@@ -0,0 +1,232 @@
+/*********************************************************\
+ * Copyright (c) 2012-2021 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/Core/Platform/PlatformTypes.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'return': conversion from 'int' to 'std::char_traits<wchar_t>::int_type', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4623)	// warning C4623: 'std::_UInt_is_zero': default constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::_UInt_is_zero': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_UInt_is_zero': move assignment operator was implicitly defined as deleted
+	#include <atomic>	// For "std::atomic<>"
+	#include <cstdint>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Bounded lock-free multiple producer multiple consumer (MPMC) queue
+	*
+	*  @remarks
+	*    Based on "Bounded MPMC queue" by Dmitry Vyukov - http://www.1024cores.net/home/lock-free-algorithms/queues/bounded-mpmc-queue
+	*    Each cell carries a sequence number telling producers and consumers whether or not the cell is ready for them, so pushing
+	*    and popping is a single compare-and-swap on the enqueue respectively dequeue position in the common case.
+	*
+	*  @note
+	*    - The element type must be default constructible and copy assignable
+	*    - The capacity is fixed, pushing into a full queue fails instead of blocking, it's up to the caller how to handle this
+	*/
+	template <typename TYPE, uint32_t CAPACITY>
+	class BoundedMpmcQueue final
+	{
+		static_assert(CAPACITY >= 2 && 0 == (CAPACITY & (CAPACITY - 1)), "The bounded MPMC queue capacity must be a power of two and at least two");
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		inline BoundedMpmcQueue() :
+			mEnqueuePosition(0),
+			mDequeuePosition(0)
+		{
+			for (uint32_t i = 0; i < CAPACITY; ++i)
+			{
+				mCells[i].sequence.store(i, std::memory_order_relaxed);
+			}
+		}
+
+		inline ~BoundedMpmcQueue()
+		{
+			// Nothing here
+		}
+
+		[[nodiscard]] inline uint32_t getCapacity() const
+		{
+			return CAPACITY;
+		}
+
+		/**
+		*  @brief
+		*    Return whether or not the queue is empty
+		*
+		*  @return
+		*    "true" if the queue is empty, else "false"
+		*
+		*  @note
+		*    - Only a snapshot, other threads might push or pop at the same time
+		*/
+		[[nodiscard]] inline bool isEmpty() const
+		{
+			return (mEnqueuePosition.load(std::memory_order_acquire) == mDequeuePosition.load(std::memory_order_acquire));
+		}
+
+		/**
+		*  @brief
+		*    Try to push an element, thread-safe
+		*
+		*  @param[in] value
+		*    Element to push
+		*
+		*  @return
+		*    "true" if the element has been pushed, "false" if the queue is full
+		*/
+		[[nodiscard]] bool tryPush(const TYPE& value)
+		{
+			uint32_t position = mEnqueuePosition.load(std::memory_order_relaxed);
+			for (;;)
+			{
+				Cell& cell = mCells[position & CAPACITY_MASK];
+				const uint32_t sequence = cell.sequence.load(std::memory_order_acquire);
+				const int32_t difference = static_cast<int32_t>(sequence - position);
+				if (0 == difference)
+				{
+					// The cell is free, try to claim it
+					if (mEnqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					{
+						cell.value = value;
+						cell.sequence.store(position + 1, std::memory_order_release);
+						return true;
+					}
+				}
+				else if (difference < 0)
+				{
+					// The cell still holds an element of the previous round: The queue is full
+					return false;
+				}
+				else
+				{
+					// Another producer was faster
+					position = mEnqueuePosition.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+		/**
+		*  @brief
+		*    Try to pop an element, thread-safe
+		*
+		*  @param[out] value
+		*    Receives the popped element, not touched if the queue is empty
+		*
+		*  @return
+		*    "true" if an element has been popped, "false" if the queue is empty
+		*/
+		[[nodiscard]] bool tryPop(TYPE& value)
+		{
+			uint32_t position = mDequeuePosition.load(std::memory_order_relaxed);
+			for (;;)
+			{
+				Cell& cell = mCells[position & CAPACITY_MASK];
+				const uint32_t sequence = cell.sequence.load(std::memory_order_acquire);
+				const int32_t difference = static_cast<int32_t>(sequence - (position + 1));
+				if (0 == difference)
+				{
+					// The cell holds an element, try to claim it
+					if (mDequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					{
+						value = cell.value;
+						cell.sequence.store(position + CAPACITY, std::memory_order_release);
+						return true;
+					}
+				}
+				else if (difference < 0)
+				{
+					// The cell wasn't filled, yet: The queue is empty
+					return false;
+				}
+				else
+				{
+					// Another consumer was faster
+					position = mDequeuePosition.load(std::memory_order_relaxed);
+				}
+			}
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit BoundedMpmcQueue(const BoundedMpmcQueue&) = delete;
+		BoundedMpmcQueue& operator=(const BoundedMpmcQueue&) = delete;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		static constexpr uint32_t CAPACITY_MASK = CAPACITY - 1;
+
+		struct Cell final
+		{
+			std::atomic<uint32_t> sequence;
+			TYPE				  value;
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		Cell							  mCells[CAPACITY];
+		alignas(64) std::atomic<uint32_t> mEnqueuePosition;	///< Producers side, on an own cache line to avoid false sharing
+		alignas(64) std::atomic<uint32_t> mDequeuePosition;	///< Consumers side
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
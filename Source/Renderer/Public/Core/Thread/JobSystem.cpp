@@ -0,0 +1,540 @@
+/*********************************************************\
+ * Copyright (c) 2012-2021 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/Core/Thread/JobSystem.h"
+#include "Renderer/Public/Core/Platform/PlatformManager.h"
+
+// TODO(co) Can we do something about the warning which does not involve using "std::thread"-pointers?
+PRAGMA_WARNING_DISABLE_MSVC(4355)	// warning C4355: 'this': used in base member initializer list
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr uint32_t NUMBER_OF_IDLE_SPINS = 64;	///< Number of yielding spins of an idle worker thread before going to sleep
+
+
+		//[-------------------------------------------------------]
+		//[ Global variables                                      ]
+		//[-------------------------------------------------------]
+		thread_local const Renderer::JobSystem* g_CurrentJobSystem = nullptr;	///< Job system the current thread belongs to, null pointer for threads not known to any job system
+		thread_local uint32_t g_CurrentThreadIndex = 0;							///< Work-stealing queue index of the current thread, only valid if "g_CurrentJobSystem" is valid
+		thread_local uint32_t g_RandomState = 0x9e3779b9u;						///< Xorshift state used to choose the work-stealing victim
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] uint32_t getRandomNumber()
+		{
+			// "Xorshift RNGs" by George Marsaglia - https://www.jstatsoft.org/article/view/v008i14
+			uint32_t x = g_RandomState;
+			x ^= x << 13;
+			x ^= x >> 17;
+			x ^= x << 5;
+			g_RandomState = x;
+			return x;
+		}
+
+		[[nodiscard]] uint32_t roundUpToPowerOfTwo(uint32_t value)
+		{
+			uint32_t result = 1;
+			while (result < value)
+			{
+				result <<= 1;
+			}
+			return result;
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Bounded lock-free work-stealing job queue
+	*
+	*  @remarks
+	*    The owner thread pushes and takes jobs at the bottom in LIFO order for cache friendliness, other threads steal jobs at the top in FIFO order.
+	*
+	*  @note
+	*    - Only the owner thread is allowed to call "push()" and "take()", every thread is allowed to call "steal()"
+	*    - Memory orders taken from "Correct and Efficient Work-Stealing for Weak Memory Models" by Nhat Minh Lê, Antoniu Pop, Albert Cohen and Francesco Zappa Nardelli - https://fzn.fr/readings/ppopp13.pdf
+	*/
+	class JobSystem::WorkStealingQueue final
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static constexpr int64_t CAPACITY = 4096;	///< Must be a power of two
+		static constexpr int64_t MASK	  = CAPACITY - 1;
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		inline WorkStealingQueue() :
+			mTop(0),
+			mBottom(0)
+		{
+			for (std::atomic<Job*>& job : mJobs)
+			{
+				job.store(nullptr, std::memory_order_relaxed);
+			}
+		}
+
+		[[nodiscard]] bool push(Job& job)
+		{
+			const int64_t bottom = mBottom.load(std::memory_order_relaxed);
+			const int64_t top = mTop.load(std::memory_order_acquire);
+			if (bottom - top >= CAPACITY)
+			{
+				// The queue is full
+				return false;
+			}
+			mJobs[bottom & MASK].store(&job, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			mBottom.store(bottom + 1, std::memory_order_relaxed);
+			return true;
+		}
+
+		[[nodiscard]] Job* take()
+		{
+			const int64_t bottom = mBottom.load(std::memory_order_relaxed) - 1;
+			mBottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t top = mTop.load(std::memory_order_relaxed);
+			Job* job = nullptr;
+			if (top <= bottom)
+			{
+				// The queue isn't empty
+				job = mJobs[bottom & MASK].load(std::memory_order_relaxed);
+				if (top == bottom)
+				{
+					// This is the last job inside the queue, race against stealing threads
+					if (!mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+					{
+						// Lost the race
+						job = nullptr;
+					}
+					mBottom.store(bottom + 1, std::memory_order_relaxed);
+				}
+			}
+			else
+			{
+				// The queue is empty
+				mBottom.store(bottom + 1, std::memory_order_relaxed);
+			}
+			return job;
+		}
+
+		[[nodiscard]] Job* steal()
+		{
+			int64_t top = mTop.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			const int64_t bottom = mBottom.load(std::memory_order_acquire);
+			if (top < bottom)
+			{
+				// The queue isn't empty, race against the owner thread and other stealing threads
+				Job* job = mJobs[top & MASK].load(std::memory_order_relaxed);
+				if (mTop.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				{
+					return job;
+				}
+			}
+			return nullptr;
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		alignas(64) std::atomic<int64_t> mTop;		///< Stealing threads side, on an own cache line to avoid false sharing
+		alignas(64) std::atomic<int64_t> mBottom;	///< Owner thread side
+		std::atomic<Job*>				 mJobs[CAPACITY];
+
+
+	};
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	JobSystem::JobSystem(uint32_t numberOfWorkerThreads) :
+		mNumberOfWorkerThreads(numberOfWorkerThreads),
+		mJobRing(nullptr),
+		mNextJobIndex(0),
+		mWorkStealingQueues(nullptr),
+		mNumberOfWorkStealingQueues(0),
+		mShutdown(false),
+		mNumberOfQueuedJobs(0),
+		mNumberOfSleepingWorkerThreads(0)
+	{
+		// Use as many threads as there are hardware threads on the system, the thread creating the job system is taking part in processing jobs
+		if (isInvalid(mNumberOfWorkerThreads))
+		{
+			const uint32_t numberOfHardwareThreads = std::thread::hardware_concurrency();
+			mNumberOfWorkerThreads = (numberOfHardwareThreads > 1) ? (numberOfHardwareThreads - 1) : 0;
+		}
+
+		// Create the job ring buffer
+		const uint32_t numberOfJobs = ::detail::roundUpToPowerOfTwo(NUMBER_OF_JOBS_PER_THREAD * getNumberOfThreads());
+		mJobRings.push_back(new JobRing{new Job[numberOfJobs], numberOfJobs - 1});
+		mJobRing.store(mJobRings.back(), std::memory_order_release);
+
+		// Create the work-stealing queues: The thread creating the job system, the worker threads and a shared one for all other threads
+		mNumberOfWorkStealingQueues = mNumberOfWorkerThreads + 2;
+		mWorkStealingQueues = new WorkStealingQueue[mNumberOfWorkStealingQueues];
+		::detail::g_CurrentJobSystem = this;
+		::detail::g_CurrentThreadIndex = 0;
+
+		// Create the persistent worker threads
+		mWorkerThreads.reserve(mNumberOfWorkerThreads);
+		for (uint32_t i = 0; i < mNumberOfWorkerThreads; ++i)
+		{
+			mWorkerThreads.emplace_back(&JobSystem::workerThreadMain, this, i + 1);
+		}
+	}
+
+	JobSystem::~JobSystem()
+	{
+		// Worker threads shutdown
+		{
+			std::lock_guard<std::mutex> wakeUpMutexLock(mWakeUpMutex);
+			mShutdown = true;
+		}
+		mWakeUpConditionVariable.notify_all();
+		for (std::thread& workerThread : mWorkerThreads)
+		{
+			workerThread.join();
+		}
+		if (this == ::detail::g_CurrentJobSystem)
+		{
+			::detail::g_CurrentJobSystem = nullptr;
+		}
+
+		// Destroy the work-stealing queues and the job ring buffers
+		delete [] mWorkStealingQueues;
+		for (JobRing* jobRing : mJobRings)
+		{
+			delete [] jobRing->jobs;
+			delete jobRing;
+		}
+	}
+
+	Job& JobSystem::createJob(JobFunction function, const void* data, uint32_t numberOfBytes, Job* parent)
+	{
+		ASSERT(numberOfBytes <= Job::MAXIMUM_NUMBER_OF_DATA_BYTES, "Too many job data bytes")
+		ASSERT(nullptr == parent || !parent->isFinished(), "The parent job has already been finished")
+
+		// Claim the next finished job from the job ring buffer, in-flight jobs are skipped
+		// -> Waiting for an in-flight job instead could deadlock in case the in-flight job is e.g. a parent job which wasn't run, yet
+		// -> Claiming is done by switching the number of unfinished jobs from zero to one, so concurrently creating threads never get the same job
+		Job* job = nullptr;
+		JobRing* jobRing = mJobRing.load(std::memory_order_acquire);
+		while (nullptr == job)
+		{
+			for (uint32_t i = 0; i <= jobRing->jobIndexMask; ++i)
+			{
+				Job& candidateJob = jobRing->jobs[mNextJobIndex.fetch_add(1, std::memory_order_relaxed) & jobRing->jobIndexMask];
+				uint32_t numberOfUnfinishedJobs = 0;
+				if (candidateJob.numberOfUnfinishedJobs.compare_exchange_strong(numberOfUnfinishedJobs, 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+				{
+					job = &candidateJob;
+					break;
+				}
+			}
+			if (nullptr == job)
+			{
+				// All jobs are in-flight
+				jobRing = growJobRing(jobRing);
+			}
+		}
+
+		// Setup the job, the generation change invalidates job handles referencing the previous use of the job
+		job->generation.fetch_add(1, std::memory_order_release);
+		if (numberOfBytes > 0)
+		{
+			memcpy(job->data, data, numberOfBytes);
+		}
+		job->function = function;
+		job->parent = parent;
+		job->numberOfContinuations.store(0, std::memory_order_relaxed);
+		if (nullptr != parent)
+		{
+			parent->numberOfUnfinishedJobs.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		// Done
+		return *job;
+	}
+
+	void JobSystem::addContinuation(Job& ancestor, Job& continuation)
+	{
+		const uint32_t continuationIndex = ancestor.numberOfContinuations.fetch_add(1, std::memory_order_relaxed);
+		ASSERT(continuationIndex < Job::MAXIMUM_NUMBER_OF_CONTINUATIONS, "Too many job continuations")
+		ancestor.continuations[continuationIndex] = &continuation;
+	}
+
+	JobHandle JobSystem::run(Job& job)
+	{
+		// Get the job handle before running the job, as soon as the job is finished it might get recycled
+		const JobHandle jobHandle{&job, job.generation.load(std::memory_order_relaxed)};
+		push(job);
+
+		// Wake up a sleeping worker thread, if there's one
+		// -> Both, "mNumberOfQueuedJobs" as well as "mNumberOfSleepingWorkerThreads", are sequentially consistent so either the worker thread sees the queued job or we see the sleeping worker thread
+		if (mNumberOfSleepingWorkerThreads.load() > 0)
+		{
+			std::lock_guard<std::mutex> wakeUpMutexLock(mWakeUpMutex);
+			mWakeUpConditionVariable.notify_one();
+		}
+
+		// Done
+		return jobHandle;
+	}
+
+	void JobSystem::wait(const JobHandle& jobHandle)
+	{
+		const uint32_t threadIndex = getCurrentThreadIndex();
+		while (!jobHandle.isFinished())
+		{
+			Job* nextJob = getJob(threadIndex);
+			if (nullptr != nextJob)
+			{
+				execute(*nextJob);
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	uint32_t JobSystem::getGrainSize(uint32_t numberOfItems, uint32_t granularity) const
+	{
+		ASSERT(0 != granularity, "Invalid granularity")
+		if (0 == mNumberOfWorkerThreads || numberOfItems <= granularity)
+		{
+			// Not worth the additional threading effort
+			return numberOfItems;
+		}
+
+		// Split into a few ranges per thread so work-stealing can compensate unequally loaded threads, but never below the granularity
+		const uint32_t numberOfRanges = getNumberOfThreads() * NUMBER_OF_RANGES_PER_THREAD;
+		const uint32_t grainSize = (numberOfItems + numberOfRanges - 1) / numberOfRanges;
+		return ((grainSize + granularity - 1) / granularity) * granularity;
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	void JobSystem::workerThreadMain(uint32_t threadIndex)
+	{
+		RENDERER_SET_CURRENT_THREAD_DEBUG_NAME("Job worker", "Renderer: Job system worker")
+		::detail::g_CurrentJobSystem = this;
+		::detail::g_CurrentThreadIndex = threadIndex;
+		::detail::g_RandomState += threadIndex * 0x85ebca6bu;
+
+		uint32_t numberOfIdleSpins = 0;
+		while (!mShutdown.load(std::memory_order_relaxed))
+		{
+			Job* job = getJob(threadIndex);
+			if (nullptr != job)
+			{
+				execute(*job);
+				numberOfIdleSpins = 0;
+			}
+			else if (numberOfIdleSpins < ::detail::NUMBER_OF_IDLE_SPINS)
+			{
+				// Give the job producing threads a moment before going to sleep
+				std::this_thread::yield();
+				++numberOfIdleSpins;
+			}
+			else
+			{
+				// Sleep until there's work to do
+				std::unique_lock<std::mutex> wakeUpMutexLock(mWakeUpMutex);
+				++mNumberOfSleepingWorkerThreads;
+				mWakeUpConditionVariable.wait(wakeUpMutexLock, [this]() { return (mNumberOfQueuedJobs.load() > 0 || mShutdown.load()); });
+				--mNumberOfSleepingWorkerThreads;
+				numberOfIdleSpins = 0;
+			}
+		}
+	}
+
+	uint32_t JobSystem::getCurrentThreadIndex() const
+	{
+		// Threads not known to the job system share the last work-stealing queue
+		return (this == ::detail::g_CurrentJobSystem) ? ::detail::g_CurrentThreadIndex : (mNumberOfWorkStealingQueues - 1);
+	}
+
+	JobSystem::JobRing* JobSystem::growJobRing(const JobRing* fullJobRing)
+	{
+		std::lock_guard<std::mutex> jobRingMutexLock(mJobRingMutex);
+
+		// Another thread might have been faster
+		JobRing* jobRing = mJobRing.load(std::memory_order_acquire);
+		if (jobRing == fullJobRing)
+		{
+			// Double the number of jobs, the full job ring buffer stays alive since its jobs are still in-flight
+			const uint32_t numberOfJobs = (fullJobRing->jobIndexMask + 1) * 2;
+			ASSERT(numberOfJobs > fullJobRing->jobIndexMask + 1, "Job ring buffer overflow, are there created jobs which are never run?")
+			jobRing = new JobRing{new Job[numberOfJobs], numberOfJobs - 1};
+			mJobRings.push_back(jobRing);
+			mJobRing.store(jobRing, std::memory_order_release);
+		}
+		return jobRing;
+	}
+
+	void JobSystem::push(Job& job)
+	{
+		// Increment the number of queued jobs before pushing the job so the number of queued jobs never gets negative
+		++mNumberOfQueuedJobs;
+		const uint32_t threadIndex = getCurrentThreadIndex();
+		bool pushed = false;
+		if (threadIndex == mNumberOfWorkStealingQueues - 1)
+		{
+			std::lock_guard<std::mutex> sharedWorkStealingQueueMutexLock(mSharedWorkStealingQueueMutex);
+			pushed = mWorkStealingQueues[threadIndex].push(job);
+		}
+		else
+		{
+			pushed = mWorkStealingQueues[threadIndex].push(job);
+		}
+		if (!pushed)
+		{
+			// The queue is full, just execute the job directly inside the current thread
+			--mNumberOfQueuedJobs;
+			execute(job);
+		}
+	}
+
+	Job* JobSystem::getJob(uint32_t threadIndex)
+	{
+		// First try to take a job from the own queue
+		Job* job = nullptr;
+		if (threadIndex == mNumberOfWorkStealingQueues - 1)
+		{
+			std::lock_guard<std::mutex> sharedWorkStealingQueueMutexLock(mSharedWorkStealingQueueMutex);
+			job = mWorkStealingQueues[threadIndex].take();
+		}
+		else
+		{
+			job = mWorkStealingQueues[threadIndex].take();
+		}
+
+		// Try to steal a job from another queue, start at a random queue to distribute the stealing threads
+		if (nullptr == job && mNumberOfQueuedJobs.load(std::memory_order_relaxed) > 0)
+		{
+			const uint32_t firstVictimIndex = ::detail::getRandomNumber() % mNumberOfWorkStealingQueues;
+			for (uint32_t i = 0; i < mNumberOfWorkStealingQueues && nullptr == job; ++i)
+			{
+				const uint32_t victimIndex = (firstVictimIndex + i) % mNumberOfWorkStealingQueues;
+				if (victimIndex != threadIndex)
+				{
+					job = mWorkStealingQueues[victimIndex].steal();
+				}
+			}
+		}
+
+		// Done
+		if (nullptr != job)
+		{
+			--mNumberOfQueuedJobs;
+		}
+		return job;
+	}
+
+	void JobSystem::execute(Job& job)
+	{
+		if (nullptr != job.function)
+		{
+			job.function(job, job.data);
+		}
+		finish(job);
+	}
+
+	void JobSystem::finish(Job& job)
+	{
+		// Backup the parent and the continuations, as soon as the job is finished it can be recycled
+		Job* parent = job.parent;
+		const uint32_t numberOfContinuations = job.numberOfContinuations.load(std::memory_order_relaxed);
+		Job* continuations[Job::MAXIMUM_NUMBER_OF_CONTINUATIONS];
+		for (uint32_t i = 0; i < numberOfContinuations; ++i)
+		{
+			continuations[i] = job.continuations[i];
+		}
+
+		// Is the job including all its child jobs finished?
+		if (1 == job.numberOfUnfinishedJobs.fetch_sub(1, std::memory_order_acq_rel))
+		{
+			// Inform the parent job
+			if (nullptr != parent)
+			{
+				finish(*parent);
+			}
+
+			// Run the continuation jobs
+			for (uint32_t i = 0; i < numberOfContinuations; ++i)
+			{
+				run(*continuations[i]);
+			}
+		}
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
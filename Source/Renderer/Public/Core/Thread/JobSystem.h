@@ -0,0 +1,469 @@
+/*********************************************************\
+ * Copyright (c) 2012-2021 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/Export.h"
+#include "Renderer/Public/Core/GetInvalid.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'return': conversion from 'int' to 'std::char_traits<wchar_t>::int_type', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4623)	// warning C4623: 'std::_UInt_is_zero': default constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::_UInt_is_zero': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_UInt_is_zero': move assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5039)	// warning C5039: '_Thrd_start': pointer or reference to potentially throwing function passed to extern C function under -EHc. Undefined behavior may occur if this function throws an exception.
+	#include <mutex>
+	#include <atomic>	// For "std::atomic<>"
+	#include <thread>
+	#include <vector>
+	#include <cstring>	// For "memcpy()"
+	#include <type_traits>
+	#include <condition_variable>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Global definitions                                    ]
+	//[-------------------------------------------------------]
+	struct Job;
+	typedef void (*JobFunction)(Job& job, const void* data);	///< Job function, "data" points to the job data copied during job creation
+
+
+	//[-------------------------------------------------------]
+	//[ Structures                                            ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Job, the unit of work processed by the job system
+	*
+	*  @note
+	*    - Jobs are owned and recycled by the job system, never destroy a job
+	*    - A job is finished as soon as its job function as well as all of its child jobs are finished
+	*    - The job data is stored first so it's always aligned to the job alignment
+	*/
+	struct alignas(64) Job final
+	{
+		static constexpr uint32_t MAXIMUM_NUMBER_OF_DATA_BYTES	   = 64;
+		static constexpr uint32_t MAXIMUM_NUMBER_OF_CONTINUATIONS = 4;
+
+		uint8_t				  data[MAXIMUM_NUMBER_OF_DATA_BYTES];	///< Job data, copied during job creation
+		JobFunction			  function;								///< Job function, can be a null pointer for pure synchronization jobs
+		Job*				  parent;								///< Parent job which isn't finished before this job is finished, can be a null pointer
+		std::atomic<uint32_t> numberOfUnfinishedJobs;				///< The job itself plus the number of its unfinished child jobs, zero means the job is finished and can be recycled
+		std::atomic<uint32_t> numberOfContinuations;
+		std::atomic<uint32_t> generation;							///< Incremented each time the job is recycled, used by "Renderer::JobHandle" to detect a recycled job
+		Job*				  continuations[MAXIMUM_NUMBER_OF_CONTINUATIONS];	///< Jobs which are run as soon as this job is finished
+
+		inline Job() :
+			data{},
+			function(nullptr),
+			parent(nullptr),
+			numberOfUnfinishedJobs(0),
+			numberOfContinuations(0),
+			generation(0),
+			continuations{}
+		{
+			// Nothing here
+		}
+
+		[[nodiscard]] inline bool isFinished() const
+		{
+			return (0 == numberOfUnfinishedJobs.load(std::memory_order_acquire));
+		}
+	};
+	static_assert(128 == sizeof(Job), "Job should be exactly two cache lines in size");
+
+	/**
+	*  @brief
+	*    Job handle used to wait for a job
+	*
+	*  @remarks
+	*    A finished job is recycled by the job system, so a plain job reference can't tell whether or not the job it was
+	*    referring to is finished. The job handle remembers the job generation and considers the job to be finished as soon
+	*    as the job got recycled.
+	*/
+	struct JobHandle final
+	{
+		const Job* job;
+		uint32_t   generation;
+
+		[[nodiscard]] inline bool isFinished() const
+		{
+			// Generation first: If the job gets recycled in between, we'll notice it the next time
+			return (job->generation.load(std::memory_order_acquire) != generation || job->isFinished());
+		}
+	};
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Job system with persistent worker threads and per-thread work-stealing job queues
+	*
+	*  @remarks
+	*    The job system is handy for task parallel as well as for data parallel situations. Example use-cases:
+	*    - Frustum culling
+	*    - Animation update
+	*    - Particles update
+	*
+	*    Dependencies between jobs can be expressed in two ways:
+	*    - Parent/child: A parent job is only finished after all of its child jobs are finished. An empty job can be used as
+	*      counter by creating jobs as its children, running it and then waiting for it.
+	*    - Continuations: A continuation job is run as soon as its ancestor job is finished.
+	*
+	*    Data parallel usage example:
+	*    @code
+	*    JobSystem& jobSystem = renderer.getJobSystem();
+	*    jobSystem.parallelFor(static_cast<uint32_t>(items.size()), 64, [&items](uint32_t startIndex, uint32_t endIndex)
+	*    {
+	*        for (uint32_t i = startIndex; i < endIndex; ++i)
+	*        {
+	*            // ... do work...
+	*        }
+	*    });
+	*    @endcode
+	*
+	*    Job graph usage example:
+	*    @code
+	*    Job& rootJob = jobSystem.createEmptyJob();
+	*    Job& animationJob = jobSystem.createJob([&scene]() { scene.updateAnimations(); }, &rootJob);
+	*    Job& skinningJob = jobSystem.createJob([&scene]() { scene.updateSkinning(); }, &rootJob);
+	*    jobSystem.addContinuation(animationJob, skinningJob);	// Skinning needs the animation result
+	*    jobSystem.run(animationJob);
+	*    const JobHandle rootJobHandle = jobSystem.run(rootJob);
+	*    jobSystem.wait(rootJobHandle);
+	*    @endcode
+	*
+	*  @note
+	*    - The worker threads are created once and are sleeping while there's no work, so there's no per-frame thread creation
+	*    - The thread which created the job system as well as every thread waiting for a job takes part in processing jobs
+	*    - Jobs are allocated from a job ring buffer without any heap allocation, each created job must be run
+	*    - In case all jobs inside the job ring buffer are in-flight, the job ring buffer grows instead of waiting for a job which might never finish
+	*    - Jobs can be run from any thread, threads not known to the job system share a mutex protected job queue
+	*    - Work-stealing job queue basing on "Correct and Efficient Work-Stealing for Weak Memory Models" by Nhat Minh Lê, Antoniu Pop, Albert Cohen and Francesco Zappa Nardelli - https://fzn.fr/readings/ppopp13.pdf
+	*/
+	class JobSystem final
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		static constexpr uint32_t NUMBER_OF_JOBS_PER_THREAD = 1024;	///< Initial number of jobs inside the job ring buffer per thread which can be in-flight at the same time
+		static constexpr uint32_t NUMBER_OF_RANGES_PER_THREAD = 4;	///< Number of ranges per thread a parallel for is split into to be able to compensate unequally loaded threads by work-stealing
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] numberOfWorkerThreads
+		*    Number of worker threads, invalid number means to use the number of hardware threads minus one for the thread creating the job system
+		*/
+		RENDERER_API_EXPORT explicit JobSystem(uint32_t numberOfWorkerThreads = getInvalid<uint32_t>());
+
+		/**
+		*  @brief
+		*    Destructor
+		*
+		*  @note
+		*    - All jobs must be finished when destroying the job system
+		*/
+		RENDERER_API_EXPORT ~JobSystem();
+
+		/**
+		*  @brief
+		*    Return the number of worker threads
+		*
+		*  @return
+		*    The number of worker threads, can be zero in which case all jobs are processed by the waiting thread
+		*/
+		[[nodiscard]] inline uint32_t getNumberOfWorkerThreads() const
+		{
+			return mNumberOfWorkerThreads;
+		}
+
+		/**
+		*  @brief
+		*    Return the number of threads processing jobs
+		*
+		*  @return
+		*    The number of threads processing jobs, the worker threads plus the waiting thread
+		*/
+		[[nodiscard]] inline uint32_t getNumberOfThreads() const
+		{
+			return mNumberOfWorkerThreads + 1;
+		}
+
+		//[-------------------------------------------------------]
+		//[ Job                                                   ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Create a job
+		*
+		*  @param[in] function
+		*    Job function, can be a null pointer for pure synchronization jobs
+		*  @param[in] data
+		*    Job data to copy, can be a null pointer
+		*  @param[in] numberOfBytes
+		*    Number of job data bytes, must not exceed "Renderer::Job::MAXIMUM_NUMBER_OF_DATA_BYTES"
+		*  @param[in] parent
+		*    Optional parent job, can be a null pointer, if valid the parent job must not have been run, yet
+		*
+		*  @return
+		*    The created job which must be run
+		*/
+		[[nodiscard]] RENDERER_API_EXPORT Job& createJob(JobFunction function, const void* data, uint32_t numberOfBytes, Job* parent);
+
+		/**
+		*  @brief
+		*    Create a job executing the given function object
+		*
+		*  @param[in] function
+		*    Trivially copyable function object like a lambda capturing only references and plain data, either invocable without parameters or with a "Renderer::Job&" parameter
+		*  @param[in] parent
+		*    Optional parent job, can be a null pointer, if valid the parent job must not have been run, yet
+		*
+		*  @return
+		*    The created job which must be run
+		*/
+		template <typename FUNCTION>
+		[[nodiscard]] Job& createJob(const FUNCTION& function, Job* parent = nullptr)
+		{
+			static_assert(sizeof(FUNCTION) <= Job::MAXIMUM_NUMBER_OF_DATA_BYTES, "The function object is too large to be stored inside the job data");
+			static_assert(alignof(FUNCTION) <= alignof(Job), "The function object alignment exceeds the job alignment");
+			static_assert(std::is_trivially_copyable_v<FUNCTION> && std::is_trivially_destructible_v<FUNCTION>, "The function object must be trivially copyable and destructible");
+			return createJob(&JobSystem::executeFunctionObject<FUNCTION>, &function, static_cast<uint32_t>(sizeof(FUNCTION)), parent);
+		}
+
+		/**
+		*  @brief
+		*    Create an empty job
+		*
+		*  @param[in] parent
+		*    Optional parent job, can be a null pointer, if valid the parent job must not have been run, yet
+		*
+		*  @return
+		*    The created job which must be run
+		*
+		*  @note
+		*    - Handy as root or counter job having child jobs
+		*/
+		[[nodiscard]] inline Job& createEmptyJob(Job* parent = nullptr)
+		{
+			return createJob(nullptr, nullptr, 0, parent);
+		}
+
+		/**
+		*  @brief
+		*    Add a continuation job which is run as soon as the given ancestor job is finished
+		*
+		*  @param[in] ancestor
+		*    Ancestor job which must not have been run, yet
+		*  @param[in] continuation
+		*    Continuation job which must not have been run, yet, the continuation job is run by the job system so don't run it on your own
+		*/
+		RENDERER_API_EXPORT void addContinuation(Job& ancestor, Job& continuation);
+
+		/**
+		*  @brief
+		*    Run the given job
+		*
+		*  @param[in] job
+		*    Job to run, it's not allowed to run a job multiple times
+		*
+		*  @return
+		*    Handle of the job which can be used to wait for the job, the job itself must not be accessed after it has been run
+		*/
+		RENDERER_API_EXPORT JobHandle run(Job& job);
+
+		/**
+		*  @brief
+		*    Wait until the given job is finished
+		*
+		*  @param[in] jobHandle
+		*    Handle of the job to wait for
+		*
+		*  @note
+		*    - The calling thread processes jobs while waiting
+		*/
+		RENDERER_API_EXPORT void wait(const JobHandle& jobHandle);
+
+		inline void runAndWait(Job& job)
+		{
+			wait(run(job));
+		}
+
+		//[-------------------------------------------------------]
+		//[ Data parallel                                         ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Return the automatic grain size used to split the given number of items into ranges
+		*
+		*  @param[in] numberOfItems
+		*    Number of items
+		*  @param[in] granularity
+		*    Minimum number of items per range, each range start is a multiple of the granularity (e.g. SIMD lane count), must not be zero
+		*
+		*  @return
+		*    Number of items per range, the number of items itself if splitting isn't worth the effort
+		*/
+		[[nodiscard]] RENDERER_API_EXPORT uint32_t getGrainSize(uint32_t numberOfItems, uint32_t granularity) const;
+
+		/**
+		*  @brief
+		*    Process the given number of items in parallel and wait until all items have been processed
+		*
+		*  @param[in] numberOfItems
+		*    Number of items
+		*  @param[in] granularity
+		*    Minimum number of items per range, each range start is a multiple of the granularity (e.g. SIMD lane count), must not be zero
+		*  @param[in] function
+		*    Function object with the signature "void(uint32_t startIndex, uint32_t endIndex)" called once per range, must be thread-safe
+		*/
+		template <typename FUNCTION>
+		void parallelFor(uint32_t numberOfItems, uint32_t granularity, const FUNCTION& function)
+		{
+			const uint32_t grainSize = getGrainSize(numberOfItems, granularity);
+			if (grainSize >= numberOfItems)
+			{
+				// Just execute it directly inside the current thread, not worth the additional threading effort
+				if (numberOfItems > 0)
+				{
+					function(0, numberOfItems);
+				}
+			}
+			else
+			{
+				// Kick a child job per range, the function object itself isn't copied since we're waiting for the jobs to finish
+				const FUNCTION* functionPointer = &function;
+				Job& rootJob = createEmptyJob();
+				for (uint32_t startIndex = 0; startIndex < numberOfItems; startIndex += grainSize)
+				{
+					const uint32_t endIndex = (numberOfItems - startIndex > grainSize) ? (startIndex + grainSize) : numberOfItems;
+					run(createJob([functionPointer, startIndex, endIndex]() { (*functionPointer)(startIndex, endIndex); }, &rootJob));
+				}
+				runAndWait(rootJob);
+			}
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		class WorkStealingQueue;
+
+		struct JobRing final
+		{
+			Job*	 jobs;
+			uint32_t jobIndexMask;
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private static methods                                ]
+	//[-------------------------------------------------------]
+	private:
+		template <typename FUNCTION>
+		static void executeFunctionObject([[maybe_unused]] Job& job, const void* data)
+		{
+			const FUNCTION& function = *static_cast<const FUNCTION*>(data);
+			if constexpr (std::is_invocable_v<const FUNCTION&, Job&>)
+			{
+				function(job);
+			}
+			else
+			{
+				function();
+			}
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit JobSystem(const JobSystem&) = delete;
+		JobSystem& operator=(const JobSystem&) = delete;
+		void workerThreadMain(uint32_t threadIndex);
+		[[nodiscard]] uint32_t getCurrentThreadIndex() const;
+		[[nodiscard]] JobRing* growJobRing(const JobRing* fullJobRing);
+		void push(Job& job);
+		[[nodiscard]] Job* getJob(uint32_t threadIndex);
+		void execute(Job& job);
+		void finish(Job& job);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		uint32_t				 mNumberOfWorkerThreads;
+		// Job ring buffer: Replaced by a larger one if all jobs are in-flight, previous job ring buffers are kept alive since their jobs might still be in-flight
+		std::atomic<JobRing*>	 mJobRing;
+		std::vector<JobRing*>	 mJobRings;
+		std::mutex				 mJobRingMutex;
+		std::atomic<uint32_t>	 mNextJobIndex;
+		// Job queues: Index 0 = thread which created the job system, then one per worker thread, last one is shared by all other threads
+		WorkStealingQueue*		 mWorkStealingQueues;
+		uint32_t				 mNumberOfWorkStealingQueues;
+		std::mutex				 mSharedWorkStealingQueueMutex;
+		// Worker threads
+		std::atomic<bool>		 mShutdown;
+		std::atomic<int32_t>	 mNumberOfQueuedJobs;
+		std::atomic<uint32_t>	 mNumberOfSleepingWorkerThreads;
+		std::mutex				 mWakeUpMutex;
+		std::condition_variable	 mWakeUpConditionVariable;
+		std::vector<std::thread> mWorkerThreads;
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
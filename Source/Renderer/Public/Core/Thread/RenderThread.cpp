@@ -0,0 +1,127 @@
+/*********************************************************\
+ * Copyright (c) 2012-2021 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/Core/Thread/RenderThread.h"
+#include "Renderer/Public/Core/Platform/PlatformManager.h"
+
+// TODO(co) Can we do something about the warning which does not involve using "std::thread"-pointers?
+PRAGMA_WARNING_DISABLE_MSVC(4355)	// warning C4355: 'this': used in base member initializer list
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	RenderThread::RenderThread() :
+		mFunction(nullptr),
+		mUserData(nullptr),
+		mShutdown(false),
+		mBusy(false),
+		mThread(&RenderThread::renderThreadMain, this)
+	{
+		// Nothing here
+	}
+
+	RenderThread::~RenderThread()
+	{
+		// Render thread shutdown
+		wait();
+		{
+			std::lock_guard<std::mutex> mutexLock(mMutex);
+			mShutdown = true;
+		}
+		mConditionVariable.notify_all();
+		mThread.join();
+	}
+
+	void RenderThread::kick(RenderThreadFunction function, void* userData)
+	{
+		ASSERT(nullptr != function, "Invalid render thread function")
+
+		// Only a single function can be in-flight
+		wait();
+
+		// Wake up the render thread
+		{
+			std::lock_guard<std::mutex> mutexLock(mMutex);
+			mFunction = function;
+			mUserData = userData;
+		}
+		mBusy = true;
+		mConditionVariable.notify_all();
+	}
+
+	void RenderThread::wait()
+	{
+		if (mBusy)
+		{
+			std::unique_lock<std::mutex> mutexLock(mMutex);
+			mConditionVariable.wait(mutexLock, [this]() { return (nullptr == mFunction); });
+			mBusy = false;
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	void RenderThread::renderThreadMain()
+	{
+		RENDERER_SET_CURRENT_THREAD_DEBUG_NAME("Render thread", "Renderer: Render thread")
+		std::unique_lock<std::mutex> mutexLock(mMutex);
+		for (;;)
+		{
+			// Sleep until there's something to do
+			mConditionVariable.wait(mutexLock, [this]() { return (nullptr != mFunction || mShutdown); });
+			if (nullptr == mFunction)
+			{
+				// Shutdown
+				break;
+			}
+
+			// Execute the function without holding the lock, the kicking thread only touches the function after it has been finished
+			const RenderThreadFunction function = mFunction;
+			void* userData = mUserData;
+			mutexLock.unlock();
+			function(userData);
+			mutexLock.lock();
+
+			// Signal the finished function
+			mFunction = nullptr;
+			mUserData = nullptr;
+			mConditionVariable.notify_all();
+		}
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
@@ -0,0 +1,164 @@
+/*********************************************************\
+ * Copyright (c) 2012-2021 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/Export.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'return': conversion from 'int' to 'std::char_traits<wchar_t>::int_type', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4623)	// warning C4623: 'std::_UInt_is_zero': default constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::_UInt_is_zero': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_UInt_is_zero': move assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5039)	// warning C5039: '_Thrd_start': pointer or reference to potentially throwing function passed to extern C function under -EHc. Undefined behavior may occur if this function throws an exception.
+	#include <mutex>
+	#include <thread>
+	#include <condition_variable>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Global definitions                                    ]
+	//[-------------------------------------------------------]
+	typedef void (*RenderThreadFunction)(void* userData);	///< Render thread function
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Dedicated render thread processing one kicked function at a time
+	*
+	*  @remarks
+	*    Used to dispatch a filled RHI command buffer while the kicking thread is already preparing the next frame. Usage example:
+	*    @code
+	*    renderThread.wait();	// Wait until the previous frame has been dispatched before touching the RHI
+	*    // ... fill the command buffer of the current frame...
+	*    renderThread.kick([](void* userData) { static_cast<Frame*>(userData)->dispatchAndPresent(); }, &frame);
+	*    @endcode
+	*
+	*  @note
+	*    - The thread is created once and is sleeping while there's no work, so there's no per-frame thread creation
+	*    - Only a single function can be in-flight, kicking while the previous function is still in-flight waits for it
+	*    - "kick()" and "wait()" must be called by the same thread
+	*/
+	class RenderThread final
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*/
+		RENDERER_API_EXPORT RenderThread();
+
+		/**
+		*  @brief
+		*    Destructor
+		*
+		*  @note
+		*    - Waits for an in-flight function
+		*/
+		RENDERER_API_EXPORT ~RenderThread();
+
+		/**
+		*  @brief
+		*    Return whether or not a kicked function is in-flight
+		*
+		*  @return
+		*    "true" if a kicked function wasn't waited for, yet, else "false"
+		*/
+		[[nodiscard]] inline bool isBusy() const
+		{
+			return mBusy;
+		}
+
+		/**
+		*  @brief
+		*    Let the render thread execute the given function
+		*
+		*  @param[in] function
+		*    Function to execute inside the render thread, must be valid
+		*  @param[in] userData
+		*    User data passed to the function, can be a null pointer, must stay valid until the function has been waited for
+		*/
+		RENDERER_API_EXPORT void kick(RenderThreadFunction function, void* userData);
+
+		/**
+		*  @brief
+		*    Wait until the kicked function is finished
+		*
+		*  @note
+		*    - Returns immediately if there's no in-flight function
+		*/
+		RENDERER_API_EXPORT void wait();
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit RenderThread(const RenderThread&) = delete;
+		RenderThread& operator=(const RenderThread&) = delete;
+		void renderThreadMain();
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		std::mutex				mMutex;
+		std::condition_variable mConditionVariable;	///< Used for kicking the render thread as well as for signaling the finished function
+		RenderThreadFunction	mFunction;			///< Function to execute, null pointer if there's nothing to execute, protected by "mMutex"
+		void*					mUserData;			///< Protected by "mMutex"
+		bool					mShutdown;			///< Protected by "mMutex"
+		bool					mBusy;				///< Only accessed by the kicking thread
+		std::thread				mThread;			///< Last member so the thread is started after everything else has been initialized
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
@@ -372,16 +372,14 @@ namespace Renderer
 				#else
 					uint32_t numberOfCommands = 0;
 					{
-						const uint8_t* commandPacketBuffer = commandBuffer.getCommandPacketBuffer();
-						Rhi::ConstCommandPacket constCommandPacket = commandPacketBuffer;
+						Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket();
 						while (nullptr != constCommandPacket)
 						{
 							// Count command packet
 							++numberOfCommands;
 
 							{ // Next command
-								const uint32_t nextCommandPacketByteIndex = Rhi::CommandPacketHelper::getNextCommandPacketByteIndex(constCommandPacket);
-								constCommandPacket = (~0u != nextCommandPacketByteIndex) ? &commandPacketBuffer[nextCommandPacketByteIndex] : nullptr;
+								constCommandPacket = Rhi::CommandPacketHelper::getNextCommandPacket(constCommandPacket);
 							}
 						}
 					}
@@ -390,16 +388,14 @@ namespace Renderer
 				{
 					// Loop through all commands and count them
 					uint32_t numberOfCommandFunctions[static_cast<uint8_t>(Rhi::CommandDispatchFunctionIndex::NUMBER_OF_FUNCTIONS)] = {};
-					const uint8_t* commandPacketBuffer = commandBuffer.getCommandPacketBuffer();
-					Rhi::ConstCommandPacket constCommandPacket = commandPacketBuffer;
+					Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket();
 					while (nullptr != constCommandPacket)
 					{
 						// Count command packet
 						++numberOfCommandFunctions[static_cast<uint32_t>(Rhi::CommandPacketHelper::loadCommandDispatchFunctionIndex(constCommandPacket))];
 
 						{ // Next command
-							const uint32_t nextCommandPacketByteIndex = Rhi::CommandPacketHelper::getNextCommandPacketByteIndex(constCommandPacket);
-							constCommandPacket = (~0u != nextCommandPacketByteIndex) ? &commandPacketBuffer[nextCommandPacketByteIndex] : nullptr;
+							constCommandPacket = Rhi::CommandPacketHelper::getNextCommandPacket(constCommandPacket);
 						}
 					}
 
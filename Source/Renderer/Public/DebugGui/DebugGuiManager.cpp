@@ -25,6 +25,7 @@
 #include "Renderer/Public/DebugGui/DebugGuiHelper.h"
 #include "Renderer/Public/Resource/Texture/TextureResourceManager.h"
 #include "Renderer/Public/Core/File/IFileManager.h"
+#include "Renderer/Public/Core/Renderer/FrameUploadManager.h"
 #include "Renderer/Public/Core/IProfiler.h"
 #include "Renderer/Public/IRenderer.h"
 #include "Renderer/Public/Context.h"
@@ -160,7 +161,6 @@ namespace Renderer
 			// Ask ImGui to render into the internal command buffer and then request the resulting draw data
 			ImGui::Render();
 			const ImDrawData* imDrawData = ImGui::GetDrawData();
-			Rhi::IRhi& rhi = mRenderer.getRhi();
 			Rhi::IBufferManager& bufferManager = mRenderer.getBufferManager();
 
 			{ // Vertex and index buffers
@@ -188,11 +188,13 @@ namespace Renderer
 				}
 
 				{ // Copy and convert all vertices and indices into a single contiguous buffer
+					// -> With pipelined rendering the frame upload manager stages the data of the current frame and the render thread uploads it
+					FrameUploadManager& frameUploadManager = mRenderer.getFrameUploadManager();
 					Rhi::MappedSubresource vertexBufferMappedSubresource;
-					if (rhi.map(*mVertexBuffer, 0, Rhi::MapType::WRITE_DISCARD, 0, vertexBufferMappedSubresource))
+					if (frameUploadManager.map(*mVertexBuffer, static_cast<uint32_t>(imDrawData->TotalVtxCount * sizeof(ImDrawVert)), Rhi::MapType::WRITE_DISCARD, vertexBufferMappedSubresource))
 					{
 						Rhi::MappedSubresource indexBufferMappedSubresource;
-						if (rhi.map(*mIndexBuffer, 0, Rhi::MapType::WRITE_DISCARD, 0, indexBufferMappedSubresource))
+						if (frameUploadManager.map(*mIndexBuffer, static_cast<uint32_t>(imDrawData->TotalIdxCount * sizeof(ImDrawIdx)), Rhi::MapType::WRITE_DISCARD, indexBufferMappedSubresource))
 						{
 							ImDrawVert* imDrawVert = static_cast<ImDrawVert*>(vertexBufferMappedSubresource.data);
 							ImDrawIdx* imDrawIdx = static_cast<ImDrawIdx*>(indexBufferMappedSubresource.data);
@@ -206,11 +208,11 @@ namespace Renderer
 							}
 
 							// Unmap the index buffer
-							rhi.unmap(*mIndexBuffer, 0);
+							frameUploadManager.unmap(*mIndexBuffer);
 						}
 
 						// Unmap the vertex buffer
-						rhi.unmap(*mVertexBuffer, 0);
+						frameUploadManager.unmap(*mVertexBuffer);
 					}
 				}
 			}
@@ -52,6 +52,7 @@ namespace Renderer
 	class Context;
 	class TimeManager;
 	class IFileManager;
+	class FrameUploadManager;
 	class AssetManager;
 	class IRenderer;
 	class ResourceStreamer;
@@ -71,8 +72,7 @@ namespace Renderer
 	class SkeletonAnimationResourceManager;
 	class MaterialBlueprintResourceManager;
 	class CompositorWorkspaceResourceManager;
-	template <typename ReturnType> class ThreadPool;
-	typedef ThreadPool<void> DefaultThreadPool;
+	class JobSystem;
 	#ifdef RENDERER_IMGUI
 		class DebugGuiManager;
 	#endif
@@ -92,7 +92,8 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Global definitions                                    ]
 	//[-------------------------------------------------------]
-	typedef StringId AssetId;	///< Asset identifier, internally just a POD "uint32_t", string ID scheme is "<project name>/<asset directory>/<asset name>"
+	typedef StringId AssetId;			///< Asset identifier, internally just a POD "uint32_t", string ID scheme is "<project name>/<asset directory>/<asset name>"
+	typedef StringId AssetPackageId;	///< Asset package identifier, internally just a POD "uint32_t", string ID scheme is "<project name>/<asset package name>"
 
 
 	//[-------------------------------------------------------]
@@ -191,14 +192,14 @@ namespace Renderer
 
 		/**
 		*  @brief
-		*    Return the default thread pool instance
+		*    Return the job system instance
 		*
 		*  @return
-		*    The default thread pool instance, do not release the returned instance
+		*    The job system instance, do not release the returned instance
 		*/
-		[[nodiscard]] inline DefaultThreadPool& getDefaultThreadPool() const
+		[[nodiscard]] inline JobSystem& getJobSystem() const
 		{
-			return *mDefaultThreadPool;
+			return *mJobSystem;
 		}
 
 		/**
@@ -225,6 +226,18 @@ namespace Renderer
 			return *mTimeManager;
 		}
 
+		/**
+		*  @brief
+		*    Return the frame upload manager instance
+		*
+		*  @return
+		*    The frame upload manager instance, do not release the returned instance
+		*/
+		[[nodiscard]] inline FrameUploadManager& getFrameUploadManager() const
+		{
+			return *mFrameUploadManager;
+		}
+
 		//[-------------------------------------------------------]
 		//[ Resource                                              ]
 		//[-------------------------------------------------------]
@@ -502,9 +515,40 @@ namespace Renderer
 		//[ Pipeline state object cache                           ]
 		//[-------------------------------------------------------]
 		virtual void clearPipelineStateObjectCache() = 0;
+
+		/**
+		*  @brief
+		*    Load the pipeline state object cache
+		*
+		*  @remarks
+		*    The pipeline state object cache inside the local data has priority. If there's none, the precompiled pipeline state object
+		*    cache shipped inside the mounted asset packages is used, see "Renderer::IRenderer::savePrecompiledPipelineStateObjectCache()".
+		*
+		*  @note
+		*    - Call this after the asset packages have been mounted
+		*/
 		virtual void loadPipelineStateObjectCache() = 0;
+
+		/**
+		*  @brief
+		*    Save the pipeline state object cache into the local data, if there's something new to save
+		*/
 		virtual void savePipelineStateObjectCache() = 0;
 
+		/**
+		*  @brief
+		*    Save the pipeline state object cache into the given mounted asset package directory
+		*
+		*  @param[in] assetPackageId
+		*    ID of the mounted asset package to save the precompiled pipeline state object cache into
+		*
+		*  @remarks
+		*    Used by the renderer toolkit to emit a precompiled pipeline state object cache per RHI implementation, so shipped asset packages
+		*    start with a warm pipeline state object cache. The precompiled pipeline state object cache is stored as "<rhi name>.pso_cache"
+		*    next to the asset package file.
+		*/
+		virtual void savePrecompiledPipelineStateObjectCache(AssetPackageId assetPackageId) = 0;
+
 
 	//[-------------------------------------------------------]
 	//[ Protected methods                                     ]
@@ -524,9 +568,10 @@ namespace Renderer
 			mBufferManager(nullptr),
 			mTextureManager(nullptr),
 			mFileManager(nullptr),
-			mDefaultThreadPool(nullptr),
+			mJobSystem(nullptr),
 			mAssetManager(nullptr),
 			mTimeManager(nullptr),
+			mFrameUploadManager(nullptr),
 			// Resource
 			mRendererResourceManager(nullptr),
 			mResourceStreamer(nullptr),
@@ -570,9 +615,10 @@ namespace Renderer
 		Rhi::IBufferManager*  mBufferManager;	///< The used RHI buffer manager instance (we keep a reference to it), always valid
 		Rhi::ITextureManager* mTextureManager;	///< The used RHI texture manager instance (we keep a reference to it), always valid
 		IFileManager*		  mFileManager;		///< The used file manager instance, always valid
-		DefaultThreadPool*	  mDefaultThreadPool;
+		JobSystem*			  mJobSystem;
 		AssetManager*		  mAssetManager;
 		TimeManager*		  mTimeManager;
+		FrameUploadManager*	  mFrameUploadManager;
 		// Resource
 		RendererResourceManager*			mRendererResourceManager;
 		ResourceStreamer*					mResourceStreamer;
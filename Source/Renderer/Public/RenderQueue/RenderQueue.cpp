@@ -36,9 +36,11 @@
 #include "Renderer/Public/Resource/MaterialBlueprint/BufferManager/PassBufferManager.h"
 #include "Renderer/Public/Resource/MaterialBlueprint/BufferManager/LightBufferManager.h"
 #include "Renderer/Public/Resource/MaterialBlueprint/BufferManager/IndirectBufferManager.h"
+#include "Renderer/Public/Resource/MaterialBlueprint/BufferManager/MaterialBufferManager.h"
 #include "Renderer/Public/Resource/MaterialBlueprint/BufferManager/UniformInstanceBufferManager.h"
 #include "Renderer/Public/Resource/MaterialBlueprint/BufferManager/TextureInstanceBufferManager.h"
 #include "Renderer/Public/Core/IProfiler.h"
+#include "Renderer/Public/Core/Thread/JobSystem.h"
 #include "Renderer/Public/Core/Math/Transform.h"
 
 #include <array>
@@ -54,6 +56,40 @@ namespace
 	{
  
 
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr uint32_t RADIX_SORT_BITS_PER_PASS			   = 8;
+		static constexpr uint32_t RADIX_SORT_NUMBER_OF_BUCKETS		   = (1u << RADIX_SORT_BITS_PER_PASS);
+		static constexpr uint32_t RADIX_SORT_NUMBER_OF_PASSES		   = 64 / RADIX_SORT_BITS_PER_PASS;
+		static constexpr uint32_t INSERTION_SORT_MOVES_PER_ELEMENT	   = 8;	///< Temporal coherence insertion sort gives up and falls back to radix sort if more than this number of element moves per element are needed
+		static constexpr uint32_t INSERTION_SORT_MINIMUM_MAXIMUM_MOVES = 256;	///< Minimum move budget so tiny queues never fall back to radix sort
+		// Job granularities: Dispatching a job costs about 0.1 us (see "Job system" of the "Benchmark" example) but waking up an idle worker thread takes
+		// several us, so each job should at least work for about 10 us. A renderable manager needs the LOD selection, sorting key and material lookup of each
+		// of its renderables. A recorded renderable needs about five commands at 50 million commands per second (see "Command buffer" of the "Benchmark"
+		// example) plus the instance buffer filling, and each recording job additionally maps its own instance buffers.
+		static constexpr uint32_t RENDERABLE_MANAGERS_GRANULARITY	   = 64;	///< Minimum number of renderable managers for each render queue filling job to work on
+		static constexpr uint32_t RECORDING_JOBS_GRANULARITY		   = 256;	///< Minimum number of queued renderables for each command recording job to work on
+
+		// Sorting key bits
+		static constexpr uint32_t PIPELINE_STATE_NUMBER_OF_BITS	= 16;
+		static constexpr uint32_t VERTEX_ARRAY_NUMBER_OF_BITS	= 16;
+		static constexpr uint32_t RESOURCE_GROUP_NUMBER_OF_BITS	= 11;
+		static constexpr uint32_t DEPTH_NUMBER_OF_BITS			= 21;
+
+		// Sorting key bit shift: Opaque renderables are first sorted by pipeline state, then by vertex array, then by depth front to back
+		static constexpr uint32_t PIPELINE_STATE_SHIFT_OPAQUE	= 64							- PIPELINE_STATE_NUMBER_OF_BITS;	// = 48
+		static constexpr uint32_t VERTEX_ARRAY_SHIFT_OPAQUE		= PIPELINE_STATE_SHIFT_OPAQUE	- VERTEX_ARRAY_NUMBER_OF_BITS;		// = 32
+		static constexpr uint32_t RESOURCE_GROUP_SHIFT_OPAQUE	= VERTEX_ARRAY_SHIFT_OPAQUE		- RESOURCE_GROUP_NUMBER_OF_BITS;	// = 21
+		static constexpr uint32_t DEPTH_SHIFT_OPAQUE			= RESOURCE_GROUP_SHIFT_OPAQUE	- DEPTH_NUMBER_OF_BITS;				// = 0
+
+		// Sorting key transparent bit shift: Transparent renderables are sorted by depth back to front, then by pipeline state, then by vertex array
+		static constexpr uint32_t DEPTH_SHIFT_TRANSPARENT			= 64								- DEPTH_NUMBER_OF_BITS;				// = 43
+		static constexpr uint32_t PIPELINE_STATE_SHIFT_TRANSPARENT	= DEPTH_SHIFT_TRANSPARENT			- PIPELINE_STATE_NUMBER_OF_BITS;	// = 27
+		static constexpr uint32_t VERTEX_ARRAY_SHIFT_TRANSPARENT	= PIPELINE_STATE_SHIFT_TRANSPARENT	- VERTEX_ARRAY_NUMBER_OF_BITS;		// = 11
+		static constexpr uint32_t RESOURCE_GROUP_SHIFT_TRANSPARENT	= VERTEX_ARRAY_SHIFT_TRANSPARENT	- RESOURCE_GROUP_NUMBER_OF_BITS;	// = 0
+
+
 		//[-------------------------------------------------------]
 		//[ Global functions                                      ]
 		//[-------------------------------------------------------]
@@ -77,6 +113,42 @@ namespace
 			return (f2i.i >> (32 - depthBits));	// Take highest n-bits
 		}
 
+		[[nodiscard]] uint64_t getSortingKey(bool transparentPass, uint32_t quantizedDepth, uint16_t pipelineStateId, uint32_t vertexArrayId, uint16_t resourceGroupId)
+		{
+			// Define helper macros
+			#define RENDER_QUEUE_MAKE_MASK(x) ((1u << (x)) - 1u)
+			#define RENDER_QUEUE_HASH(x, bits, shift) (uint64_t((x) & RENDER_QUEUE_MAKE_MASK((bits))) << (shift))
+
+			// Generate the sorting key
+			uint64_t sortingKey;	// Guaranteed to be initialized below
+			if (transparentPass)
+			{
+				// Transparent renderables are sorted by depth back to front, then by pipeline state, then by vertex array, then by resource group
+				sortingKey =
+				RENDER_QUEUE_HASH(quantizedDepth,	DEPTH_NUMBER_OF_BITS,			DEPTH_SHIFT_TRANSPARENT)			|
+				RENDER_QUEUE_HASH(pipelineStateId,	PIPELINE_STATE_NUMBER_OF_BITS,	PIPELINE_STATE_SHIFT_TRANSPARENT)	|
+				RENDER_QUEUE_HASH(vertexArrayId,	VERTEX_ARRAY_NUMBER_OF_BITS,	VERTEX_ARRAY_SHIFT_TRANSPARENT)		|
+				RENDER_QUEUE_HASH(resourceGroupId,	RESOURCE_GROUP_NUMBER_OF_BITS,	RESOURCE_GROUP_SHIFT_TRANSPARENT);
+			}
+			else
+			{
+				// Opaque renderables are first sorted by pipeline state, then by vertex array, then by resource group, then by depth front to back
+				// -> Renderables sharing the pipeline state, vertex array and resource groups are next to each other and are merged into a single multi-draw-indirect call
+				// -> Renderables only sharing the pipeline state still need one draw call per vertex array and texture resource group: There are neither bindless textures nor a shared vertex buffer
+				sortingKey =
+				RENDER_QUEUE_HASH(pipelineStateId,	PIPELINE_STATE_NUMBER_OF_BITS,	PIPELINE_STATE_SHIFT_OPAQUE)	|
+				RENDER_QUEUE_HASH(vertexArrayId,	VERTEX_ARRAY_NUMBER_OF_BITS,	VERTEX_ARRAY_SHIFT_OPAQUE)		|
+				RENDER_QUEUE_HASH(resourceGroupId,	RESOURCE_GROUP_NUMBER_OF_BITS,	RESOURCE_GROUP_SHIFT_OPAQUE)	|
+				RENDER_QUEUE_HASH(quantizedDepth,	DEPTH_NUMBER_OF_BITS,			DEPTH_SHIFT_OPAQUE);
+			}
+
+			// Undefine helper macros
+			#undef RENDER_QUEUE_HASH
+			#undef RENDER_QUEUE_MAKE_MASK
+
+			return sortingKey;
+		}
+
 		inline void setShaderPropertiesPropertyValue(Renderer::MaterialPropertyId materialPropertyId, const Renderer::MaterialPropertyValue& materialPropertyValue, Renderer::ShaderProperties& shaderProperties)
 		{
 			switch (materialPropertyValue.getValueType())
@@ -213,6 +285,169 @@ namespace
 		}
 
 
+
+		//[-------------------------------------------------------]
+		//[ Classes                                               ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Gathers the draws of renderables into multi-draw-indirect calls, used by the sequential as well as the parallel command recording
+		*/
+		class DrawRecorder final
+		{
+		public:
+			inline DrawRecorder(Renderer::Context& context, Rhi::IIndirectBuffer* indirectBuffer, uint32_t indirectBufferOffset, uint8_t* indirectBufferData, uint32_t instanceCount) :
+				mContext(context),
+				mIndirectBuffer(indirectBuffer),
+				mIndirectBufferOffset(indirectBufferOffset),
+				mIndirectBufferData(indirectBufferData),
+				mInstanceCount(instanceCount),
+				mInstanceBatching(1 == instanceCount),
+				mCurrentDrawIndirectBufferOffset(indirectBufferOffset),
+				mCurrentNumberOfDraws(0),
+				mCurrentDrawIndexed(false),
+				mPreviousDrawArguments(nullptr)
+			{
+				// Nothing here
+			}
+
+			/**
+			*  @brief
+			*    Emit the open multi-draw-indirect call if the given renderable can't be added to it, must be called before the state change commands of the renderable are added
+			*/
+			inline void beginRenderable(const Renderer::Renderable& renderable, bool stateChange, Rhi::CommandBuffer& commandBuffer)
+			{
+				if (renderable.getDrawIndexed() != mCurrentDrawIndexed || stateChange || nullptr != renderable.getIndirectBufferPtr())
+				{
+					flush(commandBuffer);
+					mCurrentDrawIndirectBufferOffset = mIndirectBufferOffset;
+					mPreviousDrawArguments = nullptr;
+				}
+			}
+
+			void draw(const Renderer::Renderable& renderable, uint32_t startInstanceLocation, Rhi::CommandBuffer& commandBuffer)
+			{
+				// Render the specified geometric primitive, based on indexing into an array of vertices
+				const Rhi::IIndirectBufferPtr& renderableIndirectBufferPtr = renderable.getIndirectBufferPtr();
+				if (nullptr != renderableIndirectBufferPtr)
+				{
+					// Use a given indirect buffer which content is e.g. filled by a compute shader
+					if (renderable.getDrawIndexed())
+					{
+						Rhi::Command::DrawIndexedGraphics::create(commandBuffer, *renderableIndirectBufferPtr, renderable.getIndirectBufferOffset(), renderable.getNumberOfDraws());
+					}
+					else
+					{
+						Rhi::Command::DrawGraphics::create(commandBuffer, *renderableIndirectBufferPtr, renderable.getIndirectBufferOffset(), renderable.getNumberOfDraws());
+					}
+				}
+				// Please note that it's valid that there are no indices, for example "Renderer::CompositorInstancePassDebugGui" is using the render queue only to set the material resource blueprint
+				else if (0 != renderable.getNumberOfIndices())
+				{
+					// Sanity checks
+					RHI_ASSERT(mContext, nullptr != mIndirectBuffer, "Invalid indirect buffer")
+					RHI_ASSERT(mContext, nullptr != mIndirectBufferData, "Invalid indirect buffer data")
+
+					// Instance batching: Renderables without own instancing drawing the same geometry as the previous draw of the multi-draw-indirect batch and
+					// using the directly following instance data are merged into the previous draw by increasing its instance count
+					// -> The per-instance "drawId" vertex attribute starts at the start instance location, so each merged instance still reads its own instance data
+					// -> Sorting by resource group and depth puts renderables of the same mesh next to each other
+					const bool mergeableRenderable = (mInstanceBatching && 1 == renderable.getInstanceCount());
+					if (nullptr != mPreviousDrawArguments && mergeableRenderable)
+					{
+						if (renderable.getDrawIndexed())
+						{
+							Rhi::DrawIndexedArguments* previousDrawIndexedArguments = reinterpret_cast<Rhi::DrawIndexedArguments*>(mPreviousDrawArguments);
+							if (mCurrentDrawIndexed && previousDrawIndexedArguments->indexCountPerInstance == renderable.getNumberOfIndices() && previousDrawIndexedArguments->startIndexLocation == renderable.getStartIndexLocation() &&
+								previousDrawIndexedArguments->startInstanceLocation + previousDrawIndexedArguments->instanceCount == startInstanceLocation)
+							{
+								++previousDrawIndexedArguments->instanceCount;
+								return;
+							}
+						}
+						else
+						{
+							Rhi::DrawArguments* previousDrawNonIndexedArguments = reinterpret_cast<Rhi::DrawArguments*>(mPreviousDrawArguments);
+							if (!mCurrentDrawIndexed && previousDrawNonIndexedArguments->vertexCountPerInstance == renderable.getNumberOfIndices() && previousDrawNonIndexedArguments->startVertexLocation == renderable.getStartIndexLocation() &&
+								previousDrawNonIndexedArguments->startInstanceLocation + previousDrawNonIndexedArguments->instanceCount == startInstanceLocation)
+							{
+								++previousDrawNonIndexedArguments->instanceCount;
+								return;
+							}
+						}
+					}
+					mPreviousDrawArguments = mergeableRenderable ? (mIndirectBufferData + mIndirectBufferOffset) : nullptr;
+
+					// Fill indirect buffer
+					if (renderable.getDrawIndexed())
+					{
+						// Fill indirect buffer
+						Rhi::DrawIndexedArguments* drawIndexedArguments = reinterpret_cast<Rhi::DrawIndexedArguments*>(mIndirectBufferData + mIndirectBufferOffset);
+						drawIndexedArguments->indexCountPerInstance	= renderable.getNumberOfIndices();
+						drawIndexedArguments->instanceCount			= mInstanceCount * renderable.getInstanceCount();
+						drawIndexedArguments->startIndexLocation	= renderable.getStartIndexLocation();
+						drawIndexedArguments->baseVertexLocation	= 0;
+						drawIndexedArguments->startInstanceLocation	= startInstanceLocation;
+
+						// Advance indirect buffer offset
+						mIndirectBufferOffset += sizeof(Rhi::DrawIndexedArguments);
+						mCurrentDrawIndexed = true;
+					}
+					else
+					{
+						// Fill indirect buffer
+						Rhi::DrawArguments* drawArguments = reinterpret_cast<Rhi::DrawArguments*>(mIndirectBufferData + mIndirectBufferOffset);
+						drawArguments->vertexCountPerInstance = renderable.getNumberOfIndices();
+						drawArguments->instanceCount		  = mInstanceCount * renderable.getInstanceCount();
+						drawArguments->startVertexLocation	  = renderable.getStartIndexLocation();
+						drawArguments->startInstanceLocation  = startInstanceLocation;
+
+						// Advance indirect buffer offset
+						mIndirectBufferOffset += sizeof(Rhi::DrawArguments);
+						mCurrentDrawIndexed = false;
+					}
+					++mCurrentNumberOfDraws;
+				}
+			}
+
+			/**
+			*  @brief
+			*    Emit the open multi-draw-indirect call, if there's one
+			*/
+			inline void flush(Rhi::CommandBuffer& commandBuffer)
+			{
+				if (mCurrentNumberOfDraws > 0)
+				{
+					if (mCurrentDrawIndexed)
+					{
+						Rhi::Command::DrawIndexedGraphics::create(commandBuffer, *mIndirectBuffer, mCurrentDrawIndirectBufferOffset, mCurrentNumberOfDraws);
+					}
+					else
+					{
+						Rhi::Command::DrawGraphics::create(commandBuffer, *mIndirectBuffer, mCurrentDrawIndirectBufferOffset, mCurrentNumberOfDraws);
+					}
+					mCurrentNumberOfDraws = 0;
+				}
+			}
+
+		private:
+			explicit DrawRecorder(const DrawRecorder&) = delete;
+			DrawRecorder& operator=(const DrawRecorder&) = delete;
+
+		private:
+			Renderer::Context&	  mContext;
+			Rhi::IIndirectBuffer* mIndirectBuffer;					///< Can be a null pointer if there are only renderables with own indirect buffers, don't destroy the instance
+			uint32_t			  mIndirectBufferOffset;			///< Offset of the next draw arguments to write
+			uint8_t*			  mIndirectBufferData;
+			const uint32_t		  mInstanceCount;
+			const bool			  mInstanceBatching;
+			// For gathering multi-draw-indirect data
+			uint32_t			  mCurrentDrawIndirectBufferOffset;
+			uint32_t			  mCurrentNumberOfDraws;
+			bool				  mCurrentDrawIndexed;
+			uint8_t*			  mPreviousDrawArguments;			///< Draw arguments of the previous draw inside the current multi-draw-indirect batch, only set if it can be extended by further instances
+		};
+
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
 //[-------------------------------------------------------]
@@ -227,6 +462,102 @@ namespace Renderer
 {
 
 
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	void RenderQueue::radixSortSortingKeys(std::vector<uint64_t>& sortingKeys, std::vector<uint32_t>& sortedIndices, std::vector<uint64_t>& scratchSortingKeys, std::vector<uint32_t>& scratchSortedIndices)
+	{
+		const size_t numberOfElements = sortingKeys.size();
+		if (0 == numberOfElements)
+		{
+			// Nothing to sort, also there's no first key to compare the digits with
+			return;
+		}
+		scratchSortingKeys.resize(numberOfElements);
+		scratchSortedIndices.resize(numberOfElements);
+
+		// Gather the histograms of all passes at once
+		uint32_t histograms[::detail::RADIX_SORT_NUMBER_OF_PASSES][::detail::RADIX_SORT_NUMBER_OF_BUCKETS] = {};
+		for (const uint64_t sortingKey : sortingKeys)
+		{
+			for (uint32_t pass = 0; pass < ::detail::RADIX_SORT_NUMBER_OF_PASSES; ++pass)
+			{
+				++histograms[pass][(sortingKey >> (pass * ::detail::RADIX_SORT_BITS_PER_PASS)) & (::detail::RADIX_SORT_NUMBER_OF_BUCKETS - 1)];
+			}
+		}
+
+		// Scatter pass by pass
+		for (uint32_t pass = 0; pass < ::detail::RADIX_SORT_NUMBER_OF_PASSES; ++pass)
+		{
+			// Skip digits all keys agree on, the scatter wouldn't change anything
+			uint32_t* histogram = histograms[pass];
+			const uint32_t shift = pass * ::detail::RADIX_SORT_BITS_PER_PASS;
+			if (histogram[(sortingKeys[0] >> shift) & (::detail::RADIX_SORT_NUMBER_OF_BUCKETS - 1)] == numberOfElements)
+			{
+				continue;
+			}
+
+			// Turn the histogram into bucket offsets
+			uint32_t offset = 0;
+			for (uint32_t bucket = 0; bucket < ::detail::RADIX_SORT_NUMBER_OF_BUCKETS; ++bucket)
+			{
+				const uint32_t count = histogram[bucket];
+				histogram[bucket] = offset;
+				offset += count;
+			}
+
+			// Scatter into the scratch buffers and swap them afterwards, swapping vectors doesn't copy the data
+			const uint64_t* RESTRICT sourceSortingKeys = sortingKeys.data();
+			const uint32_t* RESTRICT sourceSortedIndices = sortedIndices.data();
+			uint64_t* RESTRICT destinationSortingKeys = scratchSortingKeys.data();
+			uint32_t* RESTRICT destinationSortedIndices = scratchSortedIndices.data();
+			for (size_t i = 0; i < numberOfElements; ++i)
+			{
+				const uint64_t sortingKey = sourceSortingKeys[i];
+				const uint32_t destinationIndex = histogram[(sortingKey >> shift) & (::detail::RADIX_SORT_NUMBER_OF_BUCKETS - 1)]++;
+				destinationSortingKeys[destinationIndex] = sortingKey;
+				destinationSortedIndices[destinationIndex] = sourceSortedIndices[i];
+			}
+			std::swap(sortingKeys, scratchSortingKeys);
+			std::swap(sortedIndices, scratchSortedIndices);
+		}
+	}
+
+	bool RenderQueue::insertionSortSortingKeys(std::vector<uint64_t>& sortingKeys, std::vector<uint32_t>& sortedIndices)
+	{
+		const size_t numberOfElements = sortingKeys.size();
+		const size_t maximumNumberOfMoves = std::max(numberOfElements * ::detail::INSERTION_SORT_MOVES_PER_ELEMENT, static_cast<size_t>(::detail::INSERTION_SORT_MINIMUM_MAXIMUM_MOVES));
+		size_t numberOfMoves = 0;
+		uint64_t* RESTRICT keys = sortingKeys.data();
+		uint32_t* RESTRICT indices = sortedIndices.data();
+		for (size_t i = 1; i < numberOfElements; ++i)
+		{
+			const uint64_t sortingKey = keys[i];
+			if (keys[i - 1] > sortingKey)
+			{
+				const uint32_t index = indices[i];
+				size_t j = i;
+				do
+				{
+					keys[j] = keys[j - 1];
+					indices[j] = indices[j - 1];
+					--j;
+				} while (j > 0 && keys[j - 1] > sortingKey);
+				keys[j] = sortingKey;
+				indices[j] = index;
+
+				// Give up if the order is too different from the previous frame, keys and indices are still consistent at this point
+				numberOfMoves += i - j;
+				if (numberOfMoves > maximumNumberOfMoves)
+				{
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
@@ -240,7 +571,9 @@ namespace Renderer
 		mMaximumRenderQueueIndex(maximumRenderQueueIndex),
 		mPositionOnlyPass(positionOnlyPass),
 		mTransparentPass(transparentPass),
-		mDoSort(doSort)
+		mDoSort(doSort),
+		mTemporalCoherenceSorting(true),
+		mScratchCommandBuffer(&mRenderer.getContext().getAllocator())
 	{
 		RHI_ASSERT(mRenderer.getContext(), mMaximumRenderQueueIndex >= mMinimumRenderQueueIndex, "Invalid minimum/maximum render queue index")
 		mQueues.resize(static_cast<size_t>(mMaximumRenderQueueIndex - mMinimumRenderQueueIndex + 1));
@@ -264,48 +597,13 @@ namespace Renderer
 		// Sanity check
 		RHI_ASSERT(mRenderer.getContext(), renderableManager.isVisible(), "Invalid renderable manager visibility")
 
-		// Sorting key bits
-		static constexpr uint32_t PIPELINE_STATE_NUMBER_OF_BITS	= 16;
-		static constexpr uint32_t VERTEX_ARRAY_NUMBER_OF_BITS	= 16;
-		static constexpr uint32_t RESOURCE_GROUP_NUMBER_OF_BITS	= 11;	// TODO(co) Add resource group sorting
-		static constexpr uint32_t DEPTH_NUMBER_OF_BITS			= 21;
-
-		// Sorting key bit shift: Opaque renderables are first sorted by pipeline state, then by vertex array, then by depth front to back
-		static constexpr uint32_t PIPELINE_STATE_SHIFT_OPAQUE	= 64							- PIPELINE_STATE_NUMBER_OF_BITS;	// = 48
-		static constexpr uint32_t VERTEX_ARRAY_SHIFT_OPAQUE		= PIPELINE_STATE_SHIFT_OPAQUE	- VERTEX_ARRAY_NUMBER_OF_BITS;		// = 32
-		static constexpr uint32_t RESOURCE_GROUP_SHIFT_OPAQUE	= VERTEX_ARRAY_SHIFT_OPAQUE		- RESOURCE_GROUP_NUMBER_OF_BITS;	// = 21
-		static constexpr uint32_t DEPTH_SHIFT_OPAQUE			= RESOURCE_GROUP_SHIFT_OPAQUE	- DEPTH_NUMBER_OF_BITS;				// = 0
-
-		// Sorting key transparent bit shift: Transparent renderables are sorted by depth back to front, then by pipeline state, then by vertex array
-		static constexpr uint32_t DEPTH_SHIFT_TRANSPARENT			= 64								- DEPTH_NUMBER_OF_BITS;				// = 43
-		static constexpr uint32_t PIPELINE_STATE_SHIFT_TRANSPARENT	= DEPTH_SHIFT_TRANSPARENT			- PIPELINE_STATE_NUMBER_OF_BITS;	// = 27
-		static constexpr uint32_t VERTEX_ARRAY_SHIFT_TRANSPARENT	= PIPELINE_STATE_SHIFT_TRANSPARENT	- VERTEX_ARRAY_NUMBER_OF_BITS;		// = 11
-		static constexpr uint32_t RESOURCE_GROUP_SHIFT_TRANSPARENT	= VERTEX_ARRAY_SHIFT_TRANSPARENT	- RESOURCE_GROUP_NUMBER_OF_BITS;	// = 0
-
-		// Quantize the cached distance to camera
-		// -> Solid: Sort from front to back to benefit from early z rejection
-		// -> Transparent: Sort from back to front to have correct alpha blending
-		const uint32_t quantizedDepth = ::detail::depthToBits(mTransparentPass ? -renderableManager.getCachedDistanceToCamera() : renderableManager.getCachedDistanceToCamera(), DEPTH_NUMBER_OF_BITS);
-
-		// Optionally adjust and check the LOD index
-		uint8_t lodIndex = mRenderer.getMeshResourceManager().getNumberOfTopMeshLodsToRemove();
-		RHI_ASSERT(mRenderer.getContext(), 0 != renderableManager.getNumberOfLods(), "Invalid renderable manager which has no LODs: There must always be at least one LOD, namely the original none reduced version")
-		const uint8_t numberOfLods = renderableManager.getNumberOfLods();
-		if (lodIndex >= numberOfLods)
-		{
-			// Silently clamp to maximum LOD
-			lodIndex = static_cast<uint8_t>(static_cast<int>(numberOfLods) - 1);
-		}
-
 		// Register the renderables inside our renderables queue
-		const MaterialResourceManager& materialResourceManager = mRenderer.getMaterialResourceManager();
-		const MaterialBlueprintResourceManager& materialBlueprintResourceManager = mRenderer.getMaterialBlueprintResourceManager();
-		const MaterialProperties& globalMaterialProperties = materialBlueprintResourceManager.getGlobalMaterialProperties();
+		const uint32_t quantizedDepth = getQuantizedDepth(renderableManager);
 		const bool singlePassStereoInstancing = compositorContextData.getSinglePassStereoInstancing();
 		const RenderableManager::Renderables& renderables = renderableManager.getRenderables();
-		const uint32_t numberOfRenderablesPerLod = static_cast<uint32_t>(renderables.size()) / numberOfLods;	// Each LOD has the same number of renderables
-		uint32_t renderableIndex = numberOfRenderablesPerLod * lodIndex;
-		uint32_t renderableEndIndex = renderableIndex + numberOfRenderablesPerLod;
+		uint32_t renderableIndex = 0;
+		uint32_t renderableEndIndex = 0;
+		getLodRenderableRange(renderableManager, renderableIndex, renderableEndIndex);
 		for (; renderableIndex < renderableEndIndex; ++renderableIndex)
 		{
 			const Renderable& renderable = renderables[renderableIndex];
@@ -316,176 +614,80 @@ namespace Renderer
 				const uint8_t renderQueueIndex = renderable.getRenderQueueIndex();
 				if (renderQueueIndex >= mMinimumRenderQueueIndex && renderQueueIndex <= mMaximumRenderQueueIndex)
 				{
-					// Material resource
-					const MaterialResource* materialResource = materialResourceManager.tryGetById(renderable.getMaterialResourceId());
-					if (nullptr != materialResource)
-					{
-						MaterialTechnique* materialTechnique = materialResource->getMaterialTechniqueById(materialTechniqueId);
-						if (nullptr != materialTechnique)
-						{
-							MaterialBlueprintResource* materialBlueprintResource = materialBlueprintResourceManager.tryGetById(materialTechnique->getMaterialBlueprintResourceId());
-							if (nullptr != materialBlueprintResource && IResource::LoadingState::LOADED == materialBlueprintResource->getLoadingState())
-							{
-								// Get the pipeline state object (PSO) to use, preferably by using cached information
-								Rhi::IPipelineState* foundPipelineState = nullptr;
-								if (isValid(materialBlueprintResource->getComputeShaderBlueprintResourceId()))
-								{
-									// Compute material blueprint resource
-
-									// Get a simple conservative combined generation counter to detect whether or not the renderable pipeline state cache is still considered to be valid
-									const uint32_t generationCounter = materialResource->getMaterialProperties().getShaderCombinationGenerationCounter() + globalMaterialProperties.getShaderCombinationGenerationCounter() + materialBlueprintResource->getMaterialProperties().getShaderCombinationGenerationCounter();
-
-									// Get the pipeline state object (PSO) to use, preferably by using cached information
-									Renderable::PipelineStateCaches& pipelineStateCaches = const_cast<Renderable::PipelineStateCaches&>(renderable.mPipelineStateCaches);
-									for (Renderable::PipelineStateCache& pipelineStateCache : pipelineStateCaches)
-									{
-										if (materialTechniqueId == pipelineStateCache.materialTechniqueId)
-										{
-											if (generationCounter != pipelineStateCache.generationCounter)
-											{
-												::detail::gatherShaderProperties(*materialResource, *materialBlueprintResource, globalMaterialProperties, renderable, singlePassStereoInstancing, mScratchShaderProperties, mScratchOptimizedShaderProperties);
-												const ComputePipelineStateCache* computePipelineStateCache = materialBlueprintResource->getComputePipelineStateCacheManager().getComputePipelineStateCacheByCombination(mScratchOptimizedShaderProperties, false);
-
-												// As long as we received a fallback compute pipeline state cache, we can't update the renderable pipeline state cache
-												if (nullptr != computePipelineStateCache && nullptr != computePipelineStateCache->getComputePipelineStateObjectPtr() && !computePipelineStateCache->isUsingFallback())
-												{
-													pipelineStateCache.generationCounter = generationCounter;
-													pipelineStateCache.pipelineStatePtr = computePipelineStateCache->getComputePipelineStateObjectPtr();
-												}
-											}
-											foundPipelineState = static_cast<Rhi::IComputePipelineState*>(pipelineStateCache.pipelineStatePtr->getPointer());
-											RHI_ASSERT(mRenderer.getContext(), nullptr != foundPipelineState, "Invalid found compute pipeline state")
-											break;
-										}
-									}
-									if (nullptr == foundPipelineState)
-									{
-										::detail::gatherShaderProperties(*materialResource, *materialBlueprintResource, globalMaterialProperties, renderable, singlePassStereoInstancing, mScratchShaderProperties, mScratchOptimizedShaderProperties);
-										const ComputePipelineStateCache* computePipelineStateCache = materialBlueprintResource->getComputePipelineStateCacheManager().getComputePipelineStateCacheByCombination(mScratchOptimizedShaderProperties, false);
-										if (nullptr != computePipelineStateCache && nullptr != computePipelineStateCache->getComputePipelineStateObjectPtr())
-										{
-											// As long as we received a fallback compute pipeline state cache, we can't put it into the renderable pipeline state cache
-											if (computePipelineStateCache->isUsingFallback())
-											{
-												foundPipelineState = static_cast<Rhi::IComputePipelineState*>(computePipelineStateCache->getComputePipelineStateObjectPtr());
-											}
-											else
-											{
-												foundPipelineState = static_cast<Rhi::IComputePipelineState*>(pipelineStateCaches.emplace_back(materialTechniqueId, generationCounter, computePipelineStateCache->getComputePipelineStateObjectPtr()).pipelineStatePtr.getPointer());
-											}
-											RHI_ASSERT(mRenderer.getContext(), nullptr != foundPipelineState, "Invalid found compute pipeline state")
-										}
-									}
-								}
-								else
-								{
-									// Graphics material blueprint resource
-
-									// Get a simple conservative combined generation counter to detect whether or not the renderable pipeline state cache is still considered to be valid
-									const uint32_t generationCounter = materialResource->getMaterialProperties().getShaderCombinationGenerationCounter() + globalMaterialProperties.getShaderCombinationGenerationCounter() + materialBlueprintResource->getMaterialProperties().getShaderCombinationGenerationCounter() + materialTechnique->getSerializedGraphicsPipelineStateHash();
-
-									// Get the pipeline state object (PSO) to use, preferably by using cached information
-									Renderable::PipelineStateCaches& pipelineStateCaches = const_cast<Renderable::PipelineStateCaches&>(renderable.mPipelineStateCaches);
-									for (Renderable::PipelineStateCache& pipelineStateCache : pipelineStateCaches)
-									{
-										if (materialTechniqueId == pipelineStateCache.materialTechniqueId)
-										{
-											if (generationCounter != pipelineStateCache.generationCounter)
-											{
-												::detail::gatherShaderProperties(*materialResource, *materialBlueprintResource, globalMaterialProperties, renderable, singlePassStereoInstancing, mScratchShaderProperties, mScratchOptimizedShaderProperties);
-												const GraphicsPipelineStateCache* graphicsPipelineStateCache = materialBlueprintResource->getGraphicsPipelineStateCacheManager().getGraphicsPipelineStateCacheByCombination(materialTechnique->getSerializedGraphicsPipelineStateHash(), mScratchOptimizedShaderProperties, false);
-
-												// As long as we received a fallback graphics pipeline state cache, we can't update the renderable pipeline state cache
-												if (nullptr != graphicsPipelineStateCache && nullptr != graphicsPipelineStateCache->getGraphicsPipelineStateObjectPtr() && !graphicsPipelineStateCache->isUsingFallback())
-												{
-													pipelineStateCache.generationCounter = generationCounter;
-													pipelineStateCache.pipelineStatePtr = graphicsPipelineStateCache->getGraphicsPipelineStateObjectPtr();
-												}
-											}
-											foundPipelineState = static_cast<Rhi::IGraphicsPipelineState*>(pipelineStateCache.pipelineStatePtr->getPointer());
-											RHI_ASSERT(mRenderer.getContext(), nullptr != foundPipelineState, "Invalid found graphics pipeline state")
-											break;
-										}
-									}
-									if (nullptr == foundPipelineState)
-									{
-										::detail::gatherShaderProperties(*materialResource, *materialBlueprintResource, globalMaterialProperties, renderable, singlePassStereoInstancing, mScratchShaderProperties, mScratchOptimizedShaderProperties);
-										const GraphicsPipelineStateCache* graphicsPipelineStateCache = materialBlueprintResource->getGraphicsPipelineStateCacheManager().getGraphicsPipelineStateCacheByCombination(materialTechnique->getSerializedGraphicsPipelineStateHash(), mScratchOptimizedShaderProperties, false);
-										if (nullptr != graphicsPipelineStateCache && nullptr != graphicsPipelineStateCache->getGraphicsPipelineStateObjectPtr())
-										{
-											// As long as we received a fallback graphics pipeline state cache, we can't put it into the renderable pipeline state cache
-											if (graphicsPipelineStateCache->isUsingFallback())
-											{
-												foundPipelineState = static_cast<Rhi::IGraphicsPipelineState*>(graphicsPipelineStateCache->getGraphicsPipelineStateObjectPtr());
-											}
-											else
-											{
-												foundPipelineState = static_cast<Rhi::IGraphicsPipelineState*>(pipelineStateCaches.emplace_back(materialTechniqueId, generationCounter, graphicsPipelineStateCache->getGraphicsPipelineStateObjectPtr()).pipelineStatePtr.getPointer());
-											}
-											RHI_ASSERT(mRenderer.getContext(), nullptr != foundPipelineState, "Invalid found graphics pipeline state")
-										}
-									}
-								}
-								if (nullptr != foundPipelineState)
-								{
-									const uint16_t pipelineStateId = foundPipelineState->getId();
-									const uint16_t resourceGroupId = 0;	// TODO(co) Add resource group sorting
-									const uint32_t vertexArrayId = mPositionOnlyPass ? ((nullptr != renderable.getPositionOnlyVertexArrayPtrWithFallback()) ? renderable.getPositionOnlyVertexArrayPtrWithFallback()->getId() : 0u) : ((nullptr != renderable.getVertexArrayPtr()) ? renderable.getVertexArrayPtr()->getId() : 0u);
+					addRenderable(renderable, materialTechniqueId, quantizedDepth, singlePassStereoInstancing);
+				}
+			}
+		}
+	}
 
-									// Define helper macros
-									#define RENDER_QUEUE_MAKE_MASK(x) ((1u << (x)) - 1u)
-									#define RENDER_QUEUE_HASH(x, bits, shift) (uint64_t((x) & RENDER_QUEUE_MAKE_MASK((bits))) << (shift))
+	void RenderQueue::addRenderablesFromRenderableManagers(const std::vector<RenderableManager*>& renderableManagers, MaterialTechniqueId materialTechniqueId, const CompositorContextData& compositorContextData, bool castShadows)
+	{
+		// Unsorted render queues are processed in the order the renderables were added, keep it simple and deterministic in this case
+		const uint32_t numberOfRenderableManagers = static_cast<uint32_t>(renderableManagers.size());
+		JobSystem& jobSystem = mRenderer.getJobSystem();
+		const uint32_t grainSize = jobSystem.getGrainSize(numberOfRenderableManagers, ::detail::RENDERABLE_MANAGERS_GRANULARITY);
+		if (!mDoSort || grainSize >= numberOfRenderableManagers)
+		{
+			for (const RenderableManager* renderableManager : renderableManagers)
+			{
+				addRenderablesFromRenderableManager(*renderableManager, materialTechniqueId, compositorContextData, castShadows);
+			}
+			return;
+		}
 
-									// Generate the sorting key
-									uint64_t sortingKey;	// Guaranteed to be initialized below
-									if (mTransparentPass)
-									{
-										// Transparent renderables are sorted by depth back to front, then by pipeline state, then by vertex array
-										sortingKey =
-										RENDER_QUEUE_HASH(quantizedDepth,	DEPTH_NUMBER_OF_BITS,			DEPTH_SHIFT_TRANSPARENT)			|
-										RENDER_QUEUE_HASH(pipelineStateId,	PIPELINE_STATE_NUMBER_OF_BITS,	PIPELINE_STATE_SHIFT_TRANSPARENT)	|
-										RENDER_QUEUE_HASH(vertexArrayId,	VERTEX_ARRAY_NUMBER_OF_BITS,	VERTEX_ARRAY_SHIFT_TRANSPARENT)		|
-										RENDER_QUEUE_HASH(resourceGroupId,	RESOURCE_GROUP_NUMBER_OF_BITS,	RESOURCE_GROUP_SHIFT_TRANSPARENT);
-									}
-									else
-									{
-										// Opaque renderables are first sorted by pipeline state, then by vertex array, then by depth front to back
-										sortingKey =
-										RENDER_QUEUE_HASH(pipelineStateId,	PIPELINE_STATE_NUMBER_OF_BITS,	PIPELINE_STATE_SHIFT_OPAQUE)	|
-										RENDER_QUEUE_HASH(vertexArrayId,	VERTEX_ARRAY_NUMBER_OF_BITS,	VERTEX_ARRAY_SHIFT_OPAQUE)		|
-										RENDER_QUEUE_HASH(resourceGroupId,	RESOURCE_GROUP_NUMBER_OF_BITS,	RESOURCE_GROUP_SHIFT_OPAQUE)	|
-										RENDER_QUEUE_HASH(quantizedDepth,	DEPTH_NUMBER_OF_BITS,			DEPTH_SHIFT_OPAQUE);
-									}
+		// Each range of renderable managers gets its own partial queues so the jobs don't need to synchronize
+		// -> Indexed by range instead of thread so merging the partial queues is deterministic
+		const uint32_t numberOfPartialQueues = (numberOfRenderableManagers + grainSize - 1) / grainSize;
+		if (mPartialQueues.size() < numberOfPartialQueues)
+		{
+			mPartialQueues.resize(numberOfPartialQueues);
+		}
+		const size_t numberOfQueues = mQueues.size();
+		for (uint32_t i = 0; i < numberOfPartialQueues; ++i)
+		{
+			PartialQueue& partialQueue = mPartialQueues[i];
+			partialQueue.queuedRenderables.resize(numberOfQueues);
+			for (QueuedRenderables& queuedRenderables : partialQueue.queuedRenderables)
+			{
+				queuedRenderables.clear();
+			}
+			partialQueue.deferredRenderables.clear();
+			partialQueue.numberOfNullDrawCalls = partialQueue.numberOfDrawIndexedCalls = partialQueue.numberOfDrawCalls = 0;
+		}
 
-									// Undefine helper macros
-									#undef RENDER_QUEUE_HASH
-									#undef RENDER_QUEUE_MAKE_MASK
+		// Gather the queued renderables in parallel
+		// -> Only renderables with a valid cached pipeline state are handled by the jobs, updating pipeline state caches isn't thread-safe
+		const bool singlePassStereoInstancing = compositorContextData.getSinglePassStereoInstancing();
+		jobSystem.parallelFor(numberOfRenderableManagers, ::detail::RENDERABLE_MANAGERS_GRANULARITY, [&](uint32_t startIndex, uint32_t endIndex)
+		{
+			PartialQueue& partialQueue = mPartialQueues[startIndex / grainSize];
+			for (uint32_t renderableManagerIndex = startIndex; renderableManagerIndex < endIndex; ++renderableManagerIndex)
+			{
+				addRenderablesFromRenderableManagerToPartialQueue(*renderableManagers[renderableManagerIndex], materialTechniqueId, castShadows, partialQueue);
+			}
+		});
 
-									// Register the renderable inside our renderables queue
-									Queue& queue = mQueues[static_cast<size_t>(renderQueueIndex - mMinimumRenderQueueIndex)];
-									RHI_ASSERT(mRenderer.getContext(), !queue.sorted, "Ensure render queue is still in filling state and not already in rendering state")
-									queue.queuedRenderables.emplace_back(renderable, *materialResource, *materialTechnique, *materialBlueprintResource, *foundPipelineState, sortingKey);
-									if (0 != renderable.getNumberOfIndices())
-									{
-										if (renderable.getDrawIndexed())
-										{
-											++mNumberOfDrawIndexedCalls;
-										}
-										else
-										{
-											++mNumberOfDrawCalls;
-										}
-									}
-									else
-									{
-										++mNumberOfNullDrawCalls;
-									}
-								}
-							}
-						}
-					}
+		// Merge the partial queues and add the deferred renderables which need a pipeline state cache update
+		for (uint32_t i = 0; i < numberOfPartialQueues; ++i)
+		{
+			PartialQueue& partialQueue = mPartialQueues[i];
+			for (size_t queueIndex = 0; queueIndex < numberOfQueues; ++queueIndex)
+			{
+				const QueuedRenderables& partialQueuedRenderables = partialQueue.queuedRenderables[queueIndex];
+				if (!partialQueuedRenderables.empty())
+				{
+					Queue& queue = mQueues[queueIndex];
+					RHI_ASSERT(mRenderer.getContext(), !queue.sorted, "Ensure render queue is still in filling state and not already in rendering state")
+					queue.queuedRenderables.insert(queue.queuedRenderables.end(), partialQueuedRenderables.cbegin(), partialQueuedRenderables.cend());
 				}
 			}
+			mNumberOfNullDrawCalls += partialQueue.numberOfNullDrawCalls;
+			mNumberOfDrawIndexedCalls += partialQueue.numberOfDrawIndexedCalls;
+			mNumberOfDrawCalls += partialQueue.numberOfDrawCalls;
+			for (const DeferredRenderable& deferredRenderable : partialQueue.deferredRenderables)
+			{
+				addRenderable(*deferredRenderable.renderable, materialTechniqueId, deferredRenderable.quantizedDepth, singlePassStereoInstancing);
+			}
 		}
 	}
 
@@ -586,6 +788,12 @@ namespace Renderer
 				}
 			}
 		}
+		else if (::detail::RECORDING_JOBS_GRANULARITY < getNumberOfDrawCalls() && mRenderer.getRhi().getCapabilities().nativeMultithreading && mRenderer.getJobSystem().getNumberOfWorkerThreads() > 0)
+		{
+			// Record the commands by using the job system, each job records at least the granularity number of renderables
+			const uint32_t numberOfJobs = std::min(mRenderer.getJobSystem().getNumberOfThreads(), getNumberOfDrawCalls() / ::detail::RECORDING_JOBS_GRANULARITY);
+			fillGraphicsCommandBufferParallel(renderTarget, compositorContextData, commandBuffer, numberOfJobs);
+		}
 		else
 		{
 			// Track currently bound RHI resources and states to void generating redundant commands
@@ -612,9 +820,7 @@ namespace Renderer
 
 			// For gathering multi-draw-indirect data
 			std::array<Rhi::IResourceGroup*, 16> currentSetGraphicsResourceGroup;	// TODO(co) Use maximum number of graphics resource groups here, 16 is considered a save number of root parameters
-			uint32_t currentDrawIndirectBufferOffset = indirectBufferOffset;
-			uint32_t currentNumberOfDraws = 0;
-			bool currentDrawIndexed = false;
+			::detail::DrawRecorder drawRecorder(mRenderer.getContext(), indirectBuffer, indirectBufferOffset, indirectBufferData, instanceCount);
 
 			// Process queues
 			for (Queue& queue : mQueues)
@@ -623,23 +829,16 @@ namespace Renderer
 				if (!queuedRenderables.empty())
 				{
 					// Sort queued renderables
-					if (!queue.sorted && mDoSort)
+					if (!queue.sorted)
 					{
-						// TODO(co) Exploit temporal coherence across frames then use insertion sorts as explained by L. Spiro in
-						// http://www.gamedev.net/topic/661114-temporal-coherence-and-render-queue-sorting/?view=findpost&p=5181408
-						// Keep a list of sorted indices from the previous frame (one per camera).
-						// If we have the sorted list "5, 1, 4, 3, 2, 0":
-						// * If it grew from last frame, append: 5, 1, 4, 3, 2, 0, 6, 7 and use insertion sort.
-						// * If it's the same, leave it as is, and use insertion sort just in case.
-						// * If it's shorter, reset the indices 0, 1, 2, 3, 4; probably use quicksort or other generic sort
-						// TODO(co) Use radix sort? ( https://www.quora.com/What-is-the-most-efficient-way-to-sort-a-million-32-bit-integers )
-						std::sort(queuedRenderables.begin(), queuedRenderables.end());
+						sortQueue(queue, compositorContextData.getCameraSceneItem());
 						queue.sorted = true;
 					}
 
 					// Inject queued renderables into the RHI
-					for (const QueuedRenderable& queuedRenderable : queuedRenderables)
+					for (const uint32_t queuedRenderableIndex : queue.sortedIndices)
 					{
+						const QueuedRenderable& queuedRenderable = queuedRenderables[queuedRenderableIndex];
 						RHI_ASSERT(mRenderer.getContext(), nullptr != queuedRenderable.renderable, "Invalid renderable")
 
 						// Get queued renderable data
@@ -733,24 +932,7 @@ namespace Renderer
 						}
 
 						// Emit draw command, if necessary
-						const Rhi::IIndirectBufferPtr& renderableIndirectBufferPtr = renderable.getIndirectBufferPtr();
-						if (renderable.getDrawIndexed() != currentDrawIndexed || !mScratchCommandBuffer.isEmpty() || nullptr != renderableIndirectBufferPtr)
-						{
-							if (currentDrawIndexed)
-							{
-								if (currentNumberOfDraws)
-								{
-									Rhi::Command::DrawIndexedGraphics::create(commandBuffer, *indirectBuffer, currentDrawIndirectBufferOffset, currentNumberOfDraws);
-									currentNumberOfDraws = 0;
-								}
-							}
-							else if (currentNumberOfDraws)
-							{
-								Rhi::Command::DrawGraphics::create(commandBuffer, *indirectBuffer, currentDrawIndirectBufferOffset, currentNumberOfDraws);
-								currentNumberOfDraws = 0;
-							}
-							currentDrawIndirectBufferOffset = indirectBufferOffset;
-						}
+						drawRecorder.beginRenderable(renderable, !mScratchCommandBuffer.isEmpty(), commandBuffer);
 
 						// Append scratch command buffer into the main command buffer
 						if (!mScratchCommandBuffer.isEmpty())
@@ -759,71 +941,13 @@ namespace Renderer
 						}
 
 						// Render the specified geometric primitive, based on indexing into an array of vertices
-						if (nullptr != renderableIndirectBufferPtr)
-						{
-							// Use a given indirect buffer which content is e.g. filled by a compute shader
-							if (renderable.getDrawIndexed())
-							{
-								Rhi::Command::DrawIndexedGraphics::create(commandBuffer, *renderableIndirectBufferPtr, renderable.getIndirectBufferOffset(), renderable.getNumberOfDraws());
-							}
-							else
-							{
-								Rhi::Command::DrawGraphics::create(commandBuffer, *renderableIndirectBufferPtr, renderable.getIndirectBufferOffset(), renderable.getNumberOfDraws());
-							}
-						}
-						// Please note that it's valid that there are no indices, for example "Renderer::CompositorInstancePassDebugGui" is using the render queue only to set the material resource blueprint
-						else if (0 != renderable.getNumberOfIndices())
-						{
-							// Sanity checks
-							RHI_ASSERT(mRenderer.getContext(), nullptr != indirectBuffer, "Invalid indirect buffer")
-							RHI_ASSERT(mRenderer.getContext(), nullptr != indirectBuffer, "Invalid indirect buffer data")
-
-							// Fill indirect buffer
-							if (renderable.getDrawIndexed())
-							{
-								// Fill indirect buffer
-								Rhi::DrawIndexedArguments* drawIndexedArguments = reinterpret_cast<Rhi::DrawIndexedArguments*>(indirectBufferData + indirectBufferOffset);
-								drawIndexedArguments->indexCountPerInstance	= renderable.getNumberOfIndices();
-								drawIndexedArguments->instanceCount			= instanceCount * renderable.getInstanceCount();
-								drawIndexedArguments->startIndexLocation	= renderable.getStartIndexLocation();
-								drawIndexedArguments->baseVertexLocation	= 0;
-								drawIndexedArguments->startInstanceLocation	= startInstanceLocation;
-
-								// Advance indirect buffer offset
-								indirectBufferOffset += sizeof(Rhi::DrawIndexedArguments);
-								currentDrawIndexed = true;
-							}
-							else
-							{
-								// Fill indirect buffer
-								Rhi::DrawArguments* drawArguments = reinterpret_cast<Rhi::DrawArguments*>(indirectBufferData + indirectBufferOffset);
-								drawArguments->vertexCountPerInstance = renderable.getNumberOfIndices();
-								drawArguments->instanceCount		  = instanceCount * renderable.getInstanceCount();
-								drawArguments->startVertexLocation	  = renderable.getStartIndexLocation();
-								drawArguments->startInstanceLocation  = startInstanceLocation;
-
-								// Advance indirect buffer offset
-								indirectBufferOffset += sizeof(Rhi::DrawArguments);
-								currentDrawIndexed = false;
-							}
-							++currentNumberOfDraws;
-						}
+						drawRecorder.draw(renderable, startInstanceLocation, commandBuffer);
 					}
 				}
 			}
 
 			// Emit last open draw command, if necessary
-			if (currentNumberOfDraws)
-			{
-				if (currentDrawIndexed)
-				{
-					Rhi::Command::DrawIndexedGraphics::create(commandBuffer, *indirectBuffer, currentDrawIndirectBufferOffset, currentNumberOfDraws);
-				}
-				else
-				{
-					Rhi::Command::DrawGraphics::create(commandBuffer, *indirectBuffer, currentDrawIndirectBufferOffset, currentNumberOfDraws);
-				}
-			}
+			drawRecorder.flush(commandBuffer);
 		}
 	}
 
@@ -1029,6 +1153,586 @@ namespace Renderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	uint32_t RenderQueue::getQuantizedDepth(const RenderableManager& renderableManager) const
+	{
+		// Quantize the cached distance to camera
+		// -> Solid: Sort from front to back to benefit from early z rejection
+		// -> Transparent: Sort from back to front to have correct alpha blending
+		return ::detail::depthToBits(mTransparentPass ? -renderableManager.getCachedDistanceToCamera() : renderableManager.getCachedDistanceToCamera(), ::detail::DEPTH_NUMBER_OF_BITS);
+	}
+
+	void RenderQueue::getLodRenderableRange(const RenderableManager& renderableManager, uint32_t& renderableIndex, uint32_t& renderableEndIndex) const
+	{
+		// Optionally adjust and check the LOD index
+		// -> The screen space LOD selected during the culling phase, the number of top mesh LODs to remove is the finest LOD allowed
+		uint8_t lodIndex = std::max(renderableManager.getCachedLodIndex(), mRenderer.getMeshResourceManager().getNumberOfTopMeshLodsToRemove());
+		RHI_ASSERT(mRenderer.getContext(), 0 != renderableManager.getNumberOfLods(), "Invalid renderable manager which has no LODs: There must always be at least one LOD, namely the original none reduced version")
+		const uint8_t numberOfLods = renderableManager.getNumberOfLods();
+		if (lodIndex >= numberOfLods)
+		{
+			// Silently clamp to maximum LOD
+			lodIndex = static_cast<uint8_t>(static_cast<int>(numberOfLods) - 1);
+		}
+
+		// Each LOD has the same number of renderables
+		const uint32_t numberOfRenderablesPerLod = static_cast<uint32_t>(renderableManager.getRenderables().size()) / numberOfLods;
+		renderableIndex = numberOfRenderablesPerLod * lodIndex;
+		renderableEndIndex = renderableIndex + numberOfRenderablesPerLod;
+	}
+
+	void RenderQueue::addRenderable(const Renderable& renderable, MaterialTechniqueId materialTechniqueId, uint32_t quantizedDepth, bool singlePassStereoInstancing)
+	{
+		const MaterialResourceManager& materialResourceManager = mRenderer.getMaterialResourceManager();
+		const MaterialBlueprintResourceManager& materialBlueprintResourceManager = mRenderer.getMaterialBlueprintResourceManager();
+		const MaterialProperties& globalMaterialProperties = materialBlueprintResourceManager.getGlobalMaterialProperties();
+		const uint8_t renderQueueIndex = renderable.getRenderQueueIndex();
+
+		// Material resource
+		const MaterialResource* materialResource = materialResourceManager.tryGetById(renderable.getMaterialResourceId());
+		if (nullptr != materialResource)
+		{
+			MaterialTechnique* materialTechnique = materialResource->getMaterialTechniqueById(materialTechniqueId);
+			if (nullptr != materialTechnique)
+			{
+				MaterialBlueprintResource* materialBlueprintResource = materialBlueprintResourceManager.tryGetById(materialTechnique->getMaterialBlueprintResourceId());
+				if (nullptr != materialBlueprintResource && IResource::LoadingState::LOADED == materialBlueprintResource->getLoadingState())
+				{
+					// Get the pipeline state object (PSO) to use, preferably by using cached information
+					Rhi::IPipelineState* foundPipelineState = nullptr;
+					if (isValid(materialBlueprintResource->getComputeShaderBlueprintResourceId()))
+					{
+						// Compute material blueprint resource
+
+						// Get a simple conservative combined generation counter to detect whether or not the renderable pipeline state cache is still considered to be valid
+						const uint32_t generationCounter = materialResource->getMaterialProperties().getShaderCombinationGenerationCounter() + globalMaterialProperties.getShaderCombinationGenerationCounter() + materialBlueprintResource->getMaterialProperties().getShaderCombinationGenerationCounter();
+
+						// Get the pipeline state object (PSO) to use, preferably by using cached information
+						Renderable::PipelineStateCaches& pipelineStateCaches = const_cast<Renderable::PipelineStateCaches&>(renderable.mPipelineStateCaches);
+						for (Renderable::PipelineStateCache& pipelineStateCache : pipelineStateCaches)
+						{
+							if (materialTechniqueId == pipelineStateCache.materialTechniqueId)
+							{
+								if (generationCounter != pipelineStateCache.generationCounter)
+								{
+									::detail::gatherShaderProperties(*materialResource, *materialBlueprintResource, globalMaterialProperties, renderable, singlePassStereoInstancing, mScratchShaderProperties, mScratchOptimizedShaderProperties);
+									const ComputePipelineStateCache* computePipelineStateCache = materialBlueprintResource->getComputePipelineStateCacheManager().getComputePipelineStateCacheByCombination(mScratchOptimizedShaderProperties, false);
+
+									// As long as we received a fallback compute pipeline state cache, we can't update the renderable pipeline state cache
+									if (nullptr != computePipelineStateCache && nullptr != computePipelineStateCache->getComputePipelineStateObjectPtr() && !computePipelineStateCache->isUsingFallback())
+									{
+										pipelineStateCache.generationCounter = generationCounter;
+										pipelineStateCache.pipelineStatePtr = computePipelineStateCache->getComputePipelineStateObjectPtr();
+									}
+								}
+								foundPipelineState = static_cast<Rhi::IComputePipelineState*>(pipelineStateCache.pipelineStatePtr->getPointer());
+								RHI_ASSERT(mRenderer.getContext(), nullptr != foundPipelineState, "Invalid found compute pipeline state")
+								break;
+							}
+						}
+						if (nullptr == foundPipelineState)
+						{
+							::detail::gatherShaderProperties(*materialResource, *materialBlueprintResource, globalMaterialProperties, renderable, singlePassStereoInstancing, mScratchShaderProperties, mScratchOptimizedShaderProperties);
+							const ComputePipelineStateCache* computePipelineStateCache = materialBlueprintResource->getComputePipelineStateCacheManager().getComputePipelineStateCacheByCombination(mScratchOptimizedShaderProperties, false);
+							if (nullptr != computePipelineStateCache && nullptr != computePipelineStateCache->getComputePipelineStateObjectPtr())
+							{
+								// As long as we received a fallback compute pipeline state cache, we can't put it into the renderable pipeline state cache
+								if (computePipelineStateCache->isUsingFallback())
+								{
+									foundPipelineState = static_cast<Rhi::IComputePipelineState*>(computePipelineStateCache->getComputePipelineStateObjectPtr());
+								}
+								else
+								{
+									foundPipelineState = static_cast<Rhi::IComputePipelineState*>(pipelineStateCaches.emplace_back(materialTechniqueId, generationCounter, computePipelineStateCache->getComputePipelineStateObjectPtr()).pipelineStatePtr.getPointer());
+								}
+								RHI_ASSERT(mRenderer.getContext(), nullptr != foundPipelineState, "Invalid found compute pipeline state")
+							}
+						}
+					}
+					else
+					{
+						// Graphics material blueprint resource
+
+						// Get a simple conservative combined generation counter to detect whether or not the renderable pipeline state cache is still considered to be valid
+						const uint32_t generationCounter = materialResource->getMaterialProperties().getShaderCombinationGenerationCounter() + globalMaterialProperties.getShaderCombinationGenerationCounter() + materialBlueprintResource->getMaterialProperties().getShaderCombinationGenerationCounter() + materialTechnique->getSerializedGraphicsPipelineStateHash();
+
+						// Get the pipeline state object (PSO) to use, preferably by using cached information
+						Renderable::PipelineStateCaches& pipelineStateCaches = const_cast<Renderable::PipelineStateCaches&>(renderable.mPipelineStateCaches);
+						for (Renderable::PipelineStateCache& pipelineStateCache : pipelineStateCaches)
+						{
+							if (materialTechniqueId == pipelineStateCache.materialTechniqueId)
+							{
+								if (generationCounter != pipelineStateCache.generationCounter)
+								{
+									::detail::gatherShaderProperties(*materialResource, *materialBlueprintResource, globalMaterialProperties, renderable, singlePassStereoInstancing, mScratchShaderProperties, mScratchOptimizedShaderProperties);
+									const GraphicsPipelineStateCache* graphicsPipelineStateCache = materialBlueprintResource->getGraphicsPipelineStateCacheManager().getGraphicsPipelineStateCacheByCombination(materialTechnique->getSerializedGraphicsPipelineStateHash(), mScratchOptimizedShaderProperties, false);
+
+									// As long as we received a fallback graphics pipeline state cache, we can't update the renderable pipeline state cache
+									if (nullptr != graphicsPipelineStateCache && nullptr != graphicsPipelineStateCache->getGraphicsPipelineStateObjectPtr() && !graphicsPipelineStateCache->isUsingFallback())
+									{
+										pipelineStateCache.generationCounter = generationCounter;
+										pipelineStateCache.pipelineStatePtr = graphicsPipelineStateCache->getGraphicsPipelineStateObjectPtr();
+									}
+								}
+								foundPipelineState = static_cast<Rhi::IGraphicsPipelineState*>(pipelineStateCache.pipelineStatePtr->getPointer());
+								RHI_ASSERT(mRenderer.getContext(), nullptr != foundPipelineState, "Invalid found graphics pipeline state")
+								break;
+							}
+						}
+						if (nullptr == foundPipelineState)
+						{
+							::detail::gatherShaderProperties(*materialResource, *materialBlueprintResource, globalMaterialProperties, renderable, singlePassStereoInstancing, mScratchShaderProperties, mScratchOptimizedShaderProperties);
+							const GraphicsPipelineStateCache* graphicsPipelineStateCache = materialBlueprintResource->getGraphicsPipelineStateCacheManager().getGraphicsPipelineStateCacheByCombination(materialTechnique->getSerializedGraphicsPipelineStateHash(), mScratchOptimizedShaderProperties, false);
+							if (nullptr != graphicsPipelineStateCache && nullptr != graphicsPipelineStateCache->getGraphicsPipelineStateObjectPtr())
+							{
+								// As long as we received a fallback graphics pipeline state cache, we can't put it into the renderable pipeline state cache
+								if (graphicsPipelineStateCache->isUsingFallback())
+								{
+									foundPipelineState = static_cast<Rhi::IGraphicsPipelineState*>(graphicsPipelineStateCache->getGraphicsPipelineStateObjectPtr());
+								}
+								else
+								{
+									foundPipelineState = static_cast<Rhi::IGraphicsPipelineState*>(pipelineStateCaches.emplace_back(materialTechniqueId, generationCounter, graphicsPipelineStateCache->getGraphicsPipelineStateObjectPtr()).pipelineStatePtr.getPointer());
+								}
+								RHI_ASSERT(mRenderer.getContext(), nullptr != foundPipelineState, "Invalid found graphics pipeline state")
+							}
+						}
+					}
+					if (nullptr != foundPipelineState)
+					{
+						const uint16_t pipelineStateId = foundPipelineState->getId();
+						const uint32_t vertexArrayId = mPositionOnlyPass ? ((nullptr != renderable.getPositionOnlyVertexArrayPtrWithFallback()) ? renderable.getPositionOnlyVertexArrayPtrWithFallback()->getId() : 0u) : ((nullptr != renderable.getVertexArrayPtr()) ? renderable.getVertexArrayPtr()->getId() : 0u);
+						const uint64_t sortingKey = ::detail::getSortingKey(mTransparentPass, quantizedDepth, pipelineStateId, vertexArrayId, materialTechnique->getResourceGroupSortingId());
+
+						// Register the renderable inside our renderables queue
+						Queue& queue = mQueues[static_cast<size_t>(renderQueueIndex - mMinimumRenderQueueIndex)];
+						RHI_ASSERT(mRenderer.getContext(), !queue.sorted, "Ensure render queue is still in filling state and not already in rendering state")
+						queue.queuedRenderables.emplace_back(renderable, *materialResource, *materialTechnique, *materialBlueprintResource, *foundPipelineState, sortingKey);
+						if (0 != renderable.getNumberOfIndices())
+						{
+							if (renderable.getDrawIndexed())
+							{
+								++mNumberOfDrawIndexedCalls;
+							}
+							else
+							{
+								++mNumberOfDrawCalls;
+							}
+						}
+						else
+						{
+							++mNumberOfNullDrawCalls;
+						}
+					}
+				}
+			}
+		}
+	}
+
+	void RenderQueue::addRenderablesFromRenderableManagerToPartialQueue(const RenderableManager& renderableManager, MaterialTechniqueId materialTechniqueId, bool castShadows, PartialQueue& partialQueue) const
+	{
+		// Sanity check
+		RHI_ASSERT(mRenderer.getContext(), renderableManager.isVisible(), "Invalid renderable manager visibility")
+
+		// Same as "Renderer::RenderQueue::addRenderable()" but only using renderable pipeline state caches which are up-to-date, everything else is deferred
+		const MaterialResourceManager& materialResourceManager = mRenderer.getMaterialResourceManager();
+		const MaterialBlueprintResourceManager& materialBlueprintResourceManager = mRenderer.getMaterialBlueprintResourceManager();
+		const MaterialProperties& globalMaterialProperties = materialBlueprintResourceManager.getGlobalMaterialProperties();
+		const uint32_t quantizedDepth = getQuantizedDepth(renderableManager);
+		const RenderableManager::Renderables& renderables = renderableManager.getRenderables();
+		uint32_t renderableIndex = 0;
+		uint32_t renderableEndIndex = 0;
+		getLodRenderableRange(renderableManager, renderableIndex, renderableEndIndex);
+		for (; renderableIndex < renderableEndIndex; ++renderableIndex)
+		{
+			const Renderable& renderable = renderables[renderableIndex];
+			const uint8_t renderQueueIndex = renderable.getRenderQueueIndex();
+			if ((castShadows && !renderable.getCastShadows()) || renderQueueIndex < mMinimumRenderQueueIndex || renderQueueIndex > mMaximumRenderQueueIndex)
+			{
+				continue;
+			}
+
+			// Material resource, material technique and material blueprint resource
+			const MaterialResource* materialResource = materialResourceManager.tryGetById(renderable.getMaterialResourceId());
+			if (nullptr == materialResource)
+			{
+				continue;
+			}
+			MaterialTechnique* materialTechnique = materialResource->getMaterialTechniqueById(materialTechniqueId);
+			if (nullptr == materialTechnique)
+			{
+				continue;
+			}
+			MaterialBlueprintResource* materialBlueprintResource = materialBlueprintResourceManager.tryGetById(materialTechnique->getMaterialBlueprintResourceId());
+			if (nullptr == materialBlueprintResource || IResource::LoadingState::LOADED != materialBlueprintResource->getLoadingState())
+			{
+				continue;
+			}
+
+			// Get the pipeline state object (PSO) to use from the renderable pipeline state cache, the generation counter is the same as inside "Renderer::RenderQueue::addRenderable()"
+			Rhi::IPipelineState* foundPipelineState = nullptr;
+			const bool computeMaterialBlueprint = isValid(materialBlueprintResource->getComputeShaderBlueprintResourceId());
+			uint32_t generationCounter = materialResource->getMaterialProperties().getShaderCombinationGenerationCounter() + globalMaterialProperties.getShaderCombinationGenerationCounter() + materialBlueprintResource->getMaterialProperties().getShaderCombinationGenerationCounter();
+			if (!computeMaterialBlueprint)
+			{
+				generationCounter += materialTechnique->getSerializedGraphicsPipelineStateHash();
+			}
+			for (const Renderable::PipelineStateCache& pipelineStateCache : renderable.mPipelineStateCaches)
+			{
+				if (materialTechniqueId == pipelineStateCache.materialTechniqueId)
+				{
+					if (generationCounter == pipelineStateCache.generationCounter)
+					{
+						foundPipelineState = static_cast<Rhi::IPipelineState*>(pipelineStateCache.pipelineStatePtr->getPointer());
+					}
+					break;
+				}
+			}
+			if (nullptr == foundPipelineState)
+			{
+				partialQueue.deferredRenderables.push_back({ &renderable, quantizedDepth });
+				continue;
+			}
+
+			// Register the renderable inside the partial queue
+			const uint32_t vertexArrayId = mPositionOnlyPass ? ((nullptr != renderable.getPositionOnlyVertexArrayPtrWithFallback()) ? renderable.getPositionOnlyVertexArrayPtrWithFallback()->getId() : 0u) : ((nullptr != renderable.getVertexArrayPtr()) ? renderable.getVertexArrayPtr()->getId() : 0u);
+			const uint64_t sortingKey = ::detail::getSortingKey(mTransparentPass, quantizedDepth, foundPipelineState->getId(), vertexArrayId, materialTechnique->getResourceGroupSortingId());
+			partialQueue.queuedRenderables[static_cast<size_t>(renderQueueIndex - mMinimumRenderQueueIndex)].emplace_back(renderable, *materialResource, *materialTechnique, *materialBlueprintResource, *foundPipelineState, sortingKey);
+			if (0 != renderable.getNumberOfIndices())
+			{
+				if (renderable.getDrawIndexed())
+				{
+					++partialQueue.numberOfDrawIndexedCalls;
+				}
+				else
+				{
+					++partialQueue.numberOfDrawCalls;
+				}
+			}
+			else
+			{
+				++partialQueue.numberOfNullDrawCalls;
+			}
+		}
+	}
+
+	void RenderQueue::sortQueue(Queue& queue, const CameraSceneItem* cameraSceneItem)
+	{
+		const QueuedRenderables& queuedRenderables = queue.queuedRenderables;
+		SortedIndices& sortedIndices = queue.sortedIndices;
+		const uint32_t numberOfQueuedRenderables = static_cast<uint32_t>(queuedRenderables.size());
+
+		// Without sorting, the queued renderables are used in the order they were added
+		if (!mDoSort)
+		{
+			sortedIndices.resize(numberOfQueuedRenderables);
+			for (uint32_t i = 0; i < numberOfQueuedRenderables; ++i)
+			{
+				sortedIndices[i] = i;
+			}
+			return;
+		}
+
+		// Exploit temporal coherence across frames by using insertion sort as explained by L. Spiro in
+		// http://www.gamedev.net/topic/661114-temporal-coherence-and-render-queue-sorting/?view=findpost&p=5181408
+		// Keep a list of sorted indices from the previous frame (one per camera).
+		// If we have the sorted list "5, 1, 4, 3, 2, 0":
+		// * If it grew from last frame, append: 5, 1, 4, 3, 2, 0, 6, 7 and use insertion sort.
+		// * If it's the same, leave it as is, and use insertion sort just in case.
+		// * If it's shorter, reset the indices 0, 1, 2, 3, 4 and use radix sort
+		// -> The indices of the previous frame don't need to reference the same renderables for correctness, a bad guess only costs performance
+		const bool useTemporalCoherence = (mTemporalCoherenceSorting && nullptr != cameraSceneItem && queue.sortedCameraSceneItem == cameraSceneItem && !sortedIndices.empty() && sortedIndices.size() <= numberOfQueuedRenderables);
+		if (useTemporalCoherence)
+		{
+			for (uint32_t i = static_cast<uint32_t>(sortedIndices.size()); i < numberOfQueuedRenderables; ++i)
+			{
+				sortedIndices.push_back(i);
+			}
+		}
+		else
+		{
+			sortedIndices.resize(numberOfQueuedRenderables);
+			for (uint32_t i = 0; i < numberOfQueuedRenderables; ++i)
+			{
+				sortedIndices[i] = i;
+			}
+		}
+		queue.sortedCameraSceneItem = cameraSceneItem;
+
+		// Gather the sorting keys in the current order so the sort only touches keys and indices but never the queued renderables
+		mScratchSortingKeys.resize(numberOfQueuedRenderables);
+		for (uint32_t i = 0; i < numberOfQueuedRenderables; ++i)
+		{
+			mScratchSortingKeys[i] = queuedRenderables[sortedIndices[i]].sortingKey;
+		}
+
+		// Sort, the radix sort is used as fallback in case the insertion sort turns out to be too expensive
+		if (!useTemporalCoherence || !insertionSortSortingKeys(mScratchSortingKeys, sortedIndices))
+		{
+			radixSortSortingKeys(mScratchSortingKeys, sortedIndices, mScratchRadixSortingKeys, mScratchRadixSortedIndices);
+		}
+	}
+
+	void RenderQueue::fillGraphicsCommandBufferParallel(const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer, uint32_t numberOfJobs)
+	{
+		MaterialBlueprintResourceManager& materialBlueprintResourceManager = mRenderer.getMaterialBlueprintResourceManager();
+		LightBufferManager& lightBufferManager = materialBlueprintResourceManager.getLightBufferManager();
+
+		// Gather the sorted renderables and prepare everything which isn't thread-safe: Pass buffer filling, material blueprint binding
+		// including the material buffer upload and the lazy creation of material technique resource groups
+		// -> Like the sequential recording, the pass buffer is filled and the material blueprint is bound each time the material blueprint changes
+		mRecordedRenderables.clear();
+		uint32_t numberOfBindingCommandBuffers = 0;
+		const MaterialBlueprintResource* currentMaterialBlueprintResource = nullptr;
+		for (Queue& queue : mQueues)
+		{
+			const QueuedRenderables& queuedRenderables = queue.queuedRenderables;
+			if (!queuedRenderables.empty())
+			{
+				// Sort queued renderables
+				if (!queue.sorted)
+				{
+					sortQueue(queue, compositorContextData.getCameraSceneItem());
+					queue.sorted = true;
+				}
+
+				// Prepare queued renderables
+				for (const uint32_t queuedRenderableIndex : queue.sortedIndices)
+				{
+					const QueuedRenderable& queuedRenderable = queuedRenderables[queuedRenderableIndex];
+					MaterialBlueprintResource& materialBlueprintResource = *queuedRenderable.materialBlueprintResource;
+					if (currentMaterialBlueprintResource != &materialBlueprintResource)
+					{
+						currentMaterialBlueprintResource = &materialBlueprintResource;
+						compositorContextData.mCurrentlyBoundMaterialBlueprintResource = &materialBlueprintResource;
+
+						// Fill the pass buffer manager
+						PassBufferManager* passBufferManager = materialBlueprintResource.getPassBufferManager();
+						if (nullptr != passBufferManager)
+						{
+							passBufferManager->fillBuffer(&renderTarget, compositorContextData, *queuedRenderable.materialResource);
+						}
+
+						// Record the binding of the graphics material blueprint resource and light buffer manager, the instance buffer managers are bound by the jobs
+						if (mBindingCommandBuffers.size() == numberOfBindingCommandBuffers)
+						{
+							mBindingCommandBuffers.emplace_back();
+						}
+						Rhi::CommandBuffer& bindingCommandBuffer = mBindingCommandBuffers[numberOfBindingCommandBuffers];
+						++numberOfBindingCommandBuffers;
+						materialBlueprintResource.fillGraphicsCommandBuffer(bindingCommandBuffer);
+						lightBufferManager.fillGraphicsCommandBuffer(materialBlueprintResource, bindingCommandBuffer);
+					}
+
+					// Gather the resource groups of the material technique
+					RecordedRenderable recordedRenderable = { &queuedRenderable, numberOfBindingCommandBuffers - 1, getInvalid<uint32_t>(), nullptr, getInvalid<uint32_t>(), nullptr };
+					MaterialTechnique& materialTechnique = *queuedRenderable.materialTechnique;
+					const MaterialBufferManager* materialBufferManager = materialBlueprintResource.getMaterialBufferManager();
+					if (nullptr != materialBufferManager)
+					{
+						recordedRenderable.materialResourceGroupRootParameterIndex = materialBlueprintResource.getMaterialUniformBuffer()->rootParameterIndex;
+						recordedRenderable.materialResourceGroup = materialBufferManager->getResourceGroup(materialTechnique);
+					}
+					materialTechnique.getResourceGroup(mRenderer, recordedRenderable.resourceGroupRootParameterIndex, &recordedRenderable.resourceGroup);
+					mRecordedRenderables.push_back(recordedRenderable);
+				}
+			}
+		}
+
+		// Split the recorded renderables into one range per job, each job gets its own range of the indirect buffer
+		const uint32_t numberOfRecordedRenderables = static_cast<uint32_t>(mRecordedRenderables.size());
+		Rhi::IIndirectBuffer* indirectBuffer = nullptr;
+		uint32_t indirectBufferOffset = 0;
+		uint8_t* indirectBufferData = nullptr;
+		if (mNumberOfDrawIndexedCalls > 0 || mNumberOfDrawCalls > 0)
+		{
+			IndirectBufferManager::IndirectBuffer* managedIndirectBuffer = mIndirectBufferManager.getIndirectBuffer(sizeof(Rhi::DrawIndexedArguments) * mNumberOfDrawIndexedCalls + sizeof(Rhi::DrawArguments) * mNumberOfDrawCalls);
+			RHI_ASSERT(mRenderer.getContext(), nullptr != managedIndirectBuffer, "Invalid managed indirect buffer")
+			indirectBuffer		 = managedIndirectBuffer->indirectBuffer;
+			indirectBufferOffset = managedIndirectBuffer->indirectBufferOffset;
+			indirectBufferData   = managedIndirectBuffer->mappedData;
+		}
+		mRecordingJobs.resize(numberOfJobs);
+		for (uint32_t jobIndex = 0; jobIndex < numberOfJobs; ++jobIndex)
+		{
+			RecordingJob& recordingJob = mRecordingJobs[jobIndex];
+			recordingJob.startIndex = static_cast<uint32_t>(static_cast<uint64_t>(numberOfRecordedRenderables) * jobIndex / numberOfJobs);
+			recordingJob.endIndex = static_cast<uint32_t>(static_cast<uint64_t>(numberOfRecordedRenderables) * (jobIndex + 1) / numberOfJobs);
+			recordingJob.indirectBufferOffset = indirectBufferOffset;
+			recordingJob.commandBuffer = &getFrameCommandBuffer();
+			for (uint32_t i = recordingJob.startIndex; i < recordingJob.endIndex; ++i)
+			{
+				const Renderable& renderable = *mRecordedRenderables[i].queuedRenderable->renderable;
+				if (0 != renderable.getNumberOfIndices())
+				{
+					indirectBufferOffset += renderable.getDrawIndexed() ? static_cast<uint32_t>(sizeof(Rhi::DrawIndexedArguments)) : static_cast<uint32_t>(sizeof(Rhi::DrawArguments));
+				}
+			}
+		}
+		while (mJobScratchCommandBuffers.size() < numberOfJobs)
+		{
+			mJobScratchCommandBuffers.emplace_back();
+		}
+		materialBlueprintResourceManager.reserveJobInstanceBufferManagers(numberOfJobs);
+
+		// Record the commands in parallel and merge the job command buffers in order
+		mRenderer.getJobSystem().parallelFor(numberOfJobs, 1, [&](uint32_t startIndex, uint32_t endIndex)
+		{
+			for (uint32_t jobIndex = startIndex; jobIndex < endIndex; ++jobIndex)
+			{
+				recordGraphicsCommands(jobIndex, compositorContextData, indirectBuffer, indirectBufferData);
+			}
+		});
+		for (const RecordingJob& recordingJob : mRecordingJobs)
+		{
+			if (!recordingJob.commandBuffer->isEmpty())
+			{
+				Rhi::Command::DispatchCommandBuffer::create(commandBuffer, recordingJob.commandBuffer);
+			}
+		}
+
+		// The material blueprint binding commands have been copied into the job command buffers
+		for (uint32_t i = 0; i < numberOfBindingCommandBuffers; ++i)
+		{
+			mBindingCommandBuffers[i].clear();
+		}
+
+		// The jobs left the last material blueprint bound together with their own instance buffers, so the next render queue has to bind its material blueprint again
+		compositorContextData.mCurrentlyBoundMaterialBlueprintResource = nullptr;
+	}
+
+	void RenderQueue::recordGraphicsCommands(uint32_t jobIndex, const CompositorContextData& compositorContextData, Rhi::IIndirectBuffer* indirectBuffer, uint8_t* indirectBufferData)
+	{
+		// Same as the sequential recording inside "Renderer::RenderQueue::fillGraphicsCommandBuffer()", but using the prepared material blueprint bindings and
+		// resource groups as well as instance buffer managers, scratch command buffer and indirect buffer range of the job
+		const MaterialBlueprintResourceManager& materialBlueprintResourceManager = mRenderer.getMaterialBlueprintResourceManager();
+		UniformInstanceBufferManager& uniformInstanceBufferManager = materialBlueprintResourceManager.getJobUniformInstanceBufferManager(jobIndex);
+		TextureInstanceBufferManager& textureInstanceBufferManager = materialBlueprintResourceManager.getJobTextureInstanceBufferManager(jobIndex);
+		const RecordingJob& recordingJob = mRecordingJobs[jobIndex];
+		Rhi::CommandBuffer& commandBuffer = *recordingJob.commandBuffer;
+		Rhi::CommandBuffer& scratchCommandBuffer = mJobScratchCommandBuffers[jobIndex];
+		const uint32_t instanceCount = (compositorContextData.getSinglePassStereoInstancing() ? 2u : 1u);
+
+		// Track currently bound RHI resources and states to void generating redundant commands
+		bool vertexArraySet = false;
+		Rhi::IVertexArray* currentVertexArray = nullptr;
+		Rhi::IGraphicsPipelineState* currentGraphicsPipelineState = nullptr;
+		uint32_t currentBindingIndex = getInvalid<uint32_t>();
+		std::array<Rhi::IResourceGroup*, 16> currentSetGraphicsResourceGroup;	// TODO(co) Use maximum number of graphics resource groups here, 16 is considered a save number of root parameters
+		::detail::DrawRecorder drawRecorder(mRenderer.getContext(), indirectBuffer, recordingJob.indirectBufferOffset, indirectBufferData, instanceCount);
+
+		// Inject recorded renderables into the job command buffer
+		for (uint32_t i = recordingJob.startIndex; i < recordingJob.endIndex; ++i)
+		{
+			// Get queued renderable data
+			const RecordedRenderable&		   recordedRenderable		  = mRecordedRenderables[i];
+			const QueuedRenderable&			   queuedRenderable			  = *recordedRenderable.queuedRenderable;
+			const Renderable&				   renderable				  = *queuedRenderable.renderable;
+				  MaterialTechnique&		   materialTechnique		  = *queuedRenderable.materialTechnique;
+				  MaterialBlueprintResource&   materialBlueprintResource  = *queuedRenderable.materialBlueprintResource;
+				  Rhi::IGraphicsPipelineState& foundGraphicsPipelineState = *static_cast<Rhi::IGraphicsPipelineState*>(queuedRenderable.foundPipelineState);
+
+			// Set the used graphics pipeline state object (PSO)
+			if (currentGraphicsPipelineState != &foundGraphicsPipelineState)
+			{
+				currentGraphicsPipelineState = &foundGraphicsPipelineState;
+				Rhi::Command::SetGraphicsPipelineState::create(scratchCommandBuffer, currentGraphicsPipelineState);
+			}
+
+			{ // Setup input assembly (IA): Set the used vertex array
+				const Rhi::IVertexArrayPtr& vertexArrayPtr = mPositionOnlyPass ? renderable.getPositionOnlyVertexArrayPtrWithFallback() : renderable.getVertexArrayPtr();
+				if (!vertexArraySet || currentVertexArray != vertexArrayPtr)
+				{
+					vertexArraySet = true;
+					currentVertexArray = vertexArrayPtr;
+					Rhi::Command::SetGraphicsVertexArray::create(scratchCommandBuffer, currentVertexArray);
+				}
+			}
+
+			// Expensive state change: Bind the prepared graphics material blueprint resource and the instance buffer managers of the job
+			const MaterialBlueprintResource::UniformBuffer* instanceUniformBuffer = materialBlueprintResource.getInstanceUniformBuffer();
+			const MaterialBlueprintResource::TextureBuffer* instanceTextureBuffer = materialBlueprintResource.getInstanceTextureBuffer();
+			if (currentBindingIndex != recordedRenderable.bindingIndex)
+			{
+				currentBindingIndex = recordedRenderable.bindingIndex;
+				std::fill(currentSetGraphicsResourceGroup.begin(), currentSetGraphicsResourceGroup.end(), nullptr);
+				mBindingCommandBuffers[currentBindingIndex].appendToCommandBuffer(scratchCommandBuffer);
+				if (nullptr != instanceTextureBuffer)
+				{
+					RHI_ASSERT(mRenderer.getContext(), nullptr != instanceUniformBuffer, "Invalid instance uniform buffer")
+					textureInstanceBufferManager.startupBufferFilling(materialBlueprintResource, scratchCommandBuffer);
+				}
+				else if (nullptr != instanceUniformBuffer)
+				{
+					uniformInstanceBufferManager.startupBufferFilling(materialBlueprintResource, scratchCommandBuffer);
+				}
+			}
+
+			// Cheap state change: Bind the material buffer pool and the material technique resource groups
+			if (nullptr != recordedRenderable.materialResourceGroup && currentSetGraphicsResourceGroup[recordedRenderable.materialResourceGroupRootParameterIndex] != recordedRenderable.materialResourceGroup)
+			{
+				currentSetGraphicsResourceGroup[recordedRenderable.materialResourceGroupRootParameterIndex] = recordedRenderable.materialResourceGroup;
+				Rhi::Command::SetGraphicsResourceGroup::create(scratchCommandBuffer, recordedRenderable.materialResourceGroupRootParameterIndex, recordedRenderable.materialResourceGroup);
+			}
+			if (isValid(recordedRenderable.resourceGroupRootParameterIndex) && nullptr != recordedRenderable.resourceGroup && currentSetGraphicsResourceGroup[recordedRenderable.resourceGroupRootParameterIndex] != recordedRenderable.resourceGroup)
+			{
+				currentSetGraphicsResourceGroup[recordedRenderable.resourceGroupRootParameterIndex] = recordedRenderable.resourceGroup;
+				Rhi::Command::SetGraphicsResourceGroup::create(scratchCommandBuffer, recordedRenderable.resourceGroupRootParameterIndex, recordedRenderable.resourceGroup);
+			}
+
+			// Fill the instance buffer manager
+			uint32_t startInstanceLocation = 0;
+			if (nullptr != instanceTextureBuffer)
+			{
+				RHI_ASSERT(mRenderer.getContext(), nullptr != instanceUniformBuffer, "Invalid instance uniform buffer")
+				startInstanceLocation = textureInstanceBufferManager.fillBuffer(compositorContextData.getWorldSpaceCameraPosition(), materialBlueprintResource, materialBlueprintResource.getPassBufferManager(), *instanceUniformBuffer, renderable, materialTechnique, scratchCommandBuffer);
+			}
+			else if (nullptr != instanceUniformBuffer)
+			{
+				startInstanceLocation = uniformInstanceBufferManager.fillBuffer(materialBlueprintResource, materialBlueprintResource.getPassBufferManager(), *instanceUniformBuffer, renderable, materialTechnique, scratchCommandBuffer);
+			}
+
+			// Emit draw command, if necessary, and append the scratch command buffer into the job command buffer
+			drawRecorder.beginRenderable(renderable, !scratchCommandBuffer.isEmpty(), commandBuffer);
+			if (!scratchCommandBuffer.isEmpty())
+			{
+				scratchCommandBuffer.appendToCommandBufferAndClear(commandBuffer);
+			}
+
+			// Render the specified geometric primitive, based on indexing into an array of vertices
+			drawRecorder.draw(renderable, startInstanceLocation, commandBuffer);
+		}
+
+		// Emit last open draw command, if necessary
+		drawRecorder.flush(commandBuffer);
+	}
+
+	Rhi::CommandBuffer& RenderQueue::getFrameCommandBuffer()
+	{
+		// The command buffer the job command buffers are dispatched by is cleared two frames later, until then the job command buffers must stay untouched
+		const uint64_t numberOfRenderedFrames = mRenderer.getTimeManager().getNumberOfRenderedFrames();
+		FrameCommandBuffers& frameCommandBuffers = mFrameCommandBuffers[numberOfRenderedFrames % GLM_COUNTOF(mFrameCommandBuffers)];
+		if (frameCommandBuffers.numberOfRenderedFrames != numberOfRenderedFrames)
+		{
+			for (uint32_t i = 0; i < frameCommandBuffers.numberOfUsedCommandBuffers; ++i)
+			{
+				frameCommandBuffers.commandBuffers[i].clear();
+			}
+			frameCommandBuffers.numberOfUsedCommandBuffers = 0;
+			frameCommandBuffers.numberOfRenderedFrames = numberOfRenderedFrames;
+		}
+		if (frameCommandBuffers.commandBuffers.size() == frameCommandBuffers.numberOfUsedCommandBuffers)
+		{
+			frameCommandBuffers.commandBuffers.emplace_back();
+		}
+		Rhi::CommandBuffer& commandBuffer = frameCommandBuffers.commandBuffers[frameCommandBuffers.numberOfUsedCommandBuffers];
+		++frameCommandBuffers.numberOfUsedCommandBuffers;
+		return commandBuffer;
+	}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
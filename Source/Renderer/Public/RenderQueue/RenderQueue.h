@@ -39,6 +39,7 @@ PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt<char16_t,char,_Mbstatet>': assignment operator was implicitly defined as deleted
 	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
 	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	#include <deque>
 	#include <string>
 PRAGMA_WARNING_POP
 
@@ -52,6 +53,7 @@ namespace Renderer
 	class IRenderer;
 	class MaterialResource;
 	class MaterialTechnique;
+	class CameraSceneItem;
 	class RenderableManager;
 	class CompositorContextData;
 	class IndirectBufferManager;
@@ -90,6 +92,45 @@ namespace Renderer
 	{
 
 
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Least significant digit radix sort of 64 bit sorting keys together with their queued renderable indices
+		*
+		*  @param[in, out] sortingKeys
+		*    Sorting keys to sort ascending
+		*  @param[in, out] sortedIndices
+		*    Indices moved together with the sorting keys, must have the same number of elements as "sortingKeys"
+		*  @param[out] scratchSortingKeys
+		*    Scratch buffer kept by the caller to reduce dynamic memory allocations, might be swapped with "sortingKeys"
+		*  @param[out] scratchSortedIndices
+		*    Scratch buffer kept by the caller to reduce dynamic memory allocations, might be swapped with "sortedIndices"
+		*
+		*  @remarks
+		*    Only the keys and the indices are moved around, not the much larger queued renderables. Histograms of all digits
+		*    are gathered in a single pass, digits which are identical for all keys (e.g. unused sorting key bits) are skipped.
+		*    Radix sort is stable, so the result doesn't depend on the order the renderables were added in beyond equal keys.
+		*/
+		static RENDERER_API_EXPORT void radixSortSortingKeys(std::vector<uint64_t>& sortingKeys, std::vector<uint32_t>& sortedIndices, std::vector<uint64_t>& scratchSortingKeys, std::vector<uint32_t>& scratchSortedIndices);
+
+		/**
+		*  @brief
+		*    Insertion sort of 64 bit sorting keys together with their queued renderable indices, fast for nearly sorted input
+		*
+		*  @param[in, out] sortingKeys
+		*    Sorting keys to sort ascending
+		*  @param[in, out] sortedIndices
+		*    Indices moved together with the sorting keys, must have the same number of elements as "sortingKeys"
+		*
+		*  @return
+		*    "true" if the keys are now sorted, "false" if the move budget was exceeded and the keys are only partially sorted
+		*/
+		[[nodiscard]] static RENDERER_API_EXPORT bool insertionSortSortingKeys(std::vector<uint64_t>& sortingKeys, std::vector<uint32_t>& sortedIndices);
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
@@ -133,18 +174,68 @@ namespace Renderer
 			return mMaximumRenderQueueIndex;
 		}
 
+		[[nodiscard]] inline bool getTemporalCoherenceSorting() const
+		{
+			return mTemporalCoherenceSorting;
+		}
+
+		/**
+		*  @brief
+		*    Set whether or not the sorted order of the previous frame is used as starting point for sorting
+		*
+		*  @param[in] temporalCoherenceSorting
+		*    "true" to seed an insertion sort with the previous sorted order of the same camera, "false" to always use a radix sort
+		*
+		*  @note
+		*    - The insertion sort falls back to the radix sort if the order turns out to be too different, so the result is always sorted
+		*/
+		inline void setTemporalCoherenceSorting(bool temporalCoherenceSorting)
+		{
+			mTemporalCoherenceSorting = temporalCoherenceSorting;
+		}
+
 		void clear();
 		void addRenderablesFromRenderableManager(const RenderableManager& renderableManager, MaterialTechniqueId materialTechniqueId, const CompositorContextData& compositorContextData, bool castShadows = false);
-		void fillGraphicsCommandBuffer(const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer);
-		void fillComputeCommandBuffer(const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer);
 
+		/**
+		*  @brief
+		*    Add the renderables of multiple renderable managers, using the job system if there are enough renderable managers
+		*
+		*  @param[in] renderableManagers
+		*    Visible renderable managers to add the renderables from
+		*  @param[in] materialTechniqueId
+		*    Material technique to use
+		*  @param[in] compositorContextData
+		*    Compositor context data to use
+		*  @param[in] castShadows
+		*    "true" to only add renderables casting shadows, else "false"
+		*
+		*  @note
+		*    - The renderable managers are split into ranges, each job gathers queued renderables into its own partial queues which are merged afterwards
+		*    - Renderables which need a renderable pipeline state cache update are deferred and added single-threaded afterwards
+		*    - Unsorted render queues are filled single-threaded to keep the order the renderables were added in
+		*/
+		void addRenderablesFromRenderableManagers(const std::vector<RenderableManager*>& renderableManagers, MaterialTechniqueId materialTechniqueId, const CompositorContextData& compositorContextData, bool castShadows = false);
 
-	//[-------------------------------------------------------]
-	//[ Private methods                                       ]
-	//[-------------------------------------------------------]
-	private:
-		explicit RenderQueue(const RenderQueue&) = delete;
-		RenderQueue& operator=(const RenderQueue&) = delete;
+		/**
+		*  @brief
+		*    Fill the sorted queued renderables into the given command buffer
+		*
+		*  @param[in] renderTarget
+		*    Render target to fill the pass buffer for
+		*  @param[in] compositorContextData
+		*    Compositor context data to use
+		*  @param[out] commandBuffer
+		*    Command buffer to fill
+		*
+		*  @note
+		*    - If the RHI supports native multithreading and there are enough queued renderables, the commands are recorded by the job system: Each job records a
+		*      range of the sorted renderables into its own command buffer which are then merged in order into the given command buffer by using "Rhi::Command::DispatchCommandBuffer"
+		*    - The pass buffers as well as the material blueprint bindings are filled upfront by the calling thread, each job uses its own instance buffer managers and
+		*      its own range of the indirect buffer
+		*/
+		void fillGraphicsCommandBuffer(const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer);
+		void fillComputeCommandBuffer(const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer);
 
 
 	//[-------------------------------------------------------]
@@ -176,20 +267,82 @@ namespace Renderer
 				foundPipelineState(&_foundPipelineState),
 				sortingKey(_sortingKey)
 			{}
-			[[nodiscard]] inline bool operator < (const QueuedRenderable& queuedRenderable) const
-			{
-				return (sortingKey < queuedRenderable.sortingKey);
-			}
 		};
 		typedef std::vector<QueuedRenderable> QueuedRenderables;
+		typedef std::vector<uint32_t>		  SortedIndices;
+		typedef std::vector<uint64_t>		  SortingKeys;
 
 		struct Queue final
 		{
-			QueuedRenderables queuedRenderables;
-			bool			  sorted = false;
+			QueuedRenderables	   queuedRenderables;
+			SortedIndices		   sortedIndices;					///< Indices into "queuedRenderables" in sorted order, kept across frames as starting point for temporal coherence sorting
+			const CameraSceneItem* sortedCameraSceneItem = nullptr;	///< Camera scene item "sortedIndices" was sorted for, can be a null pointer, don't destroy the instance
+			bool				   sorted = false;
 		};
 		typedef std::vector<Queue> Queues;
 
+		struct DeferredRenderable final
+		{
+			const Renderable* renderable;		///< Always valid, don't destroy the instance
+			uint32_t		  quantizedDepth;
+		};
+		typedef std::vector<DeferredRenderable> DeferredRenderables;
+
+		struct PartialQueue final
+		{
+			std::vector<QueuedRenderables> queuedRenderables;		///< Per queue
+			DeferredRenderables			   deferredRenderables;		///< Renderables which need a renderable pipeline state cache update, which isn't thread-safe
+			uint32_t					   numberOfNullDrawCalls = 0;
+			uint32_t					   numberOfDrawIndexedCalls = 0;
+			uint32_t					   numberOfDrawCalls = 0;
+		};
+		typedef std::vector<PartialQueue> PartialQueues;
+
+		struct RecordedRenderable final
+		{
+			const QueuedRenderable* queuedRenderable;						///< Always valid, don't destroy the instance
+			uint32_t				bindingIndex;							///< Index of the material blueprint binding command buffer to use
+			uint32_t				materialResourceGroupRootParameterIndex;	///< Root parameter index of the material buffer pool resource group, can be invalid
+			Rhi::IResourceGroup*	materialResourceGroup;					///< Material buffer pool resource group, can be a null pointer, don't destroy the instance
+			uint32_t				resourceGroupRootParameterIndex;		///< Root parameter index of the material technique resource group, can be invalid
+			Rhi::IResourceGroup*	resourceGroup;							///< Material technique resource group, can be a null pointer, don't destroy the instance
+		};
+		typedef std::vector<RecordedRenderable> RecordedRenderables;
+
+		struct RecordingJob final
+		{
+			uint32_t			startIndex;				///< First recorded renderable index (inclusive)
+			uint32_t			endIndex;				///< Last recorded renderable index (exclusive)
+			uint32_t			indirectBufferOffset;	///< Start of the indirect buffer range of the job
+			Rhi::CommandBuffer*	commandBuffer;			///< Command buffer the job is recording into, always valid, don't destroy the instance
+		};
+		typedef std::vector<RecordingJob> RecordingJobs;
+
+		typedef std::deque<Rhi::CommandBuffer> CommandBuffers;	///< "Rhi::CommandBuffer" can't be moved, so the addresses must stay stable while growing
+
+		struct FrameCommandBuffers final
+		{
+			CommandBuffers commandBuffers;						///< Never shrinks so the command packet chunks are recycled
+			uint32_t	   numberOfUsedCommandBuffers = 0;
+			uint64_t	   numberOfRenderedFrames = 0;			///< Number of the rendered frame the command buffers are used for
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit RenderQueue(const RenderQueue&) = delete;
+		RenderQueue& operator=(const RenderQueue&) = delete;
+		[[nodiscard]] uint32_t getQuantizedDepth(const RenderableManager& renderableManager) const;
+		void getLodRenderableRange(const RenderableManager& renderableManager, uint32_t& renderableIndex, uint32_t& renderableEndIndex) const;
+		void addRenderable(const Renderable& renderable, MaterialTechniqueId materialTechniqueId, uint32_t quantizedDepth, bool singlePassStereoInstancing);
+		void addRenderablesFromRenderableManagerToPartialQueue(const RenderableManager& renderableManager, MaterialTechniqueId materialTechniqueId, bool castShadows, PartialQueue& partialQueue) const;
+		void sortQueue(Queue& queue, const CameraSceneItem* cameraSceneItem);
+		void fillGraphicsCommandBufferParallel(const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, Rhi::CommandBuffer& commandBuffer, uint32_t numberOfJobs);
+		void recordGraphicsCommands(uint32_t jobIndex, const CompositorContextData& compositorContextData, Rhi::IIndirectBuffer* indirectBuffer, uint8_t* indirectBufferData);
+		[[nodiscard]] Rhi::CommandBuffer& getFrameCommandBuffer();
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -198,6 +351,7 @@ namespace Renderer
 		const IRenderer&		mRenderer;					///< Renderer instance, we don't own the instance so don't delete it
 		IndirectBufferManager&	mIndirectBufferManager;		///< Indirect buffer manager instance, we don't own the instance so don't delete it
 		Queues					mQueues;
+		PartialQueues			mPartialQueues;				///< Partial queues of the parallel render queue filling, kept to reduce dynamic memory allocations
 		uint32_t				mNumberOfNullDrawCalls;
 		uint32_t				mNumberOfDrawIndexedCalls;
 		uint32_t				mNumberOfDrawCalls;
@@ -206,10 +360,20 @@ namespace Renderer
 		bool					mPositionOnlyPass;
 		bool					mTransparentPass;
 		bool					mDoSort;
+		bool					mTemporalCoherenceSorting;
 		// Scratch buffers to reduce dynamic memory allocations
+		SortingKeys				mScratchSortingKeys;
+		SortingKeys				mScratchRadixSortingKeys;
+		SortedIndices			mScratchRadixSortedIndices;
 		Rhi::CommandBuffer		mScratchCommandBuffer;
 		ShaderProperties		mScratchShaderProperties;
 		ShaderProperties		mScratchOptimizedShaderProperties;
+		// Parallel command recording, see "Renderer::RenderQueue::fillGraphicsCommandBuffer()"
+		RecordedRenderables		mRecordedRenderables;
+		RecordingJobs			mRecordingJobs;
+		CommandBuffers			mBindingCommandBuffers;		///< Material blueprint binding commands appended by the jobs on material blueprint switches, only valid during recording
+		CommandBuffers			mJobScratchCommandBuffers;
+		FrameCommandBuffers		mFrameCommandBuffers[2];	///< The command buffers of a frame are dispatched by the command buffer given to the render queue, which is cleared two frames later
 
 
 	};
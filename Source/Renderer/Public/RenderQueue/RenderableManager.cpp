@@ -23,6 +23,16 @@
 //[-------------------------------------------------------]
 #include "Renderer/Public/RenderQueue/RenderableManager.h"
 #include "Renderer/Public/Core/Math/Transform.h"
+#include "Renderer/Public/Core/GetInvalid.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	#include <glm/gtx/component_wise.hpp>
+PRAGMA_WARNING_POP
+
+#include <algorithm>
+#include <cmath>
 
 
 //[-------------------------------------------------------]
@@ -40,6 +50,13 @@ namespace
 		const Renderer::Transform IdentityTransform;
 
 
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr float LOD_0_PROJECTED_BOUNDING_SPHERE_RADIUS = 0.5f;	///< Projected bounding sphere radius relative to half of the viewport height down to which LOD 0 is used, each further LOD halves this
+		static constexpr float LOD_HYSTERESIS = 0.2f;							///< Continuous LOD distance beyond a LOD border which must be crossed before the previously selected LOD is switched
+
+
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
 //[-------------------------------------------------------]
@@ -62,9 +79,11 @@ namespace Renderer
 			mDebugName{},
 		#endif
 		mNumberOfLods(1),
+		mBoundingSphereRadius(getInvalid<float>()),
 		mTransform(&::detail::IdentityTransform),
 		mVisible(true),
 		mCachedDistanceToCamera(getInvalid<float>()),
+		mCachedLodIndex(0),
 		mMinimumRenderQueueIndex(0),
 		mMaximumRenderQueueIndex(0),
 		mCastShadows(false)
@@ -116,6 +135,36 @@ namespace Renderer
 		}
 	}
 
+	void RenderableManager::updateCachedLodIndex(float inverseTanHalfFovY, float lodBias)
+	{
+		// Nothing to select in case there's just a single LOD or the bounding sphere is unknown
+		if (mNumberOfLods <= 1 || isInvalid(mBoundingSphereRadius))
+		{
+			mCachedLodIndex = 0;
+			return;
+		}
+
+		// The camera is inside the bounding sphere, use the most detailed LOD
+		const float worldSpaceBoundingSphereRadius = mBoundingSphereRadius * glm::compMax(mTransform->scale);
+		if (mCachedDistanceToCamera <= worldSpaceBoundingSphereRadius)
+		{
+			mCachedLodIndex = 0;
+			return;
+		}
+
+		// Calculate the continuous LOD using the projected bounding sphere radius relative to half of the viewport height
+		// -> Each further LOD is selected as soon as the projected size halves, so the triangle density on screen stays roughly the same
+		const float projectedBoundingSphereRadius = worldSpaceBoundingSphereRadius * inverseTanHalfFovY / mCachedDistanceToCamera;
+		const float lod = std::log2(::detail::LOD_0_PROJECTED_BOUNDING_SPHERE_RADIUS / projectedBoundingSphereRadius) + lodBias;
+
+		// Only switch the LOD as soon as the continuous LOD left the band around the previously selected LOD
+		const float previousLod = static_cast<float>(mCachedLodIndex);
+		if (lod < previousLod - ::detail::LOD_HYSTERESIS || lod >= previousLod + 1.0f + ::detail::LOD_HYSTERESIS)
+		{
+			mCachedLodIndex = static_cast<uint8_t>(std::min(std::max(std::floor(lod), 0.0f), static_cast<float>(mNumberOfLods - 1)));
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
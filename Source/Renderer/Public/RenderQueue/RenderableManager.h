@@ -129,6 +129,16 @@ namespace Renderer
 			mNumberOfLods = numberOfLods;
 		}
 
+		[[nodiscard]] inline float getBoundingSphereRadius() const
+		{
+			return mBoundingSphereRadius;
+		}
+
+		inline void setBoundingSphereRadius(float boundingSphereRadius)	// Object space bounding sphere radius, invalid disables screen space LOD selection
+		{
+			mBoundingSphereRadius = boundingSphereRadius;
+		}
+
 		[[nodiscard]] inline const Transform& getTransform() const
 		{
 			// We know that this pointer is always valid
@@ -161,6 +171,37 @@ namespace Renderer
 			mCachedDistanceToCamera = distanceToCamera;
 		}
 
+		/**
+		*  @brief
+		*    Return the cached LOD index selected during the culling phase
+		*
+		*  @return
+		*    The cached LOD index, might exceed the current number of LODs and hence must be clamped by the user
+		*
+		*  @see
+		*    - "Renderer::RenderableManager::updateCachedLodIndex()"
+		*/
+		[[nodiscard]] inline uint8_t getCachedLodIndex() const
+		{
+			return mCachedLodIndex;
+		}
+
+		/**
+		*  @brief
+		*    Update the cached LOD index using the projected size of the bounding sphere
+		*
+		*  @param[in] inverseTanHalfFovY
+		*    One divided by the tangent of half of the camera Y field of view, converts a view space size at distance one into a size relative to half of the viewport height
+		*  @param[in] lodBias
+		*    Global LOD bias, positive values select coarser LODs earlier, negative values select finer LODs longer
+		*
+		*  @note
+		*    - Must be called after "Renderer::RenderableManager::setCachedDistanceToCamera()"
+		*    - Each further LOD is selected as soon as the projected bounding sphere size halves
+		*    - Hysteresis: The previously selected LOD is kept while staying within a small band around its borders, this avoids LOD flickering when moving along a LOD border
+		*/
+		RENDERER_API_EXPORT void updateCachedLodIndex(float inverseTanHalfFovY, float lodBias);
+
 		/**
 		*  @brief
 		*    Return the minimum renderables render queue index (inclusive)
@@ -237,10 +278,12 @@ namespace Renderer
 		// Data
 		Renderables		 mRenderables;				///< Renderables, directly containing also the renderables of all LODs, each LOD has the same number of renderables
 		uint8_t			 mNumberOfLods;				///< Number of LODs, there's always at least one LOD, namely the original none reduced version
+		float			 mBoundingSphereRadius;		///< Object space bounding sphere radius used for the screen space LOD selection, invalid if unknown which means LOD 0 is always used
 		const Transform* mTransform;				///< Transform instance, always valid, just shared meaning doesn't own the instance so don't delete it
 		bool			 mVisible;
 		// Cached data
 		float			 mCachedDistanceToCamera;	///< Cached distance to camera is updated during the culling phase
+		uint8_t			 mCachedLodIndex;			///< Cached LOD index is updated during the culling phase, also the previous LOD used for hysteresis
 		uint8_t			 mMinimumRenderQueueIndex;	///< The minimum renderables render queue index (inclusive, set inside "Renderer::RenderableManager::updateCachedRenderablesData()")
 		uint8_t			 mMaximumRenderQueueIndex;	///< The maximum renderables render queue index (inclusive, set inside "Renderer::RenderableManager::updateCachedRenderablesData()")
 		bool			 mCastShadows;				///< "true" if at least one of the renderables is casting shadows, else "false" (set inside "Renderer::RenderableManager::updateCachedRenderablesData()")
@@ -23,10 +23,12 @@
 //[-------------------------------------------------------]
 #include "Renderer/Public/RendererImpl.h"
 #include "Renderer/Public/Asset/AssetManager.h"
+#include "Renderer/Public/Asset/AssetPackage.h"
 #include "Renderer/Public/Core/File/MemoryFile.h"
 #include "Renderer/Public/Core/Time/TimeManager.h"
 #include "Renderer/Public/Core/File/IFileManager.h"
-#include "Renderer/Public/Core/Thread/ThreadPool.h"
+#include "Renderer/Public/Core/Thread/JobSystem.h"
+#include "Renderer/Public/Core/Renderer/FrameUploadManager.h"
 #include "Renderer/Public/Resource/ResourceStreamer.h"
 #include "Renderer/Public/Resource/RendererResourceManager.h"
 #include "Renderer/Public/Resource/Mesh/MeshResourceManager.h"
@@ -86,25 +88,41 @@ namespace
 		namespace PipelineStateCache
 		{
 			static constexpr uint32_t FORMAT_TYPE	 = STRING_ID("PipelineStateCache");
-			static constexpr uint32_t FORMAT_VERSION = 1;
+			static constexpr uint32_t FORMAT_VERSION = 2;
 		}
 
 
 		//[-------------------------------------------------------]
 		//[ Global functions                                      ]
 		//[-------------------------------------------------------]
-		void getPipelineStateObjectCacheFilename(const Renderer::IRenderer& renderer, std::string& virtualDirectoryName, std::string& virtualFilename)
+		[[nodiscard]] std::string getPipelineStateObjectCacheFilename(const Renderer::IRenderer& renderer, const std::string& virtualDirectoryName)
 		{
-			virtualDirectoryName = renderer.getFileManager().getLocalDataMountPoint();
-			virtualFilename = virtualDirectoryName + '/' + renderer.getRhi().getName() + ".pso_cache";
+			return virtualDirectoryName + '/' + renderer.getRhi().getName() + ".pso_cache";
 		}
 
-		[[nodiscard]] bool loadPipelineStateObjectCacheFile(const Renderer::IRenderer& renderer, Renderer::MemoryFile& memoryFile)
+		[[nodiscard]] std::string getAssetPackageVirtualDirectoryName(const Renderer::AssetPackage& assetPackage)
+		{
+			// The virtual filename scheme is "<mount point = project name>/<asset directory>/<asset name>.<file extension>" and the mount point
+			// is the asset package directory, see "Renderer::AssetManager::mountAssetPackage()"
+			const Renderer::AssetPackage::SortedAssetVector& sortedAssetVector = assetPackage.getSortedAssetVector();
+			if (!sortedAssetVector.empty())
+			{
+				const char* virtualFilename = sortedAssetVector.front().virtualFilename;
+				const char* slash = strchr(virtualFilename, '/');
+				if (nullptr != slash)
+				{
+					return std::string(virtualFilename, static_cast<size_t>(slash - virtualFilename));
+				}
+			}
+
+			// Asset package without assets or not mounted
+			return std::string();
+		}
+
+		[[nodiscard]] bool loadPipelineStateObjectCacheFile(const Renderer::IRenderer& renderer, const std::string& virtualDirectoryName, Renderer::MemoryFile& memoryFile)
 		{
 			// Tell the memory mapped file about the LZ4 compressed data and decompress it at once
-			std::string virtualDirectoryName;
-			std::string virtualFilename;
-			getPipelineStateObjectCacheFilename(renderer, virtualDirectoryName, virtualFilename);
+			const std::string virtualFilename = getPipelineStateObjectCacheFilename(renderer, virtualDirectoryName);
 			const Renderer::IFileManager& fileManager = renderer.getFileManager();
 			if (fileManager.doesFileExist(virtualFilename.c_str()) && memoryFile.loadLz4CompressedDataByVirtualFilename(PipelineStateCache::FORMAT_TYPE, PipelineStateCache::FORMAT_VERSION, fileManager, virtualFilename.c_str()))
 			{
@@ -119,11 +137,9 @@ namespace
 			return false;
 		}
 
-		void savePipelineStateObjectCacheFile(const Renderer::IRenderer& renderer, const Renderer::MemoryFile& memoryFile)
+		void savePipelineStateObjectCacheFile(const Renderer::IRenderer& renderer, const std::string& virtualDirectoryName, const Renderer::MemoryFile& memoryFile)
 		{
-			std::string virtualDirectoryName;
-			std::string virtualFilename;
-			getPipelineStateObjectCacheFilename(renderer, virtualDirectoryName, virtualFilename);
+			const std::string virtualFilename = getPipelineStateObjectCacheFilename(renderer, virtualDirectoryName);
 			Renderer::IFileManager& fileManager = renderer.getFileManager();
 			if (fileManager.createDirectories(virtualDirectoryName.c_str()) && !memoryFile.writeLz4CompressedDataByVirtualFilename(PipelineStateCache::FORMAT_TYPE, PipelineStateCache::FORMAT_VERSION, fileManager, virtualFilename.c_str()))
 			{
@@ -181,9 +197,10 @@ namespace Renderer
 		mFileManager = &context.getFileManager();
 
 		// Create the core manager instances
-		mDefaultThreadPool = new DefaultThreadPool();
+		mJobSystem = new JobSystem();
 		mAssetManager = new AssetManager(*this);
 		mTimeManager = new TimeManager();
+		mFrameUploadManager = new FrameUploadManager(*mRhi);
 
 		// Create the resource manager instances
 		mRendererResourceManager = new RendererResourceManager(*this);
@@ -268,9 +285,10 @@ namespace Renderer
 		delete mResourceStreamer;
 
 		// Destroy the core manager instances
+		delete mFrameUploadManager;
 		delete mTimeManager;
 		delete mAssetManager;
-		delete mDefaultThreadPool;
+		delete mJobSystem;
 
 		// Release the texture and buffer manager instance
 		mTextureManager->releaseReference();
@@ -350,10 +368,43 @@ namespace Renderer
 		{
 			clearPipelineStateObjectCache();
 
-			// Load file
+			// Load file: The pipeline state object cache inside the local data has priority since it contains everything compiled at runtime
 			MemoryFile memoryFile;
-			if (::detail::loadPipelineStateObjectCacheFile(*this, memoryFile))
+			const char* localDataMountPoint = mFileManager->getLocalDataMountPoint();
+			bool loaded = (nullptr != localDataMountPoint && ::detail::loadPipelineStateObjectCacheFile(*this, localDataMountPoint, memoryFile));
+			if (!loaded)
+			{
+				// Fallback: Precompiled pipeline state object cache shipped inside the asset packages, later added asset packages cover old ones
+				const AssetManager::AssetPackageVector& assetPackageVector = mAssetManager->mAssetPackageVector;
+				for (AssetManager::AssetPackageVector::const_reverse_iterator iterator = assetPackageVector.crbegin(); iterator != assetPackageVector.crend() && !loaded; ++iterator)
+				{
+					const std::string virtualDirectoryName = ::detail::getAssetPackageVirtualDirectoryName(**iterator);
+					loaded = (!virtualDirectoryName.empty() && ::detail::loadPipelineStateObjectCacheFile(*this, virtualDirectoryName, memoryFile));
+				}
+			}
+			if (loaded)
 			{
+				// Opaque RHI implementation specific pipeline cache data, e.g. the content of a Vulkan pipeline cache
+				// -> The RHI implementation validates the data header itself and silently ignores data written by another device or driver version
+				// -> The stored size is validated here also in release builds, a truncated or corrupted file must not result in out-of-bounds reads
+				uint32_t numberOfBytes = 0;
+				if (memoryFile.getNumberOfBytes() < sizeof(uint32_t))
+				{
+					RHI_LOG(getContext(), WARNING, "The renderer pipeline state object cache is truncated and is discarded")
+					return;
+				}
+				memoryFile.read(&numberOfBytes, sizeof(uint32_t));
+				if (numberOfBytes > memoryFile.getNumberOfBytes() - sizeof(uint32_t))
+				{
+					RHI_LOG(getContext(), WARNING, "The renderer pipeline state object cache contains an invalid RHI pipeline cache data size of %u bytes and is discarded", numberOfBytes)
+					return;
+				}
+				if (numberOfBytes > 0)
+				{
+					mRhi->setPipelineCacheData(memoryFile.tryReadWithoutCopy(numberOfBytes), numberOfBytes);
+				}
+
+				// Shader and material blueprint caches
 				mShaderBlueprintResourceManager->loadPipelineStateObjectCache(memoryFile);
 				mMaterialBlueprintResourceManager->loadPipelineStateObjectCache(memoryFile);
 			}
@@ -369,12 +420,32 @@ namespace Renderer
 	{
 		// Do only save the pipeline state object cache if writing local data is allowed
 		// -> We only support saving material blueprint based shader bytecodes, creating shaders without material blueprint is supposed to be only used for debugging and tiny shaders which are compiled at the very beginning of rendering
-		if (mRhi->getCapabilities().shaderBytecode && nullptr != mFileManager->getLocalDataMountPoint() && (mShaderBlueprintResourceManager->doesPipelineStateObjectCacheNeedSaving() || mMaterialBlueprintResourceManager->doesPipelineStateObjectCacheNeedSaving()))
+		if (mRhi->getCapabilities().shaderBytecode && nullptr != mFileManager->getLocalDataMountPoint() && (mShaderBlueprintResourceManager->doesPipelineStateObjectCacheNeedSaving() || mMaterialBlueprintResourceManager->doesPipelineStateObjectCacheNeedSaving() || mRhi->doesPipelineCacheNeedSaving()))
 		{
 			MemoryFile memoryFile;
-			mShaderBlueprintResourceManager->savePipelineStateObjectCache(memoryFile);
-			mMaterialBlueprintResourceManager->savePipelineStateObjectCache(memoryFile);
-			::detail::savePipelineStateObjectCacheFile(*this, memoryFile);
+			writePipelineStateObjectCache(memoryFile);
+			::detail::savePipelineStateObjectCacheFile(*this, mFileManager->getLocalDataMountPoint(), memoryFile);
+		}
+	}
+
+	void RendererImpl::savePrecompiledPipelineStateObjectCache(AssetPackageId assetPackageId)
+	{
+		if (mRhi->getCapabilities().shaderBytecode)
+		{
+			const AssetPackage* assetPackage = mAssetManager->tryGetAssetPackageById(assetPackageId);
+			RHI_ASSERT(getContext(), nullptr != assetPackage, "Unknown renderer asset package ID")
+			const std::string virtualDirectoryName = ::detail::getAssetPackageVirtualDirectoryName(*assetPackage);
+			if (virtualDirectoryName.empty())
+			{
+				RHI_LOG(getContext(), CRITICAL, "The renderer can't save the precompiled pipeline state object cache into an empty or not mounted asset package")
+			}
+			else
+			{
+				// Saved unconditionally since the precompiled pipeline state object cache is supposed to contain everything which has been compiled
+				MemoryFile memoryFile;
+				writePipelineStateObjectCache(memoryFile);
+				::detail::savePipelineStateObjectCacheFile(*this, virtualDirectoryName, memoryFile);
+			}
 		}
 	}
 
@@ -388,6 +459,32 @@ namespace Renderer
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	void RendererImpl::writePipelineStateObjectCache(MemoryFile& memoryFile)
+	{
+		// Opaque RHI implementation specific pipeline cache data, the RHI implementation returns zero bytes if there's nothing to store
+		{
+			uint32_t numberOfBytes = mRhi->getPipelineCacheData(nullptr, 0);
+			MemoryFile::ByteVector pipelineCacheData(numberOfBytes);
+			if (numberOfBytes > 0)
+			{
+				numberOfBytes = mRhi->getPipelineCacheData(pipelineCacheData.data(), numberOfBytes);
+			}
+			memoryFile.write(&numberOfBytes, sizeof(uint32_t));
+			if (numberOfBytes > 0)
+			{
+				memoryFile.write(pipelineCacheData.data(), numberOfBytes);
+			}
+		}
+
+		// Shader and material blueprint caches
+		mShaderBlueprintResourceManager->savePipelineStateObjectCache(memoryFile);
+		mMaterialBlueprintResourceManager->savePipelineStateObjectCache(memoryFile);
+	}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -42,6 +42,15 @@ PRAGMA_WARNING_PUSH
 PRAGMA_WARNING_POP
 
 
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+	class MemoryFile;
+}
+
+
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
 //[-------------------------------------------------------]
@@ -117,6 +126,7 @@ namespace Renderer
 		virtual void clearPipelineStateObjectCache() override;
 		virtual void loadPipelineStateObjectCache() override;
 		virtual void savePipelineStateObjectCache() override;
+		virtual void savePrecompiledPipelineStateObjectCache(AssetPackageId assetPackageId) override;
 
 
 	//[-------------------------------------------------------]
@@ -132,6 +142,7 @@ namespace Renderer
 	private:
 		explicit RendererImpl(const RendererImpl& source) = delete;
 		RendererImpl& operator =(const RendererImpl& source) = delete;
+		void writePipelineStateObjectCache(MemoryFile& memoryFile);
 
 
 	//[-------------------------------------------------------]
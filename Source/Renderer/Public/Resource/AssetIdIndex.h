@@ -0,0 +1,297 @@
+/*********************************************************\
+ * Copyright (c) 2012-2021 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/Core/StringId.h"
+#include "Renderer/Public/Core/GetInvalid.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#include <vector>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Global definitions                                    ]
+	//[-------------------------------------------------------]
+	typedef StringId AssetId;		///< Asset identifier, internally just a POD "uint32_t", string ID scheme is "<project name>/<asset directory>/<asset name>"
+	typedef uint32_t ResourceId;	///< POD resource identifier
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Asset ID to resource ID hash index, used by all resource managers to find the resource instance of an asset
+	*
+	*  @remarks
+	*    Open addressing hash table with linear probing, the capacity is a power of two and the load factor is kept at 50% or below.
+	*    Removal uses backward shift deletion, so there are no tombstones and lookups of unknown asset IDs stay fast no matter how many
+	*    resources were added and removed over time.
+	*
+	*    Several resources can share an asset ID (e.g. cloned material resources), in this case the index stores one of the resources
+	*    together with the number of resources using the asset ID. If the indexed resource gets removed while there are still other
+	*    resources using the asset ID, the resource manager has to provide the replacement via "setResourceId()".
+	*
+	*  @note
+	*    - Not thread-safe, the resource managers are only allowed to be used by the main thread
+	*/
+	class AssetIdIndex final
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		inline AssetIdIndex() :
+			mNumberOfEntries(0)
+		{
+			// Nothing here
+		}
+
+		inline ~AssetIdIndex()
+		{
+			// Nothing here
+		}
+
+		[[nodiscard]] inline uint32_t getNumberOfEntries() const
+		{
+			return mNumberOfEntries;
+		}
+
+		[[nodiscard]] inline ResourceId getResourceId(AssetId assetId) const
+		{
+			const Entry* entry = findEntry(assetId);
+			return (nullptr != entry) ? entry->resourceId : getInvalid<ResourceId>();
+		}
+
+		/**
+		*  @brief
+		*    Register a resource using the given asset ID
+		*
+		*  @param[in] assetId
+		*    Asset ID, must be valid
+		*  @param[in] resourceId
+		*    Resource ID, must be valid, if there's already a resource using the asset ID this resource stays the indexed one
+		*/
+		void addResourceId(AssetId assetId, ResourceId resourceId)
+		{
+			ASSERT(isValid(assetId), "Invalid asset ID")
+			ASSERT(isValid(resourceId), "Invalid resource ID")
+
+			// Is there already a resource using this asset ID?
+			Entry* entry = findEntry(assetId);
+			if (nullptr != entry)
+			{
+				++entry->numberOfResources;
+				return;
+			}
+
+			// Keep the load factor at 50% or below
+			if ((mNumberOfEntries + 1) * 2 > mEntries.size())
+			{
+				rehash(mEntries.empty() ? MINIMUM_CAPACITY : static_cast<uint32_t>(mEntries.size() * 2));
+			}
+
+			// Insert the new entry at the first free slot
+			const uint32_t mask = static_cast<uint32_t>(mEntries.size() - 1);
+			uint32_t slot = getHash(assetId) & mask;
+			while (isValid(mEntries[slot].assetId))
+			{
+				slot = (slot + 1) & mask;
+			}
+			mEntries[slot] = { assetId, resourceId, 1 };
+			++mNumberOfEntries;
+		}
+
+		/**
+		*  @brief
+		*    Unregister a resource using the given asset ID
+		*
+		*  @param[in] assetId
+		*    Asset ID, must be registered
+		*  @param[in] resourceId
+		*    Resource ID, must be registered for the asset ID
+		*
+		*  @return
+		*    "true" if the removed resource was the indexed one and there are other resources left using the asset ID, in this case
+		*    the caller must provide one of them via "setResourceId()", else "false"
+		*/
+		[[nodiscard]] bool removeResourceId(AssetId assetId, ResourceId resourceId)
+		{
+			Entry* entry = findEntry(assetId);
+			ASSERT(nullptr != entry, "Unknown asset ID")
+			if (entry->numberOfResources > 1)
+			{
+				--entry->numberOfResources;
+				if (entry->resourceId == resourceId)
+				{
+					setInvalid(entry->resourceId);
+					return true;
+				}
+				return false;
+			}
+
+			// Backward shift deletion: Move following entries of the probe sequence into the gap
+			const uint32_t mask = static_cast<uint32_t>(mEntries.size() - 1);
+			uint32_t gap = static_cast<uint32_t>(entry - mEntries.data());
+			uint32_t slot = (gap + 1) & mask;
+			while (isValid(mEntries[slot].assetId))
+			{
+				// Only move the entry if its home slot isn't inside the cyclic range "]gap, slot]"
+				const uint32_t home = getHash(mEntries[slot].assetId) & mask;
+				if (((slot - home) & mask) >= ((slot - gap) & mask))
+				{
+					mEntries[gap] = mEntries[slot];
+					gap = slot;
+				}
+				slot = (slot + 1) & mask;
+			}
+			mEntries[gap] = Entry();
+			--mNumberOfEntries;
+			return false;
+		}
+
+		inline void setResourceId(AssetId assetId, ResourceId resourceId)
+		{
+			Entry* entry = findEntry(assetId);
+			ASSERT(nullptr != entry, "Unknown asset ID")
+			entry->resourceId = resourceId;
+		}
+
+		inline void clear()
+		{
+			mEntries.clear();
+			mNumberOfEntries = 0;
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		static constexpr uint32_t MINIMUM_CAPACITY = 64;	///< Must be a power of two
+
+		struct Entry final
+		{
+			AssetId	   assetId;				///< Invalid asset ID marks a free slot
+			ResourceId resourceId		 = getInvalid<ResourceId>();
+			uint32_t   numberOfResources = 0;	///< Number of resources using the asset ID
+		};
+		typedef std::vector<Entry> Entries;
+
+
+	//[-------------------------------------------------------]
+	//[ Private static methods                                ]
+	//[-------------------------------------------------------]
+	private:
+		[[nodiscard]] static inline uint32_t getHash(AssetId assetId)
+		{
+			// Asset IDs are FNV-1a hashes, but the lower bits alone used for the slot aren't distributed well enough, so use the MurmurHash3 finalizer
+			uint32_t hash = assetId;
+			hash ^= hash >> 16;
+			hash *= 0x85ebca6bu;
+			hash ^= hash >> 13;
+			hash *= 0xc2b2ae35u;
+			hash ^= hash >> 16;
+			return hash;
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		[[nodiscard]] inline const Entry* findEntry(AssetId assetId) const
+		{
+			if (mNumberOfEntries > 0)
+			{
+				const uint32_t mask = static_cast<uint32_t>(mEntries.size() - 1);
+				for (uint32_t slot = getHash(assetId) & mask; isValid(mEntries[slot].assetId); slot = (slot + 1) & mask)
+				{
+					if (mEntries[slot].assetId == assetId)
+					{
+						return &mEntries[slot];
+					}
+				}
+			}
+			return nullptr;
+		}
+
+		[[nodiscard]] inline Entry* findEntry(AssetId assetId)
+		{
+			return const_cast<Entry*>(static_cast<const AssetIdIndex*>(this)->findEntry(assetId));
+		}
+
+		void rehash(uint32_t capacity)
+		{
+			Entries entries(capacity);
+			const uint32_t mask = capacity - 1;
+			for (const Entry& entry : mEntries)
+			{
+				if (isValid(entry.assetId))
+				{
+					uint32_t slot = getHash(entry.assetId) & mask;
+					while (isValid(entries[slot].assetId))
+					{
+						slot = (slot + 1) & mask;
+					}
+					entries[slot] = entry;
+				}
+			}
+			mEntries.swap(entries);
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		Entries	 mEntries;
+		uint32_t mNumberOfEntries;
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
@@ -60,6 +60,12 @@ namespace Renderer
 		Rhi::IRenderTarget* currentRenderTarget = nullptr;
 		for (ICompositorInstancePass* compositorInstancePass : mCompositorInstancePasses)
 		{
+			// Skip compositor instance passes nothing consumes the output from
+			if (compositorInstancePass->mCulled)
+			{
+				continue;
+			}
+
 			// Check whether or not to execute the compositor pass instance
 			const ICompositorResourcePass& compositorResourcePass = compositorInstancePass->getCompositorResourcePass();
 			if ((!compositorResourcePass.getSkipFirstExecution() || compositorInstancePass->mNumberOfExecutionRequests > 0) &&
@@ -81,6 +81,18 @@ namespace Renderer
 			return mRenderTarget;
 		}
 
+		/**
+		*  @brief
+		*    Return whether or not the compositor instance pass has been culled by the compositor workspace instance
+		*
+		*  @return
+		*    "true" if the compositor instance pass is never executed since nothing consumes its output, else "false"
+		*/
+		[[nodiscard]] inline bool isCulled() const
+		{
+			return mCulled;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual Renderer::ICompositorInstancePass methods ]
@@ -133,7 +145,8 @@ namespace Renderer
 			mCompositorResourcePass(compositorResourcePass),
 			mCompositorNodeInstance(compositorNodeInstance),
 			mRenderTarget(nullptr),
-			mNumberOfExecutionRequests(0)
+			mNumberOfExecutionRequests(0),
+			mCulled(false)
 		{
 			// Nothing here
 		}
@@ -155,6 +168,7 @@ namespace Renderer
 		const CompositorNodeInstance&  mCompositorNodeInstance;
 		Rhi::IRenderTarget*			   mRenderTarget;	/// Render target, can be a null pointer, don't destroy the instance
 		uint32_t					   mNumberOfExecutionRequests;
+		bool						   mCulled;		///< Set by the compositor workspace instance in case nothing consumes the output of the compositor instance pass
 
 
 	};
@@ -59,13 +59,10 @@ namespace Renderer
 		// Fill command buffer
 		RHI_ASSERT(getCompositorNodeInstance().getCompositorWorkspaceInstance().getRenderer().getContext(), nullptr != mRenderQueueIndexRange, "Invalid render queue index range")
 		const MaterialTechniqueId materialTechniqueId = static_cast<const CompositorResourcePassScene&>(getCompositorResourcePass()).getMaterialTechniqueId();
-		for (const RenderableManager* renderableManager : mRenderQueueIndexRange->renderableManagers)
-		{
-			// The render queue index range covered by this compositor instance pass scene might be smaller than the range of the
-			// cached render queue index range. So, we could add a range check in here to reject renderable managers, but it's not
-			// really worth to do so since the render queue only considers renderables inside the render queue range anyway.
-			mRenderQueue.addRenderablesFromRenderableManager(*renderableManager, materialTechniqueId, compositorContextData);
-		}
+		// -> The render queue index range covered by this compositor instance pass scene might be smaller than the range of the
+		//    cached render queue index range. So, we could add a range check in here to reject renderable managers, but it's not
+		//    really worth to do so since the render queue only considers renderables inside the render queue range anyway.
+		mRenderQueue.addRenderablesFromRenderableManagers(mRenderQueueIndexRange->renderableManagers, materialTechniqueId, compositorContextData);
 		if (mRenderQueue.getNumberOfDrawCalls() > 0)
 		{
 			mRenderQueue.fillGraphicsCommandBuffer(*renderTarget, compositorContextData, commandBuffer);
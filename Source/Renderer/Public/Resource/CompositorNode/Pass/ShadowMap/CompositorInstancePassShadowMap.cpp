@@ -30,6 +30,8 @@
 #include "Renderer/Public/Resource/Scene/Item/Camera/CameraSceneItem.h"
 #include "Renderer/Public/Resource/Scene/Item/Light/LightSceneItem.h"
 #include "Renderer/Public/Resource/Scene/SceneNode.h"
+#include "Renderer/Public/Resource/Scene/SceneResource.h"
+#include "Renderer/Public/Resource/Scene/Culling/SceneCullingManager.h"
 #include "Renderer/Public/RenderQueue/RenderableManager.h"
 #include "Renderer/Public/Core/Math/Math.h"
 #include "Renderer/Public/Core/IProfiler.h"
@@ -62,6 +64,19 @@ namespace
 		static constexpr uint32_t INTERMEDIATE_DEPTH_BLUR_SHADOW_MAP_TEXTURE_ASSET_ID = ASSET_ID("Unrimp/Texture/DynamicByCode/IntermediateDepthBlurShadowMap");
 
 
+		//[-------------------------------------------------------]
+		//[ Structures                                            ]
+		//[-------------------------------------------------------]
+		struct ShadowCascade final
+		{
+			glm::mat4 depthProjectionMatrix;
+			glm::mat4 depthViewMatrix;
+			glm::vec3 minimumExtents;
+			glm::vec3 maximumExtents;
+			glm::vec3 cascadeExtents;
+		};
+
+
 		//[-------------------------------------------------------]
 		//[ Global functions                                      ]
 		//[-------------------------------------------------------]
@@ -212,14 +227,11 @@ namespace Renderer
 			// Combined scoped profiler CPU and GPU sample as well as renderer debug event command
 			RENDERER_SCOPED_PROFILER_EVENT_DYNAMIC(renderer.getContext(), commandBuffer, static_cast<const CompositorResourcePassShadowMap&>(getCompositorResourcePass()).getDebugName())
 
-			// Render the meshes to each cascade
-			// -> Shadows should never be rendered via single pass stereo instancing
-			const CompositorContextData shadowCompositorContextData(compositorContextData.getCompositorWorkspaceInstance(), compositorContextData.getCameraSceneItem(), false, compositorContextData.getLightSceneItem(), compositorContextData.getCompositorInstancePassShadowMap());
+			// Compute the light space matrices of each cascade upfront so the shadow casters of all cascades can be culled in parallel
+			::detail::ShadowCascade shadowCascades[CompositorResourcePassShadowMap::MAXIMUM_NUMBER_OF_SHADOW_CASCADES];
+			glm::mat4 viewSpaceToClipSpaceMatrices[CompositorResourcePassShadowMap::MAXIMUM_NUMBER_OF_SHADOW_CASCADES];
 			for (uint8_t cascadeIndex = 0; cascadeIndex < mNumberOfShadowCascades; ++cascadeIndex)
 			{
-				// Scoped debug event
-				RENDERER_SCOPED_PROFILER_EVENT_DYNAMIC(renderer.getContext(), commandBuffer, ("Shadow cascade " + std::to_string(cascadeIndex)).c_str())
-
 				// Compute the MVP matrix from the light's point of view
 				glm::mat4 depthProjectionMatrix;
 				glm::mat4 depthViewMatrix;
@@ -320,9 +332,26 @@ namespace Renderer
 					viewSpaceToClipSpace = depthProjectionMatrix * depthViewMatrix;
 				}
 
+				// Backup the cascade for culling and rendering
+				shadowCascades[cascadeIndex] = { depthProjectionMatrix, depthViewMatrix, minimumExtents, maximumExtents, cascadeExtents };
+				viewSpaceToClipSpaceMatrices[cascadeIndex] = viewSpaceToClipSpace;
+			}
+
+			// Gather the shadow casters of each cascade, the cascades are culled in parallel
+			cameraSceneItem->getSceneResource().getSceneCullingManager().gatherShadowCastersRenderableManagers(compositorContextData, mNumberOfShadowCascades, viewSpaceToClipSpaceMatrices, mShadowCastersRenderableManagers);
+
+			// Render the meshes to each cascade
+			// -> Shadows should never be rendered via single pass stereo instancing
+			const CompositorContextData shadowCompositorContextData(compositorContextData.getCompositorWorkspaceInstance(), compositorContextData.getCameraSceneItem(), false, compositorContextData.getLightSceneItem(), compositorContextData.getCompositorInstancePassShadowMap());
+			for (uint8_t cascadeIndex = 0; cascadeIndex < mNumberOfShadowCascades; ++cascadeIndex)
+			{
+				// Scoped debug event
+				RENDERER_SCOPED_PROFILER_EVENT_DYNAMIC(renderer.getContext(), commandBuffer, ("Shadow cascade " + std::to_string(cascadeIndex)).c_str())
+
 				// Set custom camera matrices
-				const_cast<CameraSceneItem*>(cameraSceneItem)->setCustomWorldSpaceToViewSpaceMatrix(depthViewMatrix);
-				const_cast<CameraSceneItem*>(cameraSceneItem)->setCustomViewSpaceToClipSpaceMatrix(depthProjectionMatrix, glm::ortho(minimumExtents.x, maximumExtents.x, minimumExtents.y, maximumExtents.y, cascadeExtents.z, 0.0f));
+				const ::detail::ShadowCascade& shadowCascade = shadowCascades[cascadeIndex];
+				const_cast<CameraSceneItem*>(cameraSceneItem)->setCustomWorldSpaceToViewSpaceMatrix(shadowCascade.depthViewMatrix);
+				const_cast<CameraSceneItem*>(cameraSceneItem)->setCustomViewSpaceToClipSpaceMatrix(shadowCascade.depthProjectionMatrix, glm::ortho(shadowCascade.minimumExtents.x, shadowCascade.maximumExtents.x, shadowCascade.minimumExtents.y, shadowCascade.maximumExtents.y, shadowCascade.cascadeExtents.z, 0.0f));
 
 				{ // Render shadow casters
 					// Scoped debug event
@@ -339,20 +368,11 @@ namespace Renderer
 						Rhi::Command::ClearGraphics::create(commandBuffer, Rhi::ClearFlag::DEPTH, color);
 					}
 
-					// Render shadow casters
-					// TODO(co) Optimization: Do only render stuff which calls into the current shadow cascade
-					RHI_ASSERT(renderer.getContext(), nullptr != mRenderQueueIndexRange, "Invalid render queue index range")
+					// Render the shadow casters of the current cascade
+					// -> The culled shadow casters aren't sorted into render queue index ranges, but it's not really worth to add a range
+					//    check in here to reject renderable managers since the render queue only considers renderables inside the render queue range anyway
 					const MaterialTechniqueId materialTechniqueId = static_cast<const CompositorResourcePassScene&>(getCompositorResourcePass()).getMaterialTechniqueId();
-					for (const RenderableManager* renderableManager : mRenderQueueIndexRange->renderableManagers)
-					{
-						// The render queue index range covered by this compositor instance pass scene might be smaller than the range of the
-						// cached render queue index range. So, we could add a range check in here to reject renderable managers, but it's not
-						// really worth to do so since the render queue only considers renderables inside the render queue range anyway.
-						if (renderableManager->getCastShadows())
-						{
-							mRenderQueue.addRenderablesFromRenderableManager(*renderableManager, materialTechniqueId, shadowCompositorContextData, true);
-						}
-					}
+					mRenderQueue.addRenderablesFromRenderableManagers(mShadowCastersRenderableManagers[cascadeIndex], materialTechniqueId, shadowCompositorContextData, true);
 					if (mRenderQueue.getNumberOfDrawCalls() > 0)
 					{
 						mRenderQueue.fillGraphicsCommandBuffer(*mDepthFramebufferPtr, shadowCompositorContextData, commandBuffer);
@@ -365,11 +385,11 @@ namespace Renderer
 				const_cast<CameraSceneItem*>(cameraSceneItem)->unsetCustomViewSpaceToClipSpaceMatrix();
 
 				// Apply the scale/offset matrix, which transforms from [-1,1] post-projection space to [0,1] UV space
-				const glm::mat4 shadowMatrix = Math::getTextureScaleBiasMatrix(renderer.getRhi()) * viewSpaceToClipSpace;
+				const glm::mat4 shadowMatrix = Math::getTextureScaleBiasMatrix(renderer.getRhi()) * viewSpaceToClipSpaceMatrices[cascadeIndex];
 
 				// Store the split distance in terms of view space depth
 				const float clipDistance = cameraSceneItem->getFarZ() - cameraSceneItem->getNearZ();
-				mPassData.shadowCascadeSplits[cascadeIndex] = cameraSceneItem->getNearZ() + splitDistance * clipDistance;
+				mPassData.shadowCascadeSplits[cascadeIndex] = cameraSceneItem->getNearZ() + cascadeSplits[cascadeIndex] * clipDistance;
 				if (0 == cascadeIndex)
 				{
 					mPassData.shadowMatrix = shadowMatrix;
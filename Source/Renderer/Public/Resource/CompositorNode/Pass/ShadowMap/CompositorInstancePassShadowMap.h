@@ -228,6 +228,7 @@ namespace Renderer
 		uint32_t					   mSettingsGenerationCounter;	// Most simple solution to detect settings changes which make internal data invalid
 		uint32_t					   mUsedSettingsGenerationCounter;
 		PassData					   mPassData;
+		CompositorWorkspaceInstance::RenderableManagers mShadowCastersRenderableManagers[CompositorResourcePassShadowMap::MAXIMUM_NUMBER_OF_SHADOW_CASCADES];	///< Culled shadow casters of each shadow cascade
 		Rhi::IFramebufferPtr		   mDepthFramebufferPtr;
 		Rhi::IFramebufferPtr		   mVarianceFramebufferPtr[CompositorResourcePassShadowMap::MAXIMUM_NUMBER_OF_SHADOW_CASCADES];
 		Rhi::IFramebufferPtr		   mIntermediateFramebufferPtr;
@@ -33,6 +33,10 @@
 #include "Renderer/Public/Resource/CompositorNode/Pass/ICompositorInstancePass.h"
 #include "Renderer/Public/Resource/CompositorNode/Pass/ShadowMap/CompositorInstancePassShadowMap.h"
 #include "Renderer/Public/Resource/CompositorNode/Pass/ShadowMap/CompositorResourcePassShadowMap.h"
+#include "Renderer/Public/Resource/CompositorNode/Pass/Compute/CompositorResourcePassCompute.h"
+#include "Renderer/Public/Resource/CompositorNode/Pass/Copy/CompositorResourcePassCopy.h"
+#include "Renderer/Public/Resource/CompositorNode/Pass/GenerateMipmaps/CompositorResourcePassGenerateMipmaps.h"
+#include "Renderer/Public/Resource/CompositorNode/Pass/ResolveMultisample/CompositorResourcePassResolveMultisample.h"
 #include "Renderer/Public/Resource/MaterialBlueprint/BufferManager/IndirectBufferManager.h"
 #include "Renderer/Public/Resource/MaterialBlueprint/BufferManager/LightBufferManager.h"
 #include "Renderer/Public/Resource/MaterialBlueprint/BufferManager/PassBufferManager.h"
@@ -45,7 +49,9 @@
 #include "Renderer/Public/Resource/Scene/Culling/SceneCullingManager.h"
 #include "Renderer/Public/Core/IProfiler.h"
 #include "Renderer/Public/Core/Renderer/FramebufferManager.h"
+#include "Renderer/Public/Core/Renderer/FrameUploadManager.h"
 #include "Renderer/Public/Core/Renderer/RenderTargetTextureManager.h"
+#include "Renderer/Public/Core/Thread/RenderThread.h"
 #ifdef RENDERER_GRAPHICS_DEBUGGER
 	#include "Renderer/Public/Core/IGraphicsDebugger.h"
 #endif
@@ -55,6 +61,244 @@
 #include "Renderer/Public/IRenderer.h"
 
 #include <algorithm>
+#include <unordered_map>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		typedef std::vector<uint32_t>													FrameGraphTextureAssetIds;			///< "Renderer::AssetId"-type
+		typedef std::unordered_map<uint32_t, const Renderer::FramebufferSignature*>		FrameGraphFramebufferSignatures;	///< Key = "Renderer::CompositorFramebufferId"
+		typedef std::unordered_map<uint32_t, Renderer::RenderTargetTextureSignatureId>	FrameGraphTransientTextures;		///< Key = "Renderer::AssetId", only render target textures flagged as transient
+
+
+		//[-------------------------------------------------------]
+		//[ Structures                                            ]
+		//[-------------------------------------------------------]
+		struct FrameGraphPass final
+		{
+			Renderer::ICompositorInstancePass* compositorInstancePass;
+			FrameGraphTextureAssetIds		   writtenTextureAssetIds;		///< Framebuffer attachment textures the compositor pass renders into
+			FrameGraphTextureAssetIds		   referencedTextureAssetIds;	///< Other textures the compositor pass reads or writes (e.g. compute pass material properties or copy source and destination)
+			bool							   executedEachFrame;			///< "false" if the compositor pass has a limited number of executions, the content it produces must survive frames
+			bool							   cullable;					///< "true" if the compositor pass has no side effects beyond rendering into its framebuffer, else "false"
+		};
+		typedef std::vector<FrameGraphPass> FrameGraphPasses;
+
+		struct FrameGraphTextureLifetime final
+		{
+			uint32_t								 assetId;	///< "Renderer::AssetId"-type
+			Renderer::RenderTargetTextureSignatureId renderTargetTextureSignatureId;
+			uint32_t								 firstPassIndex;
+			uint32_t								 lastPassIndex;
+			bool									 pinned;	///< "true" if referenced by a compositor pass which isn't executed each frame, such render target textures are never aliased
+		};
+		typedef std::vector<FrameGraphTextureLifetime> FrameGraphTextureLifetimes;
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		void gatherFrameGraphFramebufferTextureAssetIds(const FrameGraphFramebufferSignatures& frameGraphFramebufferSignatures, Renderer::CompositorFramebufferId compositorFramebufferId, FrameGraphTextureAssetIds& textureAssetIds)
+		{
+			const FrameGraphFramebufferSignatures::const_iterator iterator = frameGraphFramebufferSignatures.find(compositorFramebufferId);
+			if (frameGraphFramebufferSignatures.cend() != iterator)
+			{
+				const Renderer::FramebufferSignature& framebufferSignature = *iterator->second;
+				const uint8_t numberOfColorAttachments = framebufferSignature.getNumberOfColorAttachments();
+				for (uint8_t i = 0; i < numberOfColorAttachments; ++i)
+				{
+					const Renderer::AssetId textureAssetId = framebufferSignature.getColorFramebufferSignatureAttachment(i).textureAssetId;
+					if (Renderer::isValid(textureAssetId))
+					{
+						textureAssetIds.push_back(textureAssetId);
+					}
+				}
+				const Renderer::AssetId depthStencilTextureAssetId = framebufferSignature.getDepthStencilFramebufferSignatureAttachment().textureAssetId;
+				if (Renderer::isValid(depthStencilTextureAssetId))
+				{
+					textureAssetIds.push_back(depthStencilTextureAssetId);
+				}
+			}
+		}
+
+		[[nodiscard]] inline bool frameGraphPassReferencesTexture(const FrameGraphPass& frameGraphPass, uint32_t textureAssetId)
+		{
+			return (std::find(frameGraphPass.writtenTextureAssetIds.cbegin(), frameGraphPass.writtenTextureAssetIds.cend(), textureAssetId) != frameGraphPass.writtenTextureAssetIds.cend() ||
+					std::find(frameGraphPass.referencedTextureAssetIds.cbegin(), frameGraphPass.referencedTextureAssetIds.cend(), textureAssetId) != frameGraphPass.referencedTextureAssetIds.cend());
+		}
+
+		[[nodiscard]] bool isFrameGraphTextureReferencedAfterPass(const FrameGraphPasses& frameGraphPasses, size_t passIndex, uint32_t textureAssetId)
+		{
+			const size_t numberOfPasses = frameGraphPasses.size();
+			for (size_t i = passIndex + 1; i < numberOfPasses; ++i)
+			{
+				const FrameGraphPass& frameGraphPass = frameGraphPasses[i];
+				if (!frameGraphPass.compositorInstancePass->isCulled() && frameGraphPassReferencesTexture(frameGraphPass, textureAssetId))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		void updateFrameGraphTextureLifetime(const FrameGraphTransientTextures& frameGraphTransientTextures, uint32_t textureAssetId, uint32_t passIndex, bool executedEachFrame, FrameGraphTextureLifetimes& frameGraphTextureLifetimes)
+		{
+			const FrameGraphTransientTextures::const_iterator iterator = frameGraphTransientTextures.find(textureAssetId);
+			if (frameGraphTransientTextures.cend() != iterator)
+			{
+				FrameGraphTextureLifetimes::iterator lifetimeIterator = std::find_if(frameGraphTextureLifetimes.begin(), frameGraphTextureLifetimes.end(), [textureAssetId](const FrameGraphTextureLifetime& frameGraphTextureLifetime) { return (frameGraphTextureLifetime.assetId == textureAssetId); });
+				if (frameGraphTextureLifetimes.end() == lifetimeIterator)
+				{
+					frameGraphTextureLifetimes.push_back({ textureAssetId, iterator->second, passIndex, passIndex, !executedEachFrame });
+				}
+				else
+				{
+					// Passes are visited in execution order, so only the end of the lifetime can grow
+					lifetimeIterator->lastPassIndex = passIndex;
+					if (!executedEachFrame)
+					{
+						lifetimeIterator->pinned = true;
+					}
+				}
+			}
+		}
+
+		void gatherCommandBufferResources(const Rhi::CommandBuffer& commandBuffer, std::vector<Rhi::IResource*>& resources)
+		{
+			// The command buffer holds raw RHI resource pointers, collect all of them so the render thread can't end up using a resource which got destroyed in the meantime
+			Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket();
+			while (nullptr != constCommandPacket)
+			{
+				const void* command = Rhi::CommandPacketHelper::loadCommand(constCommandPacket);
+				switch (Rhi::CommandPacketHelper::loadCommandDispatchFunctionIndex(constCommandPacket))
+				{
+					case Rhi::CommandDispatchFunctionIndex::DISPATCH_COMMAND_BUFFER:
+						gatherCommandBufferResources(*static_cast<const Rhi::Command::DispatchCommandBuffer*>(command)->commandBufferToDispatch, resources);
+						break;
+
+					case Rhi::CommandDispatchFunctionIndex::SET_GRAPHICS_ROOT_SIGNATURE:
+						resources.push_back(static_cast<const Rhi::Command::SetGraphicsRootSignature*>(command)->rootSignature);
+						break;
+
+					case Rhi::CommandDispatchFunctionIndex::SET_GRAPHICS_PIPELINE_STATE:
+						resources.push_back(static_cast<const Rhi::Command::SetGraphicsPipelineState*>(command)->graphicsPipelineState);
+						break;
+
+					case Rhi::CommandDispatchFunctionIndex::SET_GRAPHICS_RESOURCE_GROUP:
+						resources.push_back(static_cast<const Rhi::Command::SetGraphicsResourceGroup*>(command)->resourceGroup);
+						break;
+
+					case Rhi::CommandDispatchFunctionIndex::SET_GRAPHICS_VERTEX_ARRAY:
+						resources.push_back(static_cast<const Rhi::Command::SetGraphicsVertexArray*>(command)->vertexArray);
+						break;
+
+					case Rhi::CommandDispatchFunctionIndex::SET_GRAPHICS_RENDER_TARGET:
+						resources.push_back(static_cast<const Rhi::Command::SetGraphicsRenderTarget*>(command)->renderTarget);
+						break;
+
+					case Rhi::CommandDispatchFunctionIndex::DRAW_GRAPHICS:
+						resources.push_back(const_cast<Rhi::IIndirectBuffer*>(static_cast<const Rhi::Command::DrawGraphics*>(command)->indirectBuffer));
+						break;
+
+					case Rhi::CommandDispatchFunctionIndex::DRAW_INDEXED_GRAPHICS:
+						resources.push_back(const_cast<Rhi::IIndirectBuffer*>(static_cast<const Rhi::Command::DrawIndexedGraphics*>(command)->indirectBuffer));
+						break;
+
+					case Rhi::CommandDispatchFunctionIndex::DRAW_MESH_TASKS:
+						resources.push_back(const_cast<Rhi::IIndirectBuffer*>(static_cast<const Rhi::Command::DrawMeshTasks*>(command)->indirectBuffer));
+						break;
+
+					case Rhi::CommandDispatchFunctionIndex::SET_COMPUTE_ROOT_SIGNATURE:
+						resources.push_back(static_cast<const Rhi::Command::SetComputeRootSignature*>(command)->rootSignature);
+						break;
+
+					case Rhi::CommandDispatchFunctionIndex::SET_COMPUTE_PIPELINE_STATE:
+						resources.push_back(static_cast<const Rhi::Command::SetComputePipelineState*>(command)->computePipelineState);
+						break;
+
+					case Rhi::CommandDispatchFunctionIndex::SET_COMPUTE_RESOURCE_GROUP:
+						resources.push_back(static_cast<const Rhi::Command::SetComputeResourceGroup*>(command)->resourceGroup);
+						break;
+
+					case Rhi::CommandDispatchFunctionIndex::SET_TEXTURE_MINIMUM_MAXIMUM_MIPMAP_INDEX:
+						resources.push_back(static_cast<const Rhi::Command::SetTextureMinimumMaximumMipmapIndex*>(command)->texture);
+						break;
+
+					case Rhi::CommandDispatchFunctionIndex::RESOLVE_MULTISAMPLE_FRAMEBUFFER:
+					{
+						const Rhi::Command::ResolveMultisampleFramebuffer* resolveMultisampleFramebuffer = static_cast<const Rhi::Command::ResolveMultisampleFramebuffer*>(command);
+						resources.push_back(resolveMultisampleFramebuffer->destinationRenderTarget);
+						resources.push_back(resolveMultisampleFramebuffer->sourceMultisampleFramebuffer);
+						break;
+					}
+
+					case Rhi::CommandDispatchFunctionIndex::COPY_RESOURCE:
+					{
+						const Rhi::Command::CopyResource* copyResource = static_cast<const Rhi::Command::CopyResource*>(command);
+						resources.push_back(copyResource->destinationResource);
+						resources.push_back(copyResource->sourceResource);
+						break;
+					}
+
+					case Rhi::CommandDispatchFunctionIndex::GENERATE_MIPMAPS:
+						resources.push_back(static_cast<const Rhi::Command::GenerateMipmaps*>(command)->resource);
+						break;
+
+					case Rhi::CommandDispatchFunctionIndex::COPY_UNIFORM_BUFFER_DATA:
+						resources.push_back(static_cast<const Rhi::Command::CopyUniformBufferData*>(command)->uniformBuffer);
+						break;
+
+					case Rhi::CommandDispatchFunctionIndex::SET_UNIFORM:
+						resources.push_back(static_cast<const Rhi::Command::SetUniform*>(command)->graphicsProgram);
+						break;
+
+					case Rhi::CommandDispatchFunctionIndex::RESET_QUERY_POOL:
+						resources.push_back(static_cast<const Rhi::Command::ResetQueryPool*>(command)->queryPool);
+						break;
+
+					case Rhi::CommandDispatchFunctionIndex::BEGIN_QUERY:
+						resources.push_back(static_cast<const Rhi::Command::BeginQuery*>(command)->queryPool);
+						break;
+
+					case Rhi::CommandDispatchFunctionIndex::END_QUERY:
+						resources.push_back(static_cast<const Rhi::Command::EndQuery*>(command)->queryPool);
+						break;
+
+					case Rhi::CommandDispatchFunctionIndex::WRITE_TIMESTAMP_QUERY:
+						resources.push_back(static_cast<const Rhi::Command::WriteTimestampQuery*>(command)->queryPool);
+						break;
+
+					case Rhi::CommandDispatchFunctionIndex::SET_GRAPHICS_VIEWPORTS:
+					case Rhi::CommandDispatchFunctionIndex::SET_GRAPHICS_SCISSOR_RECTANGLES:
+					case Rhi::CommandDispatchFunctionIndex::CLEAR_GRAPHICS:
+					case Rhi::CommandDispatchFunctionIndex::DISPATCH_COMPUTE:
+					case Rhi::CommandDispatchFunctionIndex::SET_DEBUG_MARKER:
+					case Rhi::CommandDispatchFunctionIndex::BEGIN_DEBUG_EVENT:
+					case Rhi::CommandDispatchFunctionIndex::END_DEBUG_EVENT:
+					case Rhi::CommandDispatchFunctionIndex::NUMBER_OF_FUNCTIONS:
+						// Nothing here, no RHI resources referenced
+						break;
+				}
+				constCommandPacket = Rhi::CommandPacketHelper::getNextCommandPacket(constCommandPacket);
+			}
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
 
 
 //[-------------------------------------------------------]
@@ -77,6 +321,11 @@ namespace Renderer
 		mCompositorWorkspaceResourceId(getInvalid<CompositorWorkspaceResourceId>()),
 		mFramebufferManagerInitialized(false),
 		mExecutionRenderTarget(nullptr),
+		mCommandBuffers{Rhi::CommandBuffer(&renderer.getContext().getAllocator()), Rhi::CommandBuffer(&renderer.getContext().getAllocator())},
+		mCommandBufferIndex(0),
+		mRenderThread(nullptr),
+		mRenderThreadRenderTarget(nullptr),
+		mRenderThreadUploadFrameIndex(0),
 		mCompositorInstancePassShadowMap(nullptr)
 		#ifdef RHI_STATISTICS
 			, mPipelineStatisticsQueryPoolPtr((renderer.getRhi().getNameId() == Rhi::NameId::OPENGL && strstr(renderer.getRhi().getCapabilities().deviceName, "AMD ") != nullptr) ? nullptr : renderer.getRhi().createQueryPool(Rhi::QueryType::PIPELINE_STATISTICS, 2 RHI_RESOURCE_DEBUG_NAME("Compositor workspace instance"))),	// TODO(co) When using OpenGL "GL_ARB_pipeline_statistics_query" features, "glCopyImageSubData()" will horribly stall/freeze on Windows using AMD Radeon 18.12.2 (tested on 16 December 2018). No issues with NVIDIA GeForce game ready driver 417.35 (release data 12/12/2018).
@@ -92,6 +341,25 @@ namespace Renderer
 	{
 		// Cleanup
 		destroySequentialCompositorNodeInstances();
+		setPipelinedRendering(false);
+	}
+
+	void CompositorWorkspaceInstance::setPipelinedRendering(bool pipelinedRendering)
+	{
+		// The RHI implementation must support native multithreading since the RHI is used by the render thread
+		if (pipelinedRendering && mRenderer.getRhi().getCapabilities().nativeMultithreading)
+		{
+			if (nullptr == mRenderThread)
+			{
+				mRenderThread = new RenderThread();
+			}
+		}
+		else if (nullptr != mRenderThread)
+		{
+			waitForRenderThread();
+			delete mRenderThread;
+			mRenderThread = nullptr;
+		}
 	}
 
 	void CompositorWorkspaceInstance::setNumberOfMultisamples(uint8_t numberOfMultisamples)
@@ -156,9 +424,11 @@ namespace Renderer
 
 	void CompositorWorkspaceInstance::execute(Rhi::IRenderTarget& renderTarget, const CameraSceneItem* cameraSceneItem, const LightSceneItem* lightSceneItem, bool singlePassStereoInstancing)
 	{
-		// Clear the command buffer from the previous frame
+		// Clear the command buffer from the frame before the previous frame, the command buffer of the previous frame might still be dispatched by the render thread
 		// -> We didn't request a clear together with the dispatch so e.g. "Renderer::DebugGuiHelper::drawMetricsWindow()" can show some command buffer statistics
-		mCommandBuffer.clear();
+		const uint32_t commandBufferIndex = (0 == mCommandBufferIndex) ? 1u : 0u;
+		Rhi::CommandBuffer& commandBuffer = mCommandBuffers[commandBufferIndex];
+		commandBuffer.clear();
 
 		// We could directly clear the render queue index ranges renderable managers as soon as the frame rendering has been finished to avoid evil dangling pointers,
 		// but on the other hand a responsible user might be interested in the potentially on-screen renderable managers to perform work which should only be performed
@@ -175,10 +445,6 @@ namespace Renderer
 			MaterialBlueprintResourceManager& materialBlueprintResourceManager = mRenderer.getMaterialBlueprintResourceManager();
 			materialBlueprintResourceManager.getGlobalMaterialProperties().setPropertyById(STRING_ID("GlobalNumberOfMultisamples"), MaterialPropertyValue::fromInteger((mNumberOfMultisamples == 1) ? 0 : mNumberOfMultisamples));
 
-			// Add reference to the render target
-			renderTarget.addReference();
-			mExecutionRenderTarget = &renderTarget;
-
 			// Get the main render target size
 			uint32_t renderTargetWidth  = 1;
 			uint32_t renderTargetHeight = 1;
@@ -203,6 +469,7 @@ namespace Renderer
 				}
 				if (destroy)
 				{
+					waitForRenderThread();
 					destroyFramebuffersAndRenderTargetTextures();
 				}
 			}
@@ -210,11 +477,39 @@ namespace Renderer
 			// Create framebuffers and render target textures, if required
 			if (!mFramebufferManagerInitialized)
 			{
+				waitForRenderThread();
 				createFramebuffersAndRenderTargetTextures(renderTarget);
 			}
 
+			// Gather render queue index ranges renderable managers
+			// -> Pure CPU work which doesn't touch the RHI, so with pipelined rendering it's overlapping with the render thread dispatching the previous frame
+			const bool pipelined = (nullptr != mRenderThread && renderTarget.getResourceType() == Rhi::ResourceType::SWAP_CHAIN);
+			const CompositorContextData compositorContextData(this, cameraSceneItem, singlePassStereoInstancing, lightSceneItem, mCompositorInstancePassShadowMap);
+			if (nullptr != cameraSceneItem)
+			{
+				mExecuteOnRenderingSceneItems.clear();
+				cameraSceneItem->getSceneResource().getSceneCullingManager().gatherRenderQueueIndexRangesRenderableManagers(renderTarget, compositorContextData, mRenderQueueIndexRanges, mExecuteOnRenderingSceneItems);
+			}
+
+			// From here on the RHI is used, e.g. for buffer mapping
+			// -> With pipelined rendering the buffer managers write into frame-indexed staging memory of the frame upload manager and the render thread performs the
+			//    uploads just before dispatching the command buffer, so filling the command buffer is overlapping with the render thread dispatching the previous frame
+			// -> Else the previous frame must have been dispatched before the RHI is used
+			FrameUploadManager& frameUploadManager = mRenderer.getFrameUploadManager();
+			if (pipelined)
+			{
+				frameUploadManager.beginDeferredUploads();
+			}
+			else
+			{
+				waitForRenderThread();
+			}
+
+			// Add reference to the render target
+			renderTarget.addReference();
+			mExecutionRenderTarget = &renderTarget;
+
 			// Begin scene rendering
-			Rhi::IRhi& rhi = renderTarget.getRhi();
 			{
 				#ifdef RENDERER_GRAPHICS_DEBUGGER
 					IGraphicsDebugger& graphicsDebugger = mRenderer.getContext().getGraphicsDebugger();
@@ -226,36 +521,31 @@ namespace Renderer
 				#ifdef RHI_STATISTICS
 					if (nullptr != mPipelineStatisticsQueryPoolPtr)
 					{
-						Rhi::Command::ResetAndBeginQuery::create(mCommandBuffer, *mPipelineStatisticsQueryPoolPtr, mCurrentPipelineStatisticsQueryIndex);
+						Rhi::Command::ResetAndBeginQuery::create(commandBuffer, *mPipelineStatisticsQueryPoolPtr, mCurrentPipelineStatisticsQueryIndex);
 					}
 				#endif
 
-				const CompositorContextData compositorContextData(this, cameraSceneItem, singlePassStereoInstancing, lightSceneItem, mCompositorInstancePassShadowMap);
 				if (nullptr != cameraSceneItem)
 				{
-					// Gather render queue index ranges renderable managers
-					mExecuteOnRenderingSceneItems.clear();
-					cameraSceneItem->getSceneResource().getSceneCullingManager().gatherRenderQueueIndexRangesRenderableManagers(renderTarget, compositorContextData, mRenderQueueIndexRanges, mExecuteOnRenderingSceneItems);
-
 					// Execute on rendering scene items
 					for (ISceneItem* sceneItem : mExecuteOnRenderingSceneItems)
 					{
-						sceneItem->onExecuteOnRendering(renderTarget, compositorContextData, mCommandBuffer);
+						sceneItem->onExecuteOnRendering(renderTarget, compositorContextData, commandBuffer);
 					}
 
 					// Fill the light buffer manager
-					materialBlueprintResourceManager.getLightBufferManager().fillBuffer(compositorContextData.getWorldSpaceCameraPosition(), cameraSceneItem->getSceneResource(), mCommandBuffer);
+					materialBlueprintResourceManager.getLightBufferManager().fillBuffer(compositorContextData.getWorldSpaceCameraPosition(), cameraSceneItem->getSceneResource(), commandBuffer);
 				}
 
 				{ // Scene rendering
 					// Combined scoped profiler CPU and GPU sample as well as RHI debug event command
-					RENDERER_SCOPED_PROFILER_EVENT(mRenderer.getContext(), mCommandBuffer, "Compositor workspace")
+					RENDERER_SCOPED_PROFILER_EVENT(mRenderer.getContext(), commandBuffer, "Compositor workspace")
 
 					// Fill command buffer
 					Rhi::IRenderTarget* currentRenderTarget = &renderTarget;
 					for (const CompositorNodeInstance* compositorNodeInstance : mSequentialCompositorNodeInstances)
 					{
-						currentRenderTarget = &compositorNodeInstance->fillCommandBuffer(*currentRenderTarget, compositorContextData, mCommandBuffer);
+						currentRenderTarget = &compositorNodeInstance->fillCommandBuffer(*currentRenderTarget, compositorContextData, commandBuffer);
 					}
 				}
 
@@ -267,10 +557,50 @@ namespace Renderer
 					#ifdef RHI_STATISTICS
 						if (nullptr != mPipelineStatisticsQueryPoolPtr)
 						{
-							Rhi::Command::EndQuery::create(mCommandBuffer, *mPipelineStatisticsQueryPoolPtr, mCurrentPipelineStatisticsQueryIndex);
+							Rhi::Command::EndQuery::create(commandBuffer, *mPipelineStatisticsQueryPoolPtr, mCurrentPipelineStatisticsQueryIndex);
+
+							// The next frame is using the other query, with pipelined rendering it's filled before the result of this frame has been read back
+							mCurrentPipelineStatisticsQueryIndex = (0 == mCurrentPipelineStatisticsQueryIndex) ? 1u : 0u;
 						}
 					#endif
-					mCommandBuffer.dispatchToRhi(rhi);
+					mCommandBufferIndex = commandBufferIndex;
+					if (pipelined)
+					{
+						// Only a single frame can be dispatched by the render thread at a time
+						waitForRenderThread();
+
+						// Let the render thread perform the staged uploads, dispatch the command buffer and present
+						// -> The render target reference added for the execution is handed over to the render thread, it's released after we waited for the render thread
+						mRenderThreadRenderTarget = &renderTarget;
+						mRenderThreadUploadFrameIndex = frameUploadManager.endDeferredUploads();
+
+						// Keep every RHI resource the command buffer points to alive until we waited for the render thread, e.g. a resource manager might release a vertex array or pipeline state object while the next frame is built
+						::detail::gatherCommandBufferResources(commandBuffer, mRenderThreadResources);
+						std::sort(mRenderThreadResources.begin(), mRenderThreadResources.end());
+						mRenderThreadResources.erase(std::unique(mRenderThreadResources.begin(), mRenderThreadResources.end()), mRenderThreadResources.end());
+						if (!mRenderThreadResources.empty() && nullptr == mRenderThreadResources.front())
+						{
+							// Draw commands without indirect buffer
+							mRenderThreadResources.erase(mRenderThreadResources.begin());
+						}
+						for (Rhi::IResource* resource : mRenderThreadResources)
+						{
+							resource->addReference();
+						}
+						mRenderThread->kick([](void* userData)
+							{
+								CompositorWorkspaceInstance* compositorWorkspaceInstance = static_cast<CompositorWorkspaceInstance*>(userData);
+								compositorWorkspaceInstance->mRenderer.getFrameUploadManager().performUploads(compositorWorkspaceInstance->mRenderThreadUploadFrameIndex);
+								compositorWorkspaceInstance->dispatchCommandBuffer(compositorWorkspaceInstance->getCommandBuffer(), *compositorWorkspaceInstance->mRenderThreadRenderTarget);
+							}, this);
+					}
+					else
+					{
+						dispatchCommandBuffer(commandBuffer, renderTarget);
+						#ifdef RHI_STATISTICS
+							readPipelineStatisticsQueryResult(renderTarget.getRhi());
+						#endif
+					}
 
 					// The command buffer has been dispatched, inform everyone who cares about this
 					for (const CompositorNodeInstance* compositorNodeInstance : mSequentialCompositorNodeInstances)
@@ -289,40 +619,14 @@ namespace Renderer
 						}
 					}
 				}
-
-				// End scene rendering
-				#ifdef RENDERER_GRAPHICS_DEBUGGER
-					if (graphicsDebugger.getCaptureNextFrame())
-					{
-						graphicsDebugger.endFrameCapture((renderTarget.getResourceType() == Rhi::ResourceType::SWAP_CHAIN) ? static_cast<Rhi::ISwapChain&>(renderTarget).getNativeWindowHandle() : NULL_HANDLE);
-					}
-				#endif
 			}
 
-			// In case the render target is a swap chain, present the content of the current back buffer
-			if (renderTarget.getResourceType() == Rhi::ResourceType::SWAP_CHAIN)
+			// Release reference from the render target, with pipelined rendering it has been handed over to the render thread
+			mExecutionRenderTarget = nullptr;
+			if (!pipelined)
 			{
-				static_cast<Rhi::ISwapChain&>(renderTarget).present();
+				renderTarget.releaseReference();
 			}
-
-			// Pipeline statistics query pool
-			#ifdef RHI_STATISTICS
-				if (nullptr != mPipelineStatisticsQueryPoolPtr)
-				{
-					// We explicitly wait if the previous result isn't available yet to avoid
-					// "D3D11 WARNING: ID3D10Query::Begin: Begin is being invoked on a Query, where the previous results have not been obtained with GetData. This is valid; but unusual. The previous results are being abandoned, and new Query results will be generated. [ EXECUTION WARNING #408: QUERY_BEGIN_ABANDONING_PREVIOUS_RESULTS]"
-					if (isValid(mPreviousCurrentPipelineStatisticsQueryIndex) && !rhi.getQueryPoolResults(*mPipelineStatisticsQueryPoolPtr, sizeof(Rhi::PipelineStatisticsQueryResult), reinterpret_cast<uint8_t*>(&mPipelineStatisticsQueryResult), mPreviousCurrentPipelineStatisticsQueryIndex, 1, 0, Rhi::QueryResultFlags::WAIT))
-					{
-						mPipelineStatisticsQueryResult = {};
-					}
-					mPreviousCurrentPipelineStatisticsQueryIndex = mCurrentPipelineStatisticsQueryIndex;
-					mCurrentPipelineStatisticsQueryIndex = (0 == mCurrentPipelineStatisticsQueryIndex) ? 1u : 0u;
-				}
-			#endif
-
-			// Release reference from the render target
-			mExecutionRenderTarget = nullptr;
-			renderTarget.releaseReference();
 		}
 	}
 
@@ -449,6 +753,9 @@ namespace Renderer
 				}
 			}
 
+			// Cull unused compositor passes and alias transient render target textures
+			compileFrameGraph();
+
 			// Tell all compositor node instances that the compositor workspace instance loading has been finished
 			for (const CompositorNodeInstance* compositorNodeInstance : mSequentialCompositorNodeInstances)
 			{
@@ -463,6 +770,9 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	void CompositorWorkspaceInstance::destroySequentialCompositorNodeInstances()
 	{
+		// The render thread might still use framebuffers and render target textures
+		waitForRenderThread();
+
 		for (CompositorNodeInstance* compositorNodeInstance : mSequentialCompositorNodeInstances)
 		{
 			delete compositorNodeInstance;
@@ -475,6 +785,174 @@ namespace Renderer
 		destroyFramebuffersAndRenderTargetTextures(true);
 	}
 
+	void CompositorWorkspaceInstance::compileFrameGraph()
+	{
+		const CompositorNodeResourceManager& compositorNodeResourceManager = mRenderer.getCompositorNodeResourceManager();
+
+		// Gather the transient render target textures as well as the framebuffer signatures
+		::detail::FrameGraphTransientTextures frameGraphTransientTextures;
+		::detail::FrameGraphFramebufferSignatures frameGraphFramebufferSignatures;
+		for (const CompositorNodeInstance* compositorNodeInstance : mSequentialCompositorNodeInstances)
+		{
+			const CompositorNodeResource& compositorNodeResource = compositorNodeResourceManager.getById(compositorNodeInstance->getCompositorNodeResourceId());
+			for (const CompositorRenderTargetTexture& compositorRenderTargetTexture : compositorNodeResource.getRenderTargetTextures())
+			{
+				const RenderTargetTextureSignature& renderTargetTextureSignature = compositorRenderTargetTexture.getRenderTargetTextureSignature();
+				if ((renderTargetTextureSignature.getFlags() & RenderTargetTextureSignature::Flag::TRANSIENT) != 0)
+				{
+					frameGraphTransientTextures.emplace(compositorRenderTargetTexture.getAssetId(), renderTargetTextureSignature.getRenderTargetTextureSignatureId());
+				}
+			}
+			for (const CompositorFramebuffer& compositorFramebuffer : compositorNodeResource.getFramebuffers())
+			{
+				frameGraphFramebufferSignatures.emplace(compositorFramebuffer.getCompositorFramebufferId(), &compositorFramebuffer.getFramebufferSignature());
+			}
+		}
+		if (frameGraphTransientTextures.empty())
+		{
+			// Without transient render target textures there's nothing to cull or to alias
+			return;
+		}
+
+		// Gather the textures referenced by the compositor passes in execution order
+		::detail::FrameGraphPasses frameGraphPasses;
+		::detail::FrameGraphTextureAssetIds channelTextureAssetIds;	// Textures of the render target the previous compositor node hands over, empty for the main render target
+		for (const CompositorNodeInstance* compositorNodeInstance : mSequentialCompositorNodeInstances)
+		{
+			const size_t numberOfCompositorInstancePasses = compositorNodeInstance->mCompositorInstancePasses.size();
+			for (size_t passIndex = 0; passIndex < numberOfCompositorInstancePasses; ++passIndex)
+			{
+				ICompositorInstancePass* compositorInstancePass = compositorNodeInstance->mCompositorInstancePasses[passIndex];
+				const ICompositorResourcePass& compositorResourcePass = compositorInstancePass->getCompositorResourcePass();
+				const CompositorTarget& compositorTarget = compositorResourcePass.getCompositorTarget();
+				const CompositorPassTypeId compositorPassTypeId = compositorResourcePass.getTypeId();
+				::detail::FrameGraphPass& frameGraphPass = frameGraphPasses.emplace_back();
+				frameGraphPass.compositorInstancePass = compositorInstancePass;
+				frameGraphPass.executedEachFrame = (isInvalid(compositorResourcePass.getNumberOfExecutions()) && !compositorResourcePass.getSkipFirstExecution());
+
+				// Framebuffer the compositor pass renders into
+				const bool channelRenderTarget = isValid(compositorTarget.getCompositorChannelId());
+				if (channelRenderTarget)
+				{
+					frameGraphPass.writtenTextureAssetIds = channelTextureAssetIds;
+				}
+				else
+				{
+					::detail::gatherFrameGraphFramebufferTextureAssetIds(frameGraphFramebufferSignatures, compositorTarget.getCompositorFramebufferId(), frameGraphPass.writtenTextureAssetIds);
+				}
+
+				// Further textures referenced by the compositor pass
+				if (CompositorResourcePassCopy::TYPE_ID == compositorPassTypeId)
+				{
+					const CompositorResourcePassCopy& compositorResourcePassCopy = static_cast<const CompositorResourcePassCopy&>(compositorResourcePass);
+					frameGraphPass.referencedTextureAssetIds.push_back(compositorResourcePassCopy.getSourceTextureAssetId());
+					frameGraphPass.referencedTextureAssetIds.push_back(compositorResourcePassCopy.getDestinationTextureAssetId());
+				}
+				else if (CompositorResourcePassGenerateMipmaps::TYPE_ID == compositorPassTypeId)
+				{
+					frameGraphPass.referencedTextureAssetIds.push_back(static_cast<const CompositorResourcePassGenerateMipmaps&>(compositorResourcePass).getTextureAssetId());
+				}
+				else if (CompositorResourcePassResolveMultisample::TYPE_ID == compositorPassTypeId)
+				{
+					::detail::gatherFrameGraphFramebufferTextureAssetIds(frameGraphFramebufferSignatures, static_cast<const CompositorResourcePassResolveMultisample&>(compositorResourcePass).getSourceMultisampleCompositorFramebufferId(), frameGraphPass.referencedTextureAssetIds);
+				}
+				else if (CompositorResourcePassCompute::TYPE_ID == compositorPassTypeId)
+				{
+					for (const MaterialProperty& materialProperty : static_cast<const CompositorResourcePassCompute&>(compositorResourcePass).getMaterialProperties().getSortedPropertyVector())
+					{
+						if (materialProperty.getValueType() == MaterialPropertyValue::ValueType::TEXTURE_ASSET_ID)
+						{
+							frameGraphPass.referencedTextureAssetIds.push_back(materialProperty.getTextureAssetIdValue());
+						}
+					}
+				}
+
+				// The last compositor pass of a compositor node provides the render target handed over to the next compositor node, so it's never culled
+				frameGraphPass.cullable = (!frameGraphPass.writtenTextureAssetIds.empty() && frameGraphPass.referencedTextureAssetIds.empty() && frameGraphPass.executedEachFrame && !channelRenderTarget &&
+										   CompositorResourcePassShadowMap::TYPE_ID != compositorPassTypeId && passIndex + 1 < numberOfCompositorInstancePasses);
+			}
+			if (!frameGraphPasses.empty())
+			{
+				channelTextureAssetIds = frameGraphPasses.back().writtenTextureAssetIds;
+			}
+		}
+
+		{ // Cull compositor passes which only render into transient textures no later compositor pass references
+			// -> Repeat until nothing changes since culling a compositor pass might make previous compositor passes obsolete as well
+			const size_t numberOfPasses = frameGraphPasses.size();
+			bool culledCompositorPass = true;
+			while (culledCompositorPass)
+			{
+				culledCompositorPass = false;
+				for (size_t passIndex = 0; passIndex < numberOfPasses; ++passIndex)
+				{
+					::detail::FrameGraphPass& frameGraphPass = frameGraphPasses[passIndex];
+					if (frameGraphPass.cullable && !frameGraphPass.compositorInstancePass->mCulled)
+					{
+						bool outputConsumed = false;
+						for (uint32_t textureAssetId : frameGraphPass.writtenTextureAssetIds)
+						{
+							if (frameGraphTransientTextures.find(textureAssetId) == frameGraphTransientTextures.cend() || ::detail::isFrameGraphTextureReferencedAfterPass(frameGraphPasses, passIndex, textureAssetId))
+							{
+								outputConsumed = true;
+								break;
+							}
+						}
+						if (!outputConsumed)
+						{
+							frameGraphPass.compositorInstancePass->mCulled = true;
+							culledCompositorPass = true;
+						}
+					}
+				}
+			}
+		}
+
+		// Derive the lifetimes of the transient render target textures from the remaining compositor passes
+		::detail::FrameGraphTextureLifetimes frameGraphTextureLifetimes;
+		{
+			const uint32_t numberOfPasses = static_cast<uint32_t>(frameGraphPasses.size());
+			for (uint32_t passIndex = 0; passIndex < numberOfPasses; ++passIndex)
+			{
+				const ::detail::FrameGraphPass& frameGraphPass = frameGraphPasses[passIndex];
+				if (!frameGraphPass.compositorInstancePass->mCulled)
+				{
+					for (uint32_t textureAssetId : frameGraphPass.writtenTextureAssetIds)
+					{
+						::detail::updateFrameGraphTextureLifetime(frameGraphTransientTextures, textureAssetId, passIndex, frameGraphPass.executedEachFrame, frameGraphTextureLifetimes);
+					}
+					for (uint32_t textureAssetId : frameGraphPass.referencedTextureAssetIds)
+					{
+						::detail::updateFrameGraphTextureLifetime(frameGraphTransientTextures, textureAssetId, passIndex, frameGraphPass.executedEachFrame, frameGraphTextureLifetimes);
+					}
+				}
+			}
+		}
+
+		{ // Let transient render target textures with the same signature and non-overlapping lifetimes share a RHI texture
+			// -> Lifetimes sorted by their start, greedily reusing the first RHI texture which is free again results in the minimal number of RHI textures
+			std::sort(frameGraphTextureLifetimes.begin(), frameGraphTextureLifetimes.end(), [](const ::detail::FrameGraphTextureLifetime& left, const ::detail::FrameGraphTextureLifetime& right) { return (left.firstPassIndex < right.firstPassIndex); });
+			::detail::FrameGraphTextureLifetimes sharedRhiTextures;	// Per shared RHI texture: The owning render target texture and the end of the latest lifetime
+			RenderTargetTextureManager& renderTargetTextureManager = mRenderer.getCompositorWorkspaceResourceManager().getRenderTargetTextureManager();
+			for (const ::detail::FrameGraphTextureLifetime& frameGraphTextureLifetime : frameGraphTextureLifetimes)
+			{
+				if (!frameGraphTextureLifetime.pinned)
+				{
+					::detail::FrameGraphTextureLifetimes::iterator iterator = std::find_if(sharedRhiTextures.begin(), sharedRhiTextures.end(), [&frameGraphTextureLifetime](const ::detail::FrameGraphTextureLifetime& sharedRhiTexture) { return (sharedRhiTexture.renderTargetTextureSignatureId == frameGraphTextureLifetime.renderTargetTextureSignatureId && sharedRhiTexture.lastPassIndex < frameGraphTextureLifetime.firstPassIndex); });
+					if (sharedRhiTextures.end() == iterator)
+					{
+						sharedRhiTextures.push_back(frameGraphTextureLifetime);
+					}
+					else
+					{
+						renderTargetTextureManager.setRenderTargetTextureAlias(AssetId(frameGraphTextureLifetime.assetId), AssetId(iterator->assetId));
+						iterator->lastPassIndex = frameGraphTextureLifetime.lastPassIndex;
+					}
+				}
+			}
+		}
+	}
+
 	void CompositorWorkspaceInstance::createFramebuffersAndRenderTargetTextures(const Rhi::IRenderTarget& mainRenderTarget)
 	{
 		RHI_ASSERT(mRenderer.getContext(), !mFramebufferManagerInitialized, "Framebuffer manager is already initialized")
@@ -487,7 +965,7 @@ namespace Renderer
 				for (ICompositorInstancePass* compositorInstancePass : compositorNodeInstance->mCompositorInstancePasses)
 				{
 					const CompositorFramebufferId compositorFramebufferId = compositorInstancePass->getCompositorResourcePass().getCompositorTarget().getCompositorFramebufferId();
-					if (isValid(compositorFramebufferId))
+					if (isValid(compositorFramebufferId) && !compositorInstancePass->mCulled)
 					{
 						compositorInstancePass->mRenderTarget = framebufferManager.getFramebufferByCompositorFramebufferId(compositorFramebufferId, mainRenderTarget, mCurrentlyUsedNumberOfMultisamples, mResolutionScale);
 					}
@@ -552,6 +1030,67 @@ namespace Renderer
 		}
 	}
 
+	void CompositorWorkspaceInstance::dispatchCommandBuffer(const Rhi::CommandBuffer& commandBuffer, Rhi::IRenderTarget& renderTarget)
+	{
+		// Dispatch command buffer to the RHI implementation
+		commandBuffer.dispatchToRhi(renderTarget.getRhi());
+
+		// End scene rendering
+		#ifdef RENDERER_GRAPHICS_DEBUGGER
+			IGraphicsDebugger& graphicsDebugger = mRenderer.getContext().getGraphicsDebugger();
+			if (graphicsDebugger.getCaptureNextFrame())
+			{
+				graphicsDebugger.endFrameCapture((renderTarget.getResourceType() == Rhi::ResourceType::SWAP_CHAIN) ? static_cast<Rhi::ISwapChain&>(renderTarget).getNativeWindowHandle() : NULL_HANDLE);
+			}
+		#endif
+
+		// In case the render target is a swap chain, present the content of the current back buffer
+		if (renderTarget.getResourceType() == Rhi::ResourceType::SWAP_CHAIN)
+		{
+			static_cast<Rhi::ISwapChain&>(renderTarget).present();
+		}
+	}
+
+	void CompositorWorkspaceInstance::waitForRenderThread()
+	{
+		if (nullptr != mRenderThreadRenderTarget)
+		{
+			// Wait until the render thread has dispatched the previous frame
+			mRenderThread->wait();
+
+			// Pipeline statistics query pool, read back inside the calling thread so "Renderer::CompositorWorkspaceInstance::getPipelineStatisticsQueryResult()" isn't written by the render thread
+			#ifdef RHI_STATISTICS
+				readPipelineStatisticsQueryResult(mRenderThreadRenderTarget->getRhi());
+			#endif
+
+			// Release references from the staged uploads and the resources used by the dispatched command buffer as well as from the render target
+			mRenderer.getFrameUploadManager().releaseUploads(mRenderThreadUploadFrameIndex);
+			for (Rhi::IResource* resource : mRenderThreadResources)
+			{
+				resource->releaseReference();
+			}
+			mRenderThreadResources.clear();
+			mRenderThreadRenderTarget->releaseReference();
+			mRenderThreadRenderTarget = nullptr;
+		}
+	}
+
+	#ifdef RHI_STATISTICS
+		void CompositorWorkspaceInstance::readPipelineStatisticsQueryResult(Rhi::IRhi& rhi)
+		{
+			if (nullptr != mPipelineStatisticsQueryPoolPtr)
+			{
+				// We explicitly wait if the previous result isn't available yet to avoid
+				// "D3D11 WARNING: ID3D10Query::Begin: Begin is being invoked on a Query, where the previous results have not been obtained with GetData. This is valid; but unusual. The previous results are being abandoned, and new Query results will be generated. [ EXECUTION WARNING #408: QUERY_BEGIN_ABANDONING_PREVIOUS_RESULTS]"
+				if (isValid(mPreviousCurrentPipelineStatisticsQueryIndex) && !rhi.getQueryPoolResults(*mPipelineStatisticsQueryPoolPtr, sizeof(Rhi::PipelineStatisticsQueryResult), reinterpret_cast<uint8_t*>(&mPipelineStatisticsQueryResult), mPreviousCurrentPipelineStatisticsQueryIndex, 1, 0, Rhi::QueryResultFlags::WAIT))
+				{
+					mPipelineStatisticsQueryResult = {};
+				}
+				mPreviousCurrentPipelineStatisticsQueryIndex = (0 == mCurrentPipelineStatisticsQueryIndex) ? 1u : 0u;
+			}
+		}
+	#endif
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
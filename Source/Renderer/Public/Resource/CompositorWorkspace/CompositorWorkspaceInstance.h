@@ -40,6 +40,7 @@ namespace Renderer
 	class CameraSceneItem;
 	class IRenderer;
 	class ISceneItem;
+	class RenderThread;
 	class RenderableManager;
 	class CompositorNodeInstance;
 	class ICompositorInstancePass;
@@ -132,6 +133,29 @@ namespace Renderer
 			mResolutionScale = resolutionScale;
 		}
 
+		[[nodiscard]] inline bool isPipelinedRendering() const
+		{
+			return (nullptr != mRenderThread);
+		}
+
+		/**
+		*  @brief
+		*    Set whether or not pipelined rendering is used
+		*
+		*  @param[in] pipelinedRendering
+		*    "true" to dispatch the command buffer of a frame on a dedicated render thread while the calling thread is already building the next frame, else "false"
+		*
+		*  @note
+		*    - Only has an effect if the RHI implementation supports native multithreading (see "Rhi::Capabilities::nativeMultithreading"), else the request is ignored
+		*    - Only swap chain render targets are dispatched by the render thread, other render targets like textures or virtual reality are still executed sequentially
+		*    - While pipelined rendering is used, the calling thread must not use the RHI context outside of "Renderer::CompositorWorkspaceInstance::execute()" until the compositor workspace instance is destroyed or pipelined rendering is disabled again, for example "Renderer::DebugDrawSceneItem::flush()" or swap chain changes are not allowed; creating RHI resources is fine
+		*    - Only a single compositor workspace instance at a time should use pipelined rendering, since there's only a single RHI context
+		*    - Culling and filling the command buffer of the next frame overlap with the render thread dispatching the previous frame: The buffer managers map through "Renderer::FrameUploadManager" which collects the data in frame-indexed staging memory, the render thread performs the uploads just before dispatching the command buffer
+		*    - RHI resources referenced by the dispatched command buffer are kept alive until the render thread has finished, so a resource released on the calling thread is destroyed one frame later
+		*    - GPU profiler samples are issued by the calling thread (see "Renderer::IProfiler::beginGpuSample()"), so Remotery Direct3D 11 GPU samples mustn't be used together with pipelined rendering
+		*/
+		RENDERER_API_EXPORT void setPipelinedRendering(bool pipelinedRendering);
+
 		[[nodiscard]] inline const RenderQueueIndexRanges& getRenderQueueIndexRanges() const	// Renderable manager pointers are only considered to be safe directly after the "Renderer::CompositorWorkspaceInstance::execute()" call
 		{
 			return mRenderQueueIndexRanges;
@@ -152,9 +176,9 @@ namespace Renderer
 			return mExecutionRenderTarget;
 		}
 
-		[[nodiscard]] inline const Rhi::CommandBuffer& getCommandBuffer() const
+		[[nodiscard]] inline const Rhi::CommandBuffer& getCommandBuffer() const	// The most recently filled command buffer, with pipelined rendering it might still be dispatched by the render thread
 		{
-			return mCommandBuffer;
+			return mCommandBuffers[mCommandBufferIndex];
 		}
 
 		#ifdef RHI_STATISTICS
@@ -180,10 +204,51 @@ namespace Renderer
 		explicit CompositorWorkspaceInstance(const CompositorWorkspaceInstance&) = delete;
 		CompositorWorkspaceInstance& operator=(const CompositorWorkspaceInstance&) = delete;
 		void destroySequentialCompositorNodeInstances();
+
+		/**
+		*  @brief
+		*    Compile the sequential compositor node instances into a frame graph
+		*
+		*  @note
+		*    - Derives the lifetime of each transient render target texture (see "Renderer::RenderTargetTextureSignature::Flag::TRANSIENT") from the compositor passes referencing it
+		*    - Culls compositor instance passes which only render into transient render target textures no later compositor pass references
+		*    - Transient render target textures with the same signature and non-overlapping lifetimes share a single RHI texture object, there's no placement into shared memory
+		*    - Only render target textures flagged as transient take part, all other textures keep their own RHI texture and are never culled away
+		*    - No resource barriers are derived: The frame graph only knows which textures a compositor pass references, not whether it reads or writes them, and
+		*      the RHI has no barrier commands. Synchronization between compositor passes is left to the RHI implementations. The Vulkan RHI only covers
+		*      framebuffer attachments through the layouts and external subpass dependencies of its render passes, a compute pass writing a texture read by a
+		*      later compositor pass isn't synchronized.
+		*/
+		void compileFrameGraph();
+
 		void createFramebuffersAndRenderTargetTextures(const Rhi::IRenderTarget& mainRenderTarget);
 		void destroyFramebuffersAndRenderTargetTextures(bool clearManagers = false);
 		void clearRenderQueueIndexRangesRenderableManagers();
 
+		/**
+		*  @brief
+		*    Dispatch the given filled command buffer to the RHI implementation and present the render target if it's a swap chain
+		*
+		*  @param[in] commandBuffer
+		*    Filled command buffer to dispatch
+		*  @param[in] renderTarget
+		*    Render target the command buffer was filled for
+		*
+		*  @note
+		*    - Executed by the render thread when pipelined rendering is used, so only the RHI must be touched
+		*/
+		void dispatchCommandBuffer(const Rhi::CommandBuffer& commandBuffer, Rhi::IRenderTarget& renderTarget);
+
+		/**
+		*  @brief
+		*    Wait until the render thread has dispatched the previous frame, must be called before the RHI context is used by the calling thread
+		*/
+		void waitForRenderThread();
+
+		#ifdef RHI_STATISTICS
+			void readPipelineStatisticsQueryResult(Rhi::IRhi& rhi);
+		#endif
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -203,7 +268,12 @@ namespace Renderer
 		// The rest is temporary "CompositorWorkspaceInstance::execute()" data to e.g. avoid reallocations
 		Rhi::IRenderTarget*				 mExecutionRenderTarget;				///< Only valid during compositor workspace instance execution
 		std::vector<ISceneItem*>		 mExecuteOnRenderingSceneItems;			///< Scene items which requested an execute call on rendering, no duplicates allowed
-		Rhi::CommandBuffer				 mCommandBuffer;						///< RHI command buffer
+		Rhi::CommandBuffer				 mCommandBuffers[2];					///< Double buffered RHI command buffers, with pipelined rendering one can be filled while the other one is dispatched by the render thread
+		uint32_t						 mCommandBufferIndex;					///< Index of the most recently filled command buffer, toggles between 0 or 1
+		RenderThread*					 mRenderThread;							///< Render thread used for pipelined rendering, can be a null pointer, we're responsible for destroying the instance in case we no longer need it
+		Rhi::IRenderTarget*				 mRenderThreadRenderTarget;				///< Render target of the frame which is dispatched by the render thread, can be a null pointer, we keep the reference added during the execution
+		uint32_t						 mRenderThreadUploadFrameIndex;			///< Frame upload manager frame index of the frame which is dispatched by the render thread, only valid if "mRenderThreadRenderTarget" isn't a null pointer
+		std::vector<Rhi::IResource*>	 mRenderThreadResources;				///< RHI resources referenced by the command buffer which is dispatched by the render thread, no duplicates, we keep a reference to them
 		CompositorInstancePassShadowMap* mCompositorInstancePassShadowMap;		///< Can be a null pointer, don't destroy the instance
 		#ifdef RHI_STATISTICS
 			Rhi::IQueryPoolPtr				   mPipelineStatisticsQueryPoolPtr;					///< Double buffered asynchronous pipeline statistics query pool, can be a null pointer
@@ -43,8 +43,8 @@ PRAGMA_WARNING_POP
 //[-------------------------------------------------------]
 namespace Renderer
 {
-	template <class ELEMENT_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class PackedElementManager;
-	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class ResourceManagerTemplate;
+	template <class ELEMENT_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_PAGE> class PackedElementManager;
+	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_PAGE> class ResourceManagerTemplate;
 	class CompositorWorkspaceResourceLoader;
 }
 
@@ -41,7 +41,7 @@ namespace Renderer
 	class RenderTargetTextureManager;
 	class CompositorWorkspaceResource;
 	class CompositorWorkspaceResourceLoader;
-	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class ResourceManagerTemplate;
+	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_PAGE> class ResourceManagerTemplate;
 }
 
 
@@ -112,6 +112,18 @@ namespace Renderer
 	private:
 		[[nodiscard]] virtual IResourceLoader* createResourceLoaderInstance(ResourceLoaderTypeId resourceLoaderTypeId) = 0;
 
+		/**
+		*  @brief
+		*    Destroy a resource whose destruction has been deferred by "Renderer::ResourceStreamer::cancelLoadRequest()"
+		*
+		*  @param[in] resourceId
+		*    ID of the resource to destroy, no resource loader is working on it anymore
+		*/
+		inline virtual void destroyResourceByResourceId([[maybe_unused]] ResourceId resourceId)
+		{
+			// Nothing here, only resource managers destroying resources which might still be in-flight have to implement this
+		}
+
 
 	};
 
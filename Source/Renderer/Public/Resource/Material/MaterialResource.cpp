@@ -24,6 +24,7 @@
 #include "Renderer/Public/Resource/Material/MaterialResource.h"
 #include "Renderer/Public/Resource/Material/MaterialTechnique.h"
 #include "Renderer/Public/Resource/Material/MaterialResourceManager.h"
+#include "Renderer/Public/Resource/ResourceManagerTemplate.h"
 #include "Renderer/Public/RenderQueue/RenderableManager.h"
 
 #include <algorithm>
@@ -116,7 +117,7 @@ namespace Renderer
 				parentMaterialResource.mSortedChildMaterialResourceIds.insert(iterator, materialResourceId);
 
 				// Setup material resource
-				setAssetId(parentMaterialResource.getAssetId());
+				materialResourceManager.mInternalResourceManager->setResourceAssetId(*this, parentMaterialResource.getAssetId());
 				mMaterialProperties = parentMaterialResource.mMaterialProperties;
 				for (MaterialTechnique* materialTechnique : parentMaterialResource.mSortedMaterialTechniqueVector)
 				{
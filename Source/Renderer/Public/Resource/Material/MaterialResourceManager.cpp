@@ -62,9 +62,7 @@ namespace Renderer
 		RHI_ASSERT(mRenderer.getContext(), nullptr == getMaterialResourceByAssetId(assetId), "Material resource is not allowed to exist, yet")
 
 		// Create the material resource instance
-		MaterialResource& materialResource = mInternalResourceManager->getResources().addElement();
-		materialResource.setResourceManager(this);
-		materialResource.setAssetId(assetId);
+		MaterialResource& materialResource = mInternalResourceManager->addResource(assetId);
 		#ifdef RHI_DEBUG
 		{
 			const AssetManager& assetManager = mRenderer.getAssetManager();
@@ -120,9 +118,7 @@ namespace Renderer
 		RHI_ASSERT(mRenderer.getContext(), mInternalResourceManager->getResources().getElementById(parentMaterialResourceId).getLoadingState() == IResource::LoadingState::LOADED, "Invalid parent material resource ID")
 
 		// Create the material resource instance
-		MaterialResource& materialResource = mInternalResourceManager->getResources().addElement();
-		materialResource.setResourceManager(this);
-		materialResource.setAssetId(assetId);
+		MaterialResource& materialResource = mInternalResourceManager->addResource(assetId);
 		materialResource.setParentMaterialResourceId(parentMaterialResourceId);
 		#ifdef RHI_DEBUG
 			materialResource.setDebugName((std::string(mInternalResourceManager->getResources().getElementById(parentMaterialResourceId).getDebugName()) + "[Clone]").c_str());
@@ -135,7 +131,16 @@ namespace Renderer
 
 	void MaterialResourceManager::destroyMaterialResource(MaterialResourceId materialResourceId)
 	{
-		mInternalResourceManager->getResources().removeElement(materialResourceId);
+		// The resource might still be in-flight inside the resource streamer, in this case it's destroyed as soon as the cancelled load request has been finalized
+		// -> Until then, asset lookups must create a new resource instead of reusing the one which is about to be destroyed
+		if (mInternalResourceManager->getRenderer().getResourceStreamer().cancelLoadRequest(*this, materialResourceId, true))
+		{
+			mInternalResourceManager->setResourceAssetId(mInternalResourceManager->getResources().getElementById(materialResourceId), getInvalid<AssetId>());
+		}
+		else
+		{
+			mInternalResourceManager->removeResource(materialResourceId);
+		}
 	}
 
 	void MaterialResourceManager::setInvalidResourceId(MaterialResourceId& materialResourceId, IResourceListener& resourceListener) const
@@ -186,6 +191,11 @@ namespace Renderer
 		return mInternalResourceManager->createResourceLoaderInstance(resourceLoaderTypeId);
 	}
 
+	void MaterialResourceManager::destroyResourceByResourceId(ResourceId resourceId)
+	{
+		mInternalResourceManager->removeResource(resourceId);
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -38,7 +38,7 @@ namespace Renderer
 	class IRenderer;
 	class MaterialResource;
 	class MaterialResourceLoader;
-	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class ResourceManagerTemplate;
+	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_PAGE> class ResourceManagerTemplate;
 }
 
 
@@ -67,6 +67,7 @@ namespace Renderer
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
 		friend class RendererImpl;
+		friend class MaterialResource;	// Changes the asset ID when the parent material resource changes
 
 
 	//[-------------------------------------------------------]
@@ -115,6 +116,7 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	private:
 		[[nodiscard]] virtual IResourceLoader* createResourceLoaderInstance(ResourceLoaderTypeId resourceLoaderTypeId) override;
+		virtual void destroyResourceByResourceId(ResourceId resourceId) override;
 
 
 	//[-------------------------------------------------------]
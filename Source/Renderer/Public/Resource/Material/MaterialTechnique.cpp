@@ -102,6 +102,21 @@ namespace Renderer
 		}
 	}
 
+	uint16_t MaterialTechnique::getResourceGroupSortingId() const
+	{
+		// Material techniques without textures and structured buffer don't bind an own resource group, material techniques with a not yet created resource group are kept apart
+		const void* resourceGroupIdentity = mResourceGroup.getPointer();
+		if (nullptr == resourceGroupIdentity && (!mTextures.empty() || nullptr != mStructuredBufferPtr))
+		{
+			resourceGroupIdentity = this;
+		}
+
+		// Hash the identities of the bound resource groups and fold the hash into a compact ID, collisions only reduce the sorting quality
+		const void* identities[2] = { resourceGroupIdentity, getAssignedMaterialPool() };
+		const uint32_t hash = Math::calculateFNV1a32(reinterpret_cast<const uint8_t*>(identities), sizeof(identities));
+		return static_cast<uint16_t>((hash >> 16) ^ (hash & 0xffff));
+	}
+
 	void MaterialTechnique::fillGraphicsCommandBuffer(const IRenderer& renderer, Rhi::CommandBuffer& commandBuffer, uint32_t& resourceGroupRootParameterIndex, Rhi::IResourceGroup** resourceGroup)
 	{
 		// Sanity check
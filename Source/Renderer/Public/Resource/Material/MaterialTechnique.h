@@ -157,6 +157,20 @@ namespace Renderer
 			return mSerializedGraphicsPipelineStateHash;
 		}
 
+		/**
+		*  @brief
+		*    Return the resource group sorting ID
+		*
+		*  @return
+		*    Compact ID which is identical for material techniques binding the same RHI resource groups, used by render queues to sort such material techniques next to each other
+		*
+		*  @note
+		*    - Material uniform data is addressed per instance using the assigned material slot, so draws of material techniques sharing the texture resource group and the material pool can be merged into a single multi-draw-indirect call
+		*    - Material techniques using different textures or material pools always break the multi-draw-indirect call, the material slot only addresses the material uniform data
+		*    - As long as the texture resource group hasn't been created, yet, the material technique itself is used as identity so no merging takes place
+		*/
+		[[nodiscard]] uint16_t getResourceGroupSortingId() const;
+
 		/**
 		*  @brief
 		*    Bind the graphics material technique into the given command buffer
@@ -187,6 +201,25 @@ namespace Renderer
 		*/
 		void fillComputeCommandBuffer(const IRenderer& renderer, Rhi::CommandBuffer& commandBuffer, uint32_t& resourceGroupRootParameterIndex, Rhi::IResourceGroup** resourceGroup);
 
+		/**
+		*  @brief
+		*    Return the resource group of the material technique, create it if needed
+		*
+		*  @param[in] renderer
+		*    Renderer to use
+		*  @param[out] resourceGroupRootParameterIndex
+		*    Root parameter index to bind the resource group to, can be "Renderer::getInvalid<uint32_t>()"
+		*  @param[out] resourceGroup
+		*    RHI resource group to set, must be valid
+		*
+		*  @note
+		*    - Unlike "Renderer::MaterialTechnique::fillGraphicsCommandBuffer()" the material buffer manager isn't bound, the render queue gathers the resource groups before recording commands in parallel
+		*/
+		inline void getResourceGroup(const IRenderer& renderer, uint32_t& resourceGroupRootParameterIndex, Rhi::IResourceGroup** resourceGroup)
+		{
+			fillCommandBuffer(renderer, resourceGroupRootParameterIndex, resourceGroup);
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual Renderer::IResourceListener methods ]
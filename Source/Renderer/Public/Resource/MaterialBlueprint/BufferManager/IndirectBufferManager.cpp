@@ -22,6 +22,8 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/MaterialBlueprint/BufferManager/IndirectBufferManager.h"
+#include "Renderer/Public/Core/Time/TimeManager.h"
+#include "Renderer/Public/Core/Renderer/FrameUploadManager.h"
 #include "Renderer/Public/IRenderer.h"
 
 #include <algorithm>
@@ -105,16 +107,30 @@ namespace Renderer
 		// Create new indirect buffer, if required
 		if (nullptr == mCurrentIndirectBuffer)
 		{
-			if (mFreeIndirectBuffers.empty())
+			// Find a free indirect buffer instance
+			// -> With persistent mapping there's no discard, so skip indirect buffers which might still be used by frames in flight
+			const Rhi::Capabilities& capabilities = mRenderer.getRhi().getCapabilities();
+			IndirectBuffers::iterator iterator = mFreeIndirectBuffers.end();
+			if (capabilities.persistentMapping)
 			{
-				// Create new indirect buffer instance
-				mUsedIndirectBuffers.emplace_back(mRenderer.getBufferManager().createIndirectBuffer(mMaximumIndirectBufferSize, nullptr, Rhi::IndirectBufferFlag::DRAW_INDEXED_ARGUMENTS, Rhi::BufferUsage::DYNAMIC_DRAW RHI_RESOURCE_DEBUG_NAME("Indirect buffer manager")));
+				const uint64_t numberOfRenderedFrames = mRenderer.getTimeManager().getNumberOfRenderedFrames();
+				iterator = std::find_if(mFreeIndirectBuffers.begin(), mFreeIndirectBuffers.end(), [numberOfRenderedFrames, &capabilities](const IndirectBuffer& indirectBuffer) { return (numberOfRenderedFrames - indirectBuffer.usedFrameNumber > capabilities.maximumNumberOfFramesInFlight); });
+			}
+			else if (!mFreeIndirectBuffers.empty())
+			{
+				iterator = mFreeIndirectBuffers.end() - 1;
+			}
+			if (mFreeIndirectBuffers.end() == iterator)
+			{
+				// Create new indirect buffer instance, streamed buffers are persistently mapped if possible
+				const Rhi::BufferUsage bufferUsage = capabilities.persistentMapping ? Rhi::BufferUsage::STREAM_DRAW : Rhi::BufferUsage::DYNAMIC_DRAW;
+				mUsedIndirectBuffers.emplace_back(mRenderer.getBufferManager().createIndirectBuffer(mMaximumIndirectBufferSize, nullptr, Rhi::IndirectBufferFlag::DRAW_INDEXED_ARGUMENTS, bufferUsage RHI_RESOURCE_DEBUG_NAME("Indirect buffer manager")));
 			}
 			else
 			{
 				// Use existing free indirect buffer instance
-				mUsedIndirectBuffers.push_back(mFreeIndirectBuffers.back());
-				mFreeIndirectBuffers.pop_back();
+				mUsedIndirectBuffers.push_back(*iterator);
+				mFreeIndirectBuffers.erase(iterator);
 			}
 			mCurrentIndirectBuffer = &mUsedIndirectBuffers.back();
 
@@ -125,8 +141,10 @@ namespace Renderer
 				RHI_ASSERT(mRenderer.getContext(), nullptr == mCurrentIndirectBuffer->mappedData, "Invalid current indirect buffer")
 
 				// Map
+				// -> With persistent mapping this doesn't involve the driver and there's no discard
+				// -> With pipelined rendering the frame upload manager hands out staging memory of the current frame and the render thread uploads it
 				Rhi::MappedSubresource mappedSubresource;
-				if (mRenderer.getRhi().map(*mCurrentIndirectBuffer->indirectBuffer, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+				if (mRenderer.getFrameUploadManager().map(*mCurrentIndirectBuffer->indirectBuffer, mMaximumIndirectBufferSize, capabilities.persistentMapping ? Rhi::MapType::WRITE_NO_OVERWRITE : Rhi::MapType::WRITE_DISCARD, mappedSubresource))
 				{
 					mCurrentIndirectBuffer->mappedData = static_cast<uint8_t*>(mappedSubresource.data);
 				}
@@ -146,7 +164,12 @@ namespace Renderer
 			unmapCurrentIndirectBuffer();
 		}
 
-		// Free all used indirect buffers
+		// Free all used indirect buffers, remember the frame they were used in for persistent mapping
+		const uint64_t numberOfRenderedFrames = mRenderer.getTimeManager().getNumberOfRenderedFrames();
+		for (IndirectBuffer& indirectBuffer : mUsedIndirectBuffers)
+		{
+			indirectBuffer.usedFrameNumber = numberOfRenderedFrames;
+		}
 		mFreeIndirectBuffers.insert(mFreeIndirectBuffers.end(), mUsedIndirectBuffers.begin(), mUsedIndirectBuffers.end());
 		mUsedIndirectBuffers.clear();
 	}
@@ -162,7 +185,7 @@ namespace Renderer
 		RHI_ASSERT(mRenderer.getContext(), nullptr != mCurrentIndirectBuffer->mappedData, "Invalid current indirect buffer")
 
 		// Unmap
-		mRenderer.getRhi().unmap(*mCurrentIndirectBuffer->indirectBuffer, 0);
+		mRenderer.getFrameUploadManager().unmap(*mCurrentIndirectBuffer->indirectBuffer, mCurrentIndirectBuffer->indirectBufferOffset);
 		mCurrentIndirectBuffer->indirectBufferOffset = 0;
 		mCurrentIndirectBuffer->mappedData = nullptr;
 		mCurrentIndirectBuffer = nullptr;
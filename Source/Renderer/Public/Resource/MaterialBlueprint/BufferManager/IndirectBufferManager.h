@@ -78,10 +78,12 @@ namespace Renderer
 			Rhi::IIndirectBuffer* indirectBuffer;		///< RHI indirect buffer instance, always valid
 			uint32_t			  indirectBufferOffset;	///< Current indirect buffer offset
 			uint8_t*			  mappedData;			///< Currently mapped data, don't destroy the data
+			uint64_t			  usedFrameNumber;		///< Number of the rendered frame which used the indirect buffer the last time, only relevant for persistent mapping
 			explicit IndirectBuffer(Rhi::IIndirectBuffer* _indirectBuffer) :
 				indirectBuffer(_indirectBuffer),
 				indirectBufferOffset(0),
-				mappedData(nullptr)
+				mappedData(nullptr),
+				usedFrameNumber(0)
 			{}
 		};
 
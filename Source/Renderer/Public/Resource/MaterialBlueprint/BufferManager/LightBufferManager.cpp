@@ -29,6 +29,8 @@
 #include "Renderer/Public/Resource/Scene/SceneResource.h"
 #include "Renderer/Public/Resource/Scene/Item/Light/LightSceneItem.h"
 #include "Renderer/Public/Core/Math/Math.h"
+#include "Renderer/Public/Core/Time/TimeManager.h"
+#include "Renderer/Public/Core/Renderer/FrameUploadManager.h"
 #include "Renderer/Public/IRenderer.h"
 
 #include <algorithm>
@@ -46,7 +48,6 @@ namespace
 		//[-------------------------------------------------------]
 		//[ Global definitions                                    ]
 		//[-------------------------------------------------------]
-		// TODO(co) Add support for persistent mapped buffers. For now, the big picture has to be OK so first focus on that.
 		static constexpr uint32_t LIGHT_DEFAULT_TEXTURE_BUFFER_NUMBER_OF_BYTES = 64 * 1024;	// 64 KiB
 		// static constexpr uint32_t LIGHT_DEFAULT_TEXTURE_BUFFER_NUMBER_OF_BYTES = 512 * 1024;	// 512 KiB
 
@@ -91,16 +92,14 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	LightBufferManager::LightBufferManager(IRenderer& renderer) :
 		mRenderer(renderer),
-		mTextureBuffer(nullptr),
+		mCurrentTextureBufferIndex(0),
 		mClusters3DTextureResourceId(getInvalid<TextureResourceId>()),
 		mLightClustersAabbMinimum(-50.0f, -1.0f, -50.0f),	// TODO(co) Just for the clusters shading kickoff
-		mLightClustersAabbMaximum( 50.0f, 40.0f,  50.0f),	// TODO(co) Just for the clusters shading kickoff
-		mResourceGroup(nullptr)
+		mLightClustersAabbMaximum( 50.0f, 40.0f,  50.0f)	// TODO(co) Just for the clusters shading kickoff
 	{
 		// Create texture buffer instance
 		mTextureScratchBuffer.resize(std::min(mRenderer.getRhi().getCapabilities().maximumTextureBufferSize, ::detail::LIGHT_DEFAULT_TEXTURE_BUFFER_NUMBER_OF_BYTES));
-		mTextureBuffer = mRenderer.getBufferManager().createTextureBuffer(static_cast<uint32_t>(mTextureScratchBuffer.size()), nullptr, Rhi::BufferFlag::SHADER_RESOURCE, Rhi::BufferUsage::DYNAMIC_DRAW, Rhi::TextureFormat::R32G32B32A32F RHI_RESOURCE_DEBUG_NAME("Light buffer manager"));
-		mTextureBuffer->addReference();
+		createTextureBuffer();
 
 		// Create the clusters 3D texture resource
 		mClusters3DTextureResourceId = mRenderer.getTextureResourceManager().createTextureResourceByAssetId(
@@ -110,11 +109,14 @@ namespace Renderer
 
 	LightBufferManager::~LightBufferManager()
 	{
-		if (nullptr != mResourceGroup)
+		for (TextureBuffer& textureBuffer : mTextureBuffers)
 		{
-			mResourceGroup->releaseReference();
+			if (nullptr != textureBuffer.resourceGroup)
+			{
+				textureBuffer.resourceGroup->releaseReference();
+			}
+			textureBuffer.textureBuffer->releaseReference();
 		}
-		mTextureBuffer->releaseReference();
 		mRenderer.getTextureResourceManager().destroyTextureResource(mClusters3DTextureResourceId);
 	}
 
@@ -135,17 +137,18 @@ namespace Renderer
 		{
 			// TODO(co) We probably need to move the light buffer manager into the material blueprint resource
 			// Create resource group instance, if needed
-			if (nullptr == mResourceGroup)
+			TextureBuffer& textureBuffer = mTextureBuffers[mCurrentTextureBufferIndex];
+			if (nullptr == textureBuffer.resourceGroup)
 			{
 				// TODO(co) We probably should put the clusters 3D texture resource into the light buffer manager resource group as well
-				// Rhi::IResource* resources[2] = { mTextureBuffer, mRenderer.getTextureResourceManager().getById(mClusters3DTextureResourceId).getTexturePtr() };
-				Rhi::IResource* resources[1] = { mTextureBuffer };
-				mResourceGroup = materialBlueprintResource.getRootSignaturePtr()->createResourceGroup(lightTextureBuffer->rootParameterIndex, static_cast<uint32_t>(GLM_COUNTOF(resources)), resources, nullptr RHI_RESOURCE_DEBUG_NAME("Light buffer manager"));
-				mResourceGroup->addReference();
+				// Rhi::IResource* resources[2] = { textureBuffer.textureBuffer, mRenderer.getTextureResourceManager().getById(mClusters3DTextureResourceId).getTexturePtr() };
+				Rhi::IResource* resources[1] = { textureBuffer.textureBuffer };
+				textureBuffer.resourceGroup = materialBlueprintResource.getRootSignaturePtr()->createResourceGroup(lightTextureBuffer->rootParameterIndex, static_cast<uint32_t>(GLM_COUNTOF(resources)), resources, nullptr RHI_RESOURCE_DEBUG_NAME("Light buffer manager"));
+				textureBuffer.resourceGroup->addReference();
 			}
 
 			// Set graphics resource group
-			Rhi::Command::SetGraphicsResourceGroup::create(commandBuffer, lightTextureBuffer->rootParameterIndex, mResourceGroup);
+			Rhi::Command::SetGraphicsResourceGroup::create(commandBuffer, lightTextureBuffer->rootParameterIndex, textureBuffer.resourceGroup);
 		}
 	}
 
@@ -160,17 +163,18 @@ namespace Renderer
 		{
 			// TODO(co) We probably need to move the light buffer manager into the material blueprint resource
 			// Create resource group instance, if needed
-			if (nullptr == mResourceGroup)
+			TextureBuffer& textureBuffer = mTextureBuffers[mCurrentTextureBufferIndex];
+			if (nullptr == textureBuffer.resourceGroup)
 			{
 				// TODO(co) We probably should put the clusters 3D texture resource into the light buffer manager resource group as well
-				// Rhi::IResource* resources[2] = { mTextureBuffer, mRenderer.getTextureResourceManager().getById(mClusters3DTextureResourceId).getTexturePtr() };
-				Rhi::IResource* resources[1] = { mTextureBuffer };
-				mResourceGroup = materialBlueprintResource.getRootSignaturePtr()->createResourceGroup(lightTextureBuffer->rootParameterIndex, static_cast<uint32_t>(GLM_COUNTOF(resources)), resources, nullptr RHI_RESOURCE_DEBUG_NAME("Light buffer manager"));
-				mResourceGroup->addReference();
+				// Rhi::IResource* resources[2] = { textureBuffer.textureBuffer, mRenderer.getTextureResourceManager().getById(mClusters3DTextureResourceId).getTexturePtr() };
+				Rhi::IResource* resources[1] = { textureBuffer.textureBuffer };
+				textureBuffer.resourceGroup = materialBlueprintResource.getRootSignaturePtr()->createResourceGroup(lightTextureBuffer->rootParameterIndex, static_cast<uint32_t>(GLM_COUNTOF(resources)), resources, nullptr RHI_RESOURCE_DEBUG_NAME("Light buffer manager"));
+				textureBuffer.resourceGroup->addReference();
 			}
 
 			// Set compute resource group
-			Rhi::Command::SetComputeResourceGroup::create(commandBuffer, lightTextureBuffer->rootParameterIndex, mResourceGroup);
+			Rhi::Command::SetComputeResourceGroup::create(commandBuffer, lightTextureBuffer->rootParameterIndex, textureBuffer.resourceGroup);
 		}
 	}
 
@@ -188,6 +192,15 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
+	void LightBufferManager::createTextureBuffer()
+	{
+		// Streamed buffers are persistently mapped if possible
+		const Rhi::BufferUsage bufferUsage = mRenderer.getRhi().getCapabilities().persistentMapping ? Rhi::BufferUsage::STREAM_DRAW : Rhi::BufferUsage::DYNAMIC_DRAW;
+		Rhi::ITextureBuffer* textureBuffer = mRenderer.getBufferManager().createTextureBuffer(static_cast<uint32_t>(mTextureScratchBuffer.size()), nullptr, Rhi::BufferFlag::SHADER_RESOURCE, bufferUsage, Rhi::TextureFormat::R32G32B32A32F RHI_RESOURCE_DEBUG_NAME("Light buffer manager"));
+		textureBuffer->addReference();
+		mTextureBuffers.emplace_back(*textureBuffer);
+	}
+
 	void LightBufferManager::fillTextureBuffer(const glm::dvec3& worldSpaceCameraPosition, SceneResource& sceneResource)
 	{
 		// TODO(co) This is just a placeholder implementation until "Renderer::LightBufferManager" is ready (containing e.g. reasonable optimizations)
@@ -222,12 +235,32 @@ namespace Renderer
 		const uint32_t numberOfBytes = static_cast<uint32_t>(scratchBufferPointer - mTextureScratchBuffer.data());
 		if (0 != numberOfBytes)
 		{
+			const Rhi::Capabilities& capabilities = mRenderer.getRhi().getCapabilities();
+			if (capabilities.persistentMapping)
+			{
+				// There's no discard, so switch to a texture buffer which isn't used by frames in flight anymore
+				const uint64_t numberOfRenderedFrames = mRenderer.getTimeManager().getNumberOfRenderedFrames();
+				const TextureBuffers::const_iterator iterator = std::find_if(mTextureBuffers.cbegin(), mTextureBuffers.cend(), [numberOfRenderedFrames, &capabilities](const TextureBuffer& textureBuffer) { return (numberOfRenderedFrames - textureBuffer.usedFrameNumber > capabilities.maximumNumberOfFramesInFlight); });
+				if (mTextureBuffers.cend() == iterator)
+				{
+					mCurrentTextureBufferIndex = mTextureBuffers.size();
+					createTextureBuffer();
+				}
+				else
+				{
+					mCurrentTextureBufferIndex = static_cast<size_t>(iterator - mTextureBuffers.cbegin());
+				}
+				mTextureBuffers[mCurrentTextureBufferIndex].usedFrameNumber = numberOfRenderedFrames;
+			}
+
+			// Map, with persistent mapping this doesn't involve the driver, with pipelined rendering the render thread uploads the staged data
+			Rhi::ITextureBuffer& textureBuffer = *mTextureBuffers[mCurrentTextureBufferIndex].textureBuffer;
 			Rhi::MappedSubresource mappedSubresource;
-			Rhi::IRhi& rhi = mRenderer.getRhi();
-			if (rhi.map(*mTextureBuffer, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+			FrameUploadManager& frameUploadManager = mRenderer.getFrameUploadManager();
+			if (frameUploadManager.map(textureBuffer, numberOfBytes, capabilities.persistentMapping ? Rhi::MapType::WRITE_NO_OVERWRITE : Rhi::MapType::WRITE_DISCARD, mappedSubresource))
 			{
 				memcpy(mappedSubresource.data, mTextureScratchBuffer.data(), numberOfBytes);
-				rhi.unmap(*mTextureBuffer, 0);
+				frameUploadManager.unmap(textureBuffer);
 			}
 		}
 	}
@@ -325,11 +358,11 @@ namespace Renderer
 		RHI_ASSERT(mRenderer.getContext(), Rhi::ResourceType::TEXTURE_3D == texturePtr.getPointer()->getResourceType(), "Invalid texture resource type")
 		Rhi::ITexture3D* texture3D = static_cast<Rhi::ITexture3D*>(texturePtr.getPointer());
 		Rhi::MappedSubresource mappedSubresource;
-		Rhi::IRhi& rhi = mRenderer.getRhi();
-		if (rhi.map(*texture3D, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+		FrameUploadManager& frameUploadManager = mRenderer.getFrameUploadManager();
+		if (frameUploadManager.map(*texture3D, sizeof(lights), Rhi::MapType::WRITE_DISCARD, mappedSubresource))
 		{
-			memcpy(mappedSubresource.data, lights, ::detail::CLUSTER_X * ::detail::CLUSTER_Y * ::detail::CLUSTER_Z * sizeof(uint32_t));
-			rhi.unmap(*texture3D, 0);
+			memcpy(mappedSubresource.data, lights, sizeof(lights));
+			frameUploadManager.unmap(*texture3D);
 		}
 	}
 
@@ -183,6 +183,7 @@ namespace Renderer
 	private:
 		explicit LightBufferManager(const LightBufferManager&) = delete;
 		LightBufferManager& operator=(const LightBufferManager&) = delete;
+		void createTextureBuffer();
 		void fillTextureBuffer(const glm::dvec3& worldSpaceCameraPosition, SceneResource& sceneResource);	// 64 bit world space position of the camera
 		void fillClusters3DTexture(SceneResource& sceneResource, Rhi::CommandBuffer& commandBuffer);
 
@@ -193,18 +194,33 @@ namespace Renderer
 	private:
 		typedef std::vector<uint8_t> ScratchBuffer;
 
+		struct TextureBuffer final
+		{
+			Rhi::ITextureBuffer* textureBuffer;		///< RHI texture buffer instance, always valid
+			Rhi::IResourceGroup* resourceGroup;		///< RHI resource group instance, can be a null pointer
+			uint64_t			 usedFrameNumber;	///< Number of the rendered frame which used the texture buffer the last time, only relevant for persistent mapping
+			explicit TextureBuffer(Rhi::ITextureBuffer& _textureBuffer) :
+				textureBuffer(&_textureBuffer),
+				resourceGroup(nullptr),
+				usedFrameNumber(0)
+			{
+				// Nothing here
+			}
+		};
+		typedef std::vector<TextureBuffer> TextureBuffers;
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
 		IRenderer&			 mRenderer;			///< Renderer instance to use
-		Rhi::ITextureBuffer* mTextureBuffer;	///< RHI texture buffer instance, always valid
+		TextureBuffers		 mTextureBuffers;				///< Texture buffers, with persistent mapping there's one for each frame which might still be in flight, else there's exactly one
+		size_t				 mCurrentTextureBufferIndex;	///< Index of the current texture buffer, always valid
 		ScratchBuffer		 mTextureScratchBuffer;
 		TextureResourceId	 mClusters3DTextureResourceId;
 		glm::vec3			 mLightClustersAabbMinimum;
 		glm::vec3			 mLightClustersAabbMaximum;
-		Rhi::IResourceGroup* mResourceGroup;	///< RHI resource group instance, always valid
 
 
 	};
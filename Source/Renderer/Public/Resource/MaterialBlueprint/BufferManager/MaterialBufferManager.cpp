@@ -28,6 +28,7 @@
 #include "Renderer/Public/Resource/Material/MaterialTechnique.h"
 #include "Renderer/Public/Resource/Material/MaterialResource.h"
 #include "Renderer/Public/Core/SwizzleVectorElementRemove.h"
+#include "Renderer/Public/Core/Renderer/FrameUploadManager.h"
 #include "Renderer/Public/IRenderer.h"
 
 #include <algorithm>
@@ -193,6 +194,13 @@ namespace Renderer
 		}
 	}
 
+	Rhi::IResourceGroup* MaterialBufferManager::getResourceGroup(const MaterialBufferSlot& materialBufferSlot) const
+	{
+		const BufferPool* bufferPool = static_cast<const BufferPool*>(materialBufferSlot.getAssignedMaterialPool());
+		RHI_ASSERT(mRenderer.getContext(), nullptr != bufferPool, "Invalid assigned material pool")
+		return bufferPool->resourceGroup;
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -304,14 +312,16 @@ namespace Renderer
 		}
 
 		// Update the uniform buffer by using our scratch buffer
+		// -> With pipelined rendering the frame upload manager stages the data of the current frame and the render thread uploads it
 		if (nullptr != uniformBuffer)
 		{
+			const uint32_t numberOfBytes = static_cast<uint32_t>(mScratchBuffer.size());
 			Rhi::MappedSubresource mappedSubresource;
-			Rhi::IRhi& rhi = mRenderer.getRhi();
-			if (rhi.map(*uniformBuffer, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+			FrameUploadManager& frameUploadManager = mRenderer.getFrameUploadManager();
+			if (frameUploadManager.map(*uniformBuffer, numberOfBytes, Rhi::MapType::WRITE_DISCARD, mappedSubresource))
 			{
-				memcpy(mappedSubresource.data, mScratchBuffer.data(), static_cast<uint32_t>(mScratchBuffer.size()));
-				rhi.unmap(*uniformBuffer, 0);
+				memcpy(mappedSubresource.data, mScratchBuffer.data(), numberOfBytes);
+				frameUploadManager.unmap(*uniformBuffer);
 			}
 		}
 
@@ -151,6 +151,21 @@ namespace Renderer
 		*/
 		void fillComputeCommandBuffer(MaterialBufferSlot& materialBufferSlot, Rhi::CommandBuffer& commandBuffer);
 
+		/**
+		*  @brief
+		*    Return the resource group of the pool the given material buffer slot is assigned to
+		*
+		*  @param[in] materialBufferSlot
+		*    Material buffer slot to return the pool resource group for
+		*
+		*  @return
+		*    The RHI resource group to bind at the material uniform buffer root parameter index, don't destroy the instance
+		*
+		*  @note
+		*    - Doesn't change the last bound pool, used by render queue command recording jobs which track the bound pool on their own
+		*/
+		[[nodiscard]] Rhi::IResourceGroup* getResourceGroup(const MaterialBufferSlot& materialBufferSlot) const;
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
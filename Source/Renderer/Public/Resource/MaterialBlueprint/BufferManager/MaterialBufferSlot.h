@@ -141,6 +141,18 @@ namespace Renderer
 			return mAssignedMaterialSlot;
 		}
 
+		/**
+		*  @brief
+		*    Return the assigned material pool
+		*
+		*  @return
+		*    The assigned material pool, can be a null pointer, only meant to be used as an identity, e.g. for sorting
+		*/
+		[[nodiscard]] inline const void* getAssignedMaterialPool() const
+		{
+			return mAssignedMaterialPool;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
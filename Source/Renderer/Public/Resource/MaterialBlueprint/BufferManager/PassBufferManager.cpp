@@ -26,6 +26,7 @@
 #include "Renderer/Public/Resource/MaterialBlueprint/MaterialBlueprintResource.h"
 #include "Renderer/Public/Resource/MaterialBlueprint/Listener/IMaterialBlueprintResourceListener.h"
 #include "Renderer/Public/Resource/Material/MaterialResource.h"
+#include "Renderer/Public/Core/Renderer/FrameUploadManager.h"
 #include "Renderer/Public/Core/Math/Math.h"
 #include "Renderer/Public/IRenderer.h"
 
@@ -189,13 +190,15 @@ namespace Renderer
 			}
 
 			{ // Update the uniform buffer by using our scratch buffer
+				// -> With pipelined rendering the frame upload manager stages the data of the current frame and the render thread uploads it
 				Rhi::IUniformBuffer* uniformBuffer = mUniformBuffers[mCurrentUniformBufferIndex].uniformBuffer;
+				const uint32_t numberOfBytes = static_cast<uint32_t>(mScratchBuffer.size());
 				Rhi::MappedSubresource mappedSubresource;
-				Rhi::IRhi& rhi = mRenderer.getRhi();
-				if (rhi.map(*uniformBuffer, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+				FrameUploadManager& frameUploadManager = mRenderer.getFrameUploadManager();
+				if (frameUploadManager.map(*uniformBuffer, numberOfBytes, Rhi::MapType::WRITE_DISCARD, mappedSubresource))
 				{
-					memcpy(mappedSubresource.data, mScratchBuffer.data(), static_cast<uint32_t>(mScratchBuffer.size()));
-					rhi.unmap(*uniformBuffer, 0);
+					memcpy(mappedSubresource.data, mScratchBuffer.data(), numberOfBytes);
+					frameUploadManager.unmap(*uniformBuffer);
 				}
 			}
 			++mCurrentUniformBufferIndex;
@@ -29,6 +29,8 @@
 #include "Renderer/Public/Resource/Skeleton/SkeletonResource.h"
 #include "Renderer/Public/RenderQueue/RenderableManager.h"
 #include "Renderer/Public/Core/Math/Transform.h"
+#include "Renderer/Public/Core/Time/TimeManager.h"
+#include "Renderer/Public/Core/Renderer/FrameUploadManager.h"
 #include "Renderer/Public/IRenderer.h"
 
 // Disable warnings in external headers, we can't fix them
@@ -84,6 +86,12 @@ namespace Renderer
 
 	void TextureInstanceBufferManager::startupBufferFilling(const MaterialBlueprintResource& materialBlueprintResource, Rhi::CommandBuffer& commandBuffer)
 	{
+		// With persistent mapping the instance buffer to fill is selected lazily, see "Renderer::TextureInstanceBufferManager::onPreCommandBufferDispatch()"
+		if (nullptr == mCurrentInstanceBuffer)
+		{
+			createInstanceBuffer();
+		}
+
 		// Sanity checks
 		RHI_ASSERT(mRenderer.getContext(), nullptr != mCurrentInstanceBuffer, "Invalid current instance buffer")
 		RHI_ASSERT(mRenderer.getContext(), isInvalid(materialBlueprintResource.getComputeShaderBlueprintResourceId()), "Invalid compute shader blueprint resource ID")
@@ -128,13 +136,13 @@ namespace Renderer
 		const Transform& objectSpaceToWorldSpaceTransform = renderable.getRenderableManager().getTransform();
 		const MaterialBlueprintResourceManager& materialBlueprintResourceManager = mRenderer.getMaterialBlueprintResourceManager();
 		const MaterialProperties& globalMaterialProperties = materialBlueprintResourceManager.getGlobalMaterialProperties();
-		IMaterialBlueprintResourceListener& materialBlueprintResourceListener = materialBlueprintResourceManager.getMaterialBlueprintResourceListener();
+		const IMaterialBlueprintResourceListener& materialBlueprintResourceListener = materialBlueprintResourceManager.getMaterialBlueprintResourceListener();
 		const MaterialBlueprintResource::UniformBufferElementProperties& uniformBufferElementProperties = instanceUniformBuffer.uniformBufferElementProperties;
 		const size_t numberOfUniformBufferElementProperties = uniformBufferElementProperties.size();
 		const SkeletonResourceId skeletonResourceId = renderable.getSkeletonResourceId();
 		const SkeletonResource* skeletonResource = isValid(skeletonResourceId) ? &mRenderer.getSkeletonResourceManager().getById(skeletonResourceId) : nullptr;
-		static const PassBufferManager::PassData passData = {};
-		materialBlueprintResourceListener.beginFillInstance((nullptr != passBufferManager) ? passBufferManager->getPassData() : passData, objectSpaceToWorldSpaceTransform, materialTechnique);
+		static const PassBufferManager::PassData emptyPassData = {};
+		const PassBufferManager::PassData& passData = (nullptr != passBufferManager) ? passBufferManager->getPassData() : emptyPassData;
 
 		{ // Handle instance buffer overflow
 			// Calculate number of additionally needed uniform buffer bytes
@@ -200,7 +208,7 @@ namespace Renderer
 			if (MaterialProperty::Usage::INSTANCE_REFERENCE == usage)	// Most likely the case, so check this first
 			{
 				const uint32_t instanceTextureBufferStartIndex = static_cast<uint32_t>(mCurrentTextureBufferPointer - mStartTextureBufferPointer) / 4;	// /4 since the texture buffer is working with float4
-				if (!materialBlueprintResourceListener.fillInstanceValue(uniformBufferElementProperty.getReferenceValue(), mCurrentUniformBufferPointer, valueTypeNumberOfBytes, instanceTextureBufferStartIndex))
+				if (!materialBlueprintResourceListener.fillInstanceValue(uniformBufferElementProperty.getReferenceValue(), mCurrentUniformBufferPointer, valueTypeNumberOfBytes, passData, objectSpaceToWorldSpaceTransform, materialTechnique, instanceTextureBufferStartIndex))
 				{
 					// Error!
 					RHI_ASSERT(mRenderer.getContext(), false, "Can't resolve reference")
@@ -288,11 +296,20 @@ namespace Renderer
 	void TextureInstanceBufferManager::onPreCommandBufferDispatch()
 	{
 		// Unmap the current instance buffer and reset the current instance buffer to the first instance
+		// -> With persistent mapping there's no discard: The next buffer filling has to select an instance buffer no frame in flight is using anymore
 		if (isValid(mCurrentInstanceBufferIndex))
 		{
 			unmapCurrentInstanceBuffer();
-			mCurrentInstanceBufferIndex = 0;
-			mCurrentInstanceBuffer = &mInstanceBuffers[mCurrentInstanceBufferIndex];
+			if (mRenderer.getRhi().getCapabilities().persistentMapping)
+			{
+				setInvalid(mCurrentInstanceBufferIndex);
+				mCurrentInstanceBuffer = nullptr;
+			}
+			else
+			{
+				mCurrentInstanceBufferIndex = 0;
+				mCurrentInstanceBuffer = &mInstanceBuffers[mCurrentInstanceBufferIndex];
+			}
 		}
 	}
 
@@ -303,20 +320,33 @@ namespace Renderer
 	void TextureInstanceBufferManager::createInstanceBuffer()
 	{
 		Rhi::IBufferManager& bufferManager = mRenderer.getBufferManager();
+		const Rhi::Capabilities& capabilities = mRenderer.getRhi().getCapabilities();
 
 		// Before doing anything else: Unmap the current instance buffer
 		unmapCurrentInstanceBuffer();
 
 		// Update current instance buffer
 		mCurrentInstanceBufferIndex = isValid(mCurrentInstanceBufferIndex) ? (mCurrentInstanceBufferIndex + 1) : 0;
+		if (capabilities.persistentMapping)
+		{
+			// Skip instance buffers which might still be used by frames in flight
+			const uint64_t numberOfRenderedFrames = mRenderer.getTimeManager().getNumberOfRenderedFrames();
+			while (mCurrentInstanceBufferIndex < mInstanceBuffers.size() && numberOfRenderedFrames - mInstanceBuffers[mCurrentInstanceBufferIndex].usedFrameNumber <= capabilities.maximumNumberOfFramesInFlight)
+			{
+				++mCurrentInstanceBufferIndex;
+			}
+		}
 		if (mCurrentInstanceBufferIndex >= mInstanceBuffers.size())
 		{
+			// Streamed buffers are persistently mapped if possible
+			const Rhi::BufferUsage bufferUsage = capabilities.persistentMapping ? Rhi::BufferUsage::STREAM_DRAW : Rhi::BufferUsage::DYNAMIC_DRAW;
+
 			// Create uniform buffer instance
-			Rhi::IUniformBuffer* uniformBuffer = bufferManager.createUniformBuffer(mMaximumUniformBufferSize, nullptr, Rhi::BufferUsage::DYNAMIC_DRAW RHI_RESOURCE_DEBUG_NAME("Texture instance buffer manager"));
+			Rhi::IUniformBuffer* uniformBuffer = bufferManager.createUniformBuffer(mMaximumUniformBufferSize, nullptr, bufferUsage RHI_RESOURCE_DEBUG_NAME("Texture instance buffer manager"));
 			uniformBuffer->addReference();
 
 			// Create texture buffer instance
-			Rhi::ITextureBuffer* textureBuffer = bufferManager.createTextureBuffer(mMaximumTextureBufferSize, nullptr, Rhi::BufferFlag::SHADER_RESOURCE, Rhi::BufferUsage::DYNAMIC_DRAW, Rhi::TextureFormat::R32G32B32A32F RHI_RESOURCE_DEBUG_NAME("Texture instance buffer manager"));
+			Rhi::ITextureBuffer* textureBuffer = bufferManager.createTextureBuffer(mMaximumTextureBufferSize, nullptr, Rhi::BufferFlag::SHADER_RESOURCE, bufferUsage, Rhi::TextureFormat::R32G32B32A32F RHI_RESOURCE_DEBUG_NAME("Texture instance buffer manager"));
 			textureBuffer->addReference();
 
 			// Create instance buffer instance
@@ -337,14 +367,17 @@ namespace Renderer
 			RHI_ASSERT(mRenderer.getContext(), 0 == mStartInstanceLocation, "Invalid start instance location")
 
 			// Map instance buffer
-			Rhi::IRhi& rhi = mRenderer.getRhi();
+			// -> With persistent mapping this doesn't involve the driver and there's no discard, the instance buffer selection ensures no frame in flight is using the data
+			// -> With pipelined rendering the frame upload manager hands out staging memory of the current frame and the render thread uploads it
+			FrameUploadManager& frameUploadManager = mRenderer.getFrameUploadManager();
+			const Rhi::MapType mapType = mRenderer.getRhi().getCapabilities().persistentMapping ? Rhi::MapType::WRITE_NO_OVERWRITE : Rhi::MapType::WRITE_DISCARD;
 			Rhi::MappedSubresource mappedSubresource;
-			if (rhi.map(*mCurrentInstanceBuffer->uniformBuffer, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+			if (frameUploadManager.map(*mCurrentInstanceBuffer->uniformBuffer, mMaximumUniformBufferSize, mapType, mappedSubresource))
 			{
 				mStartUniformBufferPointer = mCurrentUniformBufferPointer = static_cast<uint8_t*>(mappedSubresource.data);
 			}
 			RHI_ASSERT(mRenderer.getContext(), nullptr != mStartUniformBufferPointer, "Invalid start uniform buffer pointer")
-			if (rhi.map(*mCurrentInstanceBuffer->textureBuffer, 0, Rhi::MapType::WRITE_DISCARD, 0, mappedSubresource))
+			if (frameUploadManager.map(*mCurrentInstanceBuffer->textureBuffer, mMaximumTextureBufferSize, mapType, mappedSubresource))
 			{
 				mStartTextureBufferPointer = mCurrentTextureBufferPointer = static_cast<float*>(mappedSubresource.data);
 				mCurrentInstanceBuffer->mapped = true;
@@ -365,10 +398,11 @@ namespace Renderer
 			// RHI_ASSERT(mRenderer.getContext(), 0 == mStartInstanceLocation, "Invalid start instance location")	// Not done by intent
 
 			// Unmap instance buffer
-			Rhi::IRhi& rhi = mRenderer.getRhi();
-			rhi.unmap(*mCurrentInstanceBuffer->uniformBuffer, 0);
-			rhi.unmap(*mCurrentInstanceBuffer->textureBuffer, 0);
+			FrameUploadManager& frameUploadManager = mRenderer.getFrameUploadManager();
+			frameUploadManager.unmap(*mCurrentInstanceBuffer->uniformBuffer, static_cast<uint32_t>(mCurrentUniformBufferPointer - mStartUniformBufferPointer));
+			frameUploadManager.unmap(*mCurrentInstanceBuffer->textureBuffer, static_cast<uint32_t>(reinterpret_cast<const uint8_t*>(mCurrentTextureBufferPointer) - reinterpret_cast<const uint8_t*>(mStartTextureBufferPointer)));
 			mCurrentInstanceBuffer->mapped = false;
+			mCurrentInstanceBuffer->usedFrameNumber = mRenderer.getTimeManager().getNumberOfRenderedFrames();
 			mStartUniformBufferPointer = nullptr;
 			mCurrentUniformBufferPointer = nullptr;
 			mStartTextureBufferPointer = nullptr;
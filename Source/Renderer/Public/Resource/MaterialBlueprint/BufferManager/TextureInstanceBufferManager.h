@@ -148,11 +148,13 @@ namespace Renderer
 			Rhi::ITextureBuffer* textureBuffer;	///< RHI texture buffer instance, always valid
 			Rhi::IResourceGroup* resourceGroup;	///< RHI resource group instance, can be a null pointer
 			bool				 mapped;
+			uint64_t			 usedFrameNumber;	///< Number of the rendered frame which used the instance buffer the last time, only relevant for persistent mapping
 			InstanceBuffer(Rhi::IUniformBuffer& _uniformBuffer, Rhi::ITextureBuffer& _textureBuffer) :
 				uniformBuffer(&_uniformBuffer),
 				textureBuffer(&_textureBuffer),
 				resourceGroup(nullptr),
-				mapped(false)
+				mapped(false),
+				usedFrameNumber(0)
 			{
 				// Nothing here
 			}
@@ -145,10 +145,12 @@ namespace Renderer
 			Rhi::IUniformBuffer* uniformBuffer;	///< Uniform buffer instance, always valid
 			Rhi::IResourceGroup* resourceGroup;	///< Resource group instance, can be a null pointer
 			bool				 mapped;
+			uint64_t			 usedFrameNumber;	///< Number of the rendered frame which used the instance buffer the last time, only relevant for persistent mapping
 			explicit InstanceBuffer(Rhi::IUniformBuffer& _uniformBuffer) :
 				uniformBuffer(&_uniformBuffer),
 				resourceGroup(nullptr),
-				mapped(false)
+				mapped(false),
+				usedFrameNumber(0)
 			{
 				// Nothing here
 			}
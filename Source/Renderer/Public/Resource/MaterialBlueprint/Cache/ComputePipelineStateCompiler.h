@@ -27,6 +27,7 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include "Renderer/Public/Export.h"
 #include "Renderer/Public/Core/Platform/PlatformTypes.h"
 
 // Disable warnings in external headers, we can't fix them
@@ -106,7 +107,7 @@ namespace Renderer
 			return mAsynchronousCompilationEnabled;
 		}
 
-		void setAsynchronousCompilationEnabled(bool enabled);
+		RENDERER_API_EXPORT void setAsynchronousCompilationEnabled(bool enabled);
 
 		[[nodiscard]] inline uint32_t getNumberOfCompilerThreads() const
 		{
@@ -27,6 +27,7 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
+#include "Renderer/Public/Export.h"
 #include "Renderer/Public/Resource/ShaderBlueprint/GraphicsShaderType.h"
 #include "Renderer/Public/Core/GetInvalid.h"
 
@@ -119,7 +120,7 @@ namespace Renderer
 			return mAsynchronousCompilationEnabled;
 		}
 
-		void setAsynchronousCompilationEnabled(bool enabled);
+		RENDERER_API_EXPORT void setAsynchronousCompilationEnabled(bool enabled);
 
 		[[nodiscard]] inline uint32_t getNumberOfCompilerThreads() const
 		{
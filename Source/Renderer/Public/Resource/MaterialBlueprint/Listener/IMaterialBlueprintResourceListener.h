@@ -103,8 +103,8 @@ namespace Renderer
 		[[nodiscard]] virtual bool fillMaterialValue(uint32_t referenceValue, uint8_t* buffer, uint32_t numberOfBytes) = 0;
 
 		// TODO(co) It might make sense to remove those instance methods from the interface and directly hard-code them for performance reasons. Profiling later on with real world scenes will show.
-		virtual void beginFillInstance(const PassBufferManager::PassData& passData, const Transform& objectSpaceToWorldSpaceTransform, MaterialTechnique& materialTechnique) = 0;
-		[[nodiscard]] virtual bool fillInstanceValue(uint32_t referenceValue, uint8_t* buffer, uint32_t numberOfBytes, uint32_t instanceTextureBufferStartIndex) = 0;
+		// -> Instance values are filled by multiple render queue recording jobs at the same time, so there's no instance scope state and the method must be thread-safe
+		[[nodiscard]] virtual bool fillInstanceValue(uint32_t referenceValue, uint8_t* buffer, uint32_t numberOfBytes, const PassBufferManager::PassData& passData, const Transform& objectSpaceToWorldSpaceTransform, const MaterialTechnique& materialTechnique, uint32_t instanceTextureBufferStartIndex) const = 0;
 
 
 	};
@@ -1040,7 +1040,7 @@ namespace Renderer
 		return valueFilled;
 	}
 
-	bool MaterialBlueprintResourceListener::fillInstanceValue(uint32_t referenceValue, uint8_t* buffer, [[maybe_unused]] uint32_t numberOfBytes, uint32_t instanceTextureBufferStartIndex)
+	bool MaterialBlueprintResourceListener::fillInstanceValue(uint32_t referenceValue, uint8_t* buffer, [[maybe_unused]] uint32_t numberOfBytes, [[maybe_unused]] const PassBufferManager::PassData& passData, const Transform& objectSpaceToWorldSpaceTransform, const MaterialTechnique& materialTechnique, uint32_t instanceTextureBufferStartIndex) const
 	{
 		bool valueFilled = true;
 
@@ -1057,7 +1057,7 @@ namespace Renderer
 				integerBuffer[0] = instanceTextureBufferStartIndex;
 
 				// 1 = y = The assigned material slot inside the material uniform buffer
-				integerBuffer[1] = mMaterialTechnique->getAssignedMaterialSlot();
+				integerBuffer[1] = materialTechnique.getAssignedMaterialSlot();
 
 				// 2 = z = The custom parameters start index inside the instance texture buffer
 				integerBuffer[2] = 0;
@@ -1077,12 +1077,12 @@ namespace Renderer
 				// -> 0 = World space x position
 				// -> 1 = World space y position
 				// -> 2 = World space z position
-				*reinterpret_cast<float*>(integerBuffer)	 = static_cast<float>(mObjectSpaceToWorldSpaceTransform->position.x - mWorldSpaceCameraPosition.x);
-				*reinterpret_cast<float*>(integerBuffer + 1) = static_cast<float>(mObjectSpaceToWorldSpaceTransform->position.y - mWorldSpaceCameraPosition.y);
-				*reinterpret_cast<float*>(integerBuffer + 2) = static_cast<float>(mObjectSpaceToWorldSpaceTransform->position.z - mWorldSpaceCameraPosition.z);
+				*reinterpret_cast<float*>(integerBuffer)	 = static_cast<float>(objectSpaceToWorldSpaceTransform.position.x - mWorldSpaceCameraPosition.x);
+				*reinterpret_cast<float*>(integerBuffer + 1) = static_cast<float>(objectSpaceToWorldSpaceTransform.position.y - mWorldSpaceCameraPosition.y);
+				*reinterpret_cast<float*>(integerBuffer + 2) = static_cast<float>(objectSpaceToWorldSpaceTransform.position.z - mWorldSpaceCameraPosition.z);
 
 				// 3 = w = The assigned material slot inside the material uniform buffer
-				integerBuffer[3] = mMaterialTechnique->getAssignedMaterialSlot();
+				integerBuffer[3] = materialTechnique.getAssignedMaterialSlot();
 				break;
 			}
 
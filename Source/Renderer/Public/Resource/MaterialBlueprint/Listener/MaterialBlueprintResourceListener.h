@@ -126,12 +126,10 @@ namespace Renderer
 			mFarZ(0.0f),
 			mPreviousJitter(0.0f, 0.0f),
 			mPreviousNumberOfRenderedFrames(getInvalid<uint64_t>()),
-			mHosekWilkieSky(nullptr),
+			mHosekWilkieSky(nullptr)
 			#ifdef RHI_DEBUG
-				mIsComputePipeline(false),
+				, mIsComputePipeline(false)
 			#endif
-			mObjectSpaceToWorldSpaceTransform(nullptr),
-			mMaterialTechnique(nullptr)
 		{
 			// Nothing here
 		}
@@ -202,18 +200,7 @@ namespace Renderer
 			return false;
 		}
 
-		inline virtual void beginFillInstance(const PassBufferManager::PassData& passData, const Transform& objectSpaceToWorldSpaceTransform, MaterialTechnique& materialTechnique) override
-		{
-			// Remember the pass data memory address of the current scope
-			// TODO(co) Rethink the evil const-cast on here
-			mPassData = &const_cast<PassBufferManager::PassData&>(passData);
-
-			// Remember the instance data of the current scope
-			mObjectSpaceToWorldSpaceTransform = &objectSpaceToWorldSpaceTransform;
-			mMaterialTechnique				  = &materialTechnique;
-		}
-
-		[[nodiscard]] RENDERER_API_EXPORT virtual bool fillInstanceValue(uint32_t referenceValue, uint8_t* buffer, uint32_t numberOfBytes, uint32_t instanceTextureBufferStartIndex) override;
+		[[nodiscard]] RENDERER_API_EXPORT virtual bool fillInstanceValue(uint32_t referenceValue, uint8_t* buffer, uint32_t numberOfBytes, const PassBufferManager::PassData& passData, const Transform& objectSpaceToWorldSpaceTransform, const MaterialTechnique& materialTechnique, uint32_t instanceTextureBufferStartIndex) const override;
 
 
 	//[-------------------------------------------------------]
@@ -249,10 +236,6 @@ namespace Renderer
 			bool					 mIsComputePipeline;
 		#endif
 
-		// Instance
-		const Transform*   mObjectSpaceToWorldSpaceTransform;
-		MaterialTechnique* mMaterialTechnique;
-
 
 	};
 
@@ -54,6 +54,9 @@ namespace Renderer
 	//   - Texture buffers
 	//   - Sampler states
 	//   - Textures
+	// - Shader combinations used by the materials of the project, see "Renderer::MaterialBlueprintResource::createPrecompiledPipelineStateCaches()"
+	//   - Number of shader properties per shader combination
+	//   - Shader properties of all shader combinations
 	namespace v1MaterialBlueprint
 	{
 
@@ -62,7 +65,7 @@ namespace Renderer
 		//[ Definitions                                           ]
 		//[-------------------------------------------------------]
 		static constexpr uint32_t FORMAT_TYPE	 = STRING_ID("MaterialBlueprint");
-		static constexpr uint32_t FORMAT_VERSION = 11;
+		static constexpr uint32_t FORMAT_VERSION = 12;
 
 		#pragma pack(push)
 		#pragma pack(1)
@@ -76,6 +79,8 @@ namespace Renderer
 				uint32_t numberOfStructuredBuffers;
 				uint32_t numberOfSamplerStates;
 				uint32_t numberOfTextures;
+				uint32_t numberOfShaderCombinations;
+				uint32_t numberOfShaderCombinationShaderProperties;
 			};
 
 			struct RootSignatureHeader final
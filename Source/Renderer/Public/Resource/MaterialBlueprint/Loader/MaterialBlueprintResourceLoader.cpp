@@ -279,6 +279,23 @@ namespace Renderer
 			mMaterialBlueprintResource->mTextures.clear();
 		}
 
+		// Read in the shader combinations used by the materials of the project
+		if (materialBlueprintHeader.numberOfShaderCombinations > 0)
+		{
+			mMaterialBlueprintResource->mNumberOfPrecompiledShaderCombinationProperties.resize(materialBlueprintHeader.numberOfShaderCombinations);
+			mMemoryFile.read(mMaterialBlueprintResource->mNumberOfPrecompiledShaderCombinationProperties.data(), sizeof(uint32_t) * materialBlueprintHeader.numberOfShaderCombinations);
+			mMaterialBlueprintResource->mPrecompiledShaderCombinationProperties.resize(materialBlueprintHeader.numberOfShaderCombinationShaderProperties);
+			if (materialBlueprintHeader.numberOfShaderCombinationShaderProperties > 0)
+			{
+				mMemoryFile.read(mMaterialBlueprintResource->mPrecompiledShaderCombinationProperties.data(), sizeof(ShaderProperties::Property) * materialBlueprintHeader.numberOfShaderCombinationShaderProperties);
+			}
+		}
+		else
+		{
+			mMaterialBlueprintResource->mNumberOfPrecompiledShaderCombinationProperties.clear();
+			mMaterialBlueprintResource->mPrecompiledShaderCombinationProperties.clear();
+		}
+
 		// Can we create the RHI resources asynchronous as well?
 		if (mRenderer.getRhi().getCapabilities().nativeMultithreading)
 		{
@@ -40,7 +40,7 @@ namespace Renderer
 {
 	class IRenderer;
 	class MaterialBlueprintResource;
-	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class ResourceManagerTemplate;
+	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_PAGE> class ResourceManagerTemplate;
 	namespace v1MaterialBlueprint
 	{
 		struct Texture;
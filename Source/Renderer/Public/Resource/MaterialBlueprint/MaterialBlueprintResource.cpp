@@ -444,6 +444,32 @@ namespace Renderer
 		}
 	}
 
+	void MaterialBlueprintResource::createPrecompiledPipelineStateCaches()
+	{
+		// Sanity check
+		RHI_ASSERT(getResourceManager<MaterialBlueprintResourceManager>().getRenderer().getContext(), LoadingState::LOADED == getLoadingState(), "Material blueprint resource must be fully loaded, meaning also all referenced shader resources")
+
+		// Create the pipeline state cache instances for the shader combinations used by the materials of the project
+		ShaderProperties shaderProperties;
+		const ShaderProperties::Property* property = mPrecompiledShaderCombinationProperties.data();
+		for (const uint32_t numberOfProperties : mNumberOfPrecompiledShaderCombinationProperties)
+		{
+			shaderProperties.clear();
+			for (uint32_t i = 0; i < numberOfProperties; ++i, ++property)
+			{
+				shaderProperties.setPropertyValue(property->shaderPropertyId, property->value);
+			}
+			if (isValid(mComputeShaderBlueprintResourceId))
+			{
+				[[maybe_unused]] const ComputePipelineStateCache* computePipelineStateCache = mComputePipelineStateCacheManager.getComputePipelineStateCacheByCombination(shaderProperties, false);
+			}
+			else
+			{
+				[[maybe_unused]] const GraphicsPipelineStateCache* graphicsPipelineStateCache = mGraphicsPipelineStateCacheManager.getGraphicsPipelineStateCacheByCombination(getInvalid<uint32_t>(), shaderProperties, false);
+			}
+		}
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -43,8 +43,8 @@ namespace Renderer
 	class IFile;
 	class PassBufferManager;
 	class MaterialBufferManager;
-	template <class ELEMENT_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class PackedElementManager;
-	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class ResourceManagerTemplate;
+	template <class ELEMENT_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_PAGE> class PackedElementManager;
+	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_PAGE> class ResourceManagerTemplate;
 	class MaterialBlueprintResourceLoader;
 }
 
@@ -550,6 +550,22 @@ namespace Renderer
 		*/
 		RENDERER_API_EXPORT void createPipelineStateCaches(bool mandatoryOnly);
 
+		/**
+		*  @brief
+		*    Create graphics and compute pipeline state cache instances for the shader combinations used by the materials of the project
+		*
+		*  @remarks
+		*    The renderer toolkit gathers the shader combinations which are actually used by the materials referencing this material blueprint
+		*    and writes them into the material blueprint asset. Creating the pipeline state caches for those upfront means the shader cache
+		*    manager is already warm when the materials are rendered for the first time. Together with the pipeline state object cache
+		*    which is saved per RHI, the shaders are only compiled once and are later on just loaded.
+		*
+		*  @note
+		*    - The material blueprint resource must be fully loaded for this to work
+		*    - Shader properties which are only known at runtime (e.g. "UseGpuSkinning" or global material properties) can't be taken into account
+		*/
+		RENDERER_API_EXPORT void createPrecompiledPipelineStateCaches();
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -592,6 +608,9 @@ namespace Renderer
 		ShaderBlueprintResourceId		mGraphicsShaderBlueprintResourceId[NUMBER_OF_GRAPHICS_SHADER_TYPES];
 		// Compute pipeline state
 		ShaderBlueprintResourceId mComputeShaderBlueprintResourceId;
+		// Shader combinations used by the materials of the project, gathered by the renderer toolkit
+		std::vector<uint32_t>				   mNumberOfPrecompiledShaderCombinationProperties;	///< Number of shader properties per shader combination
+		ShaderProperties::SortedPropertyVector mPrecompiledShaderCombinationProperties;			///< Shader properties of all shader combinations, tightly packed
 		// Resource
 		UniformBuffers mUniformBuffers;
 		TextureBuffers mTextureBuffers;
@@ -98,9 +98,7 @@ namespace Renderer
 		bool load = (reload && nullptr != asset);
 		if (nullptr == materialBlueprintResource && nullptr != asset)
 		{
-			materialBlueprintResource = &mInternalResourceManager->getResources().addElement();
-			materialBlueprintResource->setResourceManager(this);
-			materialBlueprintResource->setAssetId(assetId);
+			materialBlueprintResource = &mInternalResourceManager->addResource(assetId);
 			materialBlueprintResource->setResourceLoaderTypeId(resourceLoaderTypeId);
 			load = true;
 		}
@@ -129,13 +127,14 @@ namespace Renderer
 			//          Later on, we can probably just write "mInternalResourceManager->loadResourceByAssetId(assetId, meshResourceId, resourceListener, reload, resourceLoaderTypeId);" and be done in this method.
 			materialBlueprintResource->enforceFullyLoaded();
 
-			// Create default pipeline state caches
+			// Create default pipeline state caches as well as the ones for the shader combinations used by the materials of the project
 			// -> Material blueprints should be loaded by a cache manager upfront so that the following expensive call doesn't cause runtime hiccups
 			// -> Runtime hiccups would also be there without fallback pipeline state caches, so there's no real way around
 			// -> We must enforce fully loaded material blueprint resource state for this
 			if (mCreateInitialPipelineStateCaches && createInitialPipelineStateCaches)
 			{
 				materialBlueprintResource->createPipelineStateCaches(true);
+				materialBlueprintResource->createPrecompiledPipelineStateCaches();
 			}
 		}
 	}
@@ -173,12 +172,33 @@ namespace Renderer
 		{
 			mTextureInstanceBufferManager->onPreCommandBufferDispatch();
 		}
+		for (UniformInstanceBufferManager* uniformInstanceBufferManager : mJobUniformInstanceBufferManagers)
+		{
+			uniformInstanceBufferManager->onPreCommandBufferDispatch();
+		}
+		for (TextureInstanceBufferManager* textureInstanceBufferManager : mJobTextureInstanceBufferManagers)
+		{
+			textureInstanceBufferManager->onPreCommandBufferDispatch();
+		}
 		if (nullptr != mIndirectBufferManager)
 		{
 			mIndirectBufferManager->onPreCommandBufferDispatch();
 		}
 	}
 
+	void MaterialBlueprintResourceManager::reserveJobInstanceBufferManagers(uint32_t numberOfJobs)
+	{
+		// Sanity check
+		RHI_ASSERT(mRenderer.getContext(), nullptr != mUniformInstanceBufferManager && nullptr != mTextureInstanceBufferManager, "Job instance buffer managers need instance buffer support")
+
+		// Create the missing job instance buffer managers
+		while (mJobUniformInstanceBufferManagers.size() < numberOfJobs)
+		{
+			mJobUniformInstanceBufferManagers.push_back(new UniformInstanceBufferManager(mRenderer));
+			mJobTextureInstanceBufferManagers.push_back(new TextureInstanceBufferManager(mRenderer));
+		}
+	}
+
 	void MaterialBlueprintResourceManager::setDefaultTextureFiltering(Rhi::FilterMode filterMode, uint8_t maximumAnisotropy)
 	{
 		// State change?
@@ -372,6 +392,14 @@ namespace Renderer
 		delete mTextureInstanceBufferManager;
 		delete mIndirectBufferManager;
 		delete mLightBufferManager;
+		for (UniformInstanceBufferManager* uniformInstanceBufferManager : mJobUniformInstanceBufferManagers)
+		{
+			delete uniformInstanceBufferManager;
+		}
+		for (TextureInstanceBufferManager* textureInstanceBufferManager : mJobTextureInstanceBufferManagers)
+		{
+			delete textureInstanceBufferManager;
+		}
 
 		// Shutdown material blueprint resource listener (we know there must be such an instance)
 		RHI_ASSERT(mRenderer.getContext(), nullptr != mMaterialBlueprintResourceListener, "Invalid material blueprint resource listener")
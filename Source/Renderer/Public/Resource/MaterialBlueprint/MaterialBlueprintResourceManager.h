@@ -60,7 +60,7 @@ namespace Renderer
 	class TextureInstanceBufferManager;
 	class MaterialBlueprintResourceLoader;
 	class IMaterialBlueprintResourceListener;
-	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class ResourceManagerTemplate;
+	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_PAGE> class ResourceManagerTemplate;
 }
 
 
@@ -193,6 +193,31 @@ namespace Renderer
 			return *mTextureInstanceBufferManager;
 		}
 
+		/**
+		*  @brief
+		*    Ensure there are uniform and texture instance buffer managers for the given number of render queue command recording jobs
+		*
+		*  @param[in] numberOfJobs
+		*    Number of command recording jobs
+		*
+		*  @note
+		*    - Each command recording job fills its own instance buffers, so the jobs don't need to synchronize
+		*    - Must be called before the command recording jobs are started, the job instance buffer managers are kept for the next frames
+		*/
+		void reserveJobInstanceBufferManagers(uint32_t numberOfJobs);
+
+		[[nodiscard]] inline UniformInstanceBufferManager& getJobUniformInstanceBufferManager(uint32_t jobIndex) const
+		{
+			RHI_ASSERT(mRenderer.getContext(), jobIndex < mJobUniformInstanceBufferManagers.size(), "Invalid job index")
+			return *mJobUniformInstanceBufferManagers[jobIndex];
+		}
+
+		[[nodiscard]] inline TextureInstanceBufferManager& getJobTextureInstanceBufferManager(uint32_t jobIndex) const
+		{
+			RHI_ASSERT(mRenderer.getContext(), jobIndex < mJobTextureInstanceBufferManagers.size(), "Invalid job index")
+			return *mJobTextureInstanceBufferManagers[jobIndex];
+		}
+
 		[[nodiscard]] inline IndirectBufferManager& getIndirectBufferManager() const
 		{
 			// We know this pointer must always be valid
@@ -247,6 +272,14 @@ namespace Renderer
 		void savePipelineStateObjectCache(MemoryFile& memoryFile);
 
 
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		typedef std::vector<UniformInstanceBufferManager*> UniformInstanceBufferManagers;
+		typedef std::vector<TextureInstanceBufferManager*> TextureInstanceBufferManagers;
+
+
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
@@ -263,6 +296,8 @@ namespace Renderer
 		TextureInstanceBufferManager*		mTextureInstanceBufferManager;				///< Texture instance buffer manager, always valid in a sane none-legacy environment
 		IndirectBufferManager*				mIndirectBufferManager;						///< Indirect buffer manager, always valid in a sane none-legacy environment
 		LightBufferManager*					mLightBufferManager;						///< Light buffer manager, always valid in a sane none-legacy environment
+		UniformInstanceBufferManagers		mJobUniformInstanceBufferManagers;			///< Uniform instance buffer managers of the render queue command recording jobs, we own the instances
+		TextureInstanceBufferManagers		mJobTextureInstanceBufferManagers;			///< Texture instance buffer managers of the render queue command recording jobs, we own the instances
 
 		// Internal resource manager implementation
 		ResourceManagerTemplate<MaterialBlueprintResource, MaterialBlueprintResourceLoader, MaterialBlueprintResourceId, 64>* mInternalResourceManager;
@@ -179,7 +179,8 @@ namespace Renderer
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
 	MeshResourceManager::MeshResourceManager(IRenderer& renderer) :
-		mNumberOfTopMeshLodsToRemove(0)
+		mNumberOfTopMeshLodsToRemove(0),
+		mLodBias(0.0f)
 	{
 		mInternalResourceManager = new ResourceManagerTemplate<MeshResource, IMeshResourceLoader, MeshResourceId, 4096>(renderer, *this);
 
@@ -38,7 +38,7 @@ namespace Renderer
 	class MeshResource;
 	class IRenderer;
 	class IMeshResourceLoader;
-	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class ResourceManagerTemplate;
+	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_PAGE> class ResourceManagerTemplate;
 }
 
 
@@ -89,6 +89,16 @@ namespace Renderer
 			mNumberOfTopMeshLodsToRemove = numberOfTopMeshLodsToRemove;
 		}
 
+		[[nodiscard]] inline float getLodBias() const
+		{
+			return mLodBias;
+		}
+
+		inline void setLodBias(float lodBias)
+		{
+			mLodBias = lodBias;
+		}
+
 		[[nodiscard]] RENDERER_API_EXPORT MeshResource* getMeshResourceByAssetId(AssetId assetId) const;	// Considered to be inefficient, avoid method whenever possible
 		RENDERER_API_EXPORT void loadMeshResourceByAssetId(AssetId assetId, MeshResourceId& meshResourceId, IResourceListener* resourceListener = nullptr, bool reload = false, ResourceLoaderTypeId resourceLoaderTypeId = getInvalid<ResourceLoaderTypeId>());	// Asynchronous
 		[[nodiscard]] RENDERER_API_EXPORT MeshResourceId createEmptyMeshResourceByAssetId(AssetId assetId);	// Mesh resource is not allowed to exist, yet, prefer asynchronous mesh resource loading over this method
@@ -139,6 +149,7 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	private:
 		uint8_t				  mNumberOfTopMeshLodsToRemove;	///< The number of top mesh LODs to remove, only has an impact while rendering and not on loading (amount of needed memory is not influenced)
+		float				  mLodBias;						///< Global LOD bias added to the screen space LOD selection, positive values select coarser LODs earlier, see "Renderer::RenderableManager::updateCachedLodIndex()"
 		ResourceManagerTemplate<MeshResource, IMeshResourceLoader, MeshResourceId, 4096>* mInternalResourceManager;
 		Rhi::IVertexBufferPtr mDrawIdVertexBufferPtr;		///< Draw ID vertex buffer, see "17/11/2012 Surviving without gl_DrawID" - https://www.g-truc.net/post-0518.html
 		Rhi::IVertexArrayPtr  mDrawIdVertexArrayPtr;		///< Draw ID vertex array, see "17/11/2012 Surviving without gl_DrawID" - https://www.g-truc.net/post-0518.html
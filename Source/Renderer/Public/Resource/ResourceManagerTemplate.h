@@ -28,6 +28,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Renderer/Public/Core/PackedElementManager.h"
+#include "Renderer/Public/Resource/AssetIdIndex.h"
 #include "Renderer/Public/Asset/AssetManager.h"
 #include "Renderer/Public/Resource/ResourceStreamer.h"
 #include "Renderer/Public/IRenderer.h"
@@ -65,7 +66,7 @@ namespace Renderer
 	*  @brief
 	*    Internal resource manager template; not public used to keep template instantiation overhead under control
 	*/
-	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS>
+	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_PAGE>
 	class ResourceManagerTemplate : private Manager
 	{
 
@@ -74,7 +75,7 @@ namespace Renderer
 	//[ Public definitions                                    ]
 	//[-------------------------------------------------------]
 	public:
-		typedef PackedElementManager<TYPE, ID_TYPE, MAXIMUM_NUMBER_OF_ELEMENTS> Resources;
+		typedef PackedElementManager<TYPE, ID_TYPE, NUMBER_OF_ELEMENTS_PER_PAGE> Resources;
 
 
 	//[-------------------------------------------------------]
@@ -110,21 +111,10 @@ namespace Renderer
 			return new LOADER_TYPE(mResourceManager, mRenderer);
 		}
 
-		[[nodiscard]] inline TYPE* getResourceByAssetId(AssetId assetId) const	// Considered to be inefficient, avoid method whenever possible
+		[[nodiscard]] inline TYPE* getResourceByAssetId(AssetId assetId) const
 		{
-			// TODO(co) Implement more efficient solution later on
-			const uint32_t numberOfElements = mResources.getNumberOfElements();
-			for (uint32_t i = 0; i < numberOfElements; ++i)
-			{
-				TYPE& resource = mResources.getElementByIndex(i);
-				if (resource.getAssetId() == assetId)
-				{
-					return &resource;
-				}
-			}
-
-			// There's no resource using the given asset ID
-			return nullptr;
+			const ResourceId resourceId = mAssetIdIndex.getResourceId(assetId);
+			return isValid(resourceId) ? &mResources.getElementById(resourceId) : nullptr;
 		}
 
 		[[nodiscard]] inline TYPE& createEmptyResourceByAssetId(AssetId assetId)	// Resource is not allowed to exist, yet
@@ -133,14 +123,40 @@ namespace Renderer
 			RHI_ASSERT(mRenderer.getContext(), nullptr == getResourceByAssetId(assetId), "The resource isn't allowed to exist, yet")
 
 			// Create the resource instance
+			return addResource(assetId);
+		}
+
+		[[nodiscard]] inline TYPE& addResource(AssetId assetId)	// There might already be other resources using the asset ID, asset ID can be invalid
+		{
 			TYPE& resource = mResources.addElement();
 			resource.setResourceManager(&mResourceManager);
 			resource.setAssetId(assetId);
-
-			// Done
+			if (isValid(assetId))
+			{
+				mAssetIdIndex.addResourceId(assetId, resource.getId());
+			}
 			return resource;
 		}
 
+		inline void removeResource(ID_TYPE resourceId)
+		{
+			unregisterAssetId(mResources.getElementById(resourceId));
+			mResources.removeElement(resourceId);
+		}
+
+		inline void setResourceAssetId(TYPE& resource, AssetId assetId)
+		{
+			if (resource.getAssetId() != assetId)
+			{
+				unregisterAssetId(resource);
+				resource.setAssetId(assetId);
+				if (isValid(assetId))
+				{
+					mAssetIdIndex.addResourceId(assetId, resource.getId());
+				}
+			}
+		}
+
 		inline void loadResourceByAssetId(AssetId assetId, ID_TYPE& resourceId, IResourceListener* resourceListener, bool reload, ResourceLoaderTypeId resourceLoaderTypeId)	// Asynchronous
 		{
 			// Choose default resource loader type ID, if necessary
@@ -158,9 +174,7 @@ namespace Renderer
 			bool load = (reload && nullptr != asset);
 			if (nullptr == resource && nullptr != asset)
 			{
-				resource = &mResources.addElement();
-				resource->setResourceManager(&mResourceManager);
-				resource->setAssetId(assetId);
+				resource = &addResource(assetId);
 				resource->setResourceLoaderTypeId(resourceLoaderTypeId);
 				load = true;
 			}
@@ -190,16 +204,11 @@ namespace Renderer
 		inline void reloadResourceByAssetId(AssetId assetId)
 		{
 			// TODO(co) Experimental implementation (take care of resource cleanup etc.)
-			const uint32_t numberOfElements = mResources.getNumberOfElements();
-			for (uint32_t i = 0; i < numberOfElements; ++i)
+			const TYPE* resource = getResourceByAssetId(assetId);
+			if (nullptr != resource)
 			{
-				const TYPE& resource = mResources.getElementByIndex(i);
-				if (resource.getAssetId() == assetId)
-				{
-					ID_TYPE resourceId = getInvalid<ID_TYPE>();
-					loadResourceByAssetId(assetId, resourceId, nullptr, true, resource.getResourceLoaderTypeId());
-					break;
-				}
+				ID_TYPE resourceId = getInvalid<ID_TYPE>();
+				loadResourceByAssetId(assetId, resourceId, nullptr, true, resource->getResourceLoaderTypeId());
 			}
 		}
 
@@ -216,6 +225,26 @@ namespace Renderer
 		explicit ResourceManagerTemplate(const ResourceManagerTemplate&) = delete;
 		ResourceManagerTemplate& operator=(const ResourceManagerTemplate&) = delete;
 
+		void unregisterAssetId(const TYPE& resource)
+		{
+			const AssetId assetId = resource.getAssetId();
+			if (isValid(assetId) && mAssetIdIndex.removeResourceId(assetId, resource.getId()))
+			{
+				// The resource was the indexed one, but there are other resources using the same asset ID (e.g. cloned material resources)
+				// -> Rare case, so a linear search is fine
+				const uint32_t numberOfElements = mResources.getNumberOfElements();
+				for (uint32_t i = 0; i < numberOfElements; ++i)
+				{
+					const TYPE& otherResource = mResources.getElementByIndex(i);
+					if (otherResource.getAssetId() == assetId && &otherResource != &resource)
+					{
+						mAssetIdIndex.setResourceId(assetId, otherResource.getId());
+						break;
+					}
+				}
+			}
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
@@ -224,6 +253,7 @@ namespace Renderer
 		IRenderer&		  mRenderer;	///< Renderer instance, do not destroy the instance
 		IResourceManager& mResourceManager;
 		Resources		  mResources;
+		AssetIdIndex	  mAssetIdIndex;	///< Asset ID to resource ID index, all resources with a valid asset ID are registered
 
 
 	};
@@ -28,8 +28,79 @@
 #include "Renderer/Public/Core/File/IFileManager.h"
 #include "Renderer/Public/IRenderer.h"
 
-// TODO(co) Can we do something about the warning which does not involve using "std::thread"-pointers?
-PRAGMA_WARNING_DISABLE_MSVC(4355)	// warning C4355: 'this': used in base member initializer list
+#include <algorithm>
+#include <chrono>
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr uint32_t MAXIMUM_NUMBER_OF_STAGE_THREADS	  = 4;		///< Maximum number of automatically chosen worker threads per asynchronous resource streamer stage
+		static constexpr uint32_t MAXIMUM_NUMBER_OF_LOADER_INSTANCES = 5;		///< In order to keep the memory consumption under control, we limit the number of simultaneous resource loader type instances
+
+
+		//[-------------------------------------------------------]
+		//[ Global functions                                      ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] uint32_t getAutomaticNumberOfStageThreads()
+		{
+			// Leave most hardware threads to the job system, streaming is mostly waiting for storage and decompression
+			const uint32_t numberOfHardwareThreads = std::thread::hardware_concurrency();
+			return std::max(1u, std::min(numberOfHardwareThreads / 4, MAXIMUM_NUMBER_OF_STAGE_THREADS));
+		}
+
+		template <typename WAKEUP>
+		void wakeupStageThread(WAKEUP& stageWakeup)
+		{
+			// Pairs with the fence inside "sleepStageThread()", so either the sleeping thread sees the pushed load request or we see the sleeping thread
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (stageWakeup.numberOfSleepingThreads.load(std::memory_order_relaxed) > 0)
+			{
+				std::lock_guard<std::mutex> mutexLock(stageWakeup.mutex);
+				stageWakeup.conditionVariable.notify_one();
+			}
+		}
+
+		template <typename WAKEUP, typename PREDICATE>
+		void sleepStageThread(WAKEUP& stageWakeup, const PREDICATE& predicate)
+		{
+			std::unique_lock<std::mutex> mutexLock(stageWakeup.mutex);
+			++stageWakeup.numberOfSleepingThreads;
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (!predicate())
+			{
+				// The timeout is just a safety net, wakeups are explicit
+				using namespace std::chrono_literals;
+				stageWakeup.conditionVariable.wait_for(mutexLock, 100ms, predicate);
+			}
+			--stageWakeup.numberOfSleepingThreads;
+		}
+
+		template <typename QUEUE, typename TYPE>
+		void pushBlocking(QUEUE& queue, const TYPE& value)
+		{
+			// The next stage is draining the queue, so just give it a moment if the queue is full
+			while (!queue.tryPush(value))
+			{
+				std::this_thread::yield();
+			}
+		}
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
 
 
 //[-------------------------------------------------------]
@@ -51,57 +122,95 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
+	void ResourceStreamer::setNumberOfThreads(uint32_t numberOfDeserializationThreads, uint32_t numberOfProcessingThreads)
+	{
+		// The load requests stay inside the lock-free queues while the worker threads are replaced
+		stopThreads();
+		startThreads(numberOfDeserializationThreads, numberOfProcessingThreads);
+	}
+
 	void ResourceStreamer::commitLoadRequest(const LoadRequest& loadRequest)
 	{
 		// The first thing we do: Update the resource loading state
 		++mNumberOfInFlightLoadRequests;
 		loadRequest.getResource().setLoadingState(IResource::LoadingState::LOADING);
 
+		// Get the in-flight load request state, a reload of a resource which is still in-flight shares the state of the previous load request
+		LoadRequest inFlightLoadRequest = loadRequest;
+		LoadRequestState* loadRequestState = tryGetLoadRequestState(*loadRequest.resourceManager, loadRequest.resourceId);
+		if (nullptr != loadRequestState)
+		{
+			++loadRequestState->numberOfLoadRequests;
+			if (static_cast<uint8_t>(loadRequest.priority) < loadRequestState->priority)
+			{
+				loadRequestState->priority = static_cast<uint8_t>(loadRequest.priority);
+			}
+		}
+		else
+		{
+			if (mFreeLoadRequestStates.empty())
+			{
+				loadRequestState = &mLoadRequestStates.emplace_back();
+			}
+			else
+			{
+				loadRequestState = mFreeLoadRequestStates.back();
+				mFreeLoadRequestStates.pop_back();
+			}
+			loadRequestState->priority = static_cast<uint8_t>(loadRequest.priority);
+			loadRequestState->cancelled = false;
+			loadRequestState->numberOfLoadRequests = 1;
+			loadRequestState->destroyResource = false;
+			loadRequestState->resourceManager = loadRequest.resourceManager;
+			loadRequestState->resourceId = loadRequest.resourceId;
+			mLoadRequestStateManager.emplace(loadRequest.resourceId, loadRequestState);
+		}
+		inFlightLoadRequest.state = loadRequestState;
+
 		// Push the load request into the queue of the first resource streamer pipeline stage
 		// -> Resource streamer stage: 1. Asynchronous deserialization
-		std::unique_lock<std::mutex> deserializationMutexLock(mDeserializationMutex);
-		mDeserializationQueue.push_back(loadRequest);
-		deserializationMutexLock.unlock();
-		mDeserializationConditionVariable.notify_one();
+		pushDeserializationQueue(inFlightLoadRequest);
 	}
 
-	void ResourceStreamer::flushAllQueues()
+	void ResourceStreamer::setLoadRequestPriority(const IResourceManager& resourceManager, ResourceId resourceId, LoadRequestPriority loadRequestPriority)
 	{
-		bool everythingFlushed = false;
-		do
+		RHI_ASSERT(mRenderer.getContext(), LoadRequestPriority::NUMBER_OF_PRIORITIES != loadRequestPriority, "Invalid load request priority")
+		LoadRequestState* loadRequestState = tryGetLoadRequestState(resourceManager, resourceId);
+		if (nullptr != loadRequestState)
 		{
-			{ // Process
-				{ // Resource streamer stage: 1. Asynchronous deserialization
-					std::lock_guard<std::mutex> deserializationMutexLock(mDeserializationMutex);
-					everythingFlushed = (mDeserializationQueue.empty() && 0 == mDeserializationWaitingQueueRequests);
-				}
+			loadRequestState->priority = static_cast<uint8_t>(loadRequestPriority);
+		}
+	}
 
-				// Resource streamer stage: 2. Asynchronous processing
-				if (everythingFlushed)
-				{
-					std::lock_guard<std::mutex> processingMutexLock(mProcessingMutex);
-					everythingFlushed = mProcessingQueue.empty();
-				}
+	bool ResourceStreamer::cancelLoadRequest(const IResourceManager& resourceManager, ResourceId resourceId, bool destroyResource)
+	{
+		LoadRequestState* loadRequestState = tryGetLoadRequestState(resourceManager, resourceId);
+		if (nullptr != loadRequestState)
+		{
+			// Only mark the load request as cancelled, a worker thread might be inside the resource loader right now
+			// -> The state stays alive until all load requests using it have been finalized, but a new load request for this resource must not pick it up
+			loadRequestState->cancelled = true;
+			loadRequestState->destroyResource = destroyResource;
+			detachLoadRequestState(*loadRequestState);
+			return true;
+		}
+		return false;
+	}
 
-				// Resource streamer stage: 3. Synchronous dispatch to e.g. the RHI implementation
-				if (everythingFlushed)
-				{
-					std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
-					everythingFlushed = (mDispatchQueue.empty() && mFullyLoadedWaitingQueue.empty());
-				}
-			}
+	void ResourceStreamer::flushAllQueues()
+	{
+		// Every load request is in-flight until it has been finalized, no matter inside which queue or worker thread it currently is
+		while (0 != mNumberOfInFlightLoadRequests)
+		{
 			dispatch();
 
 			// Wait for a moment to not totally pollute the CPU
-			if (!everythingFlushed)
+			if (0 != mNumberOfInFlightLoadRequests)
 			{
 				using namespace std::chrono_literals;
 				std::this_thread::sleep_for(1ms);
 			}
-		} while (!everythingFlushed);
-
-		// Sanity check
-		RHI_ASSERT(mRenderer.getContext(), 0 == mNumberOfInFlightLoadRequests, "Invalid number of in flight load requests")
+		}
 	}
 
 	void ResourceStreamer::dispatch()
@@ -110,20 +219,11 @@ namespace Renderer
 
 		// Continue as long as there's a load request left inside the queue
 		bool stillInTimeBudget = true;	// TODO(co) Add a maximum time budget so we're not blocking too long (the show must go on)
-		while (stillInTimeBudget)
+		LoadRequest loadRequest;
+		while (stillInTimeBudget && mDispatchQueue.tryPop(loadRequest))
 		{
-			// Get the load request
-			std::unique_lock<std::mutex> dispatchMutexLock(mDispatchMutex);
-			if (mDispatchQueue.empty())
-			{
-				break;
-			}
-			LoadRequest loadRequest = mDispatchQueue.front();
-			mDispatchQueue.pop_front();
-			dispatchMutexLock.unlock();
-
-			// Do the work
-			if (loadRequest.loadingFailed || loadRequest.resourceLoader->onDispatch())
+			// Do the work, cancelled load requests are done at once
+			if (loadRequest.loadingFailed || loadRequest.isCancelled() || loadRequest.resourceLoader->onDispatch())
 			{
 				// Load request is finished now
 				finalizeLoadRequest(loadRequest);
@@ -137,11 +237,11 @@ namespace Renderer
 		// Check fully loaded waiting queue
 		for (LoadRequests::iterator iterator = mFullyLoadedWaitingQueue.begin(); iterator != mFullyLoadedWaitingQueue.end();)
 		{
-			const LoadRequest& loadRequest = *iterator;
-			if (loadRequest.resourceLoader->isFullyLoaded())
+			const LoadRequest& fullyLoadedWaitingLoadRequest = *iterator;
+			if (fullyLoadedWaitingLoadRequest.isCancelled() || fullyLoadedWaitingLoadRequest.resourceLoader->isFullyLoaded())
 			{
 				// Load request is finished now
-				finalizeLoadRequest(loadRequest);
+				finalizeLoadRequest(fullyLoadedWaitingLoadRequest);
 
 				// Remove from queue
 				iterator = mFullyLoadedWaitingQueue.erase(iterator);
@@ -158,27 +258,20 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
-	ResourceStreamer::ResourceStreamer(IRenderer& renderer) :
+	ResourceStreamer::ResourceStreamer(IRenderer& renderer, uint32_t numberOfDeserializationThreads, uint32_t numberOfProcessingThreads) :
 		mRenderer(renderer),
 		mNumberOfInFlightLoadRequests(0),
-		mShutdownDeserializationThread(false),
-		mDeserializationWaitingQueueRequests(0),
-		mDeserializationThread(&ResourceStreamer::deserializationThreadWorker, this),
-		mShutdownProcessingThread(false),
-		mProcessingThread(&ResourceStreamer::processingThreadWorker, this)
+		mShutdownThreads(false),
+		mNumberOfDeserializationOverflowRequests(0),
+		mDeserializationWaitingQueueRequests(0)
 	{
-		// Nothing here
+		startThreads(numberOfDeserializationThreads, numberOfProcessingThreads);
 	}
 
 	ResourceStreamer::~ResourceStreamer()
 	{
-		// Deserialization thread and processing thread shutdown
-		mShutdownDeserializationThread = true;
-		mShutdownProcessingThread = true;
-		mDeserializationConditionVariable.notify_one();
-		mProcessingConditionVariable.notify_one();
-		mDeserializationThread.join();
-		mProcessingThread.join();
+		// Deserialization threads and processing threads shutdown
+		stopThreads();
 
 		// Destroy resource loader instances
 		for (auto& resourceLoaderType : mResourceLoaderTypeManager)
@@ -190,169 +283,314 @@ namespace Renderer
 		}
 	}
 
+	void ResourceStreamer::startThreads(uint32_t numberOfDeserializationThreads, uint32_t numberOfProcessingThreads)
+	{
+		RHI_ASSERT(mRenderer.getContext(), mDeserializationThreads.empty() && mProcessingThreads.empty(), "The resource streamer threads are already running")
+		if (isInvalid(numberOfDeserializationThreads))
+		{
+			numberOfDeserializationThreads = ::detail::getAutomaticNumberOfStageThreads();
+		}
+		if (isInvalid(numberOfProcessingThreads))
+		{
+			numberOfProcessingThreads = ::detail::getAutomaticNumberOfStageThreads();
+		}
+		RHI_ASSERT(mRenderer.getContext(), 0 != numberOfDeserializationThreads && 0 != numberOfProcessingThreads, "Each asynchronous resource streamer stage needs at least one thread")
+
+		// Create the worker threads
+		mShutdownThreads = false;
+		mDeserializationThreads.reserve(numberOfDeserializationThreads);
+		for (uint32_t i = 0; i < numberOfDeserializationThreads; ++i)
+		{
+			mDeserializationThreads.emplace_back(&ResourceStreamer::deserializationThreadWorker, this);
+		}
+		mProcessingThreads.reserve(numberOfProcessingThreads);
+		for (uint32_t i = 0; i < numberOfProcessingThreads; ++i)
+		{
+			mProcessingThreads.emplace_back(&ResourceStreamer::processingThreadWorker, this);
+		}
+	}
+
+	void ResourceStreamer::stopThreads()
+	{
+		// Wake up all sleeping worker threads so they notice the shutdown
+		mShutdownThreads = true;
+		{
+			std::lock_guard<std::mutex> mutexLock(mDeserializationWakeup.mutex);
+			mDeserializationWakeup.conditionVariable.notify_all();
+		}
+		{
+			std::lock_guard<std::mutex> mutexLock(mProcessingWakeup.mutex);
+			mProcessingWakeup.conditionVariable.notify_all();
+		}
+		for (std::thread& thread : mDeserializationThreads)
+		{
+			thread.join();
+		}
+		for (std::thread& thread : mProcessingThreads)
+		{
+			thread.join();
+		}
+		mDeserializationThreads.clear();
+		mProcessingThreads.clear();
+	}
+
+	ResourceStreamer::LoadRequestState* ResourceStreamer::tryGetLoadRequestState(const IResourceManager& resourceManager, ResourceId resourceId) const
+	{
+		// Resource IDs are only unique per resource manager
+		const auto range = mLoadRequestStateManager.equal_range(resourceId);
+		for (auto iterator = range.first; iterator != range.second; ++iterator)
+		{
+			if (iterator->second->resourceManager == &resourceManager)
+			{
+				return iterator->second;
+			}
+		}
+		return nullptr;
+	}
+
+	void ResourceStreamer::detachLoadRequestState(const LoadRequestState& loadRequestState)
+	{
+		const auto range = mLoadRequestStateManager.equal_range(loadRequestState.resourceId);
+		for (auto iterator = range.first; iterator != range.second; ++iterator)
+		{
+			if (iterator->second == &loadRequestState)
+			{
+				mLoadRequestStateManager.erase(iterator);
+				break;
+			}
+		}
+	}
+
+	void ResourceStreamer::releaseLoadRequestState(const LoadRequest& loadRequest)
+	{
+		LoadRequestState* loadRequestState = loadRequest.state;
+		RHI_ASSERT(mRenderer.getContext(), nullptr != loadRequestState && 0 != loadRequestState->numberOfLoadRequests, "Invalid load request state")
+		--loadRequestState->numberOfLoadRequests;
+		if (0 == loadRequestState->numberOfLoadRequests)
+		{
+			// Cancelled load request states have already been detached
+			if (!loadRequestState->cancelled)
+			{
+				detachLoadRequestState(*loadRequestState);
+			}
+			mFreeLoadRequestStates.push_back(loadRequestState);
+
+			// Perform the deferred resource destruction now that no resource loader is working on the resource anymore
+			// -> In case there's a new in-flight load request for the resource, it's cancelled and the destruction is deferred once more
+			if (loadRequestState->destroyResource && !cancelLoadRequest(*loadRequest.resourceManager, loadRequest.resourceId, true))
+			{
+				loadRequest.resourceManager->destroyResourceByResourceId(loadRequest.resourceId);
+			}
+		}
+	}
+
+	void ResourceStreamer::pushDeserializationQueue(const LoadRequest& loadRequest)
+	{
+		// Never block in here, this is called by the thread which also performs the synchronous dispatch
+		// -> If the lock-free queue is full, the load request is put into the overflow queue which is drained by the deserialization threads
+		if (!mDeserializationQueue.tryPush(loadRequest))
+		{
+			std::lock_guard<std::mutex> deserializationOverflowMutexLock(mDeserializationOverflowMutex);
+			mDeserializationOverflowQueue.push_back(loadRequest);
+			++mNumberOfDeserializationOverflowRequests;
+		}
+		::detail::wakeupStageThread(mDeserializationWakeup);
+	}
+
+	void ResourceStreamer::pushProcessingQueue(const LoadRequest& loadRequest)
+	{
+		::detail::pushBlocking(mProcessingQueue, loadRequest);
+		::detail::wakeupStageThread(mProcessingWakeup);
+	}
+
+	void ResourceStreamer::pushDispatchQueue(const LoadRequest& loadRequest)
+	{
+		// The dispatch queue is drained by "Renderer::ResourceStreamer::dispatch()", no wakeup required
+		::detail::pushBlocking(mDispatchQueue, loadRequest);
+	}
+
+	bool ResourceStreamer::popDeserializationQueue(LoadRequest& loadRequest)
+	{
+		if (mDeserializationQueue.tryPop(loadRequest))
+		{
+			return true;
+		}
+		if (0 != mNumberOfDeserializationOverflowRequests)
+		{
+			std::lock_guard<std::mutex> deserializationOverflowMutexLock(mDeserializationOverflowMutex);
+			if (!mDeserializationOverflowQueue.empty())
+			{
+				loadRequest = mDeserializationOverflowQueue.front();
+				mDeserializationOverflowQueue.pop_front();
+				--mNumberOfDeserializationOverflowRequests;
+				return true;
+			}
+		}
+		return false;
+	}
+
 	void ResourceStreamer::deserializationThreadWorker()
 	{
 		RENDERER_SET_CURRENT_THREAD_DEBUG_NAME("RS: Stage 1", "Renderer: Resource streamer stage: 1. Asynchronous deserialization")
 
 		// Resource streamer stage: 1. Asynchronous deserialization
-		while (!mShutdownDeserializationThread)
+		LoadRequest loadRequest;
+		while (!mShutdownThreads)
 		{
 			// Continue as long as there's a load request left inside the queue, if it's empty go to sleep
-			std::unique_lock<std::mutex> deserializationMutexLock(mDeserializationMutex);
-			mDeserializationConditionVariable.wait(deserializationMutexLock);
-			while (!mDeserializationQueue.empty() && !mShutdownDeserializationThread)
+			if (popDeserializationQueue(loadRequest))
 			{
-				// Get the load request
-				LoadRequest loadRequest = mDeserializationQueue.front();
-				mDeserializationQueue.pop_front();
-
-				{ // Get resource loader instance
-					std::lock_guard<std::mutex> resourceManagerMutexLock(mResourceManagerMutex);
-					const ResourceLoaderTypeId resourceLoaderTypeId = loadRequest.resourceLoaderTypeId;
-					ResourceLoaderTypeManager::iterator iterator = mResourceLoaderTypeManager.find(resourceLoaderTypeId);
-					if (mResourceLoaderTypeManager.cend() == iterator)
-					{
-						// The resource loader type ID is unknown, yet
-						ResourceLoaderType resourceLoaderType;
-						resourceLoaderType.numberOfInstances = 1;
-						mResourceLoaderTypeManager.emplace(resourceLoaderTypeId, resourceLoaderType);
-						loadRequest.resourceLoader = loadRequest.resourceManager->createResourceLoaderInstance(resourceLoaderTypeId);
-					}
-					else
-					{
-						// The resource loader type ID is already known
+				deserializeLoadRequest(loadRequest);
+			}
+			else
+			{
+				::detail::sleepStageThread(mDeserializationWakeup, [this]() { return (mShutdownThreads || !mDeserializationQueue.isEmpty() || 0 != mNumberOfDeserializationOverflowRequests); });
+			}
+		}
+	}
 
-						// First check whether or not we're able to reuse a free resource loader instance
-						ResourceLoaderType& resourceLoaderType = iterator->second;
-						ResourceLoaders& freeResourceLoaders = resourceLoaderType.freeResourceLoaders;
-						if (freeResourceLoaders.empty())
-						{
-							// In order to keep the memory consumption under control, we limit the number of simultaneous resource loader type instances
-							if (resourceLoaderType.numberOfInstances < 5)
-							{
-								loadRequest.resourceLoader = loadRequest.resourceManager->createResourceLoaderInstance(resourceLoaderTypeId);
-								RHI_ASSERT(mRenderer.getContext(), nullptr != loadRequest.resourceLoader, "Invalid load request resource loader")
-								++resourceLoaderType.numberOfInstances;
-							}
-							else
-							{
-								// We were unable to acquire a resource loader instance, we just have to try it later again
-								resourceLoaderType.waitingLoadRequests.push_back(loadRequest);
-								++mDeserializationWaitingQueueRequests;
-							}
-						}
-						else
-						{
-							loadRequest.resourceLoader = freeResourceLoaders.back();
-							freeResourceLoaders.pop_back();
-						}
-					}
-				}
+	void ResourceStreamer::processingThreadWorker()
+	{
+		RENDERER_SET_CURRENT_THREAD_DEBUG_NAME("RS: Stage 2", "Renderer: Resource streamer stage: 2. Asynchronous processing")
 
-				// If we've got a resource loader instance now, let's continue with the resource streaming pipeline
-				if (nullptr != loadRequest.resourceLoader)
+		// Resource streamer stage: 2. Asynchronous processing
+		LoadRequest loadRequest;
+		while (!mShutdownThreads)
+		{
+			// Continue as long as there's a load request left inside the queue, if it's empty go to sleep
+			if (mProcessingQueue.tryPop(loadRequest))
+			{
+				// Do the work, cancelled load requests are just passed through
+				if (!loadRequest.isCancelled())
 				{
-					deserializationMutexLock.unlock();
-					loadRequest.resourceLoader->initialize(*loadRequest.asset, loadRequest.reload, loadRequest.getResource());
+					loadRequest.resourceLoader->onProcessing();
+				}
+
+				// Push the load request into the queue of the next resource streamer pipeline stage
+				// -> Resource streamer stage: 3. Synchronous dispatch to e.g. the RHI implementation
+				pushDispatchQueue(loadRequest);
+			}
+			else
+			{
+				::detail::sleepStageThread(mProcessingWakeup, [this]() { return (mShutdownThreads || !mProcessingQueue.isEmpty()); });
+			}
+		}
+	}
+
+	void ResourceStreamer::deserializeLoadRequest(LoadRequest& loadRequest)
+	{
+		// Cancelled load requests don't need a resource loader instance, they're directly finalized
+		// -> Resource streamer stage: 3. Synchronous dispatch to finish off the cancelled loading attempt
+		if (loadRequest.isCancelled())
+		{
+			pushDispatchQueue(loadRequest);
+			return;
+		}
+
+		{ // Get resource loader instance
+			std::lock_guard<std::mutex> resourceManagerMutexLock(mResourceManagerMutex);
+			const ResourceLoaderTypeId resourceLoaderTypeId = loadRequest.resourceLoaderTypeId;
+			ResourceLoaderTypeManager::iterator iterator = mResourceLoaderTypeManager.find(resourceLoaderTypeId);
+			if (mResourceLoaderTypeManager.cend() == iterator)
+			{
+				// The resource loader type ID is unknown, yet
+				ResourceLoaderType resourceLoaderType;
+				resourceLoaderType.numberOfInstances = 1;
+				mResourceLoaderTypeManager.emplace(resourceLoaderTypeId, resourceLoaderType);
+				loadRequest.resourceLoader = loadRequest.resourceManager->createResourceLoaderInstance(resourceLoaderTypeId);
+			}
+			else
+			{
+				// The resource loader type ID is already known
 
-					// Do the work
-					if (loadRequest.resourceLoader->hasDeserialization())
+				// First check whether or not we're able to reuse a free resource loader instance
+				ResourceLoaderType& resourceLoaderType = iterator->second;
+				ResourceLoaders& freeResourceLoaders = resourceLoaderType.freeResourceLoaders;
+				if (freeResourceLoaders.empty())
+				{
+					// In order to keep the memory consumption under control, we limit the number of simultaneous resource loader type instances
+					if (resourceLoaderType.numberOfInstances < ::detail::MAXIMUM_NUMBER_OF_LOADER_INSTANCES)
 					{
-						IFileManager& fileManager = mRenderer.getFileManager();
-						IFile* file = fileManager.openFile(IFileManager::FileMode::READ, loadRequest.resourceLoader->getAsset().virtualFilename);
-						if (nullptr != file)
-						{
-							if (loadRequest.resourceLoader->onDeserialization(*file))
-							{
-								// Push the load request into the queue of the next resource streamer pipeline stage
-								if (loadRequest.resourceLoader->hasProcessing())
-								{
-									// Resource streamer stage: 2. Asynchronous processing
-									std::unique_lock<std::mutex> processingMutexLock(mProcessingMutex);
-									mProcessingQueue.push_back(loadRequest);
-									processingMutexLock.unlock();
-									mProcessingConditionVariable.notify_one();
-								}
-								else
-								{
-									// Resource streamer stage: 3. Synchronous dispatch to e.g. the RHI implementation
-									std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
-									mDispatchQueue.push_back(loadRequest);
-								}
-							}
-							else
-							{
-								// Resource streamer stage: 3. Synchronous dispatch to finish off the failed loading attempt
-								loadRequest.loadingFailed = true;
-								std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
-								mDispatchQueue.push_back(loadRequest);
-							}
-							fileManager.closeFile(*file);
-						}
-						else
-						{
-							// Error! This is horrible, now we've got a zombie inside the resource streamer. We could let it crash, but maybe the zombie won't directly eat brains.
-							RHI_ASSERT(mRenderer.getContext(), false, "We should never end up in here")
-						}
+						loadRequest.resourceLoader = loadRequest.resourceManager->createResourceLoaderInstance(resourceLoaderTypeId);
+						RHI_ASSERT(mRenderer.getContext(), nullptr != loadRequest.resourceLoader, "Invalid load request resource loader")
+						++resourceLoaderType.numberOfInstances;
 					}
 					else
 					{
-						// Push the load request into the queue of the next resource streamer pipeline stage
-						// -> Resource streamer stage: 2. Asynchronous processing
-						std::unique_lock<std::mutex> processingMutexLock(mProcessingMutex);
-						mProcessingQueue.push_back(loadRequest);
-						processingMutexLock.unlock();
-						mProcessingConditionVariable.notify_one();
+						// We were unable to acquire a resource loader instance, we just have to try it later again
+						resourceLoaderType.waitingLoadRequests.push_back(loadRequest);
+						++mDeserializationWaitingQueueRequests;
+						return;
 					}
-
-					// We're ready for the next round
-					deserializationMutexLock.lock();
+				}
+				else
+				{
+					loadRequest.resourceLoader = freeResourceLoaders.back();
+					freeResourceLoaders.pop_back();
 				}
 			}
 		}
-	}
 
-	void ResourceStreamer::processingThreadWorker()
-	{
-		RENDERER_SET_CURRENT_THREAD_DEBUG_NAME("RS: Stage 2", "Renderer: Resource streamer stage: 2. Asynchronous processing")
+		// We've got a resource loader instance now, let's continue with the resource streaming pipeline
+		loadRequest.resourceLoader->initialize(*loadRequest.asset, loadRequest.reload, loadRequest.getResource());
 
-		// Resource streamer stage: 2. Asynchronous processing
-		while (!mShutdownProcessingThread)
+		// Do the work
+		if (loadRequest.resourceLoader->hasDeserialization())
 		{
-			// Continue as long as there's a load request left inside the queue, if it's empty go to sleep
-			std::unique_lock<std::mutex> processingMutexLock(mProcessingMutex);
-			mProcessingConditionVariable.wait(processingMutexLock);
-			while (!mProcessingQueue.empty() && !mShutdownProcessingThread)
+			IFileManager& fileManager = mRenderer.getFileManager();
+			IFile* file = fileManager.openFile(IFileManager::FileMode::READ, loadRequest.resourceLoader->getAsset().virtualFilename);
+			if (nullptr != file)
 			{
-				// Get the load request
-				LoadRequest loadRequest = mProcessingQueue.front();
-				mProcessingQueue.pop_front();
-				processingMutexLock.unlock();
-
-				// Do the work
-				loadRequest.resourceLoader->onProcessing();
-
-				{ // Push the load request into the queue of the next resource streamer pipeline stage
-				  // -> Resource streamer stage: 3. Synchronous dispatch to e.g. the RHI implementation
-					std::lock_guard<std::mutex> dispatchMutexLock(mDispatchMutex);
-					mDispatchQueue.push_back(loadRequest);
+				if (loadRequest.resourceLoader->onDeserialization(*file))
+				{
+					// Push the load request into the queue of the next resource streamer pipeline stage
+					if (loadRequest.resourceLoader->hasProcessing())
+					{
+						// Resource streamer stage: 2. Asynchronous processing
+						pushProcessingQueue(loadRequest);
+					}
+					else
+					{
+						// Resource streamer stage: 3. Synchronous dispatch to e.g. the RHI implementation
+						pushDispatchQueue(loadRequest);
+					}
 				}
-
-				// We're ready for the next round
-				processingMutexLock.lock();
+				else
+				{
+					// Resource streamer stage: 3. Synchronous dispatch to finish off the failed loading attempt
+					loadRequest.loadingFailed = true;
+					pushDispatchQueue(loadRequest);
+				}
+				fileManager.closeFile(*file);
 			}
+			else
+			{
+				// Error! This is horrible, now we've got a zombie inside the resource streamer. We could let it crash, but maybe the zombie won't directly eat brains.
+				RHI_ASSERT(mRenderer.getContext(), false, "We should never end up in here")
+			}
+		}
+		else
+		{
+			// Push the load request into the queue of the next resource streamer pipeline stage
+			// -> Resource streamer stage: 2. Asynchronous processing
+			pushProcessingQueue(loadRequest);
 		}
 	}
 
 	void ResourceStreamer::finalizeLoadRequest(const LoadRequest& loadRequest)
 	{
-		{ // Release the resource loader instance
+		// Release the resource loader instance, cancelled load requests might not have acquired one
+		if (nullptr != loadRequest.resourceLoader)
+		{
 			std::unique_lock<std::mutex> resourceManagerMutexLock(mResourceManagerMutex);
 			ResourceLoaderTypeManager::iterator iterator = mResourceLoaderTypeManager.find(loadRequest.resourceLoaderTypeId);
 			if (mResourceLoaderTypeManager.cend() != iterator)
 			{
 				#ifdef RHI_DEBUG
-					loadRequest.getResource().setDebugName((std::string(loadRequest.resourceLoader->getAsset().virtualFilename) + IFileManager::INVALID_CHARACTER + "[Loaded]").c_str());
+					if (!loadRequest.isCancelled())
+					{
+						loadRequest.getResource().setDebugName((std::string(loadRequest.resourceLoader->getAsset().virtualFilename) + IFileManager::INVALID_CHARACTER + "[Loaded]").c_str());
+					}
 				#endif
 
 				// The resource loader instance is free now and ready to be reused
@@ -362,18 +600,41 @@ namespace Renderer
 				LoadRequests& waitingLoadRequests = iterator->second.waitingLoadRequests;
 				if (!waitingLoadRequests.empty())
 				{
-					// Get the waiting resource streamer load request and immediately release our resource manager mutex
-					LoadRequest waitingLoadRequest = waitingLoadRequests.front();
-					waitingLoadRequests.pop_front();
-					RHI_ASSERT(mRenderer.getContext(), 0 != mDeserializationWaitingQueueRequests, "Invalid deserialization waiting queue requests")
-					--mDeserializationWaitingQueueRequests;
+					// Get the most important waiting resource streamer load request, cancelled load requests don't need the resource loader instance and are all taken along
+					LoadRequests reinjectedLoadRequests;
+					LoadRequests::iterator mostImportantIterator = waitingLoadRequests.end();
+					for (LoadRequests::iterator waitingIterator = waitingLoadRequests.begin(); waitingIterator != waitingLoadRequests.end();)
+					{
+						if (waitingIterator->isCancelled())
+						{
+							reinjectedLoadRequests.push_back(*waitingIterator);
+							waitingIterator = waitingLoadRequests.erase(waitingIterator);
+						}
+						else
+						{
+							if (waitingLoadRequests.end() == mostImportantIterator || waitingIterator->getCurrentPriority() < mostImportantIterator->getCurrentPriority())
+							{
+								mostImportantIterator = waitingIterator;
+							}
+							++waitingIterator;
+						}
+					}
+					if (waitingLoadRequests.end() != mostImportantIterator)
+					{
+						reinjectedLoadRequests.push_back(*mostImportantIterator);
+						waitingLoadRequests.erase(mostImportantIterator);
+					}
+
+					// Immediately release our resource manager mutex
+					RHI_ASSERT(mRenderer.getContext(), mDeserializationWaitingQueueRequests >= reinjectedLoadRequests.size(), "Invalid deserialization waiting queue requests")
+					mDeserializationWaitingQueueRequests -= static_cast<uint32_t>(reinjectedLoadRequests.size());
 					resourceManagerMutexLock.unlock();
 
 					// Throw the fish back into the ocean
-					std::unique_lock<std::mutex> deserializationMutexLock(mDeserializationMutex);
-					mDeserializationQueue.push_back(waitingLoadRequest);
-					deserializationMutexLock.unlock();
-					mDeserializationConditionVariable.notify_one();
+					for (const LoadRequest& reinjectedLoadRequest : reinjectedLoadRequests)
+					{
+						pushDeserializationQueue(reinjectedLoadRequest);
+					}
 				}
 			}
 			else
@@ -384,7 +645,23 @@ namespace Renderer
 		}
 
 		// The last thing we do: Update the resource loading state
-		loadRequest.getResource().setLoadingState(loadRequest.loadingFailed ? IResource::LoadingState::FAILED : IResource::LoadingState::LOADED);
+		if (loadRequest.isCancelled())
+		{
+			// In case there's a new load request for the resource it owns the loading state, a resource which is about to be destroyed is left alone
+			if (!loadRequest.state->destroyResource && nullptr == tryGetLoadRequestState(*loadRequest.resourceManager, loadRequest.resourceId))
+			{
+				IResource& resource = loadRequest.getResource();
+				if (IResource::LoadingState::LOADING == resource.getLoadingState())
+				{
+					resource.setLoadingState(IResource::LoadingState::UNLOADED);
+				}
+			}
+		}
+		else
+		{
+			loadRequest.getResource().setLoadingState(loadRequest.loadingFailed ? IResource::LoadingState::FAILED : IResource::LoadingState::LOADED);
+		}
+		releaseLoadRequestState(loadRequest);
 		RHI_ASSERT(mRenderer.getContext(), 0 != mNumberOfInFlightLoadRequests, "Invalid number of in flight load requests")
 		--mNumberOfInFlightLoadRequests;
 	}
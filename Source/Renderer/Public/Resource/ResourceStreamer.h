@@ -28,6 +28,8 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Renderer/Public/Asset/Asset.h"
+#include "Renderer/Public/Core/GetInvalid.h"
+#include "Renderer/Public/Core/Thread/BoundedMpmcQueue.h"
 
 // Disable warnings in external headers, we can't fix them
 PRAGMA_WARNING_PUSH
@@ -41,6 +43,7 @@ PRAGMA_WARNING_PUSH
 	#include <deque>
 	#include <mutex>
 	#include <thread>
+	#include <vector>
 	#include <unordered_map>
 	#include <condition_variable>
 PRAGMA_WARNING_POP
@@ -91,8 +94,16 @@ namespace Renderer
 	*    2. Asynchronous processing
 	*    3. Synchronous dispatch, e.g. to the RHI implementation
 	*
-	*  @todo
-	*    - TODO(co) It might make sense to use lock-free-queues in here
+	*    The stages are connected by bounded lock-free queues. The asynchronous stages are each processed by a configurable number
+	*    of worker threads, so e.g. texture heavy loads can use multiple cores and storage queues at once.
+	*
+	*    Each stage has one queue per load request priority and always serves the most important load request first. Load requests
+	*    can be reprioritized or cancelled while they're in-flight, the current priority is honored as soon as a load request enters
+	*    the next stage. Cancelled load requests skip all remaining work and just release their resource loader instance.
+	*
+	*    A resource loader which is already running can't be interrupted. So destroying a resource which is still in-flight is deferred
+	*    until the cancelled load request has been finalized by "Renderer::ResourceStreamer::dispatch()", else the resource loader would
+	*    write into a destroyed resource or even into a different resource reusing its memory.
 	*/
 	class ResourceStreamer final
 	{
@@ -108,6 +119,40 @@ namespace Renderer
 	//[ Public definitions                                    ]
 	//[-------------------------------------------------------]
 	public:
+		/**
+		*  @brief
+		*    Load request priority, the resource streamer always serves more important load requests first
+		*
+		*  @note
+		*    - Usually derived from e.g. the camera distance or the screen size of the resource users
+		*/
+		enum class LoadRequestPriority : uint8_t
+		{
+			CRITICAL,	///< Required right now and there's no fallback, e.g. resources the next frame can't be rendered without
+			HIGH,		///< Visible and close to the camera respectively large on screen
+			NORMAL,		///< Default
+			LOW,		///< Far away respectively small on screen, or prefetching
+			NUMBER_OF_PRIORITIES
+		};
+
+		/**
+		*  @brief
+		*    In-flight state shared by the worker threads and the thread committing and dispatching the load request
+		*
+		*  @note
+		*    - Owned by the resource streamer, lives as long as the load request is in-flight
+		*/
+		struct LoadRequestState final
+		{
+			std::atomic<uint8_t>	priority;				///< "Renderer::ResourceStreamer::LoadRequestPriority"
+			std::atomic<bool>		cancelled;				///< "true" if the remaining work of the load request is skipped, else "false"
+			// Only touched by the thread calling "Renderer::ResourceStreamer::dispatch()"
+			uint32_t				numberOfLoadRequests;	///< Number of in-flight load requests sharing this state
+			bool					destroyResource;		///< "true" if the resource is destroyed as soon as the last load request sharing this state has been finalized, else "false"
+			const IResourceManager*	resourceManager;		///< Resource manager of the loaded resource, do not destroy the instance
+			ResourceId				resourceId;
+		};
+
 		struct LoadRequest final
 		{
 			// Data provided from the outside
@@ -116,23 +161,48 @@ namespace Renderer
 			bool				 reload;				///< "true" if the resource is new in memory, else "false" for reload an already loaded resource (and e.g. update cache entries)
 			IResourceManager*	 resourceManager;		///< Must be valid, do not destroy the instance
 			ResourceId			 resourceId;			///< Must be valid
+			LoadRequestPriority	 priority;				///< Initial priority, use "Renderer::ResourceStreamer::setLoadRequestPriority()" to change it while the load request is in-flight
 			// In-flight data
 			mutable IResourceLoader* resourceLoader;	///< Null pointer at first, must be valid as soon as the load request is in-flight, do not destroy the instance
 			bool					 loadingFailed;		///< "true" if loading failed, else "false"
+			LoadRequestState*		 state;				///< Null pointer at first, set by "Renderer::ResourceStreamer::commitLoadRequest()", do not destroy the instance
 
 			// Methods
-			inline LoadRequest(const Asset& _asset, ResourceLoaderTypeId _resourceLoaderTypeId, bool _reload, IResourceManager& _resourceManager, ResourceId _resourceId) :
+			inline LoadRequest() :
+				asset(nullptr),
+				resourceLoaderTypeId(),
+				reload(false),
+				resourceManager(nullptr),
+				resourceId(getInvalid<ResourceId>()),
+				priority(LoadRequestPriority::NORMAL),
+				resourceLoader(nullptr),
+				loadingFailed(false),
+				state(nullptr)
+			{
+				// Nothing here, required by "Renderer::BoundedMpmcQueue"
+			}
+			inline LoadRequest(const Asset& _asset, ResourceLoaderTypeId _resourceLoaderTypeId, bool _reload, IResourceManager& _resourceManager, ResourceId _resourceId, LoadRequestPriority _priority = LoadRequestPriority::NORMAL) :
 				asset(&_asset),
 				resourceLoaderTypeId(_resourceLoaderTypeId),
 				reload(_reload),
 				resourceManager(&_resourceManager),
 				resourceId(_resourceId),
+				priority(_priority),
 				resourceLoader(nullptr),
-				loadingFailed(false)
+				loadingFailed(false),
+				state(nullptr)
 			{
 				// Nothing here
 			}
 			[[nodiscard]] IResource& getResource() const;
+			[[nodiscard]] inline uint8_t getCurrentPriority() const
+			{
+				return (nullptr != state) ? state->priority.load(std::memory_order_relaxed) : static_cast<uint8_t>(priority);
+			}
+			[[nodiscard]] inline bool isCancelled() const
+			{
+				return (nullptr != state && state->cancelled.load(std::memory_order_relaxed));
+			}
 		};
 
 
@@ -145,7 +215,70 @@ namespace Renderer
 			return mNumberOfInFlightLoadRequests;
 		}
 
+		[[nodiscard]] inline uint32_t getNumberOfDeserializationThreads() const
+		{
+			return static_cast<uint32_t>(mDeserializationThreads.size());
+		}
+
+		[[nodiscard]] inline uint32_t getNumberOfProcessingThreads() const
+		{
+			return static_cast<uint32_t>(mProcessingThreads.size());
+		}
+
+		/**
+		*  @brief
+		*    Set the number of worker threads of the asynchronous resource streamer stages
+		*
+		*  @param[in] numberOfDeserializationThreads
+		*    Number of threads for stage 1, asynchronous deserialization, invalid value for choosing automatically depending on the number of hardware threads
+		*  @param[in] numberOfProcessingThreads
+		*    Number of threads for stage 2, asynchronous processing, invalid value for choosing automatically depending on the number of hardware threads
+		*
+		*  @note
+		*    - The current worker threads finish their current load request before they're replaced, in-flight load requests aren't lost
+		*    - Resource loaders must be able to run concurrently with other instances of the same resource loader type when using more than one thread per stage
+		*/
+		void setNumberOfThreads(uint32_t numberOfDeserializationThreads, uint32_t numberOfProcessingThreads);
+
 		void commitLoadRequest(const LoadRequest& loadRequest);
+
+		/**
+		*  @brief
+		*    Change the priority of an in-flight load request
+		*
+		*  @param[in] resourceManager
+		*    Resource manager of the resource to change the load request priority for
+		*  @param[in] resourceId
+		*    ID of the resource to change the load request priority for, if there's no in-flight load request for this resource nothing happens
+		*  @param[in] loadRequestPriority
+		*    New load request priority, honored as soon as the load request enters the next resource streamer stage
+		*
+		*  @note
+		*    - Must be called by the thread calling "Renderer::ResourceStreamer::dispatch()"
+		*/
+		void setLoadRequestPriority(const IResourceManager& resourceManager, ResourceId resourceId, LoadRequestPriority loadRequestPriority);
+
+		/**
+		*  @brief
+		*    Cancel an in-flight load request
+		*
+		*  @param[in] resourceManager
+		*    Resource manager of the resource to cancel the load request for
+		*  @param[in] resourceId
+		*    ID of the resource to cancel the load request for, if there's no in-flight load request for this resource nothing happens
+		*  @param[in] destroyResource
+		*    "true" to destroy the resource via "Renderer::IResourceManager::destroyResourceByResourceId()" as soon as the load request has been finalized, else "false"
+		*
+		*  @return
+		*    "true" if there was an in-flight load request which is now cancelled, else "false"
+		*
+		*  @note
+		*    - Must be called by the thread calling "Renderer::ResourceStreamer::dispatch()"
+		*    - Resource managers must not destroy a resource this method returned "true" for, a resource loader might still be working on it
+		*    - If the resource isn't destroyed, its resource loading state is set back to "Renderer::IResource::LoadingState::UNLOADED" as soon as the load request is finalized
+		*/
+		[[nodiscard]] bool cancelLoadRequest(const IResourceManager& resourceManager, ResourceId resourceId, bool destroyResource);
+
 		void flushAllQueues();
 
 		/**
@@ -162,12 +295,22 @@ namespace Renderer
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
 	private:
-		explicit ResourceStreamer(IRenderer& renderer);
+		ResourceStreamer(IRenderer& renderer, uint32_t numberOfDeserializationThreads = getInvalid<uint32_t>(), uint32_t numberOfProcessingThreads = getInvalid<uint32_t>());
 		~ResourceStreamer();
 		explicit ResourceStreamer(const ResourceStreamer&) = delete;
 		ResourceStreamer& operator=(const ResourceStreamer&) = delete;
+		void startThreads(uint32_t numberOfDeserializationThreads, uint32_t numberOfProcessingThreads);
+		void stopThreads();
+		[[nodiscard]] LoadRequestState* tryGetLoadRequestState(const IResourceManager& resourceManager, ResourceId resourceId) const;
+		void detachLoadRequestState(const LoadRequestState& loadRequestState);
+		void releaseLoadRequestState(const LoadRequest& loadRequest);
+		void pushDeserializationQueue(const LoadRequest& loadRequest);
+		void pushProcessingQueue(const LoadRequest& loadRequest);
+		void pushDispatchQueue(const LoadRequest& loadRequest);
+		[[nodiscard]] bool popDeserializationQueue(LoadRequest& loadRequest);
 		void deserializationThreadWorker();
 		void processingThreadWorker();
+		void deserializeLoadRequest(LoadRequest& loadRequest);
 		void finalizeLoadRequest(const LoadRequest& loadRequest);
 
 
@@ -184,6 +327,63 @@ namespace Renderer
 			LoadRequests	waitingLoadRequests;
 		};
 		typedef std::unordered_map<uint32_t, ResourceLoaderType> ResourceLoaderTypeManager;	///< Key = "Renderer::ResourceLoaderTypeId"
+		typedef std::vector<std::thread> Threads;
+		typedef std::deque<LoadRequestState> LoadRequestStates;			///< Deque for stable addresses
+		typedef std::vector<LoadRequestState*> FreeLoadRequestStates;
+		typedef std::unordered_multimap<ResourceId, LoadRequestState*> LoadRequestStateManager;	///< Resource IDs are only unique per resource manager, hence a multimap
+
+		/**
+		*  @brief
+		*    Bounded lock-free queues of a resource streamer stage, one per load request priority
+		*/
+		class LoadRequestQueues final
+		{
+		public:
+			[[nodiscard]] inline bool isEmpty() const
+			{
+				for (const Queue& queue : mQueues)
+				{
+					if (!queue.isEmpty())
+					{
+						return false;
+					}
+				}
+				return true;
+			}
+			[[nodiscard]] inline bool tryPush(const LoadRequest& loadRequest)
+			{
+				return mQueues[loadRequest.getCurrentPriority()].tryPush(loadRequest);
+			}
+			[[nodiscard]] inline bool tryPop(LoadRequest& loadRequest)
+			{
+				// Most important load requests first
+				for (Queue& queue : mQueues)
+				{
+					if (queue.tryPop(loadRequest))
+					{
+						return true;
+					}
+				}
+				return false;
+			}
+		private:
+			typedef BoundedMpmcQueue<LoadRequest, 256> Queue;
+			Queue mQueues[static_cast<uint8_t>(LoadRequestPriority::NUMBER_OF_PRIORITIES)];
+		};
+
+		/**
+		*  @brief
+		*    Wakeup of idle worker threads of an asynchronous resource streamer stage
+		*
+		*  @note
+		*    - The mutex is only used to go to sleep, the load requests themselves are passed through the lock-free queue
+		*/
+		struct StageWakeup final
+		{
+			std::mutex				mutex;
+			std::condition_variable conditionVariable;
+			std::atomic<uint32_t>	numberOfSleepingThreads{0};
+		};
 
 
 	//[-------------------------------------------------------]
@@ -193,25 +393,27 @@ namespace Renderer
 		IRenderer&			  mRenderer;	///< Renderer instance, do not destroy the instance
 		std::mutex			  mResourceManagerMutex;
 		std::atomic<uint32_t> mNumberOfInFlightLoadRequests;
+		std::atomic<bool>	  mShutdownThreads;
+		// Load request states, only touched by the thread calling "Renderer::ResourceStreamer::dispatch()"
+		LoadRequestStates		mLoadRequestStates;
+		FreeLoadRequestStates	mFreeLoadRequestStates;
+		LoadRequestStateManager	mLoadRequestStateManager;
 		// Resource streamer stage: 1. Asynchronous deserialization
-		std::atomic<bool>		    mShutdownDeserializationThread;
-		std::mutex					mDeserializationMutex;
-		std::condition_variable		mDeserializationConditionVariable;
-		LoadRequests				mDeserializationQueue;
+		LoadRequestQueues			mDeserializationQueue;
+		std::mutex					mDeserializationOverflowMutex;
+		LoadRequests				mDeserializationOverflowQueue;			///< Only used if "mDeserializationQueue" is full, do only touch if "mDeserializationOverflowMutex" is locked
+		std::atomic<uint32_t>		mNumberOfDeserializationOverflowRequests;
+		StageWakeup					mDeserializationWakeup;
 		ResourceLoaderTypeManager	mResourceLoaderTypeManager;	// Do only touch if "mResourceManagerMutex" is locked
 		std::atomic<uint32_t>		mDeserializationWaitingQueueRequests;
-		std::thread					mDeserializationThread;
+		Threads						mDeserializationThreads;
 		// Resource streamer stage: 2. Asynchronous processing
-		std::atomic<bool>		mShutdownProcessingThread;
-		std::mutex				mProcessingMutex;
-		std::condition_variable mProcessingConditionVariable;
-		LoadRequests			mProcessingQueue;
-		std::thread				mProcessingThread;
+		LoadRequestQueues mProcessingQueue;
+		StageWakeup		  mProcessingWakeup;
+		Threads			  mProcessingThreads;
 		// Resource streamer stage: 3. Synchronous dispatch to e.g. the RHI implementation
-		std::mutex	 mDispatchMutex;
-		LoadRequests mDispatchQueue;
-		LoadRequests mFullyLoadedWaitingQueue;
-
+		LoadRequestQueues mDispatchQueue;
+		LoadRequests	  mFullyLoadedWaitingQueue;	///< Only touched by the thread calling "Renderer::ResourceStreamer::dispatch()"
 
 	};
 
@@ -23,12 +23,14 @@
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/Scene/Culling/SceneCullingManager.h"
 #include "Renderer/Public/Resource/Scene/Culling/SceneItemSet.h"
+#include "Renderer/Public/Resource/Scene/Culling/SceneItemOctree.h"
 #include "Renderer/Public/Resource/Scene/Item/Camera/CameraSceneItem.h"
 #include "Renderer/Public/Resource/Scene/SceneNode.h"
 #include "Renderer/Public/Resource/CompositorWorkspace/CompositorContextData.h"
 #include "Renderer/Public/Resource/CompositorWorkspace/CompositorWorkspaceInstance.h"
 #include "Renderer/Public/RenderQueue/RenderableManager.h"
-#include "Renderer/Public/Core/Thread/ThreadPool.h"
+#include "Renderer/Public/Resource/Mesh/MeshResourceManager.h"
+#include "Renderer/Public/Core/Thread/JobSystem.h"
 #include "Renderer/Public/Core/Math/Math.h"
 #include "Renderer/Public/Core/Math/Frustum.h"
 #ifdef RENDERER_OPENVR
@@ -37,6 +39,26 @@
 #include "Renderer/Public/IRenderer.h"
 #include "Renderer/Public/Context.h"
 
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4100)	// warning C4100: 'address': unreferenced formal parameter
+	PRAGMA_WARNING_DISABLE_MSVC(4242)	// warning C4242: '=': conversion from 'int' to 'T', possible loss of data
+	PRAGMA_WARNING_DISABLE_MSVC(4244)	// warning C4244: '=': conversion from 'int' to 'T', possible loss of data
+	PRAGMA_WARNING_DISABLE_MSVC(4324)	// warning C4324: 'xsimd::hadd::<unnamed-tag>': structure was padded due to alignment specifier
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: '=': conversion from 'uint32_t' to 'int32_t', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	PRAGMA_WARNING_DISABLE_MSVC(4505)	// warning C4505: 'xsimd::detail::__ieee754_rem_pio2': unreferenced local function has been removed
+	PRAGMA_WARNING_DISABLE_MSVC(4530)	// warning C4530: C++ exception handler used, but unwind semantics are not enabled. Specify /EHsc
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt_base': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#define XSIMD_INSTR_SET_NOT_AVAILABLE 0	// warning C4668: 'XSIMD_INSTR_SET_NOT_AVAILABLE' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#define XSIMD_FORCE_X86_INSTR_SET XSIMD_X86_SSE4_2_VERSION	// TODO(co) How to use xsimd correctly to get rid of errors like "error C2440: 'initializing': cannot convert from 'xsimd::simd_batch_traits<xsimd::batch<float,8>>::batch_bool_type' to 'xsimd::batch_bool<float,4>'" when using "Advanced Vector Extensions 2 (/arch:AVX2)"?
+	#include <xsimd/xsimd.hpp>
+PRAGMA_WARNING_POP
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -50,12 +72,15 @@ namespace
 		//[-------------------------------------------------------]
 		//[ Global definitions                                    ]
 		//[-------------------------------------------------------]
-		static constexpr size_t SCENE_ITEMS_SPLIT_COUNT = 256;	///< Package size for each thread to work on	TODO(co) This value needs to be fine-tuned
+		static constexpr uint32_t SCENE_ITEMS_GRANULARITY = 256;	///< Minimum package size for each job to work on, must be a multiple of the SIMD lane count	TODO(co) This value needs to be fine-tuned
 		typedef xsimd::batch_bool<float, 4> bool4;
 		typedef xsimd::simd_type<float> float4;
+		static_assert(Renderer::SCENE_ITEM_SET_SIMD_LANE_COUNT == float4::size, "The scene item set arrays must be padded to the SIMD lane count");
+		static_assert(Renderer::SCENE_ITEM_SET_SIMD_ALIGNMENT >= XSIMD_DEFAULT_ALIGNMENT, "The scene item set arrays must be aligned for aligned SIMD loads and stores");
 		static const float4 FLOAT4_ALL_ZERO(0.0f);
 		static const bool4 BOOL4_ALL_FALSE(false);
 		static const bool4 BOOL4_ALL_TRUE(true);
+		static constexpr float STEREO_CULLING_WIDEN_ANGLE = 0.0872664626f;	///< 5 degrees in radians, single pass stereo rendering: "You must conservatively cull on the CPU by about 5 degrees" - http://media.steampowered.com/apps/valve/2015/Alex_Vlachos_Advanced_VR_Rendering_GDC2015.pdf
 		struct SimdPlane final
 		{
 			float4 normalX;	///< The normal's x value replicated 4 times
@@ -87,18 +112,29 @@ namespace
 			return Renderer::Math::makeMultipleOf(value, xsimd::simd_type<float>::size);
 		}
 
-		[[nodiscard]] uint32_t removeNotVisible(const Renderer::SceneItemSet& sceneItemSet, uint32_t count, const uint32_t* inputIndirection, uint32_t* outputIndirection)
+		void padToSimdLaneCount(uint32_t numberOfItems, uint32_t* indirection)
+		{
+			// Pad out to the SIMD alignment by repeating the last item
+			const uint32_t numberOfItemsAligned = alignToSimdLaneCount(numberOfItems);
+			const uint32_t lastItem = numberOfItems ? indirection[numberOfItems - 1] : 0;
+			for (uint32_t i = numberOfItems; i < numberOfItemsAligned; ++i)
+			{
+				indirection[i] = lastItem;
+			}
+		}
+
+		[[nodiscard]] uint32_t removeNotVisible(const Renderer::SceneItemSetView& sceneItemSetView, uint32_t count, const uint32_t* inputIndirection, uint32_t* outputIndirection)
 		{
-			const uint32_t* RESTRICT visibilityFlag = sceneItemSet.visibilityFlag.data();
+			const uint32_t* RESTRICT visibilityFlag = sceneItemSetView.visibilityFlag;
 			uint32_t numberOfVisibleItems = 0u;
 			if (nullptr != inputIndirection)
 			{
+				// Culling using an indirection stores the visibility flags in a compacted way, meaning at the indirection index
 				for (uint32_t i = 0; i < count; ++i)
 				{
-					const uint32_t index = inputIndirection[i];
-					if (visibilityFlag[index])
+					if (visibilityFlag[i])
 					{
-						outputIndirection[numberOfVisibleItems] = index;
+						outputIndirection[numberOfVisibleItems] = inputIndirection[i];
 						++numberOfVisibleItems;
 					}
 				}
@@ -116,12 +152,7 @@ namespace
 			}
 
 			// Pad out to the SIMD alignment
-			const uint32_t numberOfVisibleItemsAligned = alignToSimdLaneCount(numberOfVisibleItems);
-			const uint32_t lastVisibleItem = numberOfVisibleItems ? outputIndirection[numberOfVisibleItems - 1] : 0;
-			for (uint32_t i = numberOfVisibleItems; i < numberOfVisibleItemsAligned; ++i)
-			{
-				outputIndirection[i] = lastVisibleItem;
-			}
+			padToSimdLaneCount(numberOfVisibleItems, outputIndirection);
 
 			return numberOfVisibleItems;
 		}
@@ -135,6 +166,29 @@ namespace
 			return { x, y, z, w };
 		}
 
+		[[nodiscard]] FORCEINLINE bool4 simdSphereInsideFrustum(const float4& spherePositionX, const float4& spherePositionY, const float4& spherePositionZ, const float4& negativeRadius, const SimdPlane planes[6])
+		{
+			bool4 inside = BOOL4_ALL_TRUE;
+			for (uint32_t p = 0; p < 6; ++p)
+			{
+				const float4& RESTRICT n_x = planes[p].normalX;
+				const float4& RESTRICT n_y = planes[p].normalY;
+				const float4& RESTRICT n_z = planes[p].normalZ;
+				const float4 n_dot_pos = (spherePositionX * n_x) + (spherePositionY * n_y) + (spherePositionZ * n_z);
+
+				// "The Implementation of Frustum Culling in Stingray" - http://bitsquid.blogspot.de/2016/10/the-implementation-of-frustum-culling.html is using the following
+				// float4 planeTestPoint = n_dot_pos + radius;
+				// bool4 planeTest = (planeTestPoint >= planes[p].d);
+
+				// "Frustum Culling" by Dion Picco - http://www.flipcode.com/archives/Frustum_Culling.shtml worked TODO(co) Figure out the difference
+				const float4 planeTestPoint = n_dot_pos + planes[p].d;
+				const bool4 planeTest = (planeTestPoint > negativeRadius);
+
+				inside = (planeTest & inside);
+			}
+			return inside;
+		}
+
 		[[nodiscard]] SimdMatrix simdMultiply(const SimdMatrix& lhs, const SimdMatrix& rhs)
 		{
 			const SimdVector x = simdMultiply(lhs.x, rhs);
@@ -265,7 +319,12 @@ namespace
 			}
 		}
 
-		FORCEINLINE void gatherRenderQueueIndexRangesRenderableManagersBySceneItem(Renderer::ISceneItem& sceneItem, const glm::dvec3& cameraPosition, Renderer::CompositorWorkspaceInstance::RenderQueueIndexRanges& renderQueueIndexRanges, std::vector<Renderer::ISceneItem*>& executeOnRenderingSceneItems)
+		[[nodiscard]] inline float getInverseTanHalfFovY(const Renderer::CameraSceneItem& cameraSceneItem)
+		{
+			return 1.0f / std::tan(cameraSceneItem.getFovY() * 0.5f);
+		}
+
+		FORCEINLINE void gatherRenderQueueIndexRangesRenderableManagersBySceneItem(Renderer::ISceneItem& sceneItem, const glm::dvec3& cameraPosition, float inverseTanHalfFovY, float lodBias, Renderer::CompositorWorkspaceInstance::RenderQueueIndexRanges& renderQueueIndexRanges, std::vector<Renderer::ISceneItem*>& executeOnRenderingSceneItems)
 		{
 			Renderer::RenderableManager* renderableManager = const_cast<Renderer::RenderableManager*>(sceneItem.getRenderableManager());	// TODO(co) Get rid of the evil const-cast
 			if (nullptr != renderableManager && renderableManager->isVisible() && !renderableManager->getRenderables().empty())
@@ -289,6 +348,9 @@ namespace
 					// -> While using a 64 bit world space position, a 32 bit distance to camera is sufficient
 					renderableManager->setCachedDistanceToCamera(static_cast<float>(glm::distance(cameraPosition, sceneItem.getParentSceneNodeSafe().getGlobalTransform().position)));
 
+					// Select the LOD using the projected bounding sphere size
+					renderableManager->updateCachedLodIndex(inverseTanHalfFovY, lodBias);
+
 					// Execute scene item on rendering?
 					if (sceneItem.getCallExecuteOnRendering())
 					{
@@ -303,13 +365,14 @@ namespace
 		//[-------------------------------------------------------]
 		//[ Global thread functions                               ]
 		//[-------------------------------------------------------]
-		void simdSphereCulling(const float4 worldSpaceCameraPosition[3], const SimdPlane planes[6], const Renderer::SceneItemSet& sceneItemSet, size_t threadSceneItemIndexStart, size_t threadSceneItemIndexEnd, uint32_t* RESTRICT visibilityFlag)
+		void simdSphereCulling(const float4 worldSpaceCameraPosition[3], const SimdPlane planes[6], const Renderer::SceneItemSetView& sceneItemSetView, size_t threadSceneItemIndexStart, size_t threadSceneItemIndexEnd)
 		{
 			// Get pointers to the necessary members of the object set
-			const float* RESTRICT spherePositionXData = sceneItemSet.spherePositionX.data();
-			const float* RESTRICT spherePositionYData = sceneItemSet.spherePositionY.data();
-			const float* RESTRICT spherePositionZData = sceneItemSet.spherePositionZ.data();
-			const float* RESTRICT negativeRadiusData = sceneItemSet.negativeRadius.data();
+			const float* RESTRICT spherePositionXData = sceneItemSetView.spherePositionX;
+			const float* RESTRICT spherePositionYData = sceneItemSetView.spherePositionY;
+			const float* RESTRICT spherePositionZData = sceneItemSetView.spherePositionZ;
+			const float* RESTRICT negativeRadiusData = sceneItemSetView.negativeRadius;
+			uint32_t* RESTRICT visibilityFlag = sceneItemSetView.visibilityFlag;
 
 			// Test each plane of the frustum against each sphere
 			constexpr std::size_t simdSize = xsimd::simd_type<float>::size;
@@ -336,63 +399,94 @@ namespace
 				// Get negative world space radius of bounding sphere
 				const float4 negativeRadius = xsimd::load_aligned(&negativeRadiusData[sceneItemIndex]);
 
-				bool4 inside = BOOL4_ALL_TRUE;
-				for (uint32_t p = 0; p < 6; ++p)
-				{
-					const float4& RESTRICT n_x = planes[p].normalX;
-					const float4& RESTRICT n_y = planes[p].normalY;
-					const float4& RESTRICT n_z = planes[p].normalZ;
-					const float4 n_dot_pos = (spherePositionX * n_x) + (spherePositionY * n_y) + (spherePositionZ * n_z);
+				// Store 0 for spheres that didn't intersect or ended up on the positive side of the frustum planes
+				// -> Store 0xffffffff for spheres that are visible
+				xsimd::store_aligned(reinterpret_cast<bool4*>(&visibilityFlag[sceneItemIndex]), simdSphereInsideFrustum(spherePositionX, spherePositionY, spherePositionZ, negativeRadius, planes));
+			}
+		}
 
-					// "The Implementation of Frustum Culling in Stingray" - http://bitsquid.blogspot.de/2016/10/the-implementation-of-frustum-culling.html is using the following
-					// float4 planeTestPoint = n_dot_pos + radius;
-					// bool4 planeTest = (planeTestPoint >= planes[p].d);
+		void simdSphereCullingIndirection(const float4 worldSpaceCameraPosition[3], const SimdPlane planes[6], const Renderer::SceneItemSetView& sceneItemSetView, const uint32_t* RESTRICT indirection, size_t threadSceneItemIndexStart, size_t threadSceneItemIndexEnd)
+		{
+			// Get pointers to the necessary members of the object set
+			const float* RESTRICT spherePositionXData = sceneItemSetView.spherePositionX;
+			const float* RESTRICT spherePositionYData = sceneItemSetView.spherePositionY;
+			const float* RESTRICT spherePositionZData = sceneItemSetView.spherePositionZ;
+			const float* RESTRICT negativeRadiusData = sceneItemSetView.negativeRadius;
+			uint32_t* RESTRICT visibilityFlag = sceneItemSetView.visibilityFlag;
 
-					// "Frustum Culling" by Dion Picco - http://www.flipcode.com/archives/Frustum_Culling.shtml worked TODO(co) Figure out the difference
-					const float4 planeTestPoint = n_dot_pos + planes[p].d;
-					const bool4 planeTest = (planeTestPoint > negativeRadius);
+			// Test each plane of the frustum against each sphere
+			constexpr std::size_t simdSize = xsimd::simd_type<float>::size;
+			for (size_t sceneItemIndex = threadSceneItemIndexStart; sceneItemIndex < threadSceneItemIndexEnd; sceneItemIndex += simdSize)
+			{
+				// Load the bounding spheres for four objects via the indirection table
+				const uint32_t i0 = indirection[sceneItemIndex];
+				const uint32_t i1 = indirection[sceneItemIndex + 1];
+				const uint32_t i2 = indirection[sceneItemIndex + 2];
+				const uint32_t i3 = indirection[sceneItemIndex + 3];
 
-					inside = (planeTest & inside);
+				#if defined(XSIMD_X86_INSTR_SET_AVAILABLE)
+				{ // Prefetch data for the next loop iteration in order to try to hide memory latency
+					// TODO(co) Optimization: This has been added without profiling. As soon as there's enough data do profiling here.
+					const size_t nextIndirectionIndex = sceneItemIndex + simdSize;
+					for (size_t componentIndex = 0; componentIndex < 4; ++componentIndex)
+					{
+						const uint32_t nextIndex = indirection[nextIndirectionIndex + componentIndex];
+						xsimd::prefetch(&spherePositionXData[nextIndex]);
+						xsimd::prefetch(&spherePositionYData[nextIndex]);
+						xsimd::prefetch(&spherePositionZData[nextIndex]);
+						xsimd::prefetch(&negativeRadiusData[nextIndex]);
+					}
 				}
+				#endif
 
-				// Store 0 for spheres that didn't intersect or ended up on the positive side of the frustum planes
-				// -> Store 0xffffffff for spheres that are visible
-				xsimd::store_aligned(reinterpret_cast<bool4*>(&visibilityFlag[sceneItemIndex]), inside);
+				// Get camera relative world space center position of bounding sphere
+				const float4 spherePositionX = float4(spherePositionXData[i0], spherePositionXData[i1], spherePositionXData[i2], spherePositionXData[i3]) - worldSpaceCameraPosition[0];
+				const float4 spherePositionY = float4(spherePositionYData[i0], spherePositionYData[i1], spherePositionYData[i2], spherePositionYData[i3]) - worldSpaceCameraPosition[1];
+				const float4 spherePositionZ = float4(spherePositionZData[i0], spherePositionZData[i1], spherePositionZData[i2], spherePositionZData[i3]) - worldSpaceCameraPosition[2];
+
+				// Get negative world space radius of bounding sphere
+				const float4 negativeRadius = float4(negativeRadiusData[i0], negativeRadiusData[i1], negativeRadiusData[i2], negativeRadiusData[i3]);
+
+				// Store the result in the "visibilityFlag"-array in a compacted way
+				xsimd::store_aligned(reinterpret_cast<bool4*>(&visibilityFlag[sceneItemIndex]), simdSphereInsideFrustum(spherePositionX, spherePositionY, spherePositionZ, negativeRadius, planes));
 			}
 		}
 
-		void simdOobbCulling([[maybe_unused]] const float4 worldSpaceCameraPositionFloat4[3], const SimdMatrix& viewSpaceToClipSpaceMatrix, const Renderer::SceneItemSet& sceneItemSet, const uint32_t* RESTRICT indirection, size_t threadSceneItemIndexStart, size_t threadSceneItemIndexEnd, uint32_t* RESTRICT visibilityFlag)
+		void simdOobbCulling(const SimdMatrix& viewSpaceToClipSpaceMatrix, const Renderer::SceneItemSetView& sceneItemSetView, const uint32_t* RESTRICT indirection, size_t threadSceneItemIndexStart, size_t threadSceneItemIndexEnd)
 		{
 			// Get pointers to the necessary members of the object set
 
 			// Get minimum object space bounding box corner position
-			const float* RESTRICT minimumX = sceneItemSet.minimumX.data();
-			const float* RESTRICT minimumY = sceneItemSet.minimumY.data();
-			const float* RESTRICT minimumZ = sceneItemSet.minimumZ.data();
+			const float* RESTRICT minimumX = sceneItemSetView.minimumX;
+			const float* RESTRICT minimumY = sceneItemSetView.minimumY;
+			const float* RESTRICT minimumZ = sceneItemSetView.minimumZ;
 
 			// Get maximum object space bounding box corner position
-			const float* RESTRICT maximumX = sceneItemSet.maximumX.data();
-			const float* RESTRICT maximumY = sceneItemSet.maximumY.data();
-			const float* RESTRICT maximumZ = sceneItemSet.maximumZ.data();
+			const float* RESTRICT maximumX = sceneItemSetView.maximumX;
+			const float* RESTRICT maximumY = sceneItemSetView.maximumY;
+			const float* RESTRICT maximumZ = sceneItemSetView.maximumZ;
 
-			// TODO(co) Add camera relative rendering ("worldSpaceCameraPositionFloat4") and 64 bit world space position support
+			// TODO(co) Add camera relative rendering and 64 bit world space position support
 			// Get object space to world space matrix
-			const float* RESTRICT worldXX = sceneItemSet.worldXX.data();
-			const float* RESTRICT worldXY = sceneItemSet.worldXY.data();
-			const float* RESTRICT worldXZ = sceneItemSet.worldXZ.data();
-			const float* RESTRICT worldXW = sceneItemSet.worldXW.data();
-			const float* RESTRICT worldYX = sceneItemSet.worldYX.data();
-			const float* RESTRICT worldYY = sceneItemSet.worldYY.data();
-			const float* RESTRICT worldYZ = sceneItemSet.worldYZ.data();
-			const float* RESTRICT worldYW = sceneItemSet.worldYW.data();
-			const float* RESTRICT worldZX = sceneItemSet.worldZX.data();
-			const float* RESTRICT worldZY = sceneItemSet.worldZY.data();
-			const float* RESTRICT worldZZ = sceneItemSet.worldZZ.data();
-			const float* RESTRICT worldZW = sceneItemSet.worldZW.data();
-			const float* RESTRICT worldWX = sceneItemSet.worldWX.data();
-			const float* RESTRICT worldWY = sceneItemSet.worldWY.data();
-			const float* RESTRICT worldWZ = sceneItemSet.worldWZ.data();
-			const float* RESTRICT worldWW = sceneItemSet.worldWW.data();
+			const float* RESTRICT worldXX = sceneItemSetView.worldXX;
+			const float* RESTRICT worldXY = sceneItemSetView.worldXY;
+			const float* RESTRICT worldXZ = sceneItemSetView.worldXZ;
+			const float* RESTRICT worldXW = sceneItemSetView.worldXW;
+			const float* RESTRICT worldYX = sceneItemSetView.worldYX;
+			const float* RESTRICT worldYY = sceneItemSetView.worldYY;
+			const float* RESTRICT worldYZ = sceneItemSetView.worldYZ;
+			const float* RESTRICT worldYW = sceneItemSetView.worldYW;
+			const float* RESTRICT worldZX = sceneItemSetView.worldZX;
+			const float* RESTRICT worldZY = sceneItemSetView.worldZY;
+			const float* RESTRICT worldZZ = sceneItemSetView.worldZZ;
+			const float* RESTRICT worldZW = sceneItemSetView.worldZW;
+			const float* RESTRICT worldWX = sceneItemSetView.worldWX;
+			const float* RESTRICT worldWY = sceneItemSetView.worldWY;
+			const float* RESTRICT worldWZ = sceneItemSetView.worldWZ;
+			const float* RESTRICT worldWW = sceneItemSetView.worldWW;
+
+			// Get visibility flag
+			uint32_t* RESTRICT visibilityFlag = sceneItemSetView.visibilityFlag;
 
 			constexpr std::size_t simdSize = xsimd::simd_type<float>::size;
 			for (size_t sceneItemIndex = threadSceneItemIndexStart; sceneItemIndex < threadSceneItemIndexEnd; sceneItemIndex += simdSize)
@@ -531,6 +625,75 @@ namespace
 			}
 		}
 
+		[[nodiscard]] uint32_t frustumSphereCulling(Renderer::JobSystem& jobSystem, const Renderer::Frustum& frustum, const glm::vec3& worldSpaceCameraPositionFloat, const Renderer::SceneItemSetView& sceneItemSetView, const Renderer::SceneItemOctree* sceneItemOctree, std::vector<uint32_t>& intersectingSceneItemIndices, std::vector<uint32_t>& insideSceneItemIndices, std::vector<uint32_t>& indirection)
+		{
+			// Splat out the camera position and the planes to be able to do plane-sphere test with SIMD
+			const float4 worldSpaceCameraPositionFloat4[3] = { float4(worldSpaceCameraPositionFloat.x), float4(worldSpaceCameraPositionFloat.y), float4(worldSpaceCameraPositionFloat.z) };
+			SimdPlane planes[Renderer::Frustum::NUMBER_OF_PLANES];
+			for (uint32_t planeIndex = 0; planeIndex < Renderer::Frustum::NUMBER_OF_PLANES; ++planeIndex)
+			{
+				const Renderer::Plane& plane = frustum.planes[planeIndex];
+				planes[planeIndex] = { float4(plane.normal.x), float4(plane.normal.y), float4(plane.normal.z), float4(plane.d) };
+			}
+
+			// Store the indices of the objects that passed the frustum-sphere culling in the indirection array
+			// -> Padded by the SIMD lane count since the frustum-OOBB culling is prefetching the indirection of the next loop iteration
+			indirection.resize(alignToSimdLaneCount(sceneItemSetView.numberOfSceneItems) + xsimd::simd_type<float>::size);
+			if (nullptr != sceneItemOctree)
+			{
+				// Hierarchical culling: Reject whole loose octree subtrees outside of the frustum
+				sceneItemOctree->gatherSceneItems(frustum, worldSpaceCameraPositionFloat, intersectingSceneItemIndices, insideSceneItemIndices);
+
+				// Do SIMD multi-threaded frustum-sphere culling on the scene items of the intersecting loose octree nodes
+				// -> Padded the same way as the indirection array
+				const uint32_t numberOfIntersectingSceneItems = static_cast<uint32_t>(intersectingSceneItemIndices.size());
+				intersectingSceneItemIndices.resize(alignToSimdLaneCount(numberOfIntersectingSceneItems) + xsimd::simd_type<float>::size, numberOfIntersectingSceneItems ? intersectingSceneItemIndices.back() : 0);
+				const uint32_t* intersectingIndirection = intersectingSceneItemIndices.data();
+				jobSystem.parallelFor(numberOfIntersectingSceneItems, SCENE_ITEMS_GRANULARITY, [&worldSpaceCameraPositionFloat4, &planes, &sceneItemSetView, intersectingIndirection](uint32_t startIndex, uint32_t endIndex)
+				{
+					simdSphereCullingIndirection(worldSpaceCameraPositionFloat4, planes, sceneItemSetView, intersectingIndirection, startIndex, endIndex);
+				});
+				uint32_t numberOfVisibleItems = removeNotVisible(sceneItemSetView, numberOfIntersectingSceneItems, intersectingIndirection, indirection.data());
+
+				// The scene items of loose octree nodes fully inside the frustum are known to pass the frustum-sphere culling
+				if (!insideSceneItemIndices.empty())
+				{
+					memcpy(&indirection[numberOfVisibleItems], insideSceneItemIndices.data(), sizeof(uint32_t) * insideSceneItemIndices.size());
+					numberOfVisibleItems += static_cast<uint32_t>(insideSceneItemIndices.size());
+					padToSimdLaneCount(numberOfVisibleItems, indirection.data());
+				}
+				return numberOfVisibleItems;
+			}
+			else
+			{
+				// Do SIMD multi-threaded frustum-sphere culling
+				jobSystem.parallelFor(sceneItemSetView.numberOfSceneItems, SCENE_ITEMS_GRANULARITY, [&worldSpaceCameraPositionFloat4, &planes, &sceneItemSetView](uint32_t startIndex, uint32_t endIndex)
+				{
+					simdSphereCulling(worldSpaceCameraPositionFloat4, planes, sceneItemSetView, startIndex, endIndex);
+				});
+				return removeNotVisible(sceneItemSetView, sceneItemSetView.numberOfSceneItems, nullptr, indirection.data());
+			}
+		}
+
+		#ifdef RENDERER_OPENVR
+			[[nodiscard]] Renderer::Frustum getConservativeStereoFrustum(const Renderer::IVrManager& vrManager, const Renderer::CameraSceneItem& cameraSceneItem)
+			{
+				// Gather the matrices of each eye, see "Renderer::MaterialBlueprintResourceListener" for the eye matrices
+				const glm::mat4 headSpaceToCameraRelativeWorldSpaceMatrix = glm::inverse(glm::inverse(vrManager.getHmdHeadSpaceToWorldSpaceMatrix()) * cameraSceneItem.getCameraRelativeWorldSpaceToViewSpaceMatrix());
+				const glm::mat4 eyeSpaceToCameraRelativeWorldSpaceMatrices[2] =
+				{
+					headSpaceToCameraRelativeWorldSpaceMatrix * vrManager.getHmdEyeSpaceToHeadSpaceMatrix(Renderer::IVrManager::VrEye::LEFT),
+					headSpaceToCameraRelativeWorldSpaceMatrix * vrManager.getHmdEyeSpaceToHeadSpaceMatrix(Renderer::IVrManager::VrEye::RIGHT)
+				};
+				const glm::mat4 viewSpaceToClipSpaceMatrices[2] =
+				{
+					vrManager.getHmdViewSpaceToClipSpaceMatrix(Renderer::IVrManager::VrEye::LEFT, cameraSceneItem.getNearZ(), cameraSceneItem.getFarZ()),
+					vrManager.getHmdViewSpaceToClipSpaceMatrix(Renderer::IVrManager::VrEye::RIGHT, cameraSceneItem.getNearZ(), cameraSceneItem.getFarZ())
+				};
+				return Renderer::SceneCullingManager::getConservativeStereoFrustum(eyeSpaceToCameraRelativeWorldSpaceMatrices, viewSpaceToClipSpaceMatrices);
+			}
+		#endif
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -546,20 +709,60 @@ namespace Renderer
 {
 
 
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	struct SceneCullingManager::ShadowCascadeCulling final
+	{
+		SceneItemSet::IntegerVector visibilityFlag;	///< Visibility flags of this shadow cascade, the ones of the scene item set are reserved for the camera culling
+		std::vector<uint32_t>		indirection;
+		std::vector<uint32_t>		intersectingSceneItemIndices;
+		std::vector<uint32_t>		insideSceneItemIndices;
+	};
+
+
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	Frustum SceneCullingManager::getConservativeStereoFrustum(const glm::mat4 eyeSpaceToCameraRelativeWorldSpaceMatrices[2], const glm::mat4 viewSpaceToClipSpaceMatrices[2])
+	{
+		// Calculate the camera relative world space frustum of each eye
+		const auto getEyeFrustum = [&](uint32_t eyeIndex)
+		{
+			const glm::mat4& eyeSpaceToCameraRelativeWorldSpaceMatrix = eyeSpaceToCameraRelativeWorldSpaceMatrices[eyeIndex];
+			Frustum frustum(viewSpaceToClipSpaceMatrices[eyeIndex] * glm::inverse(eyeSpaceToCameraRelativeWorldSpaceMatrix));
+
+			// Widen the eye frustum around the eye position to compensate for the late head pose update after culling
+			frustum.widen(glm::vec3(eyeSpaceToCameraRelativeWorldSpaceMatrix[3]), ::detail::STEREO_CULLING_WIDEN_ANGLE);
+			return frustum;
+		};
+
+		// Combine both eye frustums into a single conservative one which encloses both
+		return Frustum(getEyeFrustum(0), getEyeFrustum(1));
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
 	SceneCullingManager::SceneCullingManager() :
 		mCullableSceneItemSet(new SceneItemSet()),
-		mCullableShadowCastersSceneItemSet(new SceneItemSet())
+		mCullableSceneItemOctree(nullptr)
 	{
 		// Nothing here
 	}
 
 	SceneCullingManager::~SceneCullingManager()
 	{
+		delete mCullableSceneItemOctree;
 		delete mCullableSceneItemSet;
-		delete mCullableShadowCastersSceneItemSet;
+	}
+
+	void SceneCullingManager::setSceneItemOctreeEnabled(bool enabled, float rootHalfSize, uint32_t maximumDepth)
+	{
+		// Always recreate the loose octree so changed settings are taken into account, the loose octree is filled on the next culling
+		delete mCullableSceneItemOctree;
+		mCullableSceneItemOctree = enabled ? new SceneItemOctree(*mCullableSceneItemSet, rootHalfSize, maximumDepth) : nullptr;
 	}
 
 	void SceneCullingManager::gatherRenderQueueIndexRangesRenderableManagers(const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, CompositorWorkspaceInstance::RenderQueueIndexRanges& renderQueueIndexRanges, std::vector<ISceneItem*>& executeOnRenderingSceneItems)
@@ -581,231 +784,180 @@ namespace Renderer
 		RHI_ASSERT(renderer.getContext(), nullptr != compositorContextData.getCompositorWorkspaceInstance(), "Invalid compositor workspace instance")
 		glm::mat4 viewSpaceToClipSpaceMatrix;
 		{
-			#ifdef RENDERER_OPENVR
-				const IVrManager& vrManager = renderer.getVrManager();
-				if (compositorContextData.getSinglePassStereoInstancing() && vrManager.isRunning() && !cameraSceneItem->hasCustomWorldSpaceToViewSpaceMatrix() && !cameraSceneItem->hasCustomViewSpaceToClipSpaceMatrix())
-				{
-					// TODO(co) There are currently multiple culling issues notable when using stereo rendering, so disabled culling for now until this has been resolved
-					// Fill render queue index ranges with the visible stuff
-					const glm::dvec3& cameraPosition = cameraSceneItem->getParentSceneNodeSafe().getGlobalTransform().position;	// 64 bit world space position of the camera
-					for (uint32_t i = 0; i < mCullableSceneItemSet->numberOfSceneItems; ++i)
-					{
-						::detail::gatherRenderQueueIndexRangesRenderableManagersBySceneItem(*mCullableSceneItemSet->sceneItemVector[i], cameraPosition, renderQueueIndexRanges, executeOnRenderingSceneItems);
-					}
-					// Fill render queue index ranges with the always-visible stuff
-					for (ISceneItem* sceneItem : mUncullableSceneItems)
-					{
-						::detail::gatherRenderQueueIndexRangesRenderableManagersBySceneItem(*sceneItem, cameraPosition, renderQueueIndexRanges, executeOnRenderingSceneItems);
-					}
-					return;
-
-					// TODO(co) Single pass stereo rendering: "You must conservatively cull on the CPU by about 5 degrees": http://media.steampowered.com/apps/valve/2015/Alex_Vlachos_Advanced_VR_Rendering_GDC2015.pdf
-					// viewSpaceToClipSpaceMatrix = vrManager.getHmdViewSpaceToClipSpaceMatrix(IVrManager::VrEye::LEFT, cameraSceneItem->getNearZ(), cameraSceneItem->getFarZ());
-				}
-				else
-			#endif
-			{
-				// Get the render target with and height
-				uint32_t renderTargetWidth = 0;
-				uint32_t renderTargetHeight = 0;
-				renderTarget.getWidthAndHeight(renderTargetWidth, renderTargetHeight);
+			// Get the render target with and height
+			uint32_t renderTargetWidth = 0;
+			uint32_t renderTargetHeight = 0;
+			renderTarget.getWidthAndHeight(renderTargetWidth, renderTargetHeight);
 
-				// Get view space to clip space matrix
-				viewSpaceToClipSpaceMatrix = cameraSceneItem->getViewSpaceToClipSpaceMatrix(static_cast<float>(renderTargetWidth) / static_cast<float>(renderTargetHeight));
-			}
+			// Get view space to clip space matrix
+			viewSpaceToClipSpaceMatrix = cameraSceneItem->getViewSpaceToClipSpaceMatrix(static_cast<float>(renderTargetWidth) / static_cast<float>(renderTargetHeight));
 		}
 
 		// Calculate frustum using a camera relative world space to clip space matrix
-		const Frustum frustum(viewSpaceToClipSpaceMatrix * cameraSceneItem->getCameraRelativeWorldSpaceToViewSpaceMatrix());
+		// -> Single pass stereo rendering: Both eyes are rendered at once, so use a conservative frustum enclosing both slightly widened eye frustums
+		#ifdef RENDERER_OPENVR
+			const IVrManager& vrManager = renderer.getVrManager();
+			const bool singlePassStereoInstancing = (compositorContextData.getSinglePassStereoInstancing() && vrManager.isRunning() && !cameraSceneItem->hasCustomWorldSpaceToViewSpaceMatrix() && !cameraSceneItem->hasCustomViewSpaceToClipSpaceMatrix());
+			const Frustum frustum = singlePassStereoInstancing ? ::detail::getConservativeStereoFrustum(vrManager, *cameraSceneItem) : Frustum(viewSpaceToClipSpaceMatrix * cameraSceneItem->getCameraRelativeWorldSpaceToViewSpaceMatrix());
+		#else
+			static constexpr bool singlePassStereoInstancing = false;
+			const Frustum frustum(viewSpaceToClipSpaceMatrix * cameraSceneItem->getCameraRelativeWorldSpaceToViewSpaceMatrix());
+		#endif
 		const glm::vec3 worldSpaceCameraPositionFloat = cameraSceneItem->getWorldSpaceCameraPosition();
-		::detail::float4 worldSpaceCameraPositionFloat4[3] = { ::detail::float4(worldSpaceCameraPositionFloat.x), ::detail::float4(worldSpaceCameraPositionFloat.y), ::detail::float4(worldSpaceCameraPositionFloat.z) };
 
-		// Splat out the planes to be able to do plane-sphere test with SIMD
-		const ::detail::SimdPlane planes[6] =
-		{
-			// Left clipping plane
-			::detail::float4(frustum.planes[Frustum::PLANE_LEFT].normal.x),
-			::detail::float4(frustum.planes[Frustum::PLANE_LEFT].normal.y),
-			::detail::float4(frustum.planes[Frustum::PLANE_LEFT].normal.z),
-			::detail::float4(frustum.planes[Frustum::PLANE_LEFT].d),
-
-			// Right clipping plane
-			::detail::float4(frustum.planes[Frustum::PLANE_RIGHT].normal.x),
-			::detail::float4(frustum.planes[Frustum::PLANE_RIGHT].normal.y),
-			::detail::float4(frustum.planes[Frustum::PLANE_RIGHT].normal.z),
-			::detail::float4(frustum.planes[Frustum::PLANE_RIGHT].d),
-
-			// Top clipping plane
-			::detail::float4(frustum.planes[Frustum::PLANE_TOP].normal.x),
-			::detail::float4(frustum.planes[Frustum::PLANE_TOP].normal.y),
-			::detail::float4(frustum.planes[Frustum::PLANE_TOP].normal.z),
-			::detail::float4(frustum.planes[Frustum::PLANE_TOP].d),
-
-			// Bottom clipping plane
-			::detail::float4(frustum.planes[Frustum::PLANE_BOTTOM].normal.x),
-			::detail::float4(frustum.planes[Frustum::PLANE_BOTTOM].normal.y),
-			::detail::float4(frustum.planes[Frustum::PLANE_BOTTOM].normal.z),
-			::detail::float4(frustum.planes[Frustum::PLANE_BOTTOM].d),
-
-			// Near clipping plane
-			::detail::float4(frustum.planes[Frustum::PLANE_NEAR].normal.x),
-			::detail::float4(frustum.planes[Frustum::PLANE_NEAR].normal.y),
-			::detail::float4(frustum.planes[Frustum::PLANE_NEAR].normal.z),
-			::detail::float4(frustum.planes[Frustum::PLANE_NEAR].d),
-
-			// Far clipping plane
-			::detail::float4(frustum.planes[Frustum::PLANE_FAR].normal.x),
-			::detail::float4(frustum.planes[Frustum::PLANE_FAR].normal.y),
-			::detail::float4(frustum.planes[Frustum::PLANE_FAR].normal.z),
-			::detail::float4(frustum.planes[Frustum::PLANE_FAR].d),
-		};
+		// Determine the visible cullable scene items
+		// -> Single pass stereo rendering: The frustum-OOBB culling works in the clip space of a single projection, so stick to the conservative frustum-sphere culling result
+		const uint32_t numberOfOobbVisible = cullSceneItems(renderer.getJobSystem(), frustum, worldSpaceCameraPositionFloat, singlePassStereoInstancing ? nullptr : &viewSpaceToClipSpaceMatrix);
 
-		// Make sure to align the size to the SIMD lane count
-		const uint32_t n_aligned_objects = ::detail::alignToSimdLaneCount(mCullableSceneItemSet->numberOfSceneItems);
-
-		// TODO(co) We need to ensure that scene item set fits the SIMD lane count, this is only done at this place for the culling kickoff
-		if (mCullableSceneItemSet->minimumX.size() != n_aligned_objects)
+		// Fill render queue index ranges with the visible stuff
+		const glm::dvec3& cameraPosition = cameraSceneItem->getParentSceneNodeSafe().getGlobalTransform().position;
+		const float inverseTanHalfFovY = ::detail::getInverseTanHalfFovY(*cameraSceneItem);
+		const float lodBias = renderer.getMeshResourceManager().getLodBias();
+		for (uint32_t indirectionIndex = 0; indirectionIndex < numberOfOobbVisible; ++indirectionIndex)
 		{
-			// Determine the needed vector size which takes alignment as well as prefetch ("xsimd::prefetch()" -> "_mm_prefetch()") into account
-			const uint32_t size = n_aligned_objects + xsimd::simd_type<float>::size;
-
-			// Minimum object space bounding box corner position
-			mCullableSceneItemSet->minimumX.resize(size);
-			mCullableSceneItemSet->minimumY.resize(size);
-			mCullableSceneItemSet->minimumZ.resize(size);
-
-			// Maximum object space bounding box corner position
-			mCullableSceneItemSet->maximumX.resize(size);
-			mCullableSceneItemSet->maximumY.resize(size);
-			mCullableSceneItemSet->maximumZ.resize(size);
-
-			// Object space to world space matrix
-			mCullableSceneItemSet->worldXX.resize(size);
-			mCullableSceneItemSet->worldXY.resize(size);
-			mCullableSceneItemSet->worldXZ.resize(size);
-			mCullableSceneItemSet->worldXW.resize(size);
-			mCullableSceneItemSet->worldYX.resize(size);
-			mCullableSceneItemSet->worldYY.resize(size);
-			mCullableSceneItemSet->worldYZ.resize(size);
-			mCullableSceneItemSet->worldYW.resize(size);
-			mCullableSceneItemSet->worldZX.resize(size);
-			mCullableSceneItemSet->worldZY.resize(size);
-			mCullableSceneItemSet->worldZZ.resize(size);
-			mCullableSceneItemSet->worldZW.resize(size);
-			mCullableSceneItemSet->worldWX.resize(size);
-			mCullableSceneItemSet->worldWY.resize(size);
-			mCullableSceneItemSet->worldWZ.resize(size);
-			mCullableSceneItemSet->worldWW.resize(size);
-
-			// World space center position of bounding sphere
-			mCullableSceneItemSet->spherePositionX.resize(size);
-			mCullableSceneItemSet->spherePositionY.resize(size);
-			mCullableSceneItemSet->spherePositionZ.resize(size);
-
-			// Negative world space radius of bounding sphere
-			mCullableSceneItemSet->negativeRadius.resize(size);
-
-			mCullableSceneItemSet->visibilityFlag.resize(size);
-			mCullableSceneItemSet->sceneItemVector.resize(size);
+			::detail::gatherRenderQueueIndexRangesRenderableManagersBySceneItem(*mCullableSceneItemSet->sceneItemVector[mIndirection[indirectionIndex]], cameraPosition, inverseTanHalfFovY, lodBias, renderQueueIndexRanges, executeOnRenderingSceneItems);
 		}
 
-		// Get the thread pool instance
-		DefaultThreadPool& defaultThreadPool = renderer.getDefaultThreadPool();
+		// Fill render queue index ranges with the always-visible stuff
+		for (ISceneItem* sceneItem : mUncullableSceneItems)
+		{
+			::detail::gatherRenderQueueIndexRangesRenderableManagersBySceneItem(*sceneItem, cameraPosition, inverseTanHalfFovY, lodBias, renderQueueIndexRanges, executeOnRenderingSceneItems);
+		}
+	}
 
-		{ // Do SIMD multi-threaded frustum-sphere culling
-			size_t itemCount = mCullableSceneItemSet->numberOfSceneItems;
-			size_t splitCount = ::detail::SCENE_ITEMS_SPLIT_COUNT;	// Package size for each thread to work on (will change when maximum number of threads is reached)
-			const size_t threadCount = defaultThreadPool.getThreadCountAndSplitCount(itemCount, splitCount);
-			if (1 == threadCount)
-			{
-				// Just execute it directly inside the current thread, not worth the additional threading effort
-				::detail::simdSphereCulling(worldSpaceCameraPositionFloat4, planes, *mCullableSceneItemSet, 0, itemCount, mCullableSceneItemSet->visibilityFlag.data());
-			}
-			else
-			{
-				// Multi-threaded
-				size_t threadSceneItemIndexOffset = 0;
-				for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
-				{
-					const size_t numberOfItemsToProcess = (threadIndex >= threadCount - 1) ? itemCount : splitCount;	// The last thread has to do all the rest of the remaining work
-					defaultThreadPool.queueTask(std::bind(::detail::simdSphereCulling, worldSpaceCameraPositionFloat4, planes, *mCullableSceneItemSet, threadSceneItemIndexOffset, threadSceneItemIndexOffset + numberOfItemsToProcess, mCullableSceneItemSet->visibilityFlag.data()));
-					itemCount -= splitCount;
-					threadSceneItemIndexOffset += splitCount;
-				}
+	uint32_t SceneCullingManager::cullSceneItems(JobSystem& jobSystem, const Frustum& frustum, const glm::vec3& worldSpaceCameraPosition, const glm::mat4* viewSpaceToClipSpaceMatrix)
+	{
+		// Get a view onto the scene item set which is shared by all culling jobs
+		// -> The culling jobs only reference data living on this stack frame, nothing is copied or allocated per job
+		// -> The scene item set arrays already fit the SIMD lane count including prefetch padding, see "Renderer::SceneItemSet::resize()"
+		const SceneItemSetView sceneItemSetView = mCullableSceneItemSet->getView();
 
-				// Wait that all worker threads have done their part of the calculation
-				defaultThreadPool.process();
-			}
+		// Do SIMD multi-threaded frustum-sphere culling, optionally using the loose octree to reject whole subtrees upfront
+		if (nullptr != mCullableSceneItemOctree)
+		{
+			mCullableSceneItemOctree->update();
+		}
+		const uint32_t numberOfVisibleItems = ::detail::frustumSphereCulling(jobSystem, frustum, worldSpaceCameraPosition, sceneItemSetView, mCullableSceneItemOctree, mIntersectingSceneItemIndices, mInsideSceneItemIndices, mIndirection);
+		if (nullptr == viewSpaceToClipSpaceMatrix)
+		{
+			// Conservative frustum-sphere culling result only
+			return numberOfVisibleItems;
 		}
-
-		// Store the indices of the objects that passed the frustum-sphere culling in the `indirection` array
-		mIndirection.resize(n_aligned_objects);
-		const uint32_t numberOfVisibleItems = ::detail::removeNotVisible(*mCullableSceneItemSet, mCullableSceneItemSet->numberOfSceneItems, nullptr, mIndirection.data());
 
 		// Construct the SimdMatrix "simd_view_proj"
 		const ::detail::SimdMatrix simd_view_proj =
 		{
-			::detail::float4(viewSpaceToClipSpaceMatrix[0][0]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[0][1]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[0][2]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[0][3]),
-
-			::detail::float4(viewSpaceToClipSpaceMatrix[1][0]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[1][1]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[1][2]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[1][3]),
-
-			::detail::float4(viewSpaceToClipSpaceMatrix[2][0]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[2][1]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[2][2]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[2][3]),
-
-			::detail::float4(viewSpaceToClipSpaceMatrix[3][0]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[3][1]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[3][2]),
-			::detail::float4(viewSpaceToClipSpaceMatrix[3][3]),
+			::detail::float4((*viewSpaceToClipSpaceMatrix)[0][0]),
+			::detail::float4((*viewSpaceToClipSpaceMatrix)[0][1]),
+			::detail::float4((*viewSpaceToClipSpaceMatrix)[0][2]),
+			::detail::float4((*viewSpaceToClipSpaceMatrix)[0][3]),
+
+			::detail::float4((*viewSpaceToClipSpaceMatrix)[1][0]),
+			::detail::float4((*viewSpaceToClipSpaceMatrix)[1][1]),
+			::detail::float4((*viewSpaceToClipSpaceMatrix)[1][2]),
+			::detail::float4((*viewSpaceToClipSpaceMatrix)[1][3]),
+
+			::detail::float4((*viewSpaceToClipSpaceMatrix)[2][0]),
+			::detail::float4((*viewSpaceToClipSpaceMatrix)[2][1]),
+			::detail::float4((*viewSpaceToClipSpaceMatrix)[2][2]),
+			::detail::float4((*viewSpaceToClipSpaceMatrix)[2][3]),
+
+			::detail::float4((*viewSpaceToClipSpaceMatrix)[3][0]),
+			::detail::float4((*viewSpaceToClipSpaceMatrix)[3][1]),
+			::detail::float4((*viewSpaceToClipSpaceMatrix)[3][2]),
+			::detail::float4((*viewSpaceToClipSpaceMatrix)[3][3]),
 		};
 
-		{ // Do SIMD multi-threaded frustum-OOBB culling
-			size_t itemCount = numberOfVisibleItems;
-			size_t splitCount = ::detail::SCENE_ITEMS_SPLIT_COUNT;	// Package size for each thread to work on (will change when maximum number of threads is reached)
-			const size_t threadCount = defaultThreadPool.getThreadCountAndSplitCount(itemCount, splitCount);
-			if (1 == threadCount)
-			{
-				// Just execute it directly inside the current thread, not worth the additional threading effort
-				::detail::simdOobbCulling(worldSpaceCameraPositionFloat4, simd_view_proj, *mCullableSceneItemSet, mIndirection.data(), 0, itemCount, mCullableSceneItemSet->visibilityFlag.data());
-			}
-			else
-			{
-				// Multi-threaded
-				size_t threadSceneItemIndexOffset = 0;
-				for (size_t threadIndex = 0; threadIndex < threadCount; ++threadIndex)
-				{
-					const size_t numberOfItemsToProcess = (threadIndex >= threadCount - 1) ? itemCount : splitCount;	// The last thread has to do all the rest of the remaining work
-					defaultThreadPool.queueTask(std::bind(::detail::simdOobbCulling, worldSpaceCameraPositionFloat4, simd_view_proj, *mCullableSceneItemSet, mIndirection.data(), threadSceneItemIndexOffset, threadSceneItemIndexOffset + numberOfItemsToProcess, mCullableSceneItemSet->visibilityFlag.data()));
-					itemCount -= splitCount;
-					threadSceneItemIndexOffset += splitCount;
-				}
-
-				// Wait that all worker threads have done their part of the calculation
-				defaultThreadPool.process();
-			}
-		}
+		// Do SIMD multi-threaded frustum-OOBB culling
+		const uint32_t* indirection = mIndirection.data();
+		jobSystem.parallelFor(numberOfVisibleItems, ::detail::SCENE_ITEMS_GRANULARITY, [&simd_view_proj, &sceneItemSetView, indirection](uint32_t startIndex, uint32_t endIndex)
+		{
+			::detail::simdOobbCulling(simd_view_proj, sceneItemSetView, indirection, startIndex, endIndex);
+		});
 
 		// Build up the indirection array that represents the objects that survived the frustum-OOBB culling
-		const uint32_t numberOfOobbVisible = ::detail::removeNotVisible(*mCullableSceneItemSet, numberOfVisibleItems, mIndirection.data(), mIndirection.data());
+		return ::detail::removeNotVisible(sceneItemSetView, numberOfVisibleItems, mIndirection.data(), mIndirection.data());
+	}
 
-		// Fill render queue index ranges with the visible stuff
-		const glm::dvec3& cameraPosition = cameraSceneItem->getParentSceneNodeSafe().getGlobalTransform().position;
-		for (uint32_t indirectionIndex = 0; indirectionIndex < numberOfOobbVisible; ++indirectionIndex)
+	void SceneCullingManager::gatherShadowCastersRenderableManagers(const CompositorContextData& compositorContextData, uint8_t numberOfShadowCascades, const glm::mat4 cameraRelativeWorldSpaceToClipSpaceMatrices[], CompositorWorkspaceInstance::RenderableManagers shadowCastersRenderableManagers[])
+	{
+		RHI_ASSERT(compositorContextData.getCompositorWorkspaceInstance()->getRenderer().getContext(), nullptr != compositorContextData.getCameraSceneItem(), "Invalid camera")
+		JobSystem& jobSystem = compositorContextData.getCompositorWorkspaceInstance()->getRenderer().getJobSystem();
+		const CameraSceneItem& cameraSceneItem = *compositorContextData.getCameraSceneItem();
+		const glm::vec3 worldSpaceCameraPositionFloat = cameraSceneItem.getWorldSpaceCameraPosition();
+
+		// The loose octree is read concurrently by the shadow cascade jobs, so update it upfront
+		if (nullptr != mCullableSceneItemOctree)
 		{
-			::detail::gatherRenderQueueIndexRangesRenderableManagersBySceneItem(*mCullableSceneItemSet->sceneItemVector[mIndirection[indirectionIndex]], cameraPosition, renderQueueIndexRanges, executeOnRenderingSceneItems);
+			mCullableSceneItemOctree->update();
 		}
 
-		// Fill render queue index ranges with the always-visible stuff
-		for (ISceneItem* sceneItem : mUncullableSceneItems)
+		// Ensure each shadow cascade has its own SIMD friendly visibility flags
+		const uint32_t numberOfSceneItems = mCullableSceneItemSet->numberOfSceneItems;
+		if (mShadowCascadeCullings.size() < numberOfShadowCascades)
+		{
+			mShadowCascadeCullings.resize(numberOfShadowCascades);
+		}
+		for (uint8_t cascadeIndex = 0; cascadeIndex < numberOfShadowCascades; ++cascadeIndex)
+		{
+			mShadowCascadeCullings[cascadeIndex].visibilityFlag.resize(mCullableSceneItemSet->visibilityFlag.size());
+		}
+
+		// One job per shadow cascade, the frustum-sphere culling of each shadow cascade is distributed across the job system as well
+		SceneItemSet& sceneItemSet = *mCullableSceneItemSet;
+		const SceneItems& uncullableSceneItems = mUncullableSceneItems;
+		const SceneItemOctree* sceneItemOctree = mCullableSceneItemOctree;
+		ShadowCascadeCulling* shadowCascadeCullings = mShadowCascadeCullings.data();
+		jobSystem.parallelFor(numberOfShadowCascades, 1, [&jobSystem, &worldSpaceCameraPositionFloat, &sceneItemSet, &uncullableSceneItems, sceneItemOctree, shadowCascadeCullings, cameraRelativeWorldSpaceToClipSpaceMatrices, shadowCastersRenderableManagers, numberOfSceneItems](uint32_t startIndex, uint32_t endIndex)
+		{
+			for (uint32_t cascadeIndex = startIndex; cascadeIndex < endIndex; ++cascadeIndex)
+			{
+				ShadowCascadeCulling& shadowCascadeCulling = shadowCascadeCullings[cascadeIndex];
+
+				// Calculate the light space frustum of the shadow cascade and extrude it towards the light by disabling the near plane
+				Frustum frustum(cameraRelativeWorldSpaceToClipSpaceMatrices[cascadeIndex]);
+				frustum.planes[Frustum::PLANE_NEAR] = Plane(glm::vec4(0.0f, 0.0f, 0.0f, std::numeric_limits<float>::max()));
+
+				// Do SIMD multi-threaded frustum-sphere culling writing into the visibility flags of the shadow cascade
+				SceneItemSetView sceneItemSetView = sceneItemSet.getView();
+				sceneItemSetView.visibilityFlag = shadowCascadeCulling.visibilityFlag.data();
+				const uint32_t numberOfVisibleItems = ::detail::frustumSphereCulling(jobSystem, frustum, worldSpaceCameraPositionFloat, sceneItemSetView, sceneItemOctree, shadowCascadeCulling.intersectingSceneItemIndices, shadowCascadeCulling.insideSceneItemIndices, shadowCascadeCulling.indirection);
+				ASSERT(numberOfVisibleItems <= numberOfSceneItems, "Invalid number of visible shadow casters")
+
+				// Gather the shadow casting renderable managers
+				CompositorWorkspaceInstance::RenderableManagers& renderableManagers = shadowCastersRenderableManagers[cascadeIndex];
+				renderableManagers.clear();
+				const auto gatherShadowCaster = [&renderableManagers](const ISceneItem& sceneItem)
+				{
+					const RenderableManager* renderableManager = sceneItem.getRenderableManager();
+					if (nullptr != renderableManager && renderableManager->isVisible() && renderableManager->getCastShadows() && !renderableManager->getRenderables().empty())
+					{
+						renderableManagers.push_back(const_cast<RenderableManager*>(renderableManager));	// TODO(co) Get rid of the evil const-cast
+					}
+				};
+				for (uint32_t indirectionIndex = 0; indirectionIndex < numberOfVisibleItems; ++indirectionIndex)
+				{
+					gatherShadowCaster(*sceneItemSet.sceneItemVector[shadowCascadeCulling.indirection[indirectionIndex]]);
+				}
+				for (const ISceneItem* sceneItem : uncullableSceneItems)
+				{
+					gatherShadowCaster(*sceneItem);
+				}
+			}
+		});
+
+		// Shadow casters outside of the camera frustum haven't been touched by the camera culling, update their cached distance to the camera and their LOD
+		// -> Not done inside the shadow cascade jobs since a renderable manager can be inside multiple shadow cascades
+		const glm::dvec3& cameraPosition = cameraSceneItem.getParentSceneNodeSafe().getGlobalTransform().position;
+		const float inverseTanHalfFovY = ::detail::getInverseTanHalfFovY(cameraSceneItem);
+		const float lodBias = compositorContextData.getCompositorWorkspaceInstance()->getRenderer().getMeshResourceManager().getLodBias();
+		for (uint8_t cascadeIndex = 0; cascadeIndex < numberOfShadowCascades; ++cascadeIndex)
 		{
-			::detail::gatherRenderQueueIndexRangesRenderableManagersBySceneItem(*sceneItem, cameraPosition, renderQueueIndexRanges, executeOnRenderingSceneItems);
+			for (RenderableManager* renderableManager : shadowCastersRenderableManagers[cascadeIndex])
+			{
+				renderableManager->setCachedDistanceToCamera(static_cast<float>(glm::distance(cameraPosition, renderableManager->getTransform().position)));
+				renderableManager->updateCachedLodIndex(inverseTanHalfFovY, lodBias);
+			}
 		}
 	}
 
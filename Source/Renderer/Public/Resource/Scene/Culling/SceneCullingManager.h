@@ -40,8 +40,11 @@ namespace Rhi
 }
 namespace Renderer
 {
+	class Frustum;
+	class JobSystem;
 	class ISceneItem;
 	struct SceneItemSet;
+	class SceneItemOctree;
 	class CompositorContextData;
 }
 
@@ -74,14 +77,57 @@ namespace Renderer
 		typedef std::vector<ISceneItem*> SceneItems;	// TODO(co) No raw-pointers (but no smart pointers either, use handles)
 
 
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Return a conservative frustum enclosing both eye frustums of single pass stereo rendering
+		*
+		*  @param[in] eyeSpaceToCameraRelativeWorldSpaceMatrices
+		*    Eye space to camera relative world space matrix of the left and the right eye
+		*  @param[in] viewSpaceToClipSpaceMatrices
+		*    Eye view space to clip space matrix of the left and the right eye
+		*
+		*  @return
+		*    Camera relative world space frustum enclosing both eye frustums
+		*
+		*  @remarks
+		*    Each eye frustum is widened by about 5 degrees around the eye position since the head pose is updated again
+		*    after culling, right before the frame is submitted to the HMD.
+		*/
+		[[nodiscard]] static RENDERER_API_EXPORT Frustum getConservativeStereoFrustum(const glm::mat4 eyeSpaceToCameraRelativeWorldSpaceMatrices[2], const glm::mat4 viewSpaceToClipSpaceMatrices[2]);
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
 	public:
-		SceneCullingManager();
-		~SceneCullingManager();
+		RENDERER_API_EXPORT SceneCullingManager();
+		RENDERER_API_EXPORT ~SceneCullingManager();
 		void gatherRenderQueueIndexRangesRenderableManagers(const Rhi::IRenderTarget& renderTarget, const CompositorContextData& compositorContextData, CompositorWorkspaceInstance::RenderQueueIndexRanges& renderQueueIndexRanges, std::vector<ISceneItem*>& executeOnRenderingSceneItems);
 
+		/**
+		*  @brief
+		*    Gather the shadow casting renderable managers of each shadow cascade
+		*
+		*  @param[in] compositorContextData
+		*    Compositor context data providing the camera scene item
+		*  @param[in] numberOfShadowCascades
+		*    Number of shadow cascades
+		*  @param[in] cameraRelativeWorldSpaceToClipSpaceMatrices
+		*    Camera relative world space to clip space matrix of each shadow cascade, "numberOfShadowCascades" entries
+		*  @param[out] shadowCastersRenderableManagers
+		*    Receives the shadow casting renderable managers of each shadow cascade, "numberOfShadowCascades" entries, lists are cleared before they're filled
+		*
+		*  @remarks
+		*    The cullable scene items are frustum-sphere culled against the light space frustum of each shadow cascade. The frustum
+		*    is extruded towards the light by ignoring its near plane since shadow casters between the light and the shadow cascade
+		*    still cast shadows into the shadow cascade. The shadow cascades are culled in parallel.
+		*/
+		void gatherShadowCastersRenderableManagers(const CompositorContextData& compositorContextData, uint8_t numberOfShadowCascades, const glm::mat4 cameraRelativeWorldSpaceToClipSpaceMatrices[], CompositorWorkspaceInstance::RenderableManagers shadowCastersRenderableManagers[]);
+
 		[[nodiscard]] inline SceneItemSet& getCullableSceneItemSet() const
 		{
 			// We know that this pointer is always valid
@@ -94,6 +140,70 @@ namespace Renderer
 			return mUncullableSceneItems;
 		}
 
+		/**
+		*  @brief
+		*    Enable or disable the optional loose octree spatial acceleration structure for the cullable scene items
+		*
+		*  @param[in] enabled
+		*    "true" to enable the loose octree, else "false"
+		*  @param[in] rootHalfSize
+		*    Half world space size of the loose octree root node cell, centered at the world space origin, scene items outside are never rejected by the loose octree
+		*  @param[in] maximumDepth
+		*    Maximum loose octree depth
+		*
+		*  @remarks
+		*    For large scenes with many mostly static scene items the loose octree rejects whole subtrees before the SIMD
+		*    per scene item culling runs, so the culling cost scales with the visible set size instead of the total
+		*    number of scene items. For small scenes the brute force SIMD culling is usually faster.
+		*/
+		RENDERER_API_EXPORT void setSceneItemOctreeEnabled(bool enabled, float rootHalfSize = 16384.0f, uint32_t maximumDepth = 10);
+
+		[[nodiscard]] inline bool isSceneItemOctreeEnabled() const
+		{
+			return (nullptr != mCullableSceneItemOctree);
+		}
+
+		/**
+		*  @brief
+		*    Determine the visible cullable scene items
+		*
+		*  @param[in] jobSystem
+		*    Job system to use for the culling jobs
+		*  @param[in] frustum
+		*    Camera relative world space frustum
+		*  @param[in] worldSpaceCameraPosition
+		*    World space camera position
+		*  @param[in] viewSpaceToClipSpaceMatrix
+		*    View space to clip space matrix for the frustum-OOBB culling, can be a null pointer to only do the conservative frustum-sphere culling
+		*
+		*  @return
+		*    The number of visible cullable scene items, see "Renderer::SceneCullingManager::getVisibleSceneItemIndices()"
+		*
+		*  @note
+		*    - Doesn't touch the scene items themselves, so it also works for synthetic cullable scene item sets without scene item instances
+		*/
+		[[nodiscard]] RENDERER_API_EXPORT uint32_t cullSceneItems(JobSystem& jobSystem, const Frustum& frustum, const glm::vec3& worldSpaceCameraPosition, const glm::mat4* viewSpaceToClipSpaceMatrix);
+
+		/**
+		*  @brief
+		*    Return the cullable scene item set indices of the visible scene items determined by the last "Renderer::SceneCullingManager::cullSceneItems()" call
+		*
+		*  @return
+		*    Cullable scene item set indices of the visible scene items, the number of indices is returned by "Renderer::SceneCullingManager::cullSceneItems()"
+		*/
+		[[nodiscard]] inline const uint32_t* getVisibleSceneItemIndices() const
+		{
+			return mIndirection.data();
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		struct ShadowCascadeCulling;	///< Per shadow cascade culling data, defined inside the implementation
+		typedef std::vector<ShadowCascadeCulling> ShadowCascadeCullings;
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -108,9 +218,12 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	private:
 		SceneItemSet*		  mCullableSceneItemSet;				///< Cullable scene item set, always valid, destroy the instance if you no longer need it
-		SceneItemSet*		  mCullableShadowCastersSceneItemSet;	///< Cullable shadow casters scene item set, always valid, destroy the instance if you no longer need it	TODO(co) Implement me
+		SceneItemOctree*	  mCullableSceneItemOctree;				///< Optional loose octree of the cullable scene item set, can be a null pointer, destroy the instance if you no longer need it
 		SceneItems			  mUncullableSceneItems;				///< Scene items which can't be culled and hence are always considered to be visible
 		std::vector<uint32_t> mIndirection;
+		std::vector<uint32_t> mIntersectingSceneItemIndices;		///< Scene items inside loose octree nodes intersecting the frustum, padded to the SIMD lane count
+		std::vector<uint32_t> mInsideSceneItemIndices;				///< Scene items inside loose octree nodes fully inside the frustum
+		ShadowCascadeCullings mShadowCascadeCullings;				///< Shadow cascade culling data, the shadow cascades share the cullable scene item set but each one has its own visibility flags
 
 
 	};
@@ -0,0 +1,318 @@
+/*********************************************************\
+ * Copyright (c) 2012-2021 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/Resource/Scene/Culling/SceneItemOctree.h"
+#include "Renderer/Public/Resource/Scene/Culling/SceneItemSet.h"
+#include "Renderer/Public/Core/Math/Frustum.h"
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+namespace
+{
+	namespace detail
+	{
+
+
+		//[-------------------------------------------------------]
+		//[ Global definitions                                    ]
+		//[-------------------------------------------------------]
+		static constexpr uint32_t FULLY_INSIDE_NODE_FLAG = 0x80000000u;	///< Set inside the traversal stack for nodes which are known to be fully inside the frustum
+		static constexpr uint32_t TRAVERSAL_STACK_SIZE	 = (Renderer::SceneItemOctree::MAXIMUM_DEPTH + 1) * 8;	///< Depth first traversal, each level adds at most eight nodes
+
+
+//[-------------------------------------------------------]
+//[ Anonymous detail namespace                            ]
+//[-------------------------------------------------------]
+	} // detail
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	SceneItemOctree::SceneItemOctree(SceneItemSet& sceneItemSet, float rootHalfSize, uint32_t maximumDepth) :
+		mSceneItemSet(sceneItemSet),
+		mMaximumDepth(maximumDepth),
+		mNumberOfInsertedSceneItems(0)
+	{
+		ASSERT(nullptr == mSceneItemSet.sceneItemOctree, "The scene item set already has a loose octree")
+		ASSERT(rootHalfSize > 0.0f, "Invalid loose octree root half size")
+		ASSERT(mMaximumDepth <= MAXIMUM_DEPTH, "Invalid loose octree maximum depth")
+
+		// Create the unbounded node as well as the root node
+		mNodes.reserve(512);
+		Node node;
+		node.center = glm::vec3(0.0f);
+		node.halfSize = rootHalfSize;
+		node.parentNodeIndex = getInvalid<uint32_t>();
+		for (uint32_t& childNodeIndex : node.childNodeIndices)
+		{
+			childNodeIndex = getInvalid<uint32_t>();
+		}
+		node.firstSceneItemIndex = getInvalid<uint32_t>();
+		node.numberOfSubtreeSceneItems = 0;
+		mNodes.push_back(node);	// "UNBOUNDED_NODE_INDEX"
+		mNodes.push_back(node);	// "ROOT_NODE_INDEX"
+
+		// Register at the scene item set so scene node transform changes are forwarded to us
+		mSceneItemSet.sceneItemOctree = this;
+	}
+
+	SceneItemOctree::~SceneItemOctree()
+	{
+		ASSERT(this == mSceneItemSet.sceneItemOctree, "Invalid scene item set loose octree")
+		mSceneItemSet.sceneItemOctree = nullptr;
+	}
+
+	void SceneItemOctree::update()
+	{
+		// Reinsert dirty scene items, the node lookup is cheap and the linked list update is only done if a scene item changed its node
+		for (uint32_t sceneItemIndex : mDirtySceneItemIndices)
+		{
+			const uint32_t nodeIndex = getNodeIndex(glm::vec3(mSceneItemSet.spherePositionX[sceneItemIndex], mSceneItemSet.spherePositionY[sceneItemIndex], mSceneItemSet.spherePositionZ[sceneItemIndex]), -mSceneItemSet.negativeRadius[sceneItemIndex]);
+			if (mSceneItemNodeIndex[sceneItemIndex] != nodeIndex)
+			{
+				unlinkSceneItem(sceneItemIndex);
+				linkSceneItem(sceneItemIndex, nodeIndex);
+			}
+			mSceneItemDirty[sceneItemIndex] = false;
+		}
+		mDirtySceneItemIndices.clear();
+
+		// Insert new scene items
+		const uint32_t numberOfSceneItems = mSceneItemSet.numberOfSceneItems;
+		if (mNumberOfInsertedSceneItems < numberOfSceneItems)
+		{
+			mSceneItemNodeIndex.resize(numberOfSceneItems, getInvalid<uint32_t>());
+			mPreviousSceneItemIndex.resize(numberOfSceneItems, getInvalid<uint32_t>());
+			mNextSceneItemIndex.resize(numberOfSceneItems, getInvalid<uint32_t>());
+			mSceneItemDirty.resize(numberOfSceneItems, false);
+			for (uint32_t sceneItemIndex = mNumberOfInsertedSceneItems; sceneItemIndex < numberOfSceneItems; ++sceneItemIndex)
+			{
+				linkSceneItem(sceneItemIndex, getNodeIndex(glm::vec3(mSceneItemSet.spherePositionX[sceneItemIndex], mSceneItemSet.spherePositionY[sceneItemIndex], mSceneItemSet.spherePositionZ[sceneItemIndex]), -mSceneItemSet.negativeRadius[sceneItemIndex]));
+			}
+			mNumberOfInsertedSceneItems = numberOfSceneItems;
+		}
+	}
+
+	void SceneItemOctree::gatherSceneItems(const Frustum& cameraRelativeFrustum, const glm::vec3& worldSpaceCameraPosition, SceneItemIndices& intersectingSceneItemIndices, SceneItemIndices& insideSceneItemIndices) const
+	{
+		intersectingSceneItemIndices.clear();
+		insideSceneItemIndices.clear();
+
+		// Scene items inside the unbounded node can't be rejected
+		for (uint32_t sceneItemIndex = mNodes[UNBOUNDED_NODE_INDEX].firstSceneItemIndex; isValid(sceneItemIndex); sceneItemIndex = mNextSceneItemIndex[sceneItemIndex])
+		{
+			intersectingSceneItemIndices.push_back(sceneItemIndex);
+		}
+
+		// Precalculate the absolute plane normals used to project the loose node bounds onto the plane normals
+		glm::vec3 absolutePlaneNormals[Frustum::NUMBER_OF_PLANES];
+		for (uint32_t planeIndex = 0; planeIndex < Frustum::NUMBER_OF_PLANES; ++planeIndex)
+		{
+			absolutePlaneNormals[planeIndex] = glm::abs(cameraRelativeFrustum.planes[planeIndex].normal);
+		}
+
+		// Depth first traversal
+		uint32_t traversalStack[::detail::TRAVERSAL_STACK_SIZE];
+		uint32_t traversalStackSize = 0;
+		traversalStack[traversalStackSize++] = ROOT_NODE_INDEX;
+		while (traversalStackSize > 0)
+		{
+			const uint32_t traversalStackEntry = traversalStack[--traversalStackSize];
+			const Node& node = mNodes[traversalStackEntry & ~::detail::FULLY_INSIDE_NODE_FLAG];
+			if (0 == node.numberOfSubtreeSceneItems)
+			{
+				// Skip empty subtrees
+				continue;
+			}
+
+			// Test the camera relative loose node bounds against the frustum planes, as soon as a node is fully inside the frustum all of its child nodes are as well
+			uint32_t fullyInsideNodeFlag = (traversalStackEntry & ::detail::FULLY_INSIDE_NODE_FLAG);
+			if (0 == fullyInsideNodeFlag)
+			{
+				const glm::vec3 center = node.center - worldSpaceCameraPosition;
+				const float looseHalfSize = node.halfSize * 2.0f;
+				bool outside = false;
+				bool intersecting = false;
+				for (uint32_t planeIndex = 0; planeIndex < Frustum::NUMBER_OF_PLANES; ++planeIndex)
+				{
+					const Plane& plane = cameraRelativeFrustum.planes[planeIndex];
+					const float distance = glm::dot(plane.normal, center) + plane.d;
+					const float projectedRadius = looseHalfSize * (absolutePlaneNormals[planeIndex].x + absolutePlaneNormals[planeIndex].y + absolutePlaneNormals[planeIndex].z);
+					if (distance < -projectedRadius)
+					{
+						outside = true;
+						break;
+					}
+					if (distance < projectedRadius)
+					{
+						intersecting = true;
+					}
+				}
+				if (outside)
+				{
+					continue;
+				}
+				if (!intersecting)
+				{
+					fullyInsideNodeFlag = ::detail::FULLY_INSIDE_NODE_FLAG;
+				}
+			}
+
+			// Gather the scene items of this node
+			SceneItemIndices& sceneItemIndices = (0 != fullyInsideNodeFlag) ? insideSceneItemIndices : intersectingSceneItemIndices;
+			for (uint32_t sceneItemIndex = node.firstSceneItemIndex; isValid(sceneItemIndex); sceneItemIndex = mNextSceneItemIndex[sceneItemIndex])
+			{
+				sceneItemIndices.push_back(sceneItemIndex);
+			}
+
+			// Traverse the child nodes
+			for (uint32_t childNodeIndex : node.childNodeIndices)
+			{
+				if (isValid(childNodeIndex))
+				{
+					ASSERT(traversalStackSize < ::detail::TRAVERSAL_STACK_SIZE, "Loose octree traversal stack overflow")
+					traversalStack[traversalStackSize++] = (childNodeIndex | fullyInsideNodeFlag);
+				}
+			}
+		}
+	}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	uint32_t SceneItemOctree::getNodeIndex(const glm::vec3& spherePosition, float radius)
+	{
+		{ // Does the bounding sphere fit into the root node at all?
+			const Node& rootNode = mNodes[ROOT_NODE_INDEX];
+			const glm::vec3 offset = glm::abs(spherePosition - rootNode.center);
+			if (offset.x > rootNode.halfSize || offset.y > rootNode.halfSize || offset.z > rootNode.halfSize || radius > rootNode.halfSize)
+			{
+				return UNBOUNDED_NODE_INDEX;
+			}
+		}
+
+		// Descend as long as the bounding sphere fits into the loose bounds of the child node containing the bounding sphere center
+		uint32_t nodeIndex = ROOT_NODE_INDEX;
+		for (uint32_t depth = 1; depth <= mMaximumDepth; ++depth)
+		{
+			const glm::vec3 center = mNodes[nodeIndex].center;
+			const float childHalfSize = mNodes[nodeIndex].halfSize * 0.5f;
+			if (radius > childHalfSize)
+			{
+				break;
+			}
+			const uint32_t childIndex = ((spherePosition.x >= center.x) ? 1u : 0u) | ((spherePosition.y >= center.y) ? 2u : 0u) | ((spherePosition.z >= center.z) ? 4u : 0u);
+			uint32_t childNodeIndex = mNodes[nodeIndex].childNodeIndices[childIndex];
+			if (isInvalid(childNodeIndex))
+			{
+				// Create the child node lazily
+				Node childNode;
+				childNode.center.x = center.x + ((childIndex & 1u) ? childHalfSize : -childHalfSize);
+				childNode.center.y = center.y + ((childIndex & 2u) ? childHalfSize : -childHalfSize);
+				childNode.center.z = center.z + ((childIndex & 4u) ? childHalfSize : -childHalfSize);
+				childNode.halfSize = childHalfSize;
+				childNode.parentNodeIndex = nodeIndex;
+				for (uint32_t& grandchildNodeIndex : childNode.childNodeIndices)
+				{
+					grandchildNodeIndex = getInvalid<uint32_t>();
+				}
+				childNode.firstSceneItemIndex = getInvalid<uint32_t>();
+				childNode.numberOfSubtreeSceneItems = 0;
+				childNodeIndex = static_cast<uint32_t>(mNodes.size());
+				mNodes.push_back(childNode);
+				mNodes[nodeIndex].childNodeIndices[childIndex] = childNodeIndex;
+			}
+			nodeIndex = childNodeIndex;
+		}
+
+		// Done
+		return nodeIndex;
+	}
+
+	void SceneItemOctree::linkSceneItem(uint32_t sceneItemIndex, uint32_t nodeIndex)
+	{
+		// Add the scene item to the front of the linked list of the node
+		Node& node = mNodes[nodeIndex];
+		mSceneItemNodeIndex[sceneItemIndex] = nodeIndex;
+		mPreviousSceneItemIndex[sceneItemIndex] = getInvalid<uint32_t>();
+		mNextSceneItemIndex[sceneItemIndex] = node.firstSceneItemIndex;
+		if (isValid(node.firstSceneItemIndex))
+		{
+			mPreviousSceneItemIndex[node.firstSceneItemIndex] = sceneItemIndex;
+		}
+		node.firstSceneItemIndex = sceneItemIndex;
+
+		// Update the subtree scene item counters up to the root node
+		for (uint32_t currentNodeIndex = nodeIndex; isValid(currentNodeIndex); currentNodeIndex = mNodes[currentNodeIndex].parentNodeIndex)
+		{
+			++mNodes[currentNodeIndex].numberOfSubtreeSceneItems;
+		}
+	}
+
+	void SceneItemOctree::unlinkSceneItem(uint32_t sceneItemIndex)
+	{
+		// Remove the scene item from the linked list of the node
+		const uint32_t nodeIndex = mSceneItemNodeIndex[sceneItemIndex];
+		const uint32_t previousSceneItemIndex = mPreviousSceneItemIndex[sceneItemIndex];
+		const uint32_t nextSceneItemIndex = mNextSceneItemIndex[sceneItemIndex];
+		if (isValid(previousSceneItemIndex))
+		{
+			mNextSceneItemIndex[previousSceneItemIndex] = nextSceneItemIndex;
+		}
+		else
+		{
+			ASSERT(mNodes[nodeIndex].firstSceneItemIndex == sceneItemIndex, "Invalid loose octree linked list")
+			mNodes[nodeIndex].firstSceneItemIndex = nextSceneItemIndex;
+		}
+		if (isValid(nextSceneItemIndex))
+		{
+			mPreviousSceneItemIndex[nextSceneItemIndex] = previousSceneItemIndex;
+		}
+		mSceneItemNodeIndex[sceneItemIndex] = getInvalid<uint32_t>();
+
+		// Update the subtree scene item counters up to the root node
+		for (uint32_t currentNodeIndex = nodeIndex; isValid(currentNodeIndex); currentNodeIndex = mNodes[currentNodeIndex].parentNodeIndex)
+		{
+			ASSERT(mNodes[currentNodeIndex].numberOfSubtreeSceneItems > 0, "Invalid loose octree subtree scene item counter")
+			--mNodes[currentNodeIndex].numberOfSubtreeSceneItems;
+		}
+	}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
@@ -0,0 +1,221 @@
+/*********************************************************\
+ * Copyright (c) 2012-2021 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/Core/GetInvalid.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4127)	// warning C4127: conditional expression is constant
+	PRAGMA_WARNING_DISABLE_MSVC(4201)	// warning C4201: nonstandard extension used: nameless struct/union
+	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
+	PRAGMA_WARNING_DISABLE_MSVC(4324)	// warning C4324: '<x>': structure was padded due to alignment specifier
+	#include <glm/glm.hpp>
+PRAGMA_WARNING_POP
+
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	#include <vector>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Forward declarations                                  ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+	class Frustum;
+	struct SceneItemSet;
+}
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Loose octree spatial acceleration structure on top of a scene item set
+	*
+	*  @remarks
+	*    The loose octree is an optional hierarchical culling layer: whole subtrees outside the frustum are rejected before the
+	*    SIMD per scene item culling runs, subtrees fully inside the frustum skip the frustum-sphere culling. A scene item is stored
+	*    inside the deepest node which cell contains the bounding sphere center and which half size is still greater or equal to
+	*    the bounding sphere radius. Since nodes have loose bounds of twice their cell size, the bounding sphere is always enclosed
+	*    by the loose node bounds. Scene items not fitting into the root node are stored inside a special unbounded node which is
+	*    never rejected.
+	*
+	*    The loose octree is maintained incrementally: "Renderer::SceneNode" marks scene items with changed bounding spheres as
+	*    dirty and only those are reinserted on the next update. Reinsertion is just a linked list unlink and link since a scene
+	*    item stays inside its node as long as it doesn't change cell or size category.
+	*
+	*  @note
+	*    - Basing on "Loose Octrees" by Thatcher Ulrich, "Game Programming Gems", 2000
+	*    - Works on the same bounding sphere data the SIMD frustum-sphere culling is using
+	*    - Nodes are created lazily and never destroyed, intended for large mostly static scenes
+	*/
+	class SceneItemOctree final
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		typedef std::vector<uint32_t> SceneItemIndices;
+		static constexpr uint32_t MAXIMUM_DEPTH = 16;	///< Upper bound for the maximum depth, root node has depth 0
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] sceneItemSet
+		*    Scene item set to build the loose octree for, must stay valid as long as the loose octree instance exists, the loose octree registers itself at the scene item set
+		*  @param[in] rootHalfSize
+		*    Half world space size of the root node cell, centered at the world space origin
+		*  @param[in] maximumDepth
+		*    Maximum loose octree depth, must not be greater as "Renderer::SceneItemOctree::MAXIMUM_DEPTH"
+		*/
+		SceneItemOctree(SceneItemSet& sceneItemSet, float rootHalfSize, uint32_t maximumDepth);
+
+		/**
+		*  @brief
+		*    Destructor, unregisters the loose octree at the scene item set
+		*/
+		~SceneItemOctree();
+
+		/**
+		*  @brief
+		*    Inform the loose octree that the bounding sphere of a scene item has been changed
+		*
+		*  @param[in] sceneItemIndex
+		*    Index of the scene item inside the scene item set
+		*/
+		inline void markSceneItemDirty(uint32_t sceneItemIndex)
+		{
+			// Scene items which haven't been inserted, yet, are going to be inserted during the next update anyway
+			if (sceneItemIndex < mNumberOfInsertedSceneItems && !mSceneItemDirty[sceneItemIndex])
+			{
+				mSceneItemDirty[sceneItemIndex] = true;
+				mDirtySceneItemIndices.push_back(sceneItemIndex);
+			}
+		}
+
+		/**
+		*  @brief
+		*    Insert new scene items and reinsert dirty scene items
+		*
+		*  @note
+		*    - Must not be called concurrently to "Renderer::SceneItemOctree::gatherSceneItems()"
+		*/
+		void update();
+
+		/**
+		*  @brief
+		*    Gather the scene items of all loose octree nodes which aren't outside of the given frustum
+		*
+		*  @param[in] cameraRelativeFrustum
+		*    Camera relative world space frustum, plane normals point into the frustum
+		*  @param[in] worldSpaceCameraPosition
+		*    32 bit world space camera position the frustum is relative to
+		*  @param[out] intersectingSceneItemIndices
+		*    Receives the indices of the scene items inside loose octree nodes intersecting the frustum, those still need the per scene item culling, list is cleared before it's filled
+		*  @param[out] insideSceneItemIndices
+		*    Receives the indices of the scene items inside loose octree nodes fully inside the frustum, those are known to pass the frustum-sphere culling, list is cleared before it's filled
+		*
+		*  @note
+		*    - Thread safe as long as there's no concurrent "Renderer::SceneItemOctree::update()"
+		*/
+		void gatherSceneItems(const Frustum& cameraRelativeFrustum, const glm::vec3& worldSpaceCameraPosition, SceneItemIndices& intersectingSceneItemIndices, SceneItemIndices& insideSceneItemIndices) const;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		static constexpr uint32_t UNBOUNDED_NODE_INDEX = 0;	///< Node for scene items which aren't fitting into the root node, never rejected
+		static constexpr uint32_t ROOT_NODE_INDEX	   = 1;
+
+		struct Node final
+		{
+			glm::vec3 center;							///< 32 bit world space cell center
+			float	  halfSize;							///< Half cell size, the loose bounds have twice the cell size
+			uint32_t  parentNodeIndex;					///< Parent node index, invalid for the unbounded and root node
+			uint32_t  childNodeIndices[8];				///< Child node indices, invalid if there's no child node
+			uint32_t  firstSceneItemIndex;				///< Head of the linked list of scene items inside this node, invalid if there are no scene items
+			uint32_t  numberOfSubtreeSceneItems;		///< Number of scene items inside this node and all its child nodes, used to skip empty subtrees
+		};
+		typedef std::vector<Node> Nodes;
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit SceneItemOctree(const SceneItemOctree&) = delete;
+		SceneItemOctree& operator=(const SceneItemOctree&) = delete;
+		[[nodiscard]] uint32_t getNodeIndex(const glm::vec3& spherePosition, float radius);
+		void linkSceneItem(uint32_t sceneItemIndex, uint32_t nodeIndex);
+		void unlinkSceneItem(uint32_t sceneItemIndex);
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		SceneItemSet&		  mSceneItemSet;
+		uint32_t			  mMaximumDepth;
+		Nodes				  mNodes;
+		uint32_t			  mNumberOfInsertedSceneItems;
+		// Per scene item data, indexed by the scene item set index
+		std::vector<uint32_t> mSceneItemNodeIndex;			///< Index of the node the scene item is inside
+		std::vector<uint32_t> mPreviousSceneItemIndex;		///< Linked list of scene items inside the same node, invalid if there's no previous scene item
+		std::vector<uint32_t> mNextSceneItemIndex;			///< Linked list of scene items inside the same node, invalid if there's no next scene item
+		std::vector<bool>	  mSceneItemDirty;				///< Is the scene item already inside the dirty scene items list?
+		SceneItemIndices	  mDirtySceneItemIndices;		///< Scene items with changed bounding sphere which need to be reinserted
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
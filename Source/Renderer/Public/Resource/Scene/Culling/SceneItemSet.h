@@ -27,26 +27,7 @@
 //[-------------------------------------------------------]
 //[ Includes                                              ]
 //[-------------------------------------------------------]
-// Disable warnings in external headers, we can't fix them
-PRAGMA_WARNING_PUSH
-	PRAGMA_WARNING_DISABLE_MSVC(4100)	// warning C4100: 'address': unreferenced formal parameter
-	PRAGMA_WARNING_DISABLE_MSVC(4242)	// warning C4242: '=': conversion from 'int' to 'T', possible loss of data
-	PRAGMA_WARNING_DISABLE_MSVC(4244)	// warning C4244: '=': conversion from 'int' to 'T', possible loss of data
-	PRAGMA_WARNING_DISABLE_MSVC(4324)	// warning C4324: 'xsimd::hadd::<unnamed-tag>': structure was padded due to alignment specifier
-	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: '=': conversion from 'uint32_t' to 'int32_t', signed/unsigned mismatch
-	PRAGMA_WARNING_DISABLE_MSVC(4464)	// warning C4464: relative include path contains '..'
-	PRAGMA_WARNING_DISABLE_MSVC(4505)	// warning C4505: 'xsimd::detail::__ieee754_rem_pio2': unreferenced local function has been removed
-	PRAGMA_WARNING_DISABLE_MSVC(4530)	// warning C4530: C++ exception handler used, but unwind semantics are not enabled. Specify /EHsc
-	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
-	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt_base': assignment operator was implicitly defined as deleted
-	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
-	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
-	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
-	#define XSIMD_INSTR_SET_NOT_AVAILABLE 0	// warning C4668: 'XSIMD_INSTR_SET_NOT_AVAILABLE' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
-	#define XSIMD_FORCE_X86_INSTR_SET XSIMD_X86_SSE4_2_VERSION	// TODO(co) How to use xsimd correctly to get rid of errors like "error C2440: 'initializing': cannot convert from 'xsimd::simd_batch_traits<xsimd::batch<float,8>>::batch_bool_type' to 'xsimd::batch_bool<float,4>'" when using "Advanced Vector Extensions 2 (/arch:AVX2)"?
-	#include <xsimd/xsimd.hpp>
-PRAGMA_WARNING_POP
-
+#include <new>
 #include <vector>
 
 
@@ -56,6 +37,7 @@ PRAGMA_WARNING_POP
 namespace Renderer
 {
 	class ISceneItem;
+	class SceneItemOctree;
 }
 
 
@@ -66,9 +48,114 @@ namespace Renderer
 {
 
 
+	//[-------------------------------------------------------]
+	//[ Global definitions                                    ]
+	//[-------------------------------------------------------]
+	static constexpr uint32_t SCENE_ITEM_SET_SIMD_LANE_COUNT = 4;	///< Number of floats processed at once by the scene culling, the culling implementation ensures it matches its SIMD instruction set
+	static constexpr size_t	  SCENE_ITEM_SET_SIMD_ALIGNMENT	 = 16;	///< Alignment in bytes of the scene item set arrays, the culling implementation ensures it matches its SIMD instruction set
+
+
 	//[-------------------------------------------------------]
 	//[ Classes                                               ]
 	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Standard library allocator returning memory aligned for aligned SIMD loads and stores
+	*
+	*  @note
+	*    - Used instead of the "xsimd" allocator so the SIMD library stays an implementation detail of the scene culling
+	*/
+	template <typename T>
+	class SceneItemSetAllocator
+	{
+	public:
+		typedef T value_type;
+
+		inline SceneItemSetAllocator() noexcept
+		{}
+
+		template <typename U>
+		inline SceneItemSetAllocator(const SceneItemSetAllocator<U>&) noexcept
+		{}
+
+		[[nodiscard]] inline T* allocate(size_t numberOfElements)
+		{
+			return static_cast<T*>(::operator new(numberOfElements * sizeof(T), std::align_val_t(SCENE_ITEM_SET_SIMD_ALIGNMENT)));
+		}
+
+		inline void deallocate(T* pointer, size_t) noexcept
+		{
+			::operator delete(pointer, std::align_val_t(SCENE_ITEM_SET_SIMD_ALIGNMENT));
+		}
+
+		template <typename U>
+		[[nodiscard]] inline bool operator ==(const SceneItemSetAllocator<U>&) const noexcept
+		{
+			return true;
+		}
+
+		template <typename U>
+		[[nodiscard]] inline bool operator !=(const SceneItemSetAllocator<U>&) const noexcept
+		{
+			return false;
+		}
+	};
+
+	/**
+	*  @brief
+	*    Non-owning view onto the structure of arrays of a scene item set
+	*
+	*  @remarks
+	*    Culling jobs work on this view instead of on the scene item set itself. The view is just a bunch of raw
+	*    pointers, so handing it to a job is cheap and never causes a heap allocation.
+	*
+	*  @note
+	*    - The view is only valid as long as the scene item set isn't resized
+	*/
+	struct SceneItemSetView final
+	{
+		// Minimum object space bounding box corner position
+		const float* minimumX;
+		const float* minimumY;
+		const float* minimumZ;
+
+		// Maximum object space bounding box corner position
+		const float* maximumX;
+		const float* maximumY;
+		const float* maximumZ;
+
+		// Object space to world space matrix
+		const float* worldXX;
+		const float* worldXY;
+		const float* worldXZ;
+		const float* worldXW;
+		const float* worldYX;
+		const float* worldYY;
+		const float* worldYZ;
+		const float* worldYW;
+		const float* worldZX;
+		const float* worldZY;
+		const float* worldZZ;
+		const float* worldZW;
+		const float* worldWX;
+		const float* worldWY;
+		const float* worldWZ;
+		const float* worldWW;
+
+		// 32 bit world space position center of bounding sphere
+		const float* spherePositionX;
+		const float* spherePositionY;
+		const float* spherePositionZ;
+
+		// Negative world space radius of bounding sphere
+		const float* negativeRadius;
+
+		// Flag to indicate if an object is culled or not, the only data written by culling jobs
+		uint32_t* visibilityFlag;
+
+		uint32_t numberOfSceneItems;
+	};
+
 	/**
 	*  @brief
 	*    Scene item set
@@ -83,10 +170,10 @@ namespace Renderer
 		//[-------------------------------------------------------]
 		//[ Public definitions                                    ]
 		//[-------------------------------------------------------]
-		typedef std::vector<float, xsimd::aligned_allocator<float, XSIMD_DEFAULT_ALIGNMENT>>			 FloatVector;
-		typedef std::vector<double, xsimd::aligned_allocator<double, XSIMD_DEFAULT_ALIGNMENT>>			 DoubleVector;
-		typedef std::vector<uint32_t, xsimd::aligned_allocator<uint32_t, XSIMD_DEFAULT_ALIGNMENT>>		 IntegerVector;
-		typedef std::vector<ISceneItem*, xsimd::aligned_allocator<ISceneItem*, XSIMD_DEFAULT_ALIGNMENT>> SceneItemVector;	// TODO(co) No raw pointers here (no smart pointers either, handles please)
+		typedef std::vector<float, SceneItemSetAllocator<float>>			   FloatVector;
+		typedef std::vector<double, SceneItemSetAllocator<double>>			   DoubleVector;
+		typedef std::vector<uint32_t, SceneItemSetAllocator<uint32_t>>		   IntegerVector;
+		typedef std::vector<ISceneItem*, SceneItemSetAllocator<ISceneItem*>> SceneItemVector;	// TODO(co) No raw pointers here (no smart pointers either, handles please)
 
 
 		//[-------------------------------------------------------]
@@ -138,6 +225,113 @@ namespace Renderer
 
 		uint32_t numberOfSceneItems = 0;
 
+		// Optional spatial acceleration structure which needs to be informed about bounding sphere changes, can be a null pointer, don't destroy the instance
+		SceneItemOctree* sceneItemOctree = nullptr;
+
+
+		//[-------------------------------------------------------]
+		//[ Public methods                                        ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Add a scene item to the scene item set
+		*
+		*  @param[in] sceneItem
+		*    Scene item to add, must stay valid as long as it's part of the scene item set
+		*
+		*  @return
+		*    Index of the scene item inside the scene item set
+		*/
+		[[nodiscard]] inline uint32_t addSceneItem(ISceneItem& sceneItem)
+		{
+			const uint32_t sceneItemIndex = numberOfSceneItems;
+			resize(numberOfSceneItems + 1);
+			sceneItemVector[sceneItemIndex] = &sceneItem;
+
+			// Done
+			return sceneItemIndex;
+		}
+
+		/**
+		*  @brief
+		*    Set the number of scene items
+		*
+		*  @param[in] newNumberOfSceneItems
+		*    New number of scene items, the data of added scene items has to be set by the caller
+		*
+		*  @note
+		*    - The arrays are kept at a size which is a multiple of the SIMD lane count plus one additional SIMD lane count
+		*      for the prefetch of the next culling loop iteration, so culling never has to resize them
+		*    - Added scene items have no scene item instance, so they can only be culled but not rendered, handy for synthetic scene item sets like the ones of benchmarks
+		*/
+		inline void resize(uint32_t newNumberOfSceneItems)
+		{
+			numberOfSceneItems = newNumberOfSceneItems;
+
+			// Ensure the SIMD friendly array size
+			constexpr uint32_t simdSize = SCENE_ITEM_SET_SIMD_LANE_COUNT;
+			if (minimumX.size() < newNumberOfSceneItems + simdSize)
+			{
+				const uint32_t size = (newNumberOfSceneItems + simdSize - 1) / simdSize * simdSize + simdSize;
+
+				// Minimum object space bounding box corner position
+				minimumX.resize(size, -0.5f);
+				minimumY.resize(size, -0.5f);
+				minimumZ.resize(size, -0.5f);
+
+				// Maximum object space bounding box corner position
+				maximumX.resize(size, 0.5f);
+				maximumY.resize(size, 0.5f);
+				maximumZ.resize(size, 0.5f);
+
+				// Object space to world space matrix
+				worldXX.resize(size, 1.0f);
+				worldXY.resize(size, 0.0f);
+				worldXZ.resize(size, 0.0f);
+				worldXW.resize(size, 0.0f);
+				worldYX.resize(size, 0.0f);
+				worldYY.resize(size, 1.0f);
+				worldYZ.resize(size, 0.0f);
+				worldYW.resize(size, 0.0f);
+				worldZX.resize(size, 0.0f);
+				worldZY.resize(size, 0.0f);
+				worldZZ.resize(size, 1.0f);
+				worldZW.resize(size, 0.0f);
+				worldWX.resize(size, 0.0f);
+				worldWY.resize(size, 0.0f);
+				worldWZ.resize(size, 0.0f);
+				worldWW.resize(size, 1.0f);
+
+				// World space center position of bounding sphere
+				spherePositionX.resize(size, 0.0f);
+				spherePositionY.resize(size, 0.0f);
+				spherePositionZ.resize(size, 0.0f);
+
+				// Negative world space radius of bounding sphere
+				negativeRadius.resize(size, -1.0f);
+
+				visibilityFlag.resize(size, 0);
+				sceneItemVector.resize(size, nullptr);
+			}
+		}
+
+		[[nodiscard]] inline SceneItemSetView getView()
+		{
+			return SceneItemSetView
+			{
+				minimumX.data(), minimumY.data(), minimumZ.data(),
+				maximumX.data(), maximumY.data(), maximumZ.data(),
+				worldXX.data(), worldXY.data(), worldXZ.data(), worldXW.data(),
+				worldYX.data(), worldYY.data(), worldYZ.data(), worldYW.data(),
+				worldZX.data(), worldZY.data(), worldZZ.data(), worldZW.data(),
+				worldWX.data(), worldWY.data(), worldWZ.data(), worldWW.data(),
+				spherePositionX.data(), spherePositionY.data(), spherePositionZ.data(),
+				negativeRadius.data(),
+				visibilityFlag.data(),
+				numberOfSceneItems
+			};
+		}
+
 
 	};
 
@@ -24,6 +24,7 @@
 #include "Renderer/Public/Resource/Scene/Item/Mesh/MeshSceneItem.h"
 #include "Renderer/Public/Resource/Scene/Loader/SceneFileFormat.h"
 #include "Renderer/Public/Resource/Scene/Culling/SceneItemSet.h"
+#include "Renderer/Public/Resource/Scene/Culling/SceneItemOctree.h"
 #include "Renderer/Public/Resource/Scene/SceneResource.h"
 #include "Renderer/Public/Resource/Scene/SceneNode.h"
 #include "Renderer/Public/Resource/Mesh/MeshResourceManager.h"
@@ -182,6 +183,12 @@ namespace Renderer
 						}
 						mSceneItemSet->negativeRadius[mSceneItemSetIndex] = -boundingSphereRadius;
 					}
+
+					// Inform the optional spatial acceleration structure about the changed bounding sphere, the mesh might be loaded long after the scene item was positioned
+					if (nullptr != mSceneItemSet->sceneItemOctree)
+					{
+						mSceneItemSet->sceneItemOctree->markSceneItemDirty(mSceneItemSetIndex);
+					}
 				}
 
 				// Fill renderable manager
@@ -203,6 +210,7 @@ namespace Renderer
 						renderables.emplace_back(mRenderableManager, vertexArrayPtr, positionOnlyVertexArrayPtr, materialResourceManager, subMesh.getMaterialResourceId(), skeletonResourceId, true, subMesh.getStartIndexLocation(), subMesh.getNumberOfIndices(), 1 RHI_RESOURCE_DEBUG_NAME((std::string(debugName) + "[SubMesh" + std::to_string(i) + ']').c_str()));
 					}
 					mRenderableManager.setNumberOfLods(meshResource.getNumberOfLods());
+					mRenderableManager.setBoundingSphereRadius(meshResource.getBoundingSphereRadius());
 				}
 
 				// Handle overwritten sub-meshes
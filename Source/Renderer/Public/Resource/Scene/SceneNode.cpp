@@ -26,6 +26,7 @@
 #include "Renderer/Public/Resource/Scene/Item/ISceneItem.h"
 #include "Renderer/Public/Resource/Scene/Item/Mesh/MeshSceneItem.h"
 #include "Renderer/Public/Resource/Scene/Culling/SceneItemSet.h"
+#include "Renderer/Public/Resource/Scene/Culling/SceneItemOctree.h"
 #include "Renderer/Public/Resource/Mesh/MeshResourceManager.h"
 #include "Renderer/Public/Resource/Mesh/MeshResource.h"
 #include "Renderer/Public/IRenderer.h"
@@ -197,6 +198,12 @@ namespace Renderer
 				sceneItemSet->spherePositionY[sceneItemSetIndex] = static_cast<float>(mGlobalTransform.position.y);
 				sceneItemSet->spherePositionZ[sceneItemSetIndex] = static_cast<float>(mGlobalTransform.position.z);
 			}
+
+			// Inform the optional spatial acceleration structure about the changed bounding sphere
+			if (nullptr != sceneItemSet->sceneItemOctree)
+			{
+				sceneItemSet->sceneItemOctree->markSceneItemDirty(sceneItemSetIndex);
+			}
 		}
 	}
 
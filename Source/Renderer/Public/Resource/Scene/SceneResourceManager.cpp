@@ -91,7 +91,16 @@ namespace Renderer
 
 	void SceneResourceManager::destroySceneResource(SceneResourceId sceneResourceId)
 	{
-		mInternalResourceManager->getResources().removeElement(sceneResourceId);
+		// The resource might still be in-flight inside the resource streamer, in this case it's destroyed as soon as the cancelled load request has been finalized
+		// -> Until then, asset lookups must create a new resource instead of reusing the one which is about to be destroyed
+		if (mInternalResourceManager->getRenderer().getResourceStreamer().cancelLoadRequest(*this, sceneResourceId, true))
+		{
+			mInternalResourceManager->setResourceAssetId(mInternalResourceManager->getResources().getElementById(sceneResourceId), getInvalid<AssetId>());
+		}
+		else
+		{
+			mInternalResourceManager->removeResource(sceneResourceId);
+		}
 	}
 
 	void SceneResourceManager::setInvalidResourceId(SceneResourceId& sceneResourceId, IResourceListener& resourceListener) const
@@ -147,6 +156,11 @@ namespace Renderer
 		return mInternalResourceManager->createResourceLoaderInstance(resourceLoaderTypeId);
 	}
 
+	void SceneResourceManager::destroyResourceByResourceId(ResourceId resourceId)
+	{
+		mInternalResourceManager->removeResource(resourceId);
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -40,7 +40,7 @@ namespace Renderer
 	class SceneResource;
 	class IRenderer;
 	class SceneResourceLoader;
-	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class ResourceManagerTemplate;
+	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_PAGE> class ResourceManagerTemplate;
 }
 
 
@@ -115,6 +115,7 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	private:
 		[[nodiscard]] virtual IResourceLoader* createResourceLoaderInstance(ResourceLoaderTypeId resourceLoaderTypeId) override;
+		virtual void destroyResourceByResourceId(ResourceId resourceId) override;
 
 
 	//[-------------------------------------------------------]
@@ -642,7 +642,7 @@ namespace
 			return retVal;
 		}
 
-		[[nodiscard]] bool evaluateExpression(const Rhi::Context& context, const Renderer::ShaderProperties& shaderProperties, SubStringRef& outSubString, bool& outSyntaxError)
+		bool parseExpression(const Rhi::Context& context, const Renderer::ShaderProperties& shaderProperties, SubStringRef& outSubString, ExpressionVec& outExpressions, bool& outSyntaxError)
 		{
 			const size_t expEnd = evaluateExpressionEnd(context, outSubString);
 			if (std::string::npos == expEnd)
@@ -660,7 +660,6 @@ namespace
 			bool nextExpressionNegates = false;
 
 			std::vector<Expression*> expressionParents;
-			ExpressionVec outExpressions;
 			outExpressions.clear();
 			outExpressions.resize(1);
 
@@ -752,6 +751,12 @@ namespace
 			return retVal;
 		}
 
+		[[nodiscard]] bool evaluateExpression(const Rhi::Context& context, const Renderer::ShaderProperties& shaderProperties, SubStringRef& outSubString, bool& outSyntaxError)
+		{
+			ExpressionVec outExpressions;
+			return parseExpression(context, shaderProperties, outSubString, outExpressions, outSyntaxError);
+		}
+
 		void evaluateParamArgs(const Rhi::Context& context, SubStringRef& outSubString, StringVector& outArgs, bool& outSyntaxError)
 		{
 			const size_t expEnd = evaluateExpressionEnd(context, outSubString);
@@ -861,6 +866,556 @@ namespace
 			}
 		}
 
+		[[nodiscard]] size_t findMathOperation(const std::string& inBuffer, const SubStringRef& subString, size_t pos, size_t& keyword)
+		{
+			keyword = static_cast<size_t>(~0);
+
+			while (std::string::npos != pos && static_cast<size_t>(~0) == keyword)
+			{
+				size_t maxSize = subString.findFirstOf(" \t(", pos + 1);
+				maxSize = (std::string::npos == maxSize) ? subString.getSize() : maxSize;
+				const SubStringRef keywordStr(&inBuffer, subString.getStart() + pos + 1, subString.getStart() + maxSize);
+
+				for (size_t i = 0; i < 8 && static_cast<size_t>(~0) == keyword; ++i)
+				{
+					if (keywordStr.matchEqual(c_operations[i].opName))
+					{
+						keyword = i;
+					}
+				}
+
+				if (static_cast<size_t>(~0) == keyword)
+				{
+					pos = subString.find("@", pos + 1);
+				}
+			}
+
+			return pos;
+		}
+
+		void parseShaderTemplateOperand(const std::string& value, Renderer::ShaderTemplate::Operand& operand)
+		{
+			char* endPtr = nullptr;
+			operand.value = static_cast<int32_t>(strtol(value.c_str(), &endPtr, 10));
+			operand.isShaderProperty = (value.c_str() == endPtr);	// Not a number, interpret as property
+			operand.shaderPropertyId = operand.isShaderProperty ? Renderer::StringId(value.c_str()).getId() : 0;
+		}
+
+		[[nodiscard]] int32_t getShaderTemplateOperandValue(const Renderer::ShaderProperties& shaderProperties, const Renderer::ShaderTemplate::Operand& operand)
+		{
+			int32_t value = operand.value;
+			if (operand.isShaderProperty)
+			{
+				// If it's no property default to 0 (property might have been optimized out)
+				shaderProperties.getPropertyValue(operand.shaderPropertyId, value);
+			}
+			return value;
+		}
+
+		// Strips "@pset", "@padd" & co. from the given buffer and records them as math operations, returns true on syntax error
+		bool parseMathOperations(const Rhi::Context& context, const std::string& inBuffer, std::string& outBuffer, Renderer::ShaderTemplate::MathOperations& mathOperations)
+		{
+			outBuffer.clear();
+			outBuffer.reserve(inBuffer.size());
+
+			StringVector argValues;
+			SubStringRef subString(&inBuffer, 0);
+
+			size_t keyword = static_cast<size_t>(~0);
+			size_t pos = findMathOperation(inBuffer, subString, subString.find("@"), keyword);
+
+			bool syntaxError = false;
+
+			while (std::string::npos != pos && !syntaxError)
+			{
+				// Copy what comes before the block
+				copy(outBuffer, subString, pos);
+
+				subString.setStart(subString.getStart() + pos + c_operations[keyword].length);
+				evaluateParamArgs(context, subString, argValues, syntaxError);
+
+				syntaxError |= (argValues.size() < 2 || argValues.size() > 3);
+
+				if (syntaxError)
+				{
+					const unsigned long lineCount = static_cast<unsigned long>(calculateLineCount(subString));
+					if (keyword <= 1)
+					{
+						RHI_LOG(context, CRITICAL, "Renderer shader builder: Syntax error at line %lu: @%s expects one parameter", lineCount, c_operations[keyword].opName)
+					}
+					else
+					{
+						RHI_LOG(context, CRITICAL, "Renderer shader builder: Syntax error at line %lu: @%s expects two or three parameters", lineCount, c_operations[keyword].opName)
+					}
+				}
+				else
+				{
+					Renderer::ShaderTemplate::MathOperation mathOperation;
+					mathOperation.operation = static_cast<uint32_t>(keyword);
+					mathOperation.destinationShaderPropertyId = Renderer::StringId(argValues[0].c_str()).getId();
+					mathOperation.sourceShaderPropertyId = mathOperation.destinationShaderPropertyId;
+					size_t idx = 1;
+					if (argValues.size() == 3)
+					{
+						mathOperation.sourceShaderPropertyId = Renderer::StringId(argValues[idx++].c_str()).getId();
+					}
+					parseShaderTemplateOperand(argValues[idx], mathOperation.operand);
+					mathOperations.push_back(mathOperation);
+				}
+
+				pos = findMathOperation(inBuffer, subString, subString.find("@"), keyword);
+			}
+
+			copy(outBuffer, subString, subString.getSize());
+
+			return syntaxError;
+		}
+
+		void executeMathOperations(const Renderer::ShaderTemplate::MathOperations& mathOperations, Renderer::ShaderProperties& shaderProperties)
+		{
+			for (const Renderer::ShaderTemplate::MathOperation& mathOperation : mathOperations)
+			{
+				int32_t op1Value = 0;
+				shaderProperties.getPropertyValue(mathOperation.sourceShaderPropertyId, op1Value);
+				const int32_t op2Value = getShaderTemplateOperandValue(shaderProperties, mathOperation.operand);
+				shaderProperties.setPropertyValue(mathOperation.destinationShaderPropertyId, c_operations[mathOperation.operation].opFunc(op1Value, op2Value));
+			}
+		}
+
+		[[nodiscard]] bool evaluateShaderTemplateExpression(const Renderer::ShaderTemplate::ExpressionNodes& expressionNodes, const Renderer::ShaderTemplate::ExpressionNode& expressionNode, const Renderer::ShaderProperties& shaderProperties)
+		{
+			bool result = true;
+			if (Renderer::ShaderTemplate::ExpressionType::VARIABLE == expressionNode.type)
+			{
+				result = (shaderProperties.getPropertyValueUnsafe(expressionNode.shaderPropertyId) != 0);
+			}
+			else
+			{
+				// Same left to right combination as "::detail::evaluateExpressionRecursive()"
+				bool andMode = true;
+				for (uint32_t i = 0; i < expressionNode.numberOfChildren; ++i)
+				{
+					const Renderer::ShaderTemplate::ExpressionNode& childExpressionNode = expressionNodes[expressionNode.firstChild + i];
+					if (Renderer::ShaderTemplate::ExpressionType::OPERATOR_OR == childExpressionNode.type)
+					{
+						andMode = false;
+					}
+					else if (Renderer::ShaderTemplate::ExpressionType::OPERATOR_AND == childExpressionNode.type)
+					{
+						andMode = true;
+					}
+					else if (andMode)
+					{
+						result &= evaluateShaderTemplateExpression(expressionNodes, childExpressionNode, shaderProperties);
+					}
+					else
+					{
+						result |= evaluateShaderTemplateExpression(expressionNodes, childExpressionNode, shaderProperties);
+					}
+				}
+			}
+			return expressionNode.negated ? !result : result;
+		}
+
+		/**
+		*  @brief
+		*    Internal helper class compiling the text of a shader template into instructions, using the same scans as the string-rewriting passes
+		*/
+		class ShaderTemplateCompiler final
+		{
+		public:
+			inline ShaderTemplateCompiler(const Rhi::Context& context, const std::string& text, Renderer::ShaderTemplate::ExpressionNodes& expressionNodes, Renderer::ShaderTemplate::ForEaches& forEaches, Renderer::ShaderTemplate::Instructions& instructions) :
+				mContext(context),
+				mText(text),
+				mExpressionNodes(expressionNodes),
+				mForEaches(forEaches),
+				mInstructions(instructions),
+				mCurrentForEachBlock(nullptr)
+			{
+				// Nothing here
+			}
+
+			inline ~ShaderTemplateCompiler()
+			{
+				// Nothing here
+			}
+
+			// Returns false if the text can't be represented exactly by instructions
+			[[nodiscard]] inline bool compile()
+			{
+				return (gatherForEachBlocks() && compileRange(0, mText.size()));
+			}
+
+		private:
+			struct ForEachBlock final
+			{
+				size_t		start;		///< Position of "@foreach"
+				size_t		bodyStart;
+				size_t		bodyEnd;	///< Position of the closing "@end"
+				size_t		end;		///< Position behind the closing "@end" including the character consumed with it
+				std::string	counterVariable;
+			};
+			typedef std::vector<ForEachBlock> ForEachBlocks;
+			typedef std::vector<size_t>		  Positions;
+
+			explicit ShaderTemplateCompiler(const ShaderTemplateCompiler&) = delete;
+			ShaderTemplateCompiler& operator=(const ShaderTemplateCompiler&) = delete;
+
+			[[nodiscard]] bool gatherForEachBlocks()
+			{
+				// Same scan as "Renderer::ShaderBuilder::parseForEach()", "@foreach" blocks are expanded in a single flat pass
+				StringVector argValues;
+				SubStringRef subString(&mText, 0);
+				size_t pos = subString.find("@foreach");
+				bool syntaxError = false;
+				while (std::string::npos != pos)
+				{
+					ForEachBlock forEachBlock;
+					forEachBlock.start = subString.getStart() + pos;
+					subString.setStart(forEachBlock.start + sizeof("@foreach"));
+					evaluateParamArgs(mContext, subString, argValues, syntaxError);
+					SubStringRef blockSubString = subString;
+					findBlockEnd(mContext, blockSubString, syntaxError);
+					if (syntaxError)
+					{
+						return false;
+					}
+					forEachBlock.bodyStart = blockSubString.getStart();
+					forEachBlock.bodyEnd = blockSubString.getEnd();
+					subString.setStart(blockSubString.getEnd() + sizeof("@end"));
+					forEachBlock.end = subString.getStart();
+
+					// Nested "@foreach" blocks are copied verbatim by the string-rewriting passes, and a "@" consumed together with the
+					// closing "@end" hides the following directive from all later passes but not from the block scans of the shader template
+					if (mText.find("@foreach", forEachBlock.bodyStart) < forEachBlock.bodyEnd || (forEachBlock.end > forEachBlock.bodyEnd + sizeof("@end") - 1 && '@' == mText[forEachBlock.end - 1]))
+					{
+						return false;
+					}
+
+					Renderer::ShaderTemplate::ForEach forEach;
+					parseShaderTemplateOperand(argValues[0], forEach.count);
+					forEach.start = 0;
+					if (argValues.size() > 1)
+					{
+						forEachBlock.counterVariable = argValues[1];
+					}
+					if (argValues.size() > 2)
+					{
+						// A shader property start is rare, leave its error handling to the string-rewriting passes
+						Renderer::ShaderTemplate::Operand start;
+						parseShaderTemplateOperand(argValues[2], start);
+						if (start.isShaderProperty)
+						{
+							return false;
+						}
+						forEach.start = start.value;
+					}
+					mForEaches.push_back(forEach);
+					mForEachBlocks.push_back(forEachBlock);
+
+					pos = subString.find("@foreach");
+				}
+				return true;
+			}
+
+			[[nodiscard]] bool gatherCounterPositions(const ForEachBlock& forEachBlock)
+			{
+				// Same matching as "::detail::repeat()", the counter variable is replaced before any other directive is looked for
+				mCounterPositions.clear();
+				const std::string& counterVariable = forEachBlock.counterVariable;
+				if (!counterVariable.empty())
+				{
+					static const constexpr char* keywords[] = { "end", "else", "foreach", "property", "piece" };
+					for (size_t pos = mText.find('@', forEachBlock.bodyStart); pos < forEachBlock.bodyEnd; pos = mText.find('@', pos + 1))
+					{
+						if (0 == mText.compare(pos + 1, counterVariable.size(), counterVariable))
+						{
+							if (pos + 1 + counterVariable.size() > forEachBlock.bodyEnd)
+							{
+								return false;
+							}
+							for (const char* keyword : keywords)
+							{
+								if (0 == mText.compare(pos + 1, strlen(keyword), keyword))
+								{
+									return false;
+								}
+							}
+							mCounterPositions.push_back(pos);
+						}
+					}
+				}
+				return true;
+			}
+
+			// Checks a range consumed by a directive
+			[[nodiscard]] bool isConsumedRangeValid(size_t begin, size_t end, size_t rangeEnd) const
+			{
+				// The consumed range mustn't reach into text which the string-rewriting passes concatenate with something else
+				if (end > rangeEnd)
+				{
+					return false;
+				}
+
+				// "@foreach" blocks and counter variables are expanded before "@property" is looked at
+				for (const ForEachBlock& forEachBlock : mForEachBlocks)
+				{
+					if (forEachBlock.start >= begin && forEachBlock.start < end)
+					{
+						return false;
+					}
+				}
+				if (nullptr != mCurrentForEachBlock)
+				{
+					const size_t counterVariableLength = mCurrentForEachBlock->counterVariable.size() + 1;
+					for (const size_t counterPosition : mCounterPositions)
+					{
+						if (counterPosition < end && counterPosition + counterVariableLength > begin)
+						{
+							return false;
+						}
+					}
+				}
+				return true;
+			}
+
+			[[nodiscard]] bool emitText(size_t begin, size_t end)
+			{
+				if (begin < end)
+				{
+					if (nullptr != mCurrentForEachBlock)
+					{
+						// Split the text at the counter variables
+						const size_t counterVariableLength = mCurrentForEachBlock->counterVariable.size() + 1;
+						for (const size_t counterPosition : mCounterPositions)
+						{
+							if (counterPosition >= begin && counterPosition < end)
+							{
+								if (counterPosition + counterVariableLength > end)
+								{
+									return false;
+								}
+								if (counterPosition > begin)
+								{
+									mInstructions.push_back({Renderer::ShaderTemplate::OpCode::TEXT, static_cast<uint32_t>(begin), static_cast<uint32_t>(counterPosition - begin)});
+								}
+								mInstructions.push_back({Renderer::ShaderTemplate::OpCode::COUNTER, 0, 0});
+								begin = counterPosition + counterVariableLength;
+							}
+						}
+					}
+					if (begin < end)
+					{
+						mInstructions.push_back({Renderer::ShaderTemplate::OpCode::TEXT, static_cast<uint32_t>(begin), static_cast<uint32_t>(end - begin)});
+					}
+				}
+
+				// The string-rewriting passes concatenate the text with the following one, a trailing "@"-token could become a directive
+				if (end < mText.size())
+				{
+					for (size_t pos = end; pos > 0; --pos)
+					{
+						const char character = mText[pos - 1];
+						if ('@' == character)
+						{
+							return false;
+						}
+						else if (!isalnum(static_cast<unsigned char>(character)) && '_' != character)
+						{
+							break;
+						}
+					}
+				}
+				return true;
+			}
+
+			[[nodiscard]] uint32_t compileExpression(const Expression& expression)
+			{
+				const uint32_t index = static_cast<uint32_t>(mExpressionNodes.size());
+				mExpressionNodes.push_back(makeExpressionNode(expression));
+				compileExpressionChildren(index, expression);
+				return index;
+			}
+
+			void compileExpressionChildren(uint32_t index, const Expression& expression)
+			{
+				// The child expression nodes are stored consecutively, so add them before recursing
+				const uint32_t firstChild = static_cast<uint32_t>(mExpressionNodes.size());
+				for (const Expression& childExpression : expression.children)
+				{
+					mExpressionNodes.push_back(makeExpressionNode(childExpression));
+				}
+				mExpressionNodes[index].firstChild = firstChild;
+				mExpressionNodes[index].numberOfChildren = static_cast<uint32_t>(expression.children.size());
+				for (size_t i = 0; i < expression.children.size(); ++i)
+				{
+					compileExpressionChildren(firstChild + static_cast<uint32_t>(i), expression.children[i]);
+				}
+			}
+
+			[[nodiscard]] Renderer::ShaderTemplate::ExpressionNode makeExpressionNode(const Expression& expression) const
+			{
+				Renderer::ShaderTemplate::ExpressionNode expressionNode;
+				switch (expression.type)
+				{
+					case EXPR_OPERATOR_OR:
+						expressionNode.type = Renderer::ShaderTemplate::ExpressionType::OPERATOR_OR;
+						break;
+
+					case EXPR_OPERATOR_AND:
+						expressionNode.type = Renderer::ShaderTemplate::ExpressionType::OPERATOR_AND;
+						break;
+
+					case EXPR_OBJECT:
+						expressionNode.type = Renderer::ShaderTemplate::ExpressionType::OBJECT;
+						break;
+
+					case EXPR_VAR:
+					default:
+						expressionNode.type = Renderer::ShaderTemplate::ExpressionType::VARIABLE;
+						break;
+				}
+				expressionNode.negated = expression.negated;
+				expressionNode.shaderPropertyId = (EXPR_VAR == expression.type) ? Renderer::StringId(expression.value.c_str()).getId() : 0;
+				expressionNode.firstChild = 0;
+				expressionNode.numberOfChildren = 0;
+				return expressionNode;
+			}
+
+			[[nodiscard]] bool compileRange(size_t begin, size_t end)
+			{
+				size_t position = begin;
+				while (position < end)
+				{
+					// Find the next "@property" or "@foreach" block inside the range, whichever comes first
+					size_t propertyPosition = mText.find("@property", position);
+					if (propertyPosition >= end)
+					{
+						propertyPosition = std::string::npos;
+					}
+					const ForEachBlock* forEachBlock = nullptr;
+					if (nullptr == mCurrentForEachBlock)
+					{
+						for (const ForEachBlock& candidateForEachBlock : mForEachBlocks)
+						{
+							if (candidateForEachBlock.start >= position)
+							{
+								if (candidateForEachBlock.start < end && candidateForEachBlock.start < propertyPosition)
+								{
+									forEachBlock = &candidateForEachBlock;
+								}
+								break;
+							}
+						}
+					}
+					if (nullptr == forEachBlock && std::string::npos == propertyPosition)
+					{
+						return emitText(position, end);
+					}
+					if (!emitText(position, (nullptr != forEachBlock) ? forEachBlock->start : propertyPosition))
+					{
+						return false;
+					}
+
+					if (nullptr != forEachBlock)
+					{
+						// "@foreach"
+						if (forEachBlock->end > end)
+						{
+							return false;
+						}
+						const uint32_t forEachIndex = static_cast<uint32_t>(forEachBlock - mForEachBlocks.data());
+						const size_t forEachInstructionIndex = mInstructions.size();
+						mInstructions.push_back({Renderer::ShaderTemplate::OpCode::FOREACH, forEachIndex, 0});
+						if (!gatherCounterPositions(*forEachBlock))
+						{
+							return false;
+						}
+						mCurrentForEachBlock = forEachBlock;
+						const uint32_t bodyInstructionIndex = static_cast<uint32_t>(mInstructions.size());
+						if (!compileRange(forEachBlock->bodyStart, forEachBlock->bodyEnd))
+						{
+							return false;
+						}
+						mCurrentForEachBlock = nullptr;
+						mInstructions.push_back({Renderer::ShaderTemplate::OpCode::FOREACH_END, bodyInstructionIndex, 0});
+						mInstructions[forEachInstructionIndex].b = static_cast<uint32_t>(mInstructions.size());
+						position = forEachBlock->end;
+					}
+					else
+					{
+						// "@property"
+						SubStringRef subString(&mText, 0);
+						subString.setStart(propertyPosition + sizeof("@property"));
+						ExpressionVec expressions;
+						bool syntaxError = false;
+						parseExpression(mContext, mEmptyShaderProperties, subString, expressions, syntaxError);
+						if (syntaxError || !isConsumedRangeValid(propertyPosition, subString.getStart(), end))
+						{
+							return false;
+						}
+						SubStringRef blockSubString = subString;
+						const bool isElse = findBlockEnd(mContext, blockSubString, syntaxError, true);
+						if (syntaxError || blockSubString.getEnd() > end)
+						{
+							return false;
+						}
+						const size_t propertyInstructionIndex = mInstructions.size();
+						mInstructions.push_back({Renderer::ShaderTemplate::OpCode::PROPERTY, compileExpression(expressions[0]), 0});
+						if (!compileRange(blockSubString.getStart(), blockSubString.getEnd()))
+						{
+							return false;
+						}
+						if (isElse)
+						{
+							const size_t elsePosition = blockSubString.getEnd();
+							subString.setStart(elsePosition + sizeof("@else"));
+							if (!isConsumedRangeValid(elsePosition, subString.getStart(), end))
+							{
+								return false;
+							}
+							blockSubString = subString;
+							findBlockEnd(mContext, blockSubString, syntaxError);
+							if (syntaxError || blockSubString.getEnd() > end)
+							{
+								return false;
+							}
+							const size_t jumpInstructionIndex = mInstructions.size();
+							mInstructions.push_back({Renderer::ShaderTemplate::OpCode::JUMP, 0, 0});
+							mInstructions[propertyInstructionIndex].b = static_cast<uint32_t>(mInstructions.size());
+							if (!compileRange(blockSubString.getStart(), blockSubString.getEnd()))
+							{
+								return false;
+							}
+							mInstructions[jumpInstructionIndex].a = static_cast<uint32_t>(mInstructions.size());
+						}
+						else
+						{
+							mInstructions[propertyInstructionIndex].b = static_cast<uint32_t>(mInstructions.size());
+						}
+						const size_t endPosition = blockSubString.getEnd();
+						subString.setStart(endPosition + sizeof("@end"));
+						if (!isConsumedRangeValid(endPosition, subString.getStart(), end))
+						{
+							return false;
+						}
+						position = subString.getStart();
+					}
+				}
+				return true;
+			}
+
+			const Rhi::Context&							mContext;
+			const std::string&							mText;
+			Renderer::ShaderTemplate::ExpressionNodes&	mExpressionNodes;
+			Renderer::ShaderTemplate::ForEaches&		mForEaches;
+			Renderer::ShaderTemplate::Instructions&		mInstructions;
+			Renderer::ShaderProperties					mEmptyShaderProperties;	///< "@property" expressions are only parsed at compile time
+			ForEachBlocks								mForEachBlocks;			///< Same order as "mForEaches"
+			const ForEachBlock*							mCurrentForEachBlock;	///< "@foreach" block which body is currently compiled, can be a null pointer
+			Positions									mCounterPositions;		///< Counter variable positions inside the body of "mCurrentForEachBlock"
+		};
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -876,6 +1431,28 @@ namespace Renderer
 {
 
 
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	void ShaderBuilder::compileShaderTemplate(const Rhi::Context& context, const std::string& sourceCode, ShaderTemplate& shaderTemplate)
+	{
+		shaderTemplate.clear();
+
+		// The math operations don't depend on the shader properties, the instructions are compiled on the text without them
+		if (!::detail::parseMathOperations(context, sourceCode, shaderTemplate.mText, shaderTemplate.mMathOperations))
+		{
+			::detail::ShaderTemplateCompiler shaderTemplateCompiler(context, shaderTemplate.mText, shaderTemplate.mExpressionNodes, shaderTemplate.mForEaches, shaderTemplate.mInstructions);
+			shaderTemplate.mCompiled = shaderTemplateCompiler.compile();
+		}
+
+		// Not representable shader source code falls back to the string-rewriting passes, which also report the syntax errors for each build
+		if (!shaderTemplate.mCompiled)
+		{
+			shaderTemplate.clear();
+		}
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
@@ -899,14 +1476,8 @@ namespace Renderer
 					buildShader.assetIds.push_back(shaderPieceResource->getAssetId());
 					combinedAssetFileHashes = Math::calculateFNV1a64(reinterpret_cast<const uint8_t*>(&assetManager.getAssetByAssetId(shaderPieceResource->getAssetId()).fileHash), sizeof(uint64_t), combinedAssetFileHashes);
 
-					// Initialize
-					mInString = shaderPieceResource->getShaderSourceCode();
-					mOutString.clear();
-
 					// Process
-					parseMath(mInString, mOutString);
-					parseForEach(mOutString, mInString);
-					parseProperties(mInString, mOutString);
+					evaluateShaderPropertyDependentPasses(shaderPieceResource->getShaderSourceCode(), shaderPieceResource->getShaderTemplate());
 					collectPieces(mOutString, mInString);
 					parseCounter(mInString, mOutString);
 				}
@@ -919,15 +1490,8 @@ namespace Renderer
 		}
 
 		{ // Process the shader blueprint resource
-			// Initialize
-			mInString = shaderBlueprintResource.getShaderSourceCode();
-			mOutString.clear();
-
 			// Process
-			bool syntaxError = false;
-			syntaxError |= parseMath(mInString, mOutString);
-			syntaxError |= parseForEach(mOutString, mInString);
-			syntaxError |= parseProperties(mInString, mOutString);
+			bool syntaxError = evaluateShaderPropertyDependentPasses(shaderBlueprintResource.getShaderSourceCode(), shaderBlueprintResource.getShaderTemplate());
 			while (!syntaxError && (mOutString.find("@piece") != std::string::npos || mOutString.find("@insertpiece") != std::string::npos))
 			{
 				syntaxError |= collectPieces(mOutString, mInString);
@@ -945,114 +1509,109 @@ namespace Renderer
 	}
 
 
+	bool ShaderBuilder::evaluateShaderSourceCode(const std::string& sourceCode, const ShaderTemplate& shaderTemplate, const ShaderProperties& shaderProperties, std::string& evaluatedSourceCode)
+	{
+		mShaderProperties = shaderProperties;
+		const bool syntaxError = evaluateShaderPropertyDependentPasses(sourceCode, shaderTemplate);
+		evaluatedSourceCode = mOutString;
+		return syntaxError;
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
-	bool ShaderBuilder::parseMath(const std::string& inBuffer, std::string& outBuffer)
+	bool ShaderBuilder::evaluateShaderPropertyDependentPasses(const std::string& sourceCode, const ShaderTemplate& shaderTemplate)
 	{
-		outBuffer.clear();
-		outBuffer.reserve(inBuffer.size());
-
-		::detail::StringVector argValues;
-		::detail::SubStringRef subString(&inBuffer, 0);
-
-		size_t pos = subString.find("@");
-		size_t keyword = static_cast<size_t>(~0);
-
-		while (std::string::npos != pos && static_cast<size_t>(~0) == keyword)
+		// A compiled shader template is evaluated in a single pass, else the shader source code runs through the string-rewriting passes
+		bool syntaxError = false;
+		if (shaderTemplate.isCompiled())
 		{
-			size_t maxSize = subString.findFirstOf(" \t(", pos + 1);
-			maxSize = (std::string::npos == maxSize) ? subString.getSize() : maxSize;
-			::detail::SubStringRef keywordStr(&inBuffer, subString.getStart() + pos + 1, subString.getStart() + maxSize);
-
-			for (size_t i = 0; i < 8 && static_cast<size_t>(~0) == keyword; ++i)
-			{
-				if (keywordStr.matchEqual(::detail::c_operations[i].opName))
-				{
-					keyword = i;
-				}
-			}
-
-			if (static_cast<size_t>(~0) == keyword)
-			{
-				pos = subString.find("@", pos + 1);
-			}
+			evaluateShaderTemplate(shaderTemplate, mOutString);
 		}
-
-		bool syntaxError = false;
-
-		while (std::string::npos != pos && !syntaxError)
+		else
 		{
-			// Copy what comes before the block
-			copy(outBuffer, subString, pos);
+			mInString = sourceCode;
+			mOutString.clear();
+			syntaxError |= parseMath(mInString, mOutString);
+			syntaxError |= parseForEach(mOutString, mInString);
+			syntaxError |= parseProperties(mInString, mOutString);
+		}
+		return syntaxError;
+	}
 
-			subString.setStart(subString.getStart() + pos + ::detail::c_operations[keyword].length);
-			evaluateParamArgs(mContext, subString, argValues, syntaxError);
+	bool ShaderBuilder::parseMath(const std::string& inBuffer, std::string& outBuffer)
+	{
+		// Scanning doesn't depend on the shader properties, so strip first and then execute the collected math operations in order
+		ShaderTemplate::MathOperations mathOperations;
+		const bool syntaxError = ::detail::parseMathOperations(mContext, inBuffer, outBuffer, mathOperations);
+		::detail::executeMathOperations(mathOperations, mShaderProperties);
+		return syntaxError;
+	}
 
-			syntaxError |= (argValues.size() < 2 || argValues.size() > 3);
+	void ShaderBuilder::evaluateShaderTemplate(const ShaderTemplate& shaderTemplate, std::string& outBuffer)
+	{
+		// Math operations first, just like "Renderer::ShaderBuilder::parseMath()"
+		::detail::executeMathOperations(shaderTemplate.mMathOperations, mShaderProperties);
 
-			if (syntaxError)
-			{
-				const unsigned long lineCount = static_cast<unsigned long>(calculateLineCount(subString));
-				if (keyword <= 1)
-				{
-					RHI_LOG(mContext, CRITICAL, "Renderer shader builder: Syntax error at line %lu: @%s expects one parameter", lineCount, ::detail::c_operations[keyword].opName)
-				}
-				else
-				{
-					RHI_LOG(mContext, CRITICAL, "Renderer shader builder: Syntax error at line %lu: @%s expects two or three parameters", lineCount, ::detail::c_operations[keyword].opName)
-				}
-			}
-			else
+		// Single pass over the instructions replaces "Renderer::ShaderBuilder::parseForEach()" and "Renderer::ShaderBuilder::parseProperties()"
+		outBuffer.clear();
+		outBuffer.reserve(shaderTemplate.mText.size());
+		const ShaderTemplate::Instructions& instructions = shaderTemplate.mInstructions;
+		const size_t numberOfInstructions = instructions.size();
+		int32_t counter = 0;
+		int32_t count = 0;
+		size_t instructionIndex = 0;
+		while (instructionIndex < numberOfInstructions)
+		{
+			const ShaderTemplate::Instruction& instruction = instructions[instructionIndex];
+			++instructionIndex;
+			switch (instruction.opCode)
 			{
-				StringId dstProperty = StringId(argValues[0].c_str());
-				size_t idx  = 1;
-				StringId srcProperty = dstProperty;
-				if (argValues.size() == 3)
-				{
-					srcProperty = StringId(argValues[idx++].c_str());
-				}
-				int op1Value = 0;
-				mShaderProperties.getPropertyValue(srcProperty, op1Value);
-				char* endPtr = nullptr;
-				int op2Value = strtol(argValues[idx].c_str(), &endPtr, 10);
-				if (argValues[idx].c_str() == endPtr)
+				case ShaderTemplate::OpCode::TEXT:
+					outBuffer.append(shaderTemplate.mText, instruction.a, instruction.b);
+					break;
+
+				case ShaderTemplate::OpCode::COUNTER:
 				{
-					// Not a number, interpret as property
-					mShaderProperties.getPropertyValue(StringId(argValues[idx].c_str()), op2Value);
+					char temp[16];
+					snprintf(temp, 16, "%lu", static_cast<unsigned long>(static_cast<size_t>(counter)));
+					outBuffer += temp;
+					break;
 				}
 
-				const int result = ::detail::c_operations[keyword].opFunc(op1Value, op2Value);
-				mShaderProperties.setPropertyValue(dstProperty, result);
-			}
+				case ShaderTemplate::OpCode::PROPERTY:
+					if (!::detail::evaluateShaderTemplateExpression(shaderTemplate.mExpressionNodes, shaderTemplate.mExpressionNodes[instruction.a], mShaderProperties))
+					{
+						instructionIndex = instruction.b;
+					}
+					break;
 
-			pos = subString.find("@");
-			keyword = static_cast<size_t>(~0);
+				case ShaderTemplate::OpCode::JUMP:
+					instructionIndex = instruction.a;
+					break;
 
-			while (std::string::npos != pos && static_cast<size_t>(~0) == keyword)
-			{
-				size_t maxSize = subString.findFirstOf(" \t(", pos + 1);
-				maxSize = (maxSize == std::string::npos) ? subString.getSize() : maxSize;
-				::detail::SubStringRef keywordStr(&inBuffer, subString.getStart() + pos + 1, subString.getStart() + maxSize);
-
-				for (size_t i = 0; i < 8 && static_cast<size_t>(~0) == keyword; ++i)
+				case ShaderTemplate::OpCode::FOREACH:
 				{
-					if (keywordStr.matchEqual(::detail::c_operations[i].opName))
+					const ShaderTemplate::ForEach& forEach = shaderTemplate.mForEaches[instruction.a];
+					count = ::detail::getShaderTemplateOperandValue(mShaderProperties, forEach.count);
+					counter = forEach.start;
+					if (counter >= count)
 					{
-						keyword = i;
+						instructionIndex = instruction.b;
 					}
+					break;
 				}
 
-				if (static_cast<size_t>(~0) == keyword)
-				{
-					pos = subString.find("@", pos + 1);
-				}
+				case ShaderTemplate::OpCode::FOREACH_END:
+					++counter;
+					if (counter < count)
+					{
+						instructionIndex = instruction.a;
+					}
+					break;
 			}
 		}
-
-		copy(outBuffer, subString, subString.getSize());
-
-		return syntaxError;
 	}
 
 	bool ShaderBuilder::parseForEach(const std::string& inBuffer, std::string& outBuffer) const
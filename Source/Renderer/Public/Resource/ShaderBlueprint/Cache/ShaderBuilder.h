@@ -28,6 +28,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/ShaderBlueprint/Cache/ShaderProperties.h"
+#include "Renderer/Public/Resource/ShaderBlueprint/Cache/ShaderTemplate.h"
 
 // Disable warnings in external headers, we can't fix them
 PRAGMA_WARNING_PUSH
@@ -100,6 +101,27 @@ namespace Renderer
 		};
 
 
+	//[-------------------------------------------------------]
+	//[ Public static methods                                 ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Compile shader source code into a shader template
+		*
+		*  @param[in] context
+		*    RHI context to use
+		*  @param[in] sourceCode
+		*    Shader blueprint or shader piece source code to compile
+		*  @param[out] shaderTemplate
+		*    Receives the compiled shader template, not compiled if the shader source code can't be represented exactly (see "Renderer::ShaderTemplate")
+		*
+		*  @note
+		*    - Meant to be called once after the shader source code has been loaded, the result is used by "Renderer::ShaderBuilder::createSourceCode()"
+		*/
+		RENDERER_API_EXPORT static void compileShaderTemplate(const Rhi::Context& context, const std::string& sourceCode, ShaderTemplate& shaderTemplate);
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
@@ -138,6 +160,28 @@ namespace Renderer
 		*/
 		void createSourceCode(const ShaderPieceResourceManager& shaderPieceResourceManager, const ShaderBlueprintResource& shaderBlueprintResource, const ShaderProperties& shaderProperties, BuildShader& buildShader);
 
+		/**
+		*  @brief
+		*    Evaluate the shader property dependent directives of shader source code
+		*
+		*  @param[in] sourceCode
+		*    Shader blueprint or shader piece source code to evaluate
+		*  @param[in] shaderTemplate
+		*    Shader template compiled from the given shader source code, if it isn't compiled the string-rewriting passes are used instead
+		*  @param[in] shaderProperties
+		*    Shader properties to use
+		*  @param[out] evaluatedSourceCode
+		*    Receives the evaluated shader source code
+		*
+		*  @return
+		*    "true" if there was a syntax error, else "false"
+		*
+		*  @note
+		*    - Covers the math operations, "@foreach" and "@property", but not "@piece", "@insertpiece", "@counter" & co. or the C-preprocessor
+		*    - Meant for comparing the shader template evaluation with the string-rewriting passes, "Renderer::ShaderBuilder::createSourceCode()" uses the same evaluation
+		*/
+		RENDERER_API_EXPORT bool evaluateShaderSourceCode(const std::string& sourceCode, const ShaderTemplate& shaderTemplate, const ShaderProperties& shaderProperties, std::string& evaluatedSourceCode);
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -145,7 +189,9 @@ namespace Renderer
 	private:
 		explicit ShaderBuilder(const ShaderBuilder&) = delete;
 		ShaderBuilder& operator=(const ShaderBuilder&) = delete;
+		bool evaluateShaderPropertyDependentPasses(const std::string& sourceCode, const ShaderTemplate& shaderTemplate);	// Result is written into "mOutString"
 		bool parseMath(const std::string& inBuffer, std::string& outBuffer);
+		void evaluateShaderTemplate(const ShaderTemplate& shaderTemplate, std::string& outBuffer);
 		bool parseForEach(const std::string& inBuffer, std::string& outBuffer) const;
 		bool parseProperties(std::string& inBuffer, std::string& outBuffer) const;
 		bool collectPieces(const std::string& inBuffer, std::string& outBuffer);
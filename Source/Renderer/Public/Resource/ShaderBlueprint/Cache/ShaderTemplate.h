@@ -0,0 +1,217 @@
+/*********************************************************\
+ * Copyright (c) 2012-2021 The Unrimp Team
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+ * and associated documentation files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy, modify, merge, publish,
+ * distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or
+ * substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+ * BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+ * DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+\*********************************************************/
+
+
+
+//[-------------------------------------------------------]
+//[ Header guard                                          ]
+//[-------------------------------------------------------]
+#pragma once
+
+
+//[-------------------------------------------------------]
+//[ Includes                                              ]
+//[-------------------------------------------------------]
+#include "Renderer/Public/Core/StringId.h"
+
+// Disable warnings in external headers, we can't fix them
+PRAGMA_WARNING_PUSH
+	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'argument': conversion from 'long' to 'unsigned int', signed/unsigned mismatch
+	PRAGMA_WARNING_DISABLE_MSVC(4571)	// warning C4571: Informational: catch(...) semantics changed since Visual C++ 7.1; structured exceptions (SEH) are no longer caught
+	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt<char16_t,char,_Mbstatet>': assignment operator was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
+	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#include <string>
+	#include <vector>
+PRAGMA_WARNING_POP
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+namespace Renderer
+{
+
+
+	//[-------------------------------------------------------]
+	//[ Classes                                               ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Shader template, shader blueprint or shader piece source code which was pre-parsed once into a compact instruction stream
+	*
+	*  @remarks
+	*    Without a shader template the shader builder runs the shader source code through several string-rewriting passes for each
+	*    new shader property combination. A shader template is compiled by "Renderer::ShaderBuilder::compileShaderTemplate()" as soon
+	*    as the shader source code has been loaded and covers the shader property dependent passes:
+	*    - "@pset", "@padd" & co. are collected into a list of math operations which is executed first
+	*    - "@foreach" and "@property"/"@else" blocks become jump instructions over the text in between
+	*    - "@property" expressions are parsed into expression nodes with already hashed shader property names
+	*    Each shader property combination is then produced by a single evaluation pass over the instructions, "@piece", "@insertpiece"
+	*    as well as "@counter", "@value" & co. are still processed on the comparatively small evaluation result.
+	*
+	*  @note
+	*    - The evaluation result is identical to the one of the string-rewriting passes; shader source code using constructs which
+	*      can't be represented exactly (e.g. nested "@foreach", a "@foreach" start which isn't a number or a "@foreach" counter variable
+	*      inside a "@property" expression) as well as shader source code with syntax errors isn't compiled and the shader builder
+	*      falls back to the string-rewriting passes
+	*/
+	class ShaderTemplate final
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Friends                                               ]
+	//[-------------------------------------------------------]
+		friend class ShaderBuilder;	// Is compiling and evaluating shader templates
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		enum class OpCode : uint8_t
+		{
+			TEXT,			///< Append "b" characters of the text starting at offset "a"
+			COUNTER,		///< Append the value of the "@foreach" counter variable
+			PROPERTY,		///< Jump to instruction "b" if the expression with root expression node "a" is false
+			JUMP,			///< Jump to instruction "a"
+			FOREACH,		///< Begin the "@foreach" loop "a", jump to instruction "b" if there's nothing to repeat
+			FOREACH_END		///< Jump back to the first instruction "a" of the "@foreach" loop if there are iterations left
+		};
+
+		enum class ExpressionType : uint8_t
+		{
+			OPERATOR_OR,	///< "||"
+			OPERATOR_AND,	///< "&&"
+			OBJECT,			///< "(...)", the child expression nodes are combined from left to right
+			VARIABLE		///< Shader property which is true if not zero
+		};
+
+		struct Instruction final
+		{
+			OpCode	 opCode;
+			uint32_t a;
+			uint32_t b;
+		};
+
+		struct Operand final
+		{
+			uint32_t shaderPropertyId;	///< "Renderer::ShaderPropertyId"-type, only valid if "isShaderProperty" is true
+			int32_t	 value;				///< Only valid if "isShaderProperty" is false
+			bool	 isShaderProperty;	///< "true" if the operand is a shader property, else it's a number
+		};
+
+		struct MathOperation final
+		{
+			uint32_t operation;						///< Index of the "@pset", "@padd" & co. math operation
+			uint32_t destinationShaderPropertyId;	///< "Renderer::ShaderPropertyId"-type
+			uint32_t sourceShaderPropertyId;		///< "Renderer::ShaderPropertyId"-type
+			Operand	 operand;
+		};
+
+		struct ExpressionNode final
+		{
+			ExpressionType type;
+			bool		   negated;
+			uint32_t	   shaderPropertyId;	///< "Renderer::ShaderPropertyId"-type, only valid for variables
+			uint32_t	   firstChild;			///< Index of the first child expression node, the child expression nodes are stored consecutively
+			uint32_t	   numberOfChildren;
+		};
+
+		struct ForEach final
+		{
+			Operand count;
+			int32_t start;
+		};
+
+		typedef std::vector<MathOperation>	MathOperations;
+		typedef std::vector<ExpressionNode> ExpressionNodes;
+		typedef std::vector<ForEach>		ForEaches;
+		typedef std::vector<Instruction>	Instructions;
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		inline ShaderTemplate() :
+			mCompiled(false)
+		{
+			// Nothing here
+		}
+
+		inline ~ShaderTemplate()
+		{
+			// Nothing here
+		}
+
+		/**
+		*  @brief
+		*    Return whether or not the shader template was compiled successfully
+		*
+		*  @return
+		*    "true" if the shader template can be evaluated, "false" if the shader builder has to use the string-rewriting passes
+		*/
+		[[nodiscard]] inline bool isCompiled() const
+		{
+			return mCompiled;
+		}
+
+		inline void clear()
+		{
+			mText.clear();
+			mMathOperations.clear();
+			mExpressionNodes.clear();
+			mForEaches.clear();
+			mInstructions.clear();
+			mCompiled = false;
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		explicit ShaderTemplate(const ShaderTemplate&) = delete;
+		ShaderTemplate& operator=(const ShaderTemplate&) = delete;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		std::string		mText;				///< Shader source code without math operations, referenced by the text instructions
+		MathOperations	mMathOperations;	///< Executed in order before the instructions
+		ExpressionNodes	mExpressionNodes;
+		ForEaches		mForEaches;
+		Instructions	mInstructions;
+		bool			mCompiled;
+
+
+	};
+
+
+//[-------------------------------------------------------]
+//[ Namespace                                             ]
+//[-------------------------------------------------------]
+} // Renderer
@@ -29,6 +29,7 @@
 #include "Renderer/Public/Resource/Material/MaterialResourceManager.h"
 #include "Renderer/Public/Resource/MaterialBlueprint/MaterialBlueprintResourceManager.h"
 #include "Renderer/Public/Resource/MaterialBlueprint/MaterialBlueprintResource.h"
+#include "Renderer/Public/Resource/ShaderBlueprint/Cache/ShaderBuilder.h"
 #include "Renderer/Public/IRenderer.h"
 
 #include <unordered_set>
@@ -113,6 +114,9 @@ namespace Renderer
 			// Read the shader blueprint ASCII source code
 			mMemoryFile.read(mShaderSourceCode, shaderBlueprintHeader.numberOfShaderSourceCodeBytes);
 			mShaderBlueprintResource->mShaderSourceCode.assign(mShaderSourceCode, mShaderSourceCode + shaderBlueprintHeader.numberOfShaderSourceCodeBytes);
+
+			// Pre-parse the shader source code once, the shader builder then evaluates the shader template for each shader property combination
+			ShaderBuilder::compileShaderTemplate(mRenderer.getRhi().getContext(), mShaderBlueprintResource->mShaderSourceCode, mShaderBlueprintResource->mShaderTemplate);
 		}
 	}
 
@@ -29,6 +29,7 @@
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/IResource.h"
 #include "Renderer/Public/Resource/ShaderBlueprint/Cache/ShaderProperties.h"
+#include "Renderer/Public/Resource/ShaderBlueprint/Cache/ShaderTemplate.h"
 
 // Disable warnings in external headers, we can't fix them
 PRAGMA_WARNING_PUSH
@@ -49,8 +50,8 @@ PRAGMA_WARNING_POP
 //[-------------------------------------------------------]
 namespace Renderer
 {
-	template <class ELEMENT_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class PackedElementManager;
-	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class ResourceManagerTemplate;
+	template <class ELEMENT_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_PAGE> class PackedElementManager;
+	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_PAGE> class ResourceManagerTemplate;
 }
 
 
@@ -134,6 +135,18 @@ namespace Renderer
 			return mShaderSourceCode;
 		}
 
+		/**
+		*  @brief
+		*    Return the shader template
+		*
+		*  @return
+		*    The shader template compiled from the shader source code, not compiled if the shader source code can't be represented by a shader template
+		*/
+		[[nodiscard]] inline const ShaderTemplate& getShaderTemplate() const
+		{
+			return mShaderTemplate;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -175,6 +188,7 @@ namespace Renderer
 			mIncludeShaderPieceResourceIds.clear();
 			mReferencedShaderProperties.clear();
 			mShaderSourceCode.clear();
+			mShaderTemplate.clear();
 
 			// Call base implementation
 			IResource::deinitializeElement();
@@ -188,6 +202,7 @@ namespace Renderer
 		IncludeShaderPieceResourceIds mIncludeShaderPieceResourceIds;
 		ShaderProperties			  mReferencedShaderProperties;	// Directly use "Renderer::ShaderProperties" to keep things simple, although we don't need a shader property value
 		std::string					  mShaderSourceCode;
+		ShaderTemplate				  mShaderTemplate;
 
 
 	};
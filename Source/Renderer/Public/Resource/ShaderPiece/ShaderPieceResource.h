@@ -28,6 +28,7 @@
 //[ Includes                                              ]
 //[-------------------------------------------------------]
 #include "Renderer/Public/Resource/IResource.h"
+#include "Renderer/Public/Resource/ShaderBlueprint/Cache/ShaderTemplate.h"
 
 // Disable warnings in external headers, we can't fix them
 PRAGMA_WARNING_PUSH
@@ -48,8 +49,8 @@ PRAGMA_WARNING_POP
 //[-------------------------------------------------------]
 namespace Renderer
 {
-	template <class ELEMENT_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class PackedElementManager;
-	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class ResourceManagerTemplate;
+	template <class ELEMENT_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_PAGE> class PackedElementManager;
+	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_PAGE> class ResourceManagerTemplate;
 }
 
 
@@ -101,6 +102,18 @@ namespace Renderer
 			return mShaderSourceCode;
 		}
 
+		/**
+		*  @brief
+		*    Return the shader template
+		*
+		*  @return
+		*    The shader template compiled from the shader source code, not compiled if the shader source code can't be represented by a shader template
+		*/
+		[[nodiscard]] inline const ShaderTemplate& getShaderTemplate() const
+		{
+			return mShaderTemplate;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -136,6 +149,7 @@ namespace Renderer
 		{
 			// Reset everything
 			mShaderSourceCode.clear();
+			mShaderTemplate.clear();
 
 			// Call base implementation
 			IResource::deinitializeElement();
@@ -146,7 +160,8 @@ namespace Renderer
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		std::string mShaderSourceCode;
+		std::string	   mShaderSourceCode;
+		ShaderTemplate mShaderTemplate;
 
 
 	};
@@ -36,7 +36,9 @@
 namespace Renderer
 {
 	class TextureResource;
-	template <class ELEMENT_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class PackedElementManager;
+	class ITextureResourceLoader;
+	template <class ELEMENT_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_PAGE> class PackedElementManager;
+	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_PAGE> class ResourceManagerTemplate;
 }
 
 
@@ -69,7 +71,8 @@ namespace Renderer
 	//[-------------------------------------------------------]
 		friend class TextureResourceManager;
 		friend class ITextureResourceLoader;
-		friend PackedElementManager<TextureResource, TextureResourceId, 2048>;	// Type definition of template class
+		friend PackedElementManager<TextureResource, TextureResourceId, 2048>;							// Type definition of template class
+		friend ResourceManagerTemplate<TextureResource, ITextureResourceLoader, TextureResourceId, 2048>;	// Type definition of template class
 
 
 	//[-------------------------------------------------------]
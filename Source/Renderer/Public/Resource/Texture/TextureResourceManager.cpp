@@ -219,9 +219,7 @@ namespace Renderer
 		bool load = (reload && nullptr != asset);
 		if (nullptr == textureResource && nullptr != asset)
 		{
-			textureResource = &mInternalResourceManager->getResources().addElement();
-			textureResource->setResourceManager(this);
-			textureResource->setAssetId(assetId);
+			textureResource = &mInternalResourceManager->addResource(assetId);
 			textureResource->setResourceLoaderTypeId(resourceLoaderTypeId);
 			textureResource->mRgbHardwareGammaCorrection = rgbHardwareGammaCorrection;
 			load = true;
@@ -303,9 +301,7 @@ namespace Renderer
 		RHI_ASSERT(mInternalResourceManager->getRenderer().getContext(), nullptr == getTextureResourceByAssetId(assetId), "The texture resource isn't allowed to exist, yet")
 
 		// Create the texture resource instance
-		TextureResource& textureResource = mInternalResourceManager->getResources().addElement();
-		textureResource.setResourceManager(this);
-		textureResource.setAssetId(assetId);
+		TextureResource& textureResource = mInternalResourceManager->addResource(assetId);
 		textureResource.mRgbHardwareGammaCorrection = rgbHardwareGammaCorrection;	// TODO(co) We might need to extend "Rhi::ITexture" so we can readback the texture format
 		textureResource.mTexture = &texture;
 
@@ -316,7 +312,16 @@ namespace Renderer
 
 	void TextureResourceManager::destroyTextureResource(TextureResourceId textureResourceId)
 	{
-		mInternalResourceManager->getResources().removeElement(textureResourceId);
+		// The resource might still be in-flight inside the resource streamer, in this case it's destroyed as soon as the cancelled load request has been finalized
+		// -> Until then, asset lookups must create a new resource instead of reusing the one which is about to be destroyed
+		if (mInternalResourceManager->getRenderer().getResourceStreamer().cancelLoadRequest(*this, textureResourceId, true))
+		{
+			mInternalResourceManager->setResourceAssetId(mInternalResourceManager->getResources().getElementById(textureResourceId), getInvalid<AssetId>());
+		}
+		else
+		{
+			mInternalResourceManager->removeResource(textureResourceId);
+		}
 	}
 
 	void TextureResourceManager::setInvalidResourceId(TextureResourceId& textureResourceId, IResourceListener& resourceListener) const
@@ -401,6 +406,11 @@ namespace Renderer
 		}
 	}
 
+	void TextureResourceManager::destroyResourceByResourceId(ResourceId resourceId)
+	{
+		mInternalResourceManager->removeResource(resourceId);
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -42,7 +42,7 @@ namespace Renderer
 	class TextureResource;
 	class IRenderer;
 	class ITextureResourceLoader;
-	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t MAXIMUM_NUMBER_OF_ELEMENTS> class ResourceManagerTemplate;
+	template <class TYPE, class LOADER_TYPE, typename ID_TYPE, uint32_t NUMBER_OF_ELEMENTS_PER_PAGE> class ResourceManagerTemplate;
 }
 
 
@@ -150,6 +150,7 @@ namespace Renderer
 	//[-------------------------------------------------------]
 	private:
 		[[nodiscard]] virtual IResourceLoader* createResourceLoaderInstance(ResourceLoaderTypeId resourceLoaderTypeId) override;
+		virtual void destroyResourceByResourceId(ResourceId resourceId) override;
 
 
 	//[-------------------------------------------------------]
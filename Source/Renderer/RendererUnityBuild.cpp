@@ -39,9 +39,12 @@
 #include "Public/Core/Platform/PlatformManager.cpp"
 #include "Public/Core/Renderer/FramebufferManager.cpp"
 #include "Public/Core/Renderer/FramebufferSignature.cpp"
+#include "Public/Core/Renderer/FrameUploadManager.cpp"
 #include "Public/Core/Renderer/RenderPassManager.cpp"
 #include "Public/Core/Renderer/RenderTargetTextureManager.cpp"
 #include "Public/Core/Renderer/RenderTargetTextureSignature.cpp"
+#include "Public/Core/Thread/JobSystem.cpp"
+#include "Public/Core/Thread/RenderThread.cpp"
 #include "Public/Core/Time/Stopwatch.cpp"
 #include "Public/Core/Time/TimeManager.cpp"
 #ifdef RENDERER_IMGUI
@@ -120,6 +123,7 @@
 #include "Public/Resource/Scene/SceneResourceManager.cpp"
 #include "Public/Resource/Scene/Factory/SceneFactory.cpp"
 #include "Public/Resource/Scene/Culling/SceneCullingManager.cpp"
+#include "Public/Resource/Scene/Culling/SceneItemOctree.cpp"
 #include "Public/Resource/Scene/Item/ISceneItem.cpp"
 #include "Public/Resource/Scene/Item/MaterialSceneItem.cpp"
 #include "Public/Resource/Scene/Item/Camera/CameraSceneItem.cpp"
@@ -106,6 +106,21 @@ namespace RendererToolkit
 		SHIPPING	///< Product is about to be shipped to clients, best possible speed as long as it finishes before the sun burns out
 	};
 
+	typedef std::unordered_map<uint32_t, std::vector<uint32_t>> MaterialBlueprintAssetIdToMaterialAssetIds;	///< Key = compiled material blueprint asset ID, value = sorted source asset IDs of the materials using the material blueprint
+
+	/**
+	*  @brief
+	*    Material blueprints used by the materials of the project, see "RendererToolkit::JsonMaterialBlueprintHelper::getMaterialAssetIdsUsingMaterialBlueprint()"
+	*
+	*  @note
+	*    - Resolving all materials is expensive, so this is gathered at most once per compilation run and reset as soon as the compilation run has been finished
+	*/
+	struct MaterialBlueprintUsage final
+	{
+		bool									   gathered = false;
+		MaterialBlueprintAssetIdToMaterialAssetIds materialBlueprintAssetIdToMaterialAssetIds;
+	};
+
 
 	//[-------------------------------------------------------]
 	//[ Classes                                               ]
@@ -142,10 +157,11 @@ namespace RendererToolkit
 			const CompiledAssetIdToSourceAssetId&	compiledAssetIdToSourceAssetId;
 			const SourceAssetIdToVirtualFilename&	sourceAssetIdToVirtualFilename;
 			const DefaultTextureAssetIds&			defaultTextureAssetIds;
+			MaterialBlueprintUsage&					materialBlueprintUsage;
 
 			Input() = delete;
 			Input(const Context& _context, const std::string _projectName, CacheManager& _cacheManager, const std::string& _virtualAssetPackageInputDirectory, const std::string& _virtualAssetFilename, const std::string& _virtualAssetInputDirectory,
-				  const std::string& _virtualAssetOutputDirectory, const SourceAssetIdToCompiledAssetId& _sourceAssetIdToCompiledAssetId, const CompiledAssetIdToSourceAssetId& _compiledAssetIdToSourceAssetId, const SourceAssetIdToVirtualFilename& _sourceAssetIdToVirtualFilename, const DefaultTextureAssetIds& _defaultTextureAssetIds) :
+				  const std::string& _virtualAssetOutputDirectory, const SourceAssetIdToCompiledAssetId& _sourceAssetIdToCompiledAssetId, const CompiledAssetIdToSourceAssetId& _compiledAssetIdToSourceAssetId, const SourceAssetIdToVirtualFilename& _sourceAssetIdToVirtualFilename, const DefaultTextureAssetIds& _defaultTextureAssetIds, MaterialBlueprintUsage& _materialBlueprintUsage) :
 				context(_context),
 				projectName(_projectName),
 				cacheManager(_cacheManager),
@@ -156,7 +172,8 @@ namespace RendererToolkit
 				sourceAssetIdToCompiledAssetId(_sourceAssetIdToCompiledAssetId),
 				compiledAssetIdToSourceAssetId(_compiledAssetIdToSourceAssetId),
 				sourceAssetIdToVirtualFilename(_sourceAssetIdToVirtualFilename),
-				defaultTextureAssetIds(_defaultTextureAssetIds)
+				defaultTextureAssetIds(_defaultTextureAssetIds),
+				materialBlueprintUsage(_materialBlueprintUsage)
 			{
 				// Nothing here
 			}
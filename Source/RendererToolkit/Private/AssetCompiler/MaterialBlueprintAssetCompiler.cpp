@@ -128,6 +128,13 @@ namespace
 			}
 		}
 
+		[[nodiscard]] Renderer::AssetId getMaterialBlueprintAssetId(const RendererToolkit::IAssetCompiler::Input& input)
+		{
+			// Source asset ID naming scheme "<name>.asset", see "RendererToolkit::ProjectImpl::readAssetPackageByDirectory()"
+			const std::string virtualAssetFilename = std_filesystem::path(input.virtualAssetFilename).replace_extension(".asset").generic_string();
+			return input.getCompiledAssetIdBySourceAssetId(Renderer::StringId::calculateFNV(virtualAssetFilename.c_str()));
+		}
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -156,6 +163,7 @@ namespace RendererToolkit
 		std::vector<std::string> virtualDependencyFilenames;
 		const std::string virtualInputFilename = input.virtualAssetInputDirectory + '/' + JsonHelper::getAssetInputFileByRapidJsonDocument(configuration.rapidJsonDocumentAsset);
 		JsonMaterialBlueprintHelper::getDependencyFiles(input, virtualInputFilename, virtualDependencyFilenames);
+		JsonMaterialBlueprintHelper::getMaterialDependencyFiles(input, ::detail::getMaterialBlueprintAssetId(input), virtualDependencyFilenames);
 		return (input.cacheManager.checkIfFileIsModified(configuration.rhiTarget, input.virtualAssetFilename, {virtualInputFilename}, getVirtualOutputAssetFilename(input, configuration), Renderer::v1MaterialBlueprint::FORMAT_VERSION) || input.cacheManager.dependencyFilesChanged(virtualDependencyFilenames));
 	}
 
@@ -174,8 +182,10 @@ namespace RendererToolkit
 		const std::string virtualOutputAssetFilename = getVirtualOutputAssetFilename(input, configuration);
 
 		// Read in dependency files
+		const Renderer::AssetId materialBlueprintAssetId = ::detail::getMaterialBlueprintAssetId(input);
 		std::vector<std::string> virtualDependencyFilenames;
 		JsonMaterialBlueprintHelper::getDependencyFiles(input, virtualInputFilename, virtualDependencyFilenames);
+		JsonMaterialBlueprintHelper::getMaterialDependencyFiles(input, materialBlueprintAssetId, virtualDependencyFilenames);
 
 		// Ask the cache manager whether or not we need to compile the source file (e.g. source changed or target not there)
 		CacheManager::CacheEntries cacheEntries;
@@ -225,12 +235,24 @@ namespace RendererToolkit
 					}
 				}
 
+				// Gather the shader combinations actually used by the materials of the project
+				// -> Those are compiled when the material blueprint gets loaded, so the runtime doesn't need to compile them on the fly
+				std::vector<Renderer::ShaderProperties> shaderCombinations;
+				uint32_t numberOfShaderCombinationShaderProperties = 0;
+				JsonMaterialBlueprintHelper::getShaderCombinationsUsedByMaterials(input, materialBlueprintAssetId, sortedMaterialPropertyVector, visualImportanceOfShaderProperties, shaderCombinations);
+				for (const Renderer::ShaderProperties& shaderProperties : shaderCombinations)
+				{
+					numberOfShaderCombinationShaderProperties += static_cast<uint32_t>(shaderProperties.getSortedPropertyVector().size());
+				}
+
 				{ // Write down the material blueprint header
 					Renderer::v1MaterialBlueprint::MaterialBlueprintHeader materialBlueprintHeader;
 					materialBlueprintHeader.numberOfProperties							= rapidJsonValueProperties.MemberCount();
 					materialBlueprintHeader.numberOfShaderCombinationProperties			= static_cast<uint32_t>(visualImportanceOfShaderPropertiesVector.size());
 					materialBlueprintHeader.numberOfIntegerShaderCombinationProperties	= static_cast<uint32_t>(maximumIntegerValueOfShaderPropertiesVector.size());	// Each integer shader combination property must have a defined maximum value
 					::detail::setMaterialBlueprintHeaderNumberOfResourcesByResourceGroups(rapidJsonValueResourceGroups, materialBlueprintHeader);
+					materialBlueprintHeader.numberOfShaderCombinations					= static_cast<uint32_t>(shaderCombinations.size());
+					materialBlueprintHeader.numberOfShaderCombinationShaderProperties	= numberOfShaderCombinationShaderProperties;
 					memoryFile.write(&materialBlueprintHeader, sizeof(Renderer::v1MaterialBlueprint::MaterialBlueprintHeader));
 				}
 
@@ -288,6 +310,21 @@ namespace RendererToolkit
 					// Textures
 					JsonMaterialBlueprintHelper::readTexturesByResourceGroups(input, sortedMaterialPropertyVector, rapidJsonValueResourceGroups, samplerBaseShaderRegisterNameToIndex, memoryFile);
 				}
+
+				// Write down the shader combinations used by the materials of the project
+				for (const Renderer::ShaderProperties& shaderProperties : shaderCombinations)
+				{
+					const uint32_t numberOfShaderProperties = static_cast<uint32_t>(shaderProperties.getSortedPropertyVector().size());
+					memoryFile.write(&numberOfShaderProperties, sizeof(uint32_t));
+				}
+				for (const Renderer::ShaderProperties& shaderProperties : shaderCombinations)
+				{
+					const Renderer::ShaderProperties::SortedPropertyVector& sortedPropertyVector = shaderProperties.getSortedPropertyVector();
+					if (!sortedPropertyVector.empty())
+					{
+						memoryFile.write(sortedPropertyVector.data(), sizeof(Renderer::ShaderProperties::Property) * sortedPropertyVector.size());
+					}
+				}
 			}
 
 			// Write LZ4 compressed output
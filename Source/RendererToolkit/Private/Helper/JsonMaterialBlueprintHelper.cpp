@@ -235,6 +235,21 @@ namespace
 			}
 		}
 
+		[[nodiscard]] bool isMaterialVirtualFilename(const std::string& virtualFilename)
+		{
+			// Only automatically in-memory generated ".asset"-files are considered, see "RendererToolkit::ProjectImpl::readAssetPackageByDirectory()"
+			return (std_filesystem::path(virtualFilename).extension().generic_string() == ".material");
+		}
+
+		[[nodiscard]] bool orderByShaderCombination(const Renderer::ShaderProperties& left, const Renderer::ShaderProperties& right)
+		{
+			return std::lexicographical_compare(left.getSortedPropertyVector().cbegin(), left.getSortedPropertyVector().cend(), right.getSortedPropertyVector().cbegin(), right.getSortedPropertyVector().cend(),
+				[](const Renderer::ShaderProperties::Property& leftProperty, const Renderer::ShaderProperties::Property& rightProperty)
+				{
+					return (leftProperty.shaderPropertyId != rightProperty.shaderPropertyId) ? (leftProperty.shaderPropertyId < rightProperty.shaderPropertyId) : (leftProperty.value < rightProperty.value);
+				});
+		}
+
 
 //[-------------------------------------------------------]
 //[ Anonymous detail namespace                            ]
@@ -566,7 +581,7 @@ namespace RendererToolkit
 		loadDocumentByFilename(input, virtualMaterialBlueprintFilename, rapidJsonDocument);
 		Renderer::ShaderProperties visualImportanceOfShaderProperties;
 		Renderer::ShaderProperties maximumIntegerValueOfShaderProperties;
-		const IAssetCompiler::Input materialBlueprintAssetInput(input.context, input.projectName, input.cacheManager, input.virtualAssetPackageInputDirectory, virtualMaterialBlueprintFilename, virtualMaterialBlueprintDirectory, input.virtualAssetOutputDirectory, input.sourceAssetIdToCompiledAssetId, input.compiledAssetIdToSourceAssetId, input.sourceAssetIdToVirtualFilename, input.defaultTextureAssetIds);
+		const IAssetCompiler::Input materialBlueprintAssetInput(input.context, input.projectName, input.cacheManager, input.virtualAssetPackageInputDirectory, virtualMaterialBlueprintFilename, virtualMaterialBlueprintDirectory, input.virtualAssetOutputDirectory, input.sourceAssetIdToCompiledAssetId, input.compiledAssetIdToSourceAssetId, input.sourceAssetIdToVirtualFilename, input.defaultTextureAssetIds, input.materialBlueprintUsage);
 		readProperties(materialBlueprintAssetInput, rapidJsonDocument["MaterialBlueprintAsset"]["Properties"], sortedMaterialPropertyVector, visualImportanceOfShaderProperties, maximumIntegerValueOfShaderProperties, true, true, false, materialPropertyIdToName);
 	}
 
@@ -1821,7 +1836,7 @@ namespace RendererToolkit
 			// Go down the rabbit hole recursively
 			try
 			{
-				const IAssetCompiler::Input materialBlueprintAssetInput(input.context, input.projectName, input.cacheManager, input.virtualAssetPackageInputDirectory, baseMaterialBlueprintVirtualInputFilename, std_filesystem::path(baseMaterialBlueprintVirtualInputFilename).parent_path().generic_string(), input.virtualAssetOutputDirectory, input.sourceAssetIdToCompiledAssetId, input.compiledAssetIdToSourceAssetId, input.sourceAssetIdToVirtualFilename, input.defaultTextureAssetIds);
+				const IAssetCompiler::Input materialBlueprintAssetInput(input.context, input.projectName, input.cacheManager, input.virtualAssetPackageInputDirectory, baseMaterialBlueprintVirtualInputFilename, std_filesystem::path(baseMaterialBlueprintVirtualInputFilename).parent_path().generic_string(), input.virtualAssetOutputDirectory, input.sourceAssetIdToCompiledAssetId, input.compiledAssetIdToSourceAssetId, input.sourceAssetIdToVirtualFilename, input.defaultTextureAssetIds, input.materialBlueprintUsage);
 				getDependencyFiles(materialBlueprintAssetInput, baseMaterialBlueprintVirtualInputFilename, virtualDependencyFilenames);
 			}
 			catch (const std::exception& e)
@@ -1831,6 +1846,131 @@ namespace RendererToolkit
 		}
 	}
 
+	const std::vector<uint32_t>& JsonMaterialBlueprintHelper::getMaterialAssetIdsUsingMaterialBlueprint(const IAssetCompiler::Input& input, Renderer::AssetId materialBlueprintAssetId)
+	{
+		// Resolve all materials of the project only once per compilation run instead of once per material blueprint
+		MaterialBlueprintUsage& materialBlueprintUsage = input.materialBlueprintUsage;
+		if (!materialBlueprintUsage.gathered)
+		{
+			MaterialBlueprintAssetIdToMaterialAssetIds& materialBlueprintAssetIdToMaterialAssetIds = materialBlueprintUsage.materialBlueprintAssetIdToMaterialAssetIds;
+			materialBlueprintAssetIdToMaterialAssetIds.clear();
+			for (const auto& pair : input.sourceAssetIdToVirtualFilename)
+			{
+				if (!::detail::isMaterialVirtualFilename(pair.second))
+				{
+					continue;
+				}
+
+				// Resolve the material techniques, base materials included
+				Renderer::MaterialProperties::SortedPropertyVector sortedMaterialPropertyVector;
+				std::vector<Renderer::v1Material::Technique> techniques;
+				try
+				{
+					JsonMaterialHelper::getPropertiesByMaterialAssetId(input, pair.first, sortedMaterialPropertyVector, &techniques);
+				}
+				catch (const std::exception& e)
+				{
+					throw std::runtime_error("Failed to gather the material blueprints used by material source asset \"" + pair.second + "\": " + std::string(e.what()));
+				}
+
+				// Register the material at each material blueprint one of its techniques is using
+				for (const Renderer::v1Material::Technique& technique : techniques)
+				{
+					std::vector<uint32_t>& materialAssetIds = materialBlueprintAssetIdToMaterialAssetIds[technique.materialBlueprintAssetId];
+					if (materialAssetIds.empty() || materialAssetIds.back() != pair.first)
+					{
+						materialAssetIds.push_back(pair.first);
+					}
+				}
+			}
+
+			// The source asset ID to virtual filename map is unordered, sort so the compiled output doesn't depend on the hash map iteration order
+			for (auto& pair : materialBlueprintAssetIdToMaterialAssetIds)
+			{
+				std::sort(pair.second.begin(), pair.second.end());
+			}
+			materialBlueprintUsage.gathered = true;
+		}
+
+		// Get the materials using the given material blueprint
+		static const std::vector<uint32_t> NO_MATERIAL_ASSET_IDS;
+		const MaterialBlueprintAssetIdToMaterialAssetIds::const_iterator iterator = materialBlueprintUsage.materialBlueprintAssetIdToMaterialAssetIds.find(materialBlueprintAssetId);
+		return (materialBlueprintUsage.materialBlueprintAssetIdToMaterialAssetIds.cend() != iterator) ? iterator->second : NO_MATERIAL_ASSET_IDS;
+	}
+
+	void JsonMaterialBlueprintHelper::getShaderCombinationsUsedByMaterials(const IAssetCompiler::Input& input, Renderer::AssetId materialBlueprintAssetId, const Renderer::MaterialProperties::SortedPropertyVector& sortedMaterialPropertyVector, const Renderer::ShaderProperties& visualImportanceOfShaderProperties, std::vector<Renderer::ShaderProperties>& shaderCombinations)
+	{
+		shaderCombinations.clear();
+		for (const uint32_t materialAssetId : getMaterialAssetIdsUsingMaterialBlueprint(input, materialBlueprintAssetId))
+		{
+			// Resolve the material properties, base materials included
+			Renderer::MaterialProperties::SortedPropertyVector sortedMaterialMaterialPropertyVector;
+			try
+			{
+				JsonMaterialHelper::getPropertiesByMaterialAssetId(input, materialAssetId, sortedMaterialMaterialPropertyVector);
+			}
+			catch (const std::exception& e)
+			{
+				throw std::runtime_error("Failed to gather the shader combinations used by material source asset " + input.sourceAssetIdToDebugName(materialAssetId) + ": " + std::string(e.what()));
+			}
+
+			// Gather the shader properties the same way "Renderer::MaterialBlueprintResource::optimizeShaderProperties()" will see them at runtime
+			// -> Global material property references can only be resolved by using the material blueprint fallback, the real global value is a runtime information
+			Renderer::ShaderProperties shaderProperties;
+			for (const Renderer::MaterialProperty& materialProperty : sortedMaterialMaterialPropertyVector)
+			{
+				if (materialProperty.getUsage() != Renderer::MaterialProperty::Usage::SHADER_COMBINATION || !visualImportanceOfShaderProperties.hasPropertyValue(materialProperty.getMaterialPropertyId()))
+				{
+					continue;
+				}
+				const Renderer::MaterialProperty* valueMaterialProperty = &materialProperty;
+				if (materialProperty.getValueType() == Renderer::MaterialPropertyValue::ValueType::GLOBAL_MATERIAL_PROPERTY_ID)
+				{
+					const Renderer::MaterialPropertyId globalMaterialPropertyId = materialProperty.getGlobalMaterialPropertyId();
+					Renderer::MaterialProperties::SortedPropertyVector::const_iterator iterator = std::lower_bound(sortedMaterialPropertyVector.cbegin(), sortedMaterialPropertyVector.cend(), globalMaterialPropertyId, Renderer::detail::OrderByMaterialPropertyId());
+					valueMaterialProperty = (iterator != sortedMaterialPropertyVector.cend() && iterator->getMaterialPropertyId() == globalMaterialPropertyId) ? &*iterator : nullptr;
+				}
+				if (nullptr != valueMaterialProperty)
+				{
+					int32_t value = 0;
+					if (valueMaterialProperty->getValueType() == Renderer::MaterialPropertyValue::ValueType::BOOLEAN)
+					{
+						value = valueMaterialProperty->getBooleanValue();
+					}
+					else if (valueMaterialProperty->getValueType() == Renderer::MaterialPropertyValue::ValueType::INTEGER)
+					{
+						value = valueMaterialProperty->getIntegerValue();
+					}
+					if (0 != value)
+					{
+						shaderProperties.setPropertyValue(materialProperty.getMaterialPropertyId(), value);
+					}
+				}
+			}
+
+			// Add the shader combination and avoid duplicates while doing so
+			std::vector<Renderer::ShaderProperties>::iterator iterator = std::lower_bound(shaderCombinations.begin(), shaderCombinations.end(), shaderProperties, ::detail::orderByShaderCombination);
+			if (iterator == shaderCombinations.end() || iterator->getSortedPropertyVector() != shaderProperties.getSortedPropertyVector())
+			{
+				shaderCombinations.insert(iterator, shaderProperties);
+			}
+		}
+	}
+
+	void JsonMaterialBlueprintHelper::getMaterialDependencyFiles(const IAssetCompiler::Input& input, Renderer::AssetId materialBlueprintAssetId, std::vector<std::string>& virtualDependencyFilenames)
+	{
+		// Only the materials using the material blueprint, either directly or via a base material, are dependencies
+		// -> A material which stopped using the material blueprint doesn't trigger a recompilation, the material blueprint just keeps a superfluous shader combination until it's compiled the next time
+		for (const uint32_t materialAssetId : getMaterialAssetIdsUsingMaterialBlueprint(input, materialBlueprintAssetId))
+		{
+			const std::string& virtualMaterialFilename = input.sourceAssetIdToVirtualAssetFilename(materialAssetId);
+			virtualDependencyFilenames.emplace_back(virtualMaterialFilename);
+			const std::string virtualMaterialDirectory = std_filesystem::path(virtualMaterialFilename).parent_path().generic_string();
+			const IAssetCompiler::Input materialAssetInput(input.context, input.projectName, input.cacheManager, input.virtualAssetPackageInputDirectory, virtualMaterialFilename, virtualMaterialDirectory, input.virtualAssetOutputDirectory, input.sourceAssetIdToCompiledAssetId, input.compiledAssetIdToSourceAssetId, input.sourceAssetIdToVirtualFilename, input.defaultTextureAssetIds, input.materialBlueprintUsage);
+			JsonMaterialHelper::getDependencyFiles(materialAssetInput, virtualMaterialFilename, virtualDependencyFilenames);
+		}
+	}
+
 
 //[-------------------------------------------------------]
 //[ Namespace                                             ]
@@ -86,6 +86,9 @@ namespace RendererToolkit
 		static void readSamplerStatesByResourceGroups(const rapidjson::Value& rapidJsonValueResourceGroups, const Renderer::MaterialProperties::SortedPropertyVector& sortedMaterialPropertyVector, Renderer::IFile& file, SamplerBaseShaderRegisterNameToIndex& samplerBaseShaderRegisterNameToIndex);
 		static void readTexturesByResourceGroups(const IAssetCompiler::Input& input, const Renderer::MaterialProperties::SortedPropertyVector& sortedMaterialPropertyVector, const rapidjson::Value& rapidJsonValueResourceGroups, const SamplerBaseShaderRegisterNameToIndex& samplerBaseShaderRegisterNameToIndex, Renderer::IFile& file);
 		static void getDependencyFiles(const IAssetCompiler::Input& input, const std::string& virtualInputFilename, std::vector<std::string>& virtualDependencyFilenames);
+		[[nodiscard]] static const std::vector<uint32_t>& getMaterialAssetIdsUsingMaterialBlueprint(const IAssetCompiler::Input& input, Renderer::AssetId materialBlueprintAssetId);
+		static void getShaderCombinationsUsedByMaterials(const IAssetCompiler::Input& input, Renderer::AssetId materialBlueprintAssetId, const Renderer::MaterialProperties::SortedPropertyVector& sortedMaterialPropertyVector, const Renderer::ShaderProperties& visualImportanceOfShaderProperties, std::vector<Renderer::ShaderProperties>& shaderCombinations);
+		static void getMaterialDependencyFiles(const IAssetCompiler::Input& input, Renderer::AssetId materialBlueprintAssetId, std::vector<std::string>& virtualDependencyFilenames);
 
 
 	//[-------------------------------------------------------]
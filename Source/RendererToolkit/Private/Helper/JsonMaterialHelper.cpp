@@ -581,7 +581,7 @@ namespace RendererToolkit
 		rapidjson::Document rapidJsonDocument;
 		JsonHelper::loadDocumentByFilename(input.context.getFileManager(), virtualMaterialFilename, "MaterialAsset", "1", rapidJsonDocument);
 		std::vector<Renderer::v1Material::Technique> temporaryTechniques;
-		const IAssetCompiler::Input materialAssetInput(input.context, input.projectName, input.cacheManager, input.virtualAssetPackageInputDirectory, virtualMaterialFilename, virtualMaterialDirectory, input.virtualAssetOutputDirectory, input.sourceAssetIdToCompiledAssetId, input.compiledAssetIdToSourceAssetId, input.sourceAssetIdToVirtualFilename, input.defaultTextureAssetIds);
+		const IAssetCompiler::Input materialAssetInput(input.context, input.projectName, input.cacheManager, input.virtualAssetPackageInputDirectory, virtualMaterialFilename, virtualMaterialDirectory, input.virtualAssetOutputDirectory, input.sourceAssetIdToCompiledAssetId, input.compiledAssetIdToSourceAssetId, input.sourceAssetIdToVirtualFilename, input.defaultTextureAssetIds, input.materialBlueprintUsage);
 		getTechniquesAndPropertiesByMaterialAssetId(materialAssetInput, rapidJsonDocument, (nullptr != techniques) ? *techniques : temporaryTechniques, sortedMaterialPropertyVector);
 	}
 
@@ -620,7 +620,7 @@ namespace RendererToolkit
 				// Go down the rabbit hole recursively
 				try
 				{
-					const IAssetCompiler::Input materialAssetInput(input.context, input.projectName, input.cacheManager, input.virtualAssetPackageInputDirectory, baseMaterialVirtualInputFilename, std_filesystem::path(baseMaterialVirtualInputFilename).parent_path().generic_string(), input.virtualAssetOutputDirectory, input.sourceAssetIdToCompiledAssetId, input.compiledAssetIdToSourceAssetId, input.sourceAssetIdToVirtualFilename, input.defaultTextureAssetIds);
+					const IAssetCompiler::Input materialAssetInput(input.context, input.projectName, input.cacheManager, input.virtualAssetPackageInputDirectory, baseMaterialVirtualInputFilename, std_filesystem::path(baseMaterialVirtualInputFilename).parent_path().generic_string(), input.virtualAssetOutputDirectory, input.sourceAssetIdToCompiledAssetId, input.compiledAssetIdToSourceAssetId, input.sourceAssetIdToVirtualFilename, input.defaultTextureAssetIds, input.materialBlueprintUsage);
 					getDependencyFiles(materialAssetInput, baseMaterialVirtualInputFilename, virtualDependencyFilenames);
 				}
 				catch (const std::exception& e)
@@ -108,6 +108,8 @@ namespace RendererToolkit
 		virtual void load(Renderer::AbsoluteDirectoryName absoluteDirectoryName) = 0;
 		virtual void importAssets(const AbsoluteFilenames& absoluteSourceFilenames, const std::string& targetAssetPackageName, const std::string& targetDirectoryName = "Imported") = 0;
 		virtual void compileAllAssets(const char* rhiTarget) = 0;
+		[[nodiscard]] virtual std::string getRhiName(const char* rhiTarget) const = 0;
+		virtual void compilePipelineStateObjectCache(Renderer::IRenderer& renderer, const char* rhiTarget) = 0;
 		virtual void startupAssetMonitor(Renderer::IRenderer& renderer, const char* rhiTarget) = 0;
 		virtual void shutdownAssetMonitor() = 0;
 
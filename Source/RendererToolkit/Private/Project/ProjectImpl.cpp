@@ -48,7 +48,11 @@
 #include <Renderer/Public/Core/File/IFileManager.h>
 #include <Renderer/Public/Core/File/FileSystemHelper.h>
 #include <Renderer/Public/Core/Platform/PlatformManager.h>
+#include <Renderer/Public/Resource/MaterialBlueprint/MaterialBlueprintResourceManager.h>
+#include <Renderer/Public/Resource/MaterialBlueprint/Cache/GraphicsPipelineStateCompiler.h>
+#include <Renderer/Public/Resource/MaterialBlueprint/Cache/ComputePipelineStateCompiler.h>
 #include <Renderer/Public/Asset/AssetPackage.h>
+#include <Renderer/Public/Asset/AssetManager.h>
 #include <Renderer/Public/Asset/Loader/AssetPackageFileFormat.h>
 
 // Disable warnings in external headers, we can't fix them
@@ -227,7 +231,7 @@ namespace RendererToolkit
 			}
 
 			// Asset compiler input
-			IAssetCompiler::Input input(mContext, mProjectName, *mCacheManager, virtualAssetPackageInputDirectory, virtualAssetFilename, virtualAssetInputDirectory, virtualAssetOutputDirectory, mSourceAssetIdToCompiledAssetId, mCompiledAssetIdToSourceAssetId, mSourceAssetIdToVirtualFilename, mDefaultTextureAssetIds);
+			IAssetCompiler::Input input(mContext, mProjectName, *mCacheManager, virtualAssetPackageInputDirectory, virtualAssetFilename, virtualAssetInputDirectory, virtualAssetOutputDirectory, mSourceAssetIdToCompiledAssetId, mCompiledAssetIdToSourceAssetId, mSourceAssetIdToVirtualFilename, mDefaultTextureAssetIds, mMaterialBlueprintUsage);
 
 			// Compile the asset
 			RHI_ASSERT(getContext(), nullptr != assetCompiler, "Invalid asset compiler")
@@ -279,7 +283,7 @@ namespace RendererToolkit
 			}
 
 			// Asset compiler input
-			IAssetCompiler::Input input(mContext, mProjectName, *mCacheManager, virtualAssetPackageInputDirectory, virtualAssetFilename, virtualAssetInputDirectory, virtualAssetOutputDirectory, mSourceAssetIdToCompiledAssetId, mCompiledAssetIdToSourceAssetId, mSourceAssetIdToVirtualFilename, mDefaultTextureAssetIds);
+			IAssetCompiler::Input input(mContext, mProjectName, *mCacheManager, virtualAssetPackageInputDirectory, virtualAssetFilename, virtualAssetInputDirectory, virtualAssetOutputDirectory, mSourceAssetIdToCompiledAssetId, mCompiledAssetIdToSourceAssetId, mSourceAssetIdToVirtualFilename, mDefaultTextureAssetIds, mMaterialBlueprintUsage);
 
 			// Asset compiler configuration
 			RHI_ASSERT(getContext(), nullptr != mRapidJsonDocument, "Invalid renderer toolkit Rapid JSON document")
@@ -324,9 +328,10 @@ namespace RendererToolkit
 
 	void ProjectImpl::onCompilationRunFinished()
 	{
-		// Compilation run finished clear internal cache of cache manager
+		// Compilation run finished clear internal cache of cache manager as well as the gathered material blueprint usage
 		mCacheManager->saveCache();
 		mCacheManager->clearInternalCache();
+		mMaterialBlueprintUsage = {};
 
 		// The renderer toolkit is now considered to be idle
 		mRendererToolkitImpl.setState(IRendererToolkit::State::IDLE);
@@ -595,6 +600,77 @@ namespace RendererToolkit
 		onCompilationRunFinished();
 	}
 
+	std::string ProjectImpl::getRhiName(const char* rhiTarget) const
+	{
+		RHI_ASSERT(getContext(), nullptr != mRapidJsonDocument, "Invalid renderer toolkit Rapid JSON document")
+		const rapidjson::Value& rapidJsonValueRhiTargets = (*mRapidJsonDocument)["Targets"]["RhiTargets"];
+		if (!rapidJsonValueRhiTargets.HasMember(rhiTarget))
+		{
+			throw std::runtime_error(std::string("Unknown RHI target \"") + rhiTarget + '\"');
+		}
+		return rapidJsonValueRhiTargets[rhiTarget]["Rhi"].GetString();
+	}
+
+	void ProjectImpl::compilePipelineStateObjectCache(Renderer::IRenderer& renderer, const char* rhiTarget)
+	{
+		// Sanity checks: The pipeline state object cache is RHI implementation specific
+		const std::string rhiName = getRhiName(rhiTarget);
+		const Rhi::IRhi& rhi = renderer.getRhi();
+		if (rhiName != rhi.getName())
+		{
+			throw std::runtime_error(std::string("The RHI target \"") + rhiTarget + "\" needs the RHI implementation \"" + rhiName + "\" but the renderer is using \"" + rhi.getName() + '\"');
+		}
+		if (!rhi.getCapabilities().shaderBytecode)
+		{
+			RHI_LOG(mContext, INFORMATION, "The RHI implementation \"%s\" has no shader bytecode support, there's no pipeline state object cache to compile", rhiName.c_str())
+			return;
+		}
+
+		// Mount the compiled asset package, if necessary (e.g. "DataPc/Example/Content" mounted as "Example")
+		Renderer::AssetManager& assetManager = renderer.getAssetManager();
+		const Renderer::AssetPackageId assetPackageId((mProjectName + '/' + mAssetPackageDirectoryName).c_str());
+		const Renderer::AssetPackage* assetPackage = assetManager.tryGetAssetPackageById(assetPackageId);
+		if (nullptr == assetPackage)
+		{
+			const std::string absoluteAssetPackageDirectoryName = renderer.getFileManager().getAbsoluteRootDirectory() + '/' + getRenderTargetDataRootDirectory(rhiTarget) + '/' + mProjectName + '/' + mAssetPackageDirectoryName;
+			assetPackage = assetManager.mountAssetPackage(absoluteAssetPackageDirectoryName.c_str(), mProjectName.c_str());
+			if (nullptr == assetPackage)
+			{
+				throw std::runtime_error("Failed to mount the compiled asset package \"" + absoluteAssetPackageDirectoryName + "\", compile all assets first");
+			}
+		}
+
+		// Load all material blueprints with synchronous pipeline state compilation: This creates the pipeline state caches of the shader
+		// combinations used by the materials of the project, see "Renderer::MaterialBlueprintResource::createPrecompiledPipelineStateCaches()"
+		Renderer::GraphicsPipelineStateCompiler& graphicsPipelineStateCompiler = renderer.getGraphicsPipelineStateCompiler();
+		Renderer::ComputePipelineStateCompiler& computePipelineStateCompiler = renderer.getComputePipelineStateCompiler();
+		const bool graphicsAsynchronousCompilationEnabled = graphicsPipelineStateCompiler.isAsynchronousCompilationEnabled();
+		const bool computeAsynchronousCompilationEnabled = computePipelineStateCompiler.isAsynchronousCompilationEnabled();
+		graphicsPipelineStateCompiler.setAsynchronousCompilationEnabled(false);
+		computePipelineStateCompiler.setAsynchronousCompilationEnabled(false);
+		{
+			Renderer::MaterialBlueprintResourceManager& materialBlueprintResourceManager = renderer.getMaterialBlueprintResourceManager();
+			const std::string_view materialBlueprintFilenameExtension = mAssetCompilerByClassId.at(MaterialBlueprintAssetCompiler::CLASS_ID)->getOptionalUniqueAssetFilenameExtension();
+			uint32_t numberOfMaterialBlueprints = 0;
+			for (const Renderer::Asset& asset : assetPackage->getSortedAssetVector())
+			{
+				if (std_filesystem::path(asset.virtualFilename).extension().generic_string() == materialBlueprintFilenameExtension)
+				{
+					Renderer::MaterialBlueprintResourceId materialBlueprintResourceId = Renderer::getInvalid<Renderer::MaterialBlueprintResourceId>();
+					materialBlueprintResourceManager.loadMaterialBlueprintResourceByAssetId(asset.assetId, materialBlueprintResourceId);
+					++numberOfMaterialBlueprints;
+				}
+			}
+			renderer.flushAllQueues();
+			RHI_LOG(mContext, INFORMATION, "Compiled the pipeline state object cache of %u material blueprints for the RHI implementation \"%s\"", numberOfMaterialBlueprints, rhiName.c_str())
+		}
+		graphicsPipelineStateCompiler.setAsynchronousCompilationEnabled(graphicsAsynchronousCompilationEnabled);
+		computePipelineStateCompiler.setAsynchronousCompilationEnabled(computeAsynchronousCompilationEnabled);
+
+		// Write the precompiled pipeline state object cache into the asset package directory, e.g. "DataPc/Example/Content/Direct3D11.pso_cache"
+		renderer.savePrecompiledPipelineStateObjectCache(assetPackageId);
+	}
+
 	void ProjectImpl::startupAssetMonitor(Renderer::IRenderer& renderer, const char* rhiTarget)
 	{
 		if (nullptr == mProjectAssetMonitor)
@@ -675,6 +751,7 @@ namespace RendererToolkit
 		mSourceAssetIdToCompiledAssetId.clear();
 		mCompiledAssetIdToSourceAssetId.clear();
 		mSourceAssetIdToVirtualFilename.clear();
+		mMaterialBlueprintUsage = {};
 		if (nullptr != mRapidJsonDocument)
 		{
 			delete mRapidJsonDocument;
@@ -158,6 +158,8 @@ namespace RendererToolkit
 	public:
 		virtual void load(Renderer::AbsoluteDirectoryName absoluteProjectDirectoryName) override;
 		virtual void compileAllAssets(const char* rhiTarget) override;
+		[[nodiscard]] virtual std::string getRhiName(const char* rhiTarget) const override;
+		virtual void compilePipelineStateObjectCache(Renderer::IRenderer& renderer, const char* rhiTarget) override;
 		virtual void importAssets(const AbsoluteFilenames& absoluteSourceFilenames, const std::string& targetAssetPackageName, const std::string& targetDirectoryName = "Imported") override;
 		virtual void startupAssetMonitor(Renderer::IRenderer& renderer, const char* rhiTarget) override;
 		virtual void shutdownAssetMonitor() override;
@@ -215,6 +217,7 @@ namespace RendererToolkit
 		CompiledAssetIdToSourceAssetId		mCompiledAssetIdToSourceAssetId;
 		SourceAssetIdToVirtualFilename		mSourceAssetIdToVirtualFilename;
 		DefaultTextureAssetIds				mDefaultTextureAssetIds;
+		MaterialBlueprintUsage				mMaterialBlueprintUsage;			///< Gathered on demand, reset after each compilation run
 		rapidjson::Document*				mRapidJsonDocument;					///< There's no real benefit in trying to store the targets data in custom data structures, so we just stick to the read in JSON object
 		ProjectAssetMonitor*				mProjectAssetMonitor;
 		std::atomic<bool>					mShutdownThread;
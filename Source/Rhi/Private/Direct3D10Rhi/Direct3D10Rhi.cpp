@@ -9806,8 +9806,7 @@ namespace Direct3D10Rhi
 	void Direct3D10Rhi::dispatchCommandBufferInternal(const Rhi::CommandBuffer& commandBuffer)
 	{
 		// Loop through all commands
-		const uint8_t* commandPacketBuffer = commandBuffer.getCommandPacketBuffer();
-		Rhi::ConstCommandPacket constCommandPacket = commandPacketBuffer;
+		Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket();
 		while (nullptr != constCommandPacket)
 		{
 			{ // Dispatch command packet
@@ -9817,8 +9816,7 @@ namespace Direct3D10Rhi
 			}
 
 			{ // Next command
-				const uint32_t nextCommandPacketByteIndex = Rhi::CommandPacketHelper::getNextCommandPacketByteIndex(constCommandPacket);
-				constCommandPacket = (~0u != nextCommandPacketByteIndex) ? &commandPacketBuffer[nextCommandPacketByteIndex] : nullptr;
+				constCommandPacket = Rhi::CommandPacketHelper::getNextCommandPacket(constCommandPacket);
 			}
 		}
 	}
@@ -11436,6 +11434,10 @@ namespace Direct3D10Rhi
 		// Direct3D 10 has shader bytecode support
 		mCapabilities.shaderBytecode = true;
 
+		// Direct3D 10 has no persistent mapping support, use the map type for synchronization
+		mCapabilities.persistentMapping = false;
+		mCapabilities.maximumNumberOfFramesInFlight = 0;
+
 		// Is there support for vertex shaders (VS)?
 		mCapabilities.vertexShader = true;
 
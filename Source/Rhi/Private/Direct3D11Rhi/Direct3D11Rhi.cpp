@@ -12544,8 +12544,7 @@ namespace Direct3D11Rhi
 	void Direct3D11Rhi::dispatchCommandBufferInternal(const Rhi::CommandBuffer& commandBuffer)
 	{
 		// Loop through all commands
-		const uint8_t* commandPacketBuffer = commandBuffer.getCommandPacketBuffer();
-		Rhi::ConstCommandPacket constCommandPacket = commandPacketBuffer;
+		Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket();
 		while (nullptr != constCommandPacket)
 		{
 			{ // Dispatch command packet
@@ -12555,8 +12554,7 @@ namespace Direct3D11Rhi
 			}
 
 			{ // Next command
-				const uint32_t nextCommandPacketByteIndex = Rhi::CommandPacketHelper::getNextCommandPacketByteIndex(constCommandPacket);
-				constCommandPacket = (~0u != nextCommandPacketByteIndex) ? &commandPacketBuffer[nextCommandPacketByteIndex] : nullptr;
+				constCommandPacket = Rhi::CommandPacketHelper::getNextCommandPacket(constCommandPacket);
 			}
 		}
 	}
@@ -15074,6 +15072,10 @@ namespace Direct3D11Rhi
 		// Direct3D 11 has shader bytecode support
 		mCapabilities.shaderBytecode = true;
 
+		// Direct3D 11 has no persistent mapping support, use the map type for synchronization
+		mCapabilities.persistentMapping = false;
+		mCapabilities.maximumNumberOfFramesInFlight = 0;
+
 		// Is there support for vertex shaders (VS)?
 		mCapabilities.vertexShader = true;
 
@@ -12596,8 +12596,7 @@ namespace Direct3D12Rhi
 	void Direct3D12Rhi::dispatchCommandBufferInternal(const Rhi::CommandBuffer& commandBuffer)
 	{
 		// Loop through all commands
-		const uint8_t* commandPacketBuffer = commandBuffer.getCommandPacketBuffer();
-		Rhi::ConstCommandPacket constCommandPacket = commandPacketBuffer;
+		Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket();
 		while (nullptr != constCommandPacket)
 		{
 			{ // Dispatch command packet
@@ -12607,8 +12606,7 @@ namespace Direct3D12Rhi
 			}
 
 			{ // Next command
-				const uint32_t nextCommandPacketByteIndex = Rhi::CommandPacketHelper::getNextCommandPacketByteIndex(constCommandPacket);
-				constCommandPacket = (~0u != nextCommandPacketByteIndex) ? &commandPacketBuffer[nextCommandPacketByteIndex] : nullptr;
+				constCommandPacket = Rhi::CommandPacketHelper::getNextCommandPacket(constCommandPacket);
 			}
 		}
 	}
@@ -14220,6 +14218,10 @@ namespace Direct3D12Rhi
 		// TODO(co) Implement shader bytecode support
 		mCapabilities.shaderBytecode = false;
 
+		// Direct3D 12 has no persistent mapping support, use the map type for synchronization
+		mCapabilities.persistentMapping = false;
+		mCapabilities.maximumNumberOfFramesInFlight = 0;
+
 		// Is there support for vertex shaders (VS)?
 		mCapabilities.vertexShader = true;
 
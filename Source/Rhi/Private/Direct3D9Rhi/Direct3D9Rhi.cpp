@@ -7888,8 +7888,7 @@ namespace Direct3D9Rhi
 	void Direct3D9Rhi::dispatchCommandBufferInternal(const Rhi::CommandBuffer& commandBuffer)
 	{
 		// Loop through all commands
-		const uint8_t* commandPacketBuffer = commandBuffer.getCommandPacketBuffer();
-		Rhi::ConstCommandPacket constCommandPacket = commandPacketBuffer;
+		Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket();
 		while (nullptr != constCommandPacket)
 		{
 			{ // Dispatch command packet
@@ -7899,8 +7898,7 @@ namespace Direct3D9Rhi
 			}
 
 			{ // Next command
-				const uint32_t nextCommandPacketByteIndex = Rhi::CommandPacketHelper::getNextCommandPacketByteIndex(constCommandPacket);
-				constCommandPacket = (~0u != nextCommandPacketByteIndex) ? &commandPacketBuffer[nextCommandPacketByteIndex] : nullptr;
+				constCommandPacket = Rhi::CommandPacketHelper::getNextCommandPacket(constCommandPacket);
 			}
 		}
 	}
@@ -9359,6 +9357,10 @@ namespace Direct3D9Rhi
 		// TODO(co) Direct3D 9 shader bytecode support is under construction
 		mCapabilities.shaderBytecode = false;
 
+		// Direct3D 9 has no persistent mapping support, use the map type for synchronization
+		mCapabilities.persistentMapping = false;
+		mCapabilities.maximumNumberOfFramesInFlight = 0;
+
 		// Is there support for vertex shaders (VS)?
 		mCapabilities.vertexShader = true;
 
@@ -1014,9 +1014,13 @@ namespace NullRhi
 		*
 		*  @param[in] nullRhi
 		*    Owner null RHI instance
+		*  @param[in] numberOfBytes
+		*    Number of bytes within the buffer
 		*/
-		inline explicit VertexBuffer(NullRhi& nullRhi RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
-			IVertexBuffer(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER)
+		inline VertexBuffer(NullRhi& nullRhi, uint32_t numberOfBytes RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
+			IVertexBuffer(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
+			mNumberOfBytes(numberOfBytes),
+			mMappedData(nullptr)
 		{}
 
 		/**
@@ -1024,7 +1028,31 @@ namespace NullRhi
 		*    Destructor
 		*/
 		inline virtual ~VertexBuffer() override
-		{}
+		{
+			if (nullptr != mMappedData)
+			{
+				RHI_FREE(getRhi().getContext(), mMappedData);
+			}
+		}
+
+		/**
+		*  @brief
+		*    Return the system memory the buffer is mapped to
+		*
+		*  @return
+		*    The system memory, can be a null pointer for an empty buffer, don't destroy the memory
+		*
+		*  @note
+		*    - The system memory is allocated when the buffer is mapped the first time, so buffers which are never mapped don't need any memory
+		*/
+		[[nodiscard]] inline uint8_t* getMappedData()
+		{
+			if (nullptr == mMappedData && mNumberOfBytes > 0)
+			{
+				mMappedData = RHI_MALLOC_TYPED(getRhi().getContext(), uint8_t, mNumberOfBytes);
+			}
+			return mMappedData;
+		}
 
 
 	//[-------------------------------------------------------]
@@ -1045,6 +1073,14 @@ namespace NullRhi
 		VertexBuffer& operator =(const VertexBuffer& source) = delete;
 
 
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		uint32_t mNumberOfBytes;
+		uint8_t* mMappedData;	///< System memory the buffer is mapped to, null pointer as long as the buffer has never been mapped
+
+
 	};
 
 
@@ -1071,9 +1107,13 @@ namespace NullRhi
 		*
 		*  @param[in] nullRhi
 		*    Owner null RHI instance
+		*  @param[in] numberOfBytes
+		*    Number of bytes within the buffer
 		*/
-		inline explicit IndexBuffer(NullRhi& nullRhi RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
-			IIndexBuffer(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER)
+		inline IndexBuffer(NullRhi& nullRhi, uint32_t numberOfBytes RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
+			IIndexBuffer(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
+			mNumberOfBytes(numberOfBytes),
+			mMappedData(nullptr)
 		{}
 
 		/**
@@ -1081,7 +1121,31 @@ namespace NullRhi
 		*    Destructor
 		*/
 		inline virtual ~IndexBuffer() override
-		{}
+		{
+			if (nullptr != mMappedData)
+			{
+				RHI_FREE(getRhi().getContext(), mMappedData);
+			}
+		}
+
+		/**
+		*  @brief
+		*    Return the system memory the buffer is mapped to
+		*
+		*  @return
+		*    The system memory, can be a null pointer for an empty buffer, don't destroy the memory
+		*
+		*  @note
+		*    - The system memory is allocated when the buffer is mapped the first time, so buffers which are never mapped don't need any memory
+		*/
+		[[nodiscard]] inline uint8_t* getMappedData()
+		{
+			if (nullptr == mMappedData && mNumberOfBytes > 0)
+			{
+				mMappedData = RHI_MALLOC_TYPED(getRhi().getContext(), uint8_t, mNumberOfBytes);
+			}
+			return mMappedData;
+		}
 
 
 	//[-------------------------------------------------------]
@@ -1102,6 +1166,14 @@ namespace NullRhi
 		IndexBuffer& operator =(const IndexBuffer& source) = delete;
 
 
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		uint32_t mNumberOfBytes;
+		uint8_t* mMappedData;	///< System memory the buffer is mapped to, null pointer as long as the buffer has never been mapped
+
+
 	};
 
 
@@ -1190,9 +1262,13 @@ namespace NullRhi
 		*
 		*  @param[in] nullRhi
 		*    Owner null RHI instance
+		*  @param[in] numberOfBytes
+		*    Number of bytes within the buffer
 		*/
-		inline explicit TextureBuffer(NullRhi& nullRhi RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
-			ITextureBuffer(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER)
+		inline TextureBuffer(NullRhi& nullRhi, uint32_t numberOfBytes RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
+			ITextureBuffer(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
+			mNumberOfBytes(numberOfBytes),
+			mMappedData(nullptr)
 		{}
 
 		/**
@@ -1200,7 +1276,31 @@ namespace NullRhi
 		*    Destructor
 		*/
 		inline virtual ~TextureBuffer() override
-		{}
+		{
+			if (nullptr != mMappedData)
+			{
+				RHI_FREE(getRhi().getContext(), mMappedData);
+			}
+		}
+
+		/**
+		*  @brief
+		*    Return the system memory the buffer is mapped to
+		*
+		*  @return
+		*    The system memory, can be a null pointer for an empty buffer, don't destroy the memory
+		*
+		*  @note
+		*    - The system memory is allocated when the buffer is mapped the first time, so buffers which are never mapped don't need any memory
+		*/
+		[[nodiscard]] inline uint8_t* getMappedData()
+		{
+			if (nullptr == mMappedData && mNumberOfBytes > 0)
+			{
+				mMappedData = RHI_MALLOC_TYPED(getRhi().getContext(), uint8_t, mNumberOfBytes);
+			}
+			return mMappedData;
+		}
 
 
 	//[-------------------------------------------------------]
@@ -1221,6 +1321,14 @@ namespace NullRhi
 		TextureBuffer& operator =(const TextureBuffer& source) = delete;
 
 
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		uint32_t mNumberOfBytes;
+		uint8_t* mMappedData;	///< System memory the buffer is mapped to, null pointer as long as the buffer has never been mapped
+
+
 	};
 
 
@@ -1247,9 +1355,13 @@ namespace NullRhi
 		*
 		*  @param[in] nullRhi
 		*    Owner null RHI instance
+		*  @param[in] numberOfBytes
+		*    Number of bytes within the buffer
 		*/
-		inline explicit StructuredBuffer(NullRhi& nullRhi RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
-			IStructuredBuffer(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER)
+		inline StructuredBuffer(NullRhi& nullRhi, uint32_t numberOfBytes RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
+			IStructuredBuffer(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
+			mNumberOfBytes(numberOfBytes),
+			mMappedData(nullptr)
 		{}
 
 		/**
@@ -1257,7 +1369,31 @@ namespace NullRhi
 		*    Destructor
 		*/
 		inline virtual ~StructuredBuffer() override
-		{}
+		{
+			if (nullptr != mMappedData)
+			{
+				RHI_FREE(getRhi().getContext(), mMappedData);
+			}
+		}
+
+		/**
+		*  @brief
+		*    Return the system memory the buffer is mapped to
+		*
+		*  @return
+		*    The system memory, can be a null pointer for an empty buffer, don't destroy the memory
+		*
+		*  @note
+		*    - The system memory is allocated when the buffer is mapped the first time, so buffers which are never mapped don't need any memory
+		*/
+		[[nodiscard]] inline uint8_t* getMappedData()
+		{
+			if (nullptr == mMappedData && mNumberOfBytes > 0)
+			{
+				mMappedData = RHI_MALLOC_TYPED(getRhi().getContext(), uint8_t, mNumberOfBytes);
+			}
+			return mMappedData;
+		}
 
 
 	//[-------------------------------------------------------]
@@ -1278,6 +1414,14 @@ namespace NullRhi
 		StructuredBuffer& operator =(const StructuredBuffer& source) = delete;
 
 
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		uint32_t mNumberOfBytes;
+		uint8_t* mMappedData;	///< System memory the buffer is mapped to, null pointer as long as the buffer has never been mapped
+
+
 	};
 
 
@@ -1304,9 +1448,13 @@ namespace NullRhi
 		*
 		*  @param[in] nullRhi
 		*    Owner null RHI instance
+		*  @param[in] numberOfBytes
+		*    Number of bytes within the buffer
 		*/
-		inline explicit IndirectBuffer(NullRhi& nullRhi RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
-			IIndirectBuffer(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER)
+		inline IndirectBuffer(NullRhi& nullRhi, uint32_t numberOfBytes RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
+			IIndirectBuffer(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
+			mNumberOfBytes(numberOfBytes),
+			mMappedData(nullptr)
 		{}
 
 		/**
@@ -1314,7 +1462,31 @@ namespace NullRhi
 		*    Destructor
 		*/
 		inline virtual ~IndirectBuffer() override
-		{}
+		{
+			if (nullptr != mMappedData)
+			{
+				RHI_FREE(getRhi().getContext(), mMappedData);
+			}
+		}
+
+		/**
+		*  @brief
+		*    Return the system memory the buffer is mapped to
+		*
+		*  @return
+		*    The system memory, can be a null pointer for an empty buffer, don't destroy the memory
+		*
+		*  @note
+		*    - The system memory is allocated when the buffer is mapped the first time, so buffers which are never mapped don't need any memory
+		*/
+		[[nodiscard]] inline uint8_t* getMappedData()
+		{
+			if (nullptr == mMappedData && mNumberOfBytes > 0)
+			{
+				mMappedData = RHI_MALLOC_TYPED(getRhi().getContext(), uint8_t, mNumberOfBytes);
+			}
+			return mMappedData;
+		}
 
 
 	//[-------------------------------------------------------]
@@ -1345,6 +1517,14 @@ namespace NullRhi
 		IndirectBuffer& operator =(const IndirectBuffer& source) = delete;
 
 
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		uint32_t mNumberOfBytes;
+		uint8_t* mMappedData;	///< System memory the buffer is mapped to, null pointer as long as the buffer has never been mapped
+
+
 	};
 
 
@@ -1371,9 +1551,13 @@ namespace NullRhi
 		*
 		*  @param[in] nullRhi
 		*    Owner null RHI instance
+		*  @param[in] numberOfBytes
+		*    Number of bytes within the buffer
 		*/
-		inline explicit UniformBuffer(NullRhi& nullRhi RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
-			IUniformBuffer(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER)
+		inline UniformBuffer(NullRhi& nullRhi, uint32_t numberOfBytes RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
+			IUniformBuffer(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
+			mNumberOfBytes(numberOfBytes),
+			mMappedData(nullptr)
 		{}
 
 		/**
@@ -1381,7 +1565,31 @@ namespace NullRhi
 		*    Destructor
 		*/
 		inline virtual ~UniformBuffer() override
-		{}
+		{
+			if (nullptr != mMappedData)
+			{
+				RHI_FREE(getRhi().getContext(), mMappedData);
+			}
+		}
+
+		/**
+		*  @brief
+		*    Return the system memory the buffer is mapped to
+		*
+		*  @return
+		*    The system memory, can be a null pointer for an empty buffer, don't destroy the memory
+		*
+		*  @note
+		*    - The system memory is allocated when the buffer is mapped the first time, so buffers which are never mapped don't need any memory
+		*/
+		[[nodiscard]] inline uint8_t* getMappedData()
+		{
+			if (nullptr == mMappedData && mNumberOfBytes > 0)
+			{
+				mMappedData = RHI_MALLOC_TYPED(getRhi().getContext(), uint8_t, mNumberOfBytes);
+			}
+			return mMappedData;
+		}
 
 
 	//[-------------------------------------------------------]
@@ -1402,6 +1610,14 @@ namespace NullRhi
 		UniformBuffer& operator =(const UniformBuffer& source) = delete;
 
 
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		uint32_t mNumberOfBytes;
+		uint8_t* mMappedData;	///< System memory the buffer is mapped to, null pointer as long as the buffer has never been mapped
+
+
 	};
 
 
@@ -1445,16 +1661,16 @@ namespace NullRhi
 	//[ Public virtual Rhi::IBufferManager methods            ]
 	//[-------------------------------------------------------]
 	public:
-		[[nodiscard]] inline virtual Rhi::IVertexBuffer* createVertexBuffer([[maybe_unused]] uint32_t numberOfBytes, [[maybe_unused]] const void* data = nullptr, [[maybe_unused]] uint32_t bufferFlags = 0, [[maybe_unused]] Rhi::BufferUsage bufferUsage = Rhi::BufferUsage::STATIC_DRAW RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
+		[[nodiscard]] inline virtual Rhi::IVertexBuffer* createVertexBuffer(uint32_t numberOfBytes, [[maybe_unused]] const void* data = nullptr, [[maybe_unused]] uint32_t bufferFlags = 0, [[maybe_unused]] Rhi::BufferUsage bufferUsage = Rhi::BufferUsage::STATIC_DRAW RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
 		{
 			NullRhi& nullRhi = static_cast<NullRhi&>(getRhi());
-			return RHI_NEW(nullRhi.getContext(), VertexBuffer)(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+			return RHI_NEW(nullRhi.getContext(), VertexBuffer)(nullRhi, numberOfBytes RHI_RESOURCE_DEBUG_PASS_PARAMETER);
 		}
 
-		[[nodiscard]] inline virtual Rhi::IIndexBuffer* createIndexBuffer([[maybe_unused]] uint32_t numberOfBytes, [[maybe_unused]] const void* data = nullptr, [[maybe_unused]] uint32_t bufferFlags = 0, [[maybe_unused]] Rhi::BufferUsage bufferUsage = Rhi::BufferUsage::STATIC_DRAW, [[maybe_unused]] Rhi::IndexBufferFormat::Enum indexBufferFormat = Rhi::IndexBufferFormat::UNSIGNED_SHORT RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
+		[[nodiscard]] inline virtual Rhi::IIndexBuffer* createIndexBuffer(uint32_t numberOfBytes, [[maybe_unused]] const void* data = nullptr, [[maybe_unused]] uint32_t bufferFlags = 0, [[maybe_unused]] Rhi::BufferUsage bufferUsage = Rhi::BufferUsage::STATIC_DRAW, [[maybe_unused]] Rhi::IndexBufferFormat::Enum indexBufferFormat = Rhi::IndexBufferFormat::UNSIGNED_SHORT RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
 		{
 			NullRhi& nullRhi = static_cast<NullRhi&>(getRhi());
-			return RHI_NEW(nullRhi.getContext(), IndexBuffer)(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+			return RHI_NEW(nullRhi.getContext(), IndexBuffer)(nullRhi, numberOfBytes RHI_RESOURCE_DEBUG_PASS_PARAMETER);
 		}
 
 		[[nodiscard]] virtual Rhi::IVertexArray* createVertexArray([[maybe_unused]] const Rhi::VertexAttributes& vertexAttributes, uint32_t numberOfVertexBuffers, const Rhi::VertexArrayVertexBuffer* vertexBuffers, Rhi::IIndexBuffer* indexBuffer = nullptr RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
@@ -1495,7 +1711,7 @@ namespace NullRhi
 			return nullRhi.VertexArrayMakeId.CreateID(id) ? RHI_NEW(nullRhi.getContext(), VertexArray)(nullRhi, id RHI_RESOURCE_DEBUG_PASS_PARAMETER) : nullptr;
 		}
 
-		[[nodiscard]] inline virtual Rhi::ITextureBuffer* createTextureBuffer([[maybe_unused]] uint32_t numberOfBytes, [[maybe_unused]] const void* data = nullptr, [[maybe_unused]] uint32_t bufferFlags = Rhi::BufferFlag::SHADER_RESOURCE, [[maybe_unused]] Rhi::BufferUsage bufferUsage = Rhi::BufferUsage::STATIC_DRAW, [[maybe_unused]] Rhi::TextureFormat::Enum textureFormat = Rhi::TextureFormat::R32G32B32A32F RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
+		[[nodiscard]] inline virtual Rhi::ITextureBuffer* createTextureBuffer(uint32_t numberOfBytes, [[maybe_unused]] const void* data = nullptr, [[maybe_unused]] uint32_t bufferFlags = Rhi::BufferFlag::SHADER_RESOURCE, [[maybe_unused]] Rhi::BufferUsage bufferUsage = Rhi::BufferUsage::STATIC_DRAW, [[maybe_unused]] Rhi::TextureFormat::Enum textureFormat = Rhi::TextureFormat::R32G32B32A32F RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
 		{
 			NullRhi& nullRhi = static_cast<NullRhi&>(getRhi());
 
@@ -1503,10 +1719,10 @@ namespace NullRhi
 			RHI_ASSERT(nullRhi.getContext(), (numberOfBytes % Rhi::TextureFormat::getNumberOfBytesPerElement(textureFormat)) == 0, "The null texture buffer size must be a multiple of the selected texture format bytes per texel")
 
 			// Create the texture buffer
-			return RHI_NEW(nullRhi.getContext(), TextureBuffer)(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+			return RHI_NEW(nullRhi.getContext(), TextureBuffer)(nullRhi, numberOfBytes RHI_RESOURCE_DEBUG_PASS_PARAMETER);
 		}
 
-		[[nodiscard]] inline virtual Rhi::IStructuredBuffer* createStructuredBuffer([[maybe_unused]] uint32_t numberOfBytes, [[maybe_unused]] const void* data, [[maybe_unused]] uint32_t bufferFlags, [[maybe_unused]] Rhi::BufferUsage bufferUsage, [[maybe_unused]] uint32_t numberOfStructureBytes RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
+		[[nodiscard]] inline virtual Rhi::IStructuredBuffer* createStructuredBuffer(uint32_t numberOfBytes, [[maybe_unused]] const void* data, [[maybe_unused]] uint32_t bufferFlags, [[maybe_unused]] Rhi::BufferUsage bufferUsage, [[maybe_unused]] uint32_t numberOfStructureBytes RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
 		{
 			NullRhi& nullRhi = static_cast<NullRhi&>(getRhi());
 
@@ -1515,10 +1731,10 @@ namespace NullRhi
 			RHI_ASSERT(nullRhi.getContext(), (numberOfBytes % (sizeof(float) * 4)) == 0, "Performance: The null structured buffer should be aligned to a 128-bit stride, see \"Understanding Structured Buffer Performance\" by Evan Hart, posted Apr 17 2015 at 11:33AM - https://developer.nvidia.com/content/understanding-structured-buffer-performance")
 
 			// Create the structured buffer
-			return RHI_NEW(nullRhi.getContext(), StructuredBuffer)(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+			return RHI_NEW(nullRhi.getContext(), StructuredBuffer)(nullRhi, numberOfBytes RHI_RESOURCE_DEBUG_PASS_PARAMETER);
 		}
 
-		[[nodiscard]] inline virtual Rhi::IIndirectBuffer* createIndirectBuffer([[maybe_unused]] uint32_t numberOfBytes, [[maybe_unused]] const void* data = nullptr, [[maybe_unused]] uint32_t indirectBufferFlags = 0, [[maybe_unused]] Rhi::BufferUsage bufferUsage = Rhi::BufferUsage::STATIC_DRAW RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
+		[[nodiscard]] inline virtual Rhi::IIndirectBuffer* createIndirectBuffer(uint32_t numberOfBytes, [[maybe_unused]] const void* data = nullptr, [[maybe_unused]] uint32_t indirectBufferFlags = 0, [[maybe_unused]] Rhi::BufferUsage bufferUsage = Rhi::BufferUsage::STATIC_DRAW RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
 		{
 			NullRhi& nullRhi = static_cast<NullRhi&>(getRhi());
 
@@ -1529,10 +1745,10 @@ namespace NullRhi
 			RHI_ASSERT(nullRhi.getContext(), (indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_INDEXED_ARGUMENTS) == 0 || (numberOfBytes % sizeof(Rhi::DrawIndexedArguments)) == 0, "Null indirect buffer element type flags specification is \"DRAW_INDEXED_ARGUMENTS\" but the given number of bytes don't align to this")
 
 			// Create indirect buffer
-			return RHI_NEW(nullRhi.getContext(), IndirectBuffer)(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+			return RHI_NEW(nullRhi.getContext(), IndirectBuffer)(nullRhi, numberOfBytes RHI_RESOURCE_DEBUG_PASS_PARAMETER);
 		}
 
-		[[nodiscard]] inline virtual Rhi::IUniformBuffer* createUniformBuffer([[maybe_unused]] uint32_t numberOfBytes, [[maybe_unused]] const void* data = nullptr, [[maybe_unused]] Rhi::BufferUsage bufferUsage = Rhi::BufferUsage::STATIC_DRAW RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
+		[[nodiscard]] inline virtual Rhi::IUniformBuffer* createUniformBuffer(uint32_t numberOfBytes, [[maybe_unused]] const void* data = nullptr, [[maybe_unused]] Rhi::BufferUsage bufferUsage = Rhi::BufferUsage::STATIC_DRAW RHI_RESOURCE_DEBUG_NAME_PARAMETER) override
 		{
 			NullRhi& nullRhi = static_cast<NullRhi&>(getRhi());
 
@@ -1541,7 +1757,7 @@ namespace NullRhi
 			// RHI_ASSERT(nullRhi.getContext(), (bufferFlags & Rhi::BufferFlag::SHADER_RESOURCE) != 0, "Invalid null buffer flags, uniform buffer must be used as shader resource")
 
 			// Create the uniform buffer
-			return RHI_NEW(nullRhi.getContext(), UniformBuffer)(nullRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+			return RHI_NEW(nullRhi.getContext(), UniformBuffer)(nullRhi, numberOfBytes RHI_RESOURCE_DEBUG_PASS_PARAMETER);
 		}
 
 
@@ -3982,8 +4198,7 @@ namespace NullRhi
 	void NullRhi::dispatchCommandBufferInternal(const Rhi::CommandBuffer& commandBuffer)
 	{
 		// Loop through all commands
-		const uint8_t* commandPacketBuffer = commandBuffer.getCommandPacketBuffer();
-		Rhi::ConstCommandPacket constCommandPacket = commandPacketBuffer;
+		Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket();
 		while (nullptr != constCommandPacket)
 		{
 			{ // Dispatch command packet
@@ -3993,8 +4208,7 @@ namespace NullRhi
 			}
 
 			{ // Next command
-				const uint32_t nextCommandPacketByteIndex = Rhi::CommandPacketHelper::getNextCommandPacketByteIndex(constCommandPacket);
-				constCommandPacket = (~0u != nextCommandPacketByteIndex) ? &commandPacketBuffer[nextCommandPacketByteIndex] : nullptr;
+				constCommandPacket = Rhi::CommandPacketHelper::getNextCommandPacket(constCommandPacket);
 			}
 		}
 	}
@@ -4456,14 +4670,75 @@ namespace NullRhi
 	//[-------------------------------------------------------]
 	//[ Resource handling                                     ]
 	//[-------------------------------------------------------]
-	bool NullRhi::map(Rhi::IResource&, uint32_t, Rhi::MapType, uint32_t, Rhi::MappedSubresource&)
+	bool NullRhi::map(Rhi::IResource& resource, uint32_t, Rhi::MapType, uint32_t, Rhi::MappedSubresource& mappedSubresource)
 	{
-		// Not supported by the null RHI
-		return false;
+		// Buffers are mapped to system memory so code filling buffers can be used with the null RHI, the written data isn't used
+		mappedSubresource.rowPitch   = 0;
+		mappedSubresource.depthPitch = 0;
+		switch (resource.getResourceType())
+		{
+			case Rhi::ResourceType::VERTEX_BUFFER:
+				mappedSubresource.data = static_cast<VertexBuffer&>(resource).getMappedData();
+				break;
+
+			case Rhi::ResourceType::INDEX_BUFFER:
+				mappedSubresource.data = static_cast<IndexBuffer&>(resource).getMappedData();
+				break;
+
+			case Rhi::ResourceType::TEXTURE_BUFFER:
+				mappedSubresource.data = static_cast<TextureBuffer&>(resource).getMappedData();
+				break;
+
+			case Rhi::ResourceType::STRUCTURED_BUFFER:
+				mappedSubresource.data = static_cast<StructuredBuffer&>(resource).getMappedData();
+				break;
+
+			case Rhi::ResourceType::INDIRECT_BUFFER:
+				mappedSubresource.data = static_cast<IndirectBuffer&>(resource).getMappedData();
+				break;
+
+			case Rhi::ResourceType::UNIFORM_BUFFER:
+				mappedSubresource.data = static_cast<UniformBuffer&>(resource).getMappedData();
+				break;
+
+			case Rhi::ResourceType::ROOT_SIGNATURE:
+			case Rhi::ResourceType::RESOURCE_GROUP:
+			case Rhi::ResourceType::GRAPHICS_PROGRAM:
+			case Rhi::ResourceType::VERTEX_ARRAY:
+			case Rhi::ResourceType::RENDER_PASS:
+			case Rhi::ResourceType::QUERY_POOL:
+			case Rhi::ResourceType::SWAP_CHAIN:
+			case Rhi::ResourceType::FRAMEBUFFER:
+			case Rhi::ResourceType::TEXTURE_1D:
+			case Rhi::ResourceType::TEXTURE_1D_ARRAY:
+			case Rhi::ResourceType::TEXTURE_2D:
+			case Rhi::ResourceType::TEXTURE_2D_ARRAY:
+			case Rhi::ResourceType::TEXTURE_3D:
+			case Rhi::ResourceType::TEXTURE_CUBE:
+			case Rhi::ResourceType::TEXTURE_CUBE_ARRAY:
+			case Rhi::ResourceType::GRAPHICS_PIPELINE_STATE:
+			case Rhi::ResourceType::COMPUTE_PIPELINE_STATE:
+			case Rhi::ResourceType::SAMPLER_STATE:
+			case Rhi::ResourceType::VERTEX_SHADER:
+			case Rhi::ResourceType::TESSELLATION_CONTROL_SHADER:
+			case Rhi::ResourceType::TESSELLATION_EVALUATION_SHADER:
+			case Rhi::ResourceType::GEOMETRY_SHADER:
+			case Rhi::ResourceType::FRAGMENT_SHADER:
+			case Rhi::ResourceType::TASK_SHADER:
+			case Rhi::ResourceType::MESH_SHADER:
+			case Rhi::ResourceType::COMPUTE_SHADER:
+			default:
+				// Not supported by the null RHI
+				mappedSubresource.data = nullptr;
+				break;
+		}
+		return (nullptr != mappedSubresource.data);
 	}
 
 	void NullRhi::unmap(Rhi::IResource&, uint32_t)
-	{}
+	{
+		// Nothing here, the system memory of mapped buffers stays allocated until the buffer is destroyed
+	}
 
 	bool NullRhi::getQueryPoolResults(Rhi::IQueryPool&, uint32_t, uint8_t*, uint32_t, uint32_t, uint32_t, uint32_t)
 	{
@@ -4523,7 +4798,8 @@ namespace NullRhi
 		mCapabilities.maximumNumberOfCubeTextureArraySlices = 42;
 
 		// Maximum texture buffer (TBO) size in texel (>65536, typically much larger than that of one-dimensional texture, in case there's no support for texture buffer it's 0)
-		mCapabilities.maximumTextureBufferSize = mCapabilities.maximumStructuredBufferSize = 42;
+		// -> Buffers can be mapped, so use the OpenGL 3 minimum to not restrict the renderer buffer managers filling them: 128 MiB
+		mCapabilities.maximumTextureBufferSize = mCapabilities.maximumStructuredBufferSize = 128 * 1024 * 1024;
 
 		// Maximum indirect buffer size in bytes
 		mCapabilities.maximumIndirectBufferSize = 128 * 1024;	// 128 KiB
@@ -4560,6 +4836,10 @@ namespace NullRhi
 		// The null RHI has no shader bytecode support
 		mCapabilities.shaderBytecode = false;
 
+		// The null RHI has no persistent mapping
+		mCapabilities.persistentMapping = false;
+		mCapabilities.maximumNumberOfFramesInFlight = 0;
+
 		// Is there support for vertex shaders (VS)?
 		mCapabilities.vertexShader = true;
 
@@ -1027,6 +1027,15 @@ FNDEF_EX(glGetQueryObjectuivARB,	PFNGLGETQUERYOBJECTUIVARBPROC);
 // GL_ARB_timer_query
 FNDEF_EX(glQueryCounter,	PFNGLQUERYCOUNTERPROC);
 
+// GL_ARB_buffer_storage
+FNDEF_EX(glNamedBufferStorage,	PFNGLNAMEDBUFFERSTORAGEPROC);
+FNDEF_EX(glMapNamedBufferRange,	PFNGLMAPNAMEDBUFFERRANGEPROC);
+
+// GL_ARB_sync
+FNDEF_EX(glFenceSync,		PFNGLFENCESYNCPROC);
+FNDEF_EX(glClientWaitSync,	PFNGLCLIENTWAITSYNCPROC);
+FNDEF_EX(glDeleteSync,		PFNGLDELETESYNCPROC);
+
 
 //[-------------------------------------------------------]
 //[ Core (OpenGL version dependent)                       ]
@@ -1054,6 +1063,7 @@ namespace
 		//[ Global definitions                                    ]
 		//[-------------------------------------------------------]
 		static constexpr const char* GLSL_NAME = "GLSL";	///< ASCII name of this shader language, always valid (do not free the memory the returned pointer is pointing to)
+		static constexpr uint8_t MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT = 2;	///< Maximum number of presented frames the GPU might still be working on while the CPU writes into persistently mapped buffers, see "Rhi::Capabilities::maximumNumberOfFramesInFlight"
 
 		#ifdef RHI_OPENGL_GLSLTOSPIRV
 			static bool GlslangInitialized = false;
@@ -1171,6 +1181,16 @@ namespace
 		//[-------------------------------------------------------]
 		//[ Global functions                                      ]
 		//[-------------------------------------------------------]
+		[[nodiscard]] void* createPersistentlyMappedBuffer(GLuint openGLBuffer, uint32_t numberOfBytes, const void* data)
+		{
+			// Immutable buffer storage which stays mapped for the lifetime of the buffer
+			// -> Coherent mapping, so CPU writes become visible to the GPU without explicit flushes
+			// -> "GL_DYNAMIC_STORAGE_BIT" keeps "glNamedBufferSubData()" working
+			static constexpr GLbitfield OPENGL_MAP_FLAGS = (GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+			glNamedBufferStorage(openGLBuffer, static_cast<GLsizeiptr>(numberOfBytes), data, OPENGL_MAP_FLAGS | GL_DYNAMIC_STORAGE_BIT);
+			return glMapNamedBufferRange(openGLBuffer, 0, static_cast<GLsizeiptr>(numberOfBytes), OPENGL_MAP_FLAGS);
+		}
+
 		void updateWidthHeight(uint32_t mipmapIndex, uint32_t textureWidth, uint32_t textureHeight, uint32_t& width, uint32_t& height)
 		{
 			Rhi::ITexture::getMipmapSize(mipmapIndex, textureWidth, textureHeight);
@@ -1854,6 +1874,17 @@ namespace OpenGLRhi
 
 		void dispatchCommandBufferInternal(const Rhi::CommandBuffer& commandBuffer);
 
+		/**
+		*  @brief
+		*    Fence the frame which is about to be presented
+		*
+		*  @note
+		*    - Blocks until the GPU is done with the frame presented "Rhi::Capabilities::maximumNumberOfFramesInFlight" presents ago,
+		*      afterwards the CPU is allowed to overwrite persistently mapped buffer data this frame used
+		*    - Does nothing if "Rhi::Capabilities::persistentMapping" is false
+		*/
+		void fencePresentedFrame();
+
 		//[-------------------------------------------------------]
 		//[ Graphics                                              ]
 		//[-------------------------------------------------------]
@@ -2066,6 +2097,9 @@ namespace OpenGLRhi
 		GLuint	 mOpenGLVertexProgram;			///< Currently set OpenGL vertex program, can be zero if no resource is set
 		GLint	 mDrawIdUniformLocation;		///< Draw ID uniform location
 		uint32_t mCurrentStartInstanceLocation;	///< Currently set start instance location
+		// Frame fences for persistently mapped buffers
+		GLsync	 mOpenGLFrameFences[::detail::MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT];	///< OpenGL fences of the last presented frames, ring buffer, entries can be a null pointer
+		uint32_t mCurrentOpenGLFrameFenceIndex;										///< Ring buffer index of the OpenGL frame fence to set next
 
 
 	};
@@ -2621,6 +2655,16 @@ namespace OpenGLRhi
 			return mGL_ARB_timer_query;
 		}
 
+		[[nodiscard]] inline bool isGL_ARB_buffer_storage() const
+		{
+			return mGL_ARB_buffer_storage;
+		}
+
+		[[nodiscard]] inline bool isGL_ARB_sync() const
+		{
+			return mGL_ARB_sync;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
@@ -2834,6 +2878,8 @@ namespace OpenGLRhi
 			mGL_ARB_occlusion_query				 = false;
 			mGL_ARB_pipeline_statistics_query	 = false;
 			mGL_ARB_timer_query					 = false;
+			mGL_ARB_buffer_storage				 = false;
+			mGL_ARB_sync						 = false;
 		}
 
 		/**
@@ -3548,6 +3594,30 @@ namespace OpenGLRhi
 				mGL_ARB_timer_query = result;
 			}
 
+			// GL_ARB_buffer_storage - Is core since OpenGL 4.4
+			// -> We only use the named entry points which are provided by "GL_ARB_direct_state_access"
+			mGL_ARB_buffer_storage = (mGL_ARB_direct_state_access && isSupported("GL_ARB_buffer_storage"));
+			if (mGL_ARB_buffer_storage)
+			{
+				// Load the entry points
+				bool result = true;	// Success by default
+				IMPORT_FUNC(glNamedBufferStorage)
+				IMPORT_FUNC(glMapNamedBufferRange)
+				mGL_ARB_buffer_storage = result;
+			}
+
+			// GL_ARB_sync - Is core since OpenGL 3.2
+			mGL_ARB_sync = isCoreProfile ? true : isSupported("GL_ARB_sync");
+			if (mGL_ARB_sync)
+			{
+				// Load the entry points
+				bool result = true;	// Success by default
+				IMPORT_FUNC(glFenceSync)
+				IMPORT_FUNC(glClientWaitSync)
+				IMPORT_FUNC(glDeleteSync)
+				mGL_ARB_sync = result;
+			}
+
 
 			//[-------------------------------------------------------]
 			//[ Core (OpenGL version dependent)                       ]
@@ -3627,6 +3697,8 @@ namespace OpenGLRhi
 		bool mGL_ARB_occlusion_query;
 		bool mGL_ARB_pipeline_statistics_query;
 		bool mGL_ARB_timer_query;
+		bool mGL_ARB_buffer_storage;
+		bool mGL_ARB_sync;
 
 
 	};
@@ -6901,6 +6973,18 @@ namespace OpenGLRhi
 			return mOpenGLInternalFormat;
 		}
 
+		/**
+		*  @brief
+		*    Return the persistently mapped data
+		*
+		*  @return
+		*    The persistently mapped data, null pointer if the buffer isn't persistently mapped (see "Rhi::Capabilities::persistentMapping")
+		*/
+		[[nodiscard]] inline void* getPersistentlyMappedData() const
+		{
+			return mPersistentlyMappedData;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual Rhi::RefCount methods               ]
@@ -6929,7 +7013,8 @@ namespace OpenGLRhi
 			ITextureBuffer(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mOpenGLTextureBuffer(0),
 			mOpenGLTexture(0),
-			mOpenGLInternalFormat(Mapping::getOpenGLInternalFormat(textureFormat))
+			mOpenGLInternalFormat(Mapping::getOpenGLInternalFormat(textureFormat)),
+			mPersistentlyMappedData(nullptr)
 		{}
 
 
@@ -6940,6 +7025,7 @@ namespace OpenGLRhi
 		GLuint mOpenGLTextureBuffer;	///< OpenGL texture buffer, can be zero if no resource is allocated
 		GLuint mOpenGLTexture;			///< OpenGL texture, can be zero if no resource is allocated
 		GLuint mOpenGLInternalFormat;	///< OpenGL internal format
+		void*  mPersistentlyMappedData;	///< Persistently mapped OpenGL texture buffer data, can be a null pointer, unmapped by OpenGL when the buffer gets destroyed
 
 
 	//[-------------------------------------------------------]
@@ -7103,8 +7189,16 @@ namespace OpenGLRhi
 					glCreateBuffers(1, &mOpenGLTextureBuffer);
 
 					// Upload the data
+					// -> Streamed buffers are persistently mapped if possible, see "Rhi::Capabilities::persistentMapping"
 					// -> Usage: These constants directly map to "GL_ARB_vertex_buffer_object" and OpenGL ES 3 constants, do not change them
-					glNamedBufferData(mOpenGLTextureBuffer, static_cast<GLsizeiptr>(numberOfBytes), data, static_cast<GLenum>(bufferUsage));
+					if (Rhi::BufferUsage::STREAM_DRAW == bufferUsage && openGLRhi.getCapabilities().persistentMapping)
+					{
+						mPersistentlyMappedData = ::detail::createPersistentlyMappedBuffer(mOpenGLTextureBuffer, numberOfBytes, data);
+					}
+					else
+					{
+						glNamedBufferData(mOpenGLTextureBuffer, static_cast<GLsizeiptr>(numberOfBytes), data, static_cast<GLenum>(bufferUsage));
+					}
 				}
 
 				{ // Texture part
@@ -7468,6 +7562,18 @@ namespace OpenGLRhi
 			return mOpenGLIndirectBuffer;
 		}
 
+		/**
+		*  @brief
+		*    Return the persistently mapped data
+		*
+		*  @return
+		*    The persistently mapped data, null pointer if the buffer isn't persistently mapped (see "Rhi::Capabilities::persistentMapping")
+		*/
+		[[nodiscard]] inline void* getPersistentlyMappedData() const
+		{
+			return mPersistentlyMappedData;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Rhi::IIndirectBuffer methods           ]
@@ -7502,7 +7608,8 @@ namespace OpenGLRhi
 		*/
 		inline explicit IndirectBuffer(OpenGLRhi& openGLRhi RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
 			IIndirectBuffer(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
-			mOpenGLIndirectBuffer(0)
+			mOpenGLIndirectBuffer(0),
+			mPersistentlyMappedData(nullptr)
 		{}
 
 
@@ -7511,6 +7618,7 @@ namespace OpenGLRhi
 	//[-------------------------------------------------------]
 	protected:
 		GLuint mOpenGLIndirectBuffer;	///< OpenGL indirect buffer, can be zero if no resource is allocated
+		void*  mPersistentlyMappedData;	///< Persistently mapped OpenGL indirect buffer data, can be a null pointer, unmapped by OpenGL when the buffer gets destroyed
 
 
 	//[-------------------------------------------------------]
@@ -7644,8 +7752,16 @@ namespace OpenGLRhi
 				glCreateBuffers(1, &mOpenGLIndirectBuffer);
 
 				// Upload the data
+				// -> Streamed buffers are persistently mapped if possible, see "Rhi::Capabilities::persistentMapping"
 				// -> Usage: These constants directly map to "GL_ARB_vertex_buffer_object" and OpenGL ES 3 constants, do not change them
-				glNamedBufferData(mOpenGLIndirectBuffer, static_cast<GLsizeiptr>(numberOfBytes), data, static_cast<GLenum>(bufferUsage));
+				if (Rhi::BufferUsage::STREAM_DRAW == bufferUsage && openGLRhi.getCapabilities().persistentMapping)
+				{
+					mPersistentlyMappedData = ::detail::createPersistentlyMappedBuffer(mOpenGLIndirectBuffer, numberOfBytes, data);
+				}
+				else
+				{
+					glNamedBufferData(mOpenGLIndirectBuffer, static_cast<GLsizeiptr>(numberOfBytes), data, static_cast<GLenum>(bufferUsage));
+				}
 			}
 			else
 			{
@@ -7726,6 +7842,18 @@ namespace OpenGLRhi
 			return mOpenGLUniformBuffer;
 		}
 
+		/**
+		*  @brief
+		*    Return the persistently mapped data
+		*
+		*  @return
+		*    The persistently mapped data, null pointer if the buffer isn't persistently mapped (see "Rhi::Capabilities::persistentMapping")
+		*/
+		[[nodiscard]] inline void* getPersistentlyMappedData() const
+		{
+			return mPersistentlyMappedData;
+		}
+
 
 	//[-------------------------------------------------------]
 	//[ Protected virtual Rhi::RefCount methods               ]
@@ -7750,7 +7878,8 @@ namespace OpenGLRhi
 		*/
 		inline explicit UniformBuffer(OpenGLRhi& openGLRhi RHI_RESOURCE_DEBUG_NAME_PARAMETER_NO_DEFAULT) :
 			IUniformBuffer(openGLRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
-			mOpenGLUniformBuffer(0)
+			mOpenGLUniformBuffer(0),
+			mPersistentlyMappedData(nullptr)
 		{}
 
 
@@ -7759,6 +7888,7 @@ namespace OpenGLRhi
 	//[-------------------------------------------------------]
 	protected:
 		GLuint mOpenGLUniformBuffer;	///< OpenGL uniform buffer, can be zero if no resource is allocated
+		void*  mPersistentlyMappedData;	///< Persistently mapped OpenGL uniform buffer data, can be a null pointer, unmapped by OpenGL when the buffer gets destroyed
 
 
 	//[-------------------------------------------------------]
@@ -7896,8 +8026,16 @@ namespace OpenGLRhi
 				glCreateBuffers(1, &mOpenGLUniformBuffer);
 
 				// Upload the data
+				// -> Streamed buffers are persistently mapped if possible, see "Rhi::Capabilities::persistentMapping"
 				// -> Usage: These constants directly map to "GL_ARB_vertex_buffer_object" and OpenGL ES 3 constants, do not change them
-				glNamedBufferData(mOpenGLUniformBuffer, static_cast<GLsizeiptr>(numberOfBytes), data, static_cast<GLenum>(bufferUsage));
+				if (Rhi::BufferUsage::STREAM_DRAW == bufferUsage && openGLRhi.getCapabilities().persistentMapping)
+				{
+					mPersistentlyMappedData = ::detail::createPersistentlyMappedBuffer(mOpenGLUniformBuffer, numberOfBytes, data);
+				}
+				else
+				{
+					glNamedBufferData(mOpenGLUniformBuffer, static_cast<GLsizeiptr>(numberOfBytes), data, static_cast<GLenum>(bufferUsage));
+				}
 			}
 			else
 			{
@@ -13276,6 +13414,9 @@ namespace OpenGLRhi
 
 		virtual void present() override
 		{
+			// Fence the frame so the CPU knows when it's allowed to overwrite persistently mapped buffer data again
+			static_cast<OpenGLRhi&>(getRhi()).fencePresentedFrame();
+
 			if (nullptr != mRenderWindow)
 			{
 				mRenderWindow->present();
@@ -18803,12 +18944,18 @@ namespace
 			return N;
 		}
 
-		[[nodiscard]] bool mapBuffer([[maybe_unused]] const Rhi::Context& context, const OpenGLRhi::Extensions& extensions, GLenum target, [[maybe_unused]] GLenum bindingTarget, GLuint openGLBuffer, Rhi::MapType mapType, Rhi::MappedSubresource& mappedSubresource)
+		[[nodiscard]] bool mapBuffer([[maybe_unused]] const Rhi::Context& context, const OpenGLRhi::Extensions& extensions, GLenum target, [[maybe_unused]] GLenum bindingTarget, GLuint openGLBuffer, void* persistentlyMappedData, Rhi::MapType mapType, Rhi::MappedSubresource& mappedSubresource)
 		{
-			// TODO(co) This buffer update isn't efficient, use e.g. persistent buffer mapping
-
+			// Persistently mapped buffer?
+			// -> No driver round-trip and no discard, the user is responsible for not overwriting data the GPU is still using (see "Rhi::Capabilities::persistentMapping")
+			if (nullptr != persistentlyMappedData)
+			{
+				mappedSubresource.data		 = persistentlyMappedData;
+				mappedSubresource.rowPitch   = 0;
+				mappedSubresource.depthPitch = 0;
+			}
 			// Is "GL_ARB_direct_state_access" there?
-			if (extensions.isGL_ARB_direct_state_access())
+			else if (extensions.isGL_ARB_direct_state_access())
 			{
 				// Effective direct state access (DSA)
 				mappedSubresource.data		 = glMapNamedBuffer(openGLBuffer, OpenGLRhi::Mapping::getOpenGLMapType(mapType));
@@ -18852,10 +18999,15 @@ namespace
 			return (nullptr != mappedSubresource.data);
 		}
 
-		void unmapBuffer(const OpenGLRhi::Extensions& extensions, GLenum target, [[maybe_unused]] GLenum bindingTarget, GLuint openGLBuffer)
+		void unmapBuffer(const OpenGLRhi::Extensions& extensions, GLenum target, [[maybe_unused]] GLenum bindingTarget, GLuint openGLBuffer, const void* persistentlyMappedData)
 		{
+			// Persistently mapped buffers stay mapped
+			if (nullptr != persistentlyMappedData)
+			{
+				// Nothing here
+			}
 			// Is "GL_ARB_direct_state_access" there?
-			if (extensions.isGL_ARB_direct_state_access())
+			else if (extensions.isGL_ARB_direct_state_access())
 			{
 				// Effective direct state access (DSA)
 				glUnmapNamedBuffer(openGLBuffer);
@@ -19227,7 +19379,10 @@ namespace OpenGLRhi
 		// Draw ID uniform location for "GL_ARB_base_instance"-emulation (see "17/11/2012 Surviving without gl_DrawID" - https://www.g-truc.net/post-0518.html)
 		mOpenGLVertexProgram(0),
 		mDrawIdUniformLocation(-1),
-		mCurrentStartInstanceLocation(~0u)
+		mCurrentStartInstanceLocation(~0u),
+		// Frame fences for persistently mapped buffers
+		mOpenGLFrameFences{},
+		mCurrentOpenGLFrameFenceIndex(0)
 	{
 		// Is OpenGL available?
 		mOpenGLRuntimeLinking = RHI_NEW(mContext, OpenGLRuntimeLinking)(*this);
@@ -19341,6 +19496,15 @@ namespace OpenGLRhi
 		// -> Silently ignores 0's and names that do not correspond to existing vertex array objects
 		glDeleteVertexArrays(1, &mDefaultOpenGLVertexArray);
 
+		// Destroy the OpenGL frame fences
+		for (GLsync openGLFrameFence : mOpenGLFrameFences)
+		{
+			if (nullptr != openGLFrameFence)
+			{
+				glDeleteSync(openGLFrameFence);
+			}
+		}
+
 		// Release the graphics and compute root signature instance, in case we have one
 		if (nullptr != mGraphicsRootSignature)
 		{
@@ -19392,8 +19556,7 @@ namespace OpenGLRhi
 	void OpenGLRhi::dispatchCommandBufferInternal(const Rhi::CommandBuffer& commandBuffer)
 	{
 		// Loop through all commands
-		const uint8_t* commandPacketBuffer = commandBuffer.getCommandPacketBuffer();
-		Rhi::ConstCommandPacket constCommandPacket = commandPacketBuffer;
+		Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket();
 		while (nullptr != constCommandPacket)
 		{
 			{ // Dispatch command packet
@@ -19403,12 +19566,31 @@ namespace OpenGLRhi
 			}
 
 			{ // Next command
-				const uint32_t nextCommandPacketByteIndex = Rhi::CommandPacketHelper::getNextCommandPacketByteIndex(constCommandPacket);
-				constCommandPacket = (~0u != nextCommandPacketByteIndex) ? &commandPacketBuffer[nextCommandPacketByteIndex] : nullptr;
+				constCommandPacket = Rhi::CommandPacketHelper::getNextCommandPacket(constCommandPacket);
 			}
 		}
 	}
 
+	void OpenGLRhi::fencePresentedFrame()
+	{
+		if (mCapabilities.persistentMapping)
+		{
+			// Wait until the GPU is done with the oldest frame still in flight, the ring buffer slot is reused for the current frame
+			GLsync& openGLFrameFence = mOpenGLFrameFences[mCurrentOpenGLFrameFenceIndex];
+			if (nullptr != openGLFrameFence)
+			{
+				// "GL_TIMEOUT_IGNORED" isn't allowed for "glClientWaitSync()", so wait in one second steps
+				while (GL_TIMEOUT_EXPIRED == glClientWaitSync(openGLFrameFence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000))
+				{
+					// Nothing here
+				}
+				glDeleteSync(openGLFrameFence);
+			}
+			openGLFrameFence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			mCurrentOpenGLFrameFenceIndex = (mCurrentOpenGLFrameFenceIndex + 1) % ::detail::MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT;
+		}
+	}
+
 
 	//[-------------------------------------------------------]
 	//[ Graphics                                              ]
@@ -20821,22 +21003,22 @@ namespace OpenGLRhi
 		switch (resource.getResourceType())
 		{
 			case Rhi::ResourceType::VERTEX_BUFFER:
-				return ::detail::mapBuffer(mContext, *mExtensions, GL_ARRAY_BUFFER_ARB, GL_ARRAY_BUFFER_BINDING_ARB, static_cast<VertexBuffer&>(resource).getOpenGLArrayBuffer(), mapType, mappedSubresource);
+				return ::detail::mapBuffer(mContext, *mExtensions, GL_ARRAY_BUFFER_ARB, GL_ARRAY_BUFFER_BINDING_ARB, static_cast<VertexBuffer&>(resource).getOpenGLArrayBuffer(), nullptr, mapType, mappedSubresource);
 
 			case Rhi::ResourceType::INDEX_BUFFER:
-				return ::detail::mapBuffer(mContext, *mExtensions, GL_ELEMENT_ARRAY_BUFFER_ARB, GL_ELEMENT_ARRAY_BUFFER_BINDING_ARB, static_cast<IndexBuffer&>(resource).getOpenGLElementArrayBuffer(), mapType, mappedSubresource);
+				return ::detail::mapBuffer(mContext, *mExtensions, GL_ELEMENT_ARRAY_BUFFER_ARB, GL_ELEMENT_ARRAY_BUFFER_BINDING_ARB, static_cast<IndexBuffer&>(resource).getOpenGLElementArrayBuffer(), nullptr, mapType, mappedSubresource);
 
 			case Rhi::ResourceType::TEXTURE_BUFFER:
-				return ::detail::mapBuffer(mContext, *mExtensions, GL_TEXTURE_BUFFER_ARB, GL_TEXTURE_BINDING_BUFFER_ARB, static_cast<TextureBuffer&>(resource).getOpenGLTextureBuffer(), mapType, mappedSubresource);
+				return ::detail::mapBuffer(mContext, *mExtensions, GL_TEXTURE_BUFFER_ARB, GL_TEXTURE_BINDING_BUFFER_ARB, static_cast<TextureBuffer&>(resource).getOpenGLTextureBuffer(), static_cast<TextureBuffer&>(resource).getPersistentlyMappedData(), mapType, mappedSubresource);
 
 			case Rhi::ResourceType::STRUCTURED_BUFFER:
-				return ::detail::mapBuffer(mContext, *mExtensions, GL_TEXTURE_BUFFER_ARB, GL_TEXTURE_BINDING_BUFFER_ARB, static_cast<StructuredBuffer&>(resource).getOpenGLStructuredBuffer(), mapType, mappedSubresource);
+				return ::detail::mapBuffer(mContext, *mExtensions, GL_TEXTURE_BUFFER_ARB, GL_TEXTURE_BINDING_BUFFER_ARB, static_cast<StructuredBuffer&>(resource).getOpenGLStructuredBuffer(), nullptr, mapType, mappedSubresource);
 
 			case Rhi::ResourceType::INDIRECT_BUFFER:
-				return ::detail::mapBuffer(mContext, *mExtensions, GL_DRAW_INDIRECT_BUFFER, GL_DRAW_INDIRECT_BUFFER_BINDING, static_cast<IndirectBuffer&>(resource).getOpenGLIndirectBuffer(), mapType, mappedSubresource);
+				return ::detail::mapBuffer(mContext, *mExtensions, GL_DRAW_INDIRECT_BUFFER, GL_DRAW_INDIRECT_BUFFER_BINDING, static_cast<IndirectBuffer&>(resource).getOpenGLIndirectBuffer(), static_cast<IndirectBuffer&>(resource).getPersistentlyMappedData(), mapType, mappedSubresource);
 
 			case Rhi::ResourceType::UNIFORM_BUFFER:
-				return ::detail::mapBuffer(mContext, *mExtensions, GL_UNIFORM_BUFFER, GL_UNIFORM_BUFFER_BINDING, static_cast<UniformBuffer&>(resource).getOpenGLUniformBuffer(), mapType, mappedSubresource);
+				return ::detail::mapBuffer(mContext, *mExtensions, GL_UNIFORM_BUFFER, GL_UNIFORM_BUFFER_BINDING, static_cast<UniformBuffer&>(resource).getOpenGLUniformBuffer(), static_cast<UniformBuffer&>(resource).getPersistentlyMappedData(), mapType, mappedSubresource);
 
 			case Rhi::ResourceType::TEXTURE_1D:
 			{
@@ -20909,7 +21091,7 @@ namespace OpenGLRhi
 			}
 
 			case Rhi::ResourceType::TEXTURE_3D:
-				return ::detail::mapBuffer(mContext, *mExtensions, GL_PIXEL_UNPACK_BUFFER_ARB, GL_PIXEL_UNPACK_BUFFER_BINDING_ARB, static_cast<Texture3D&>(resource).getOpenGLPixelUnpackBuffer(), mapType, mappedSubresource);
+				return ::detail::mapBuffer(mContext, *mExtensions, GL_PIXEL_UNPACK_BUFFER_ARB, GL_PIXEL_UNPACK_BUFFER_BINDING_ARB, static_cast<Texture3D&>(resource).getOpenGLPixelUnpackBuffer(), nullptr, mapType, mappedSubresource);
 
 			case Rhi::ResourceType::TEXTURE_CUBE:
 			{
@@ -20959,27 +21141,27 @@ namespace OpenGLRhi
 		switch (resource.getResourceType())
 		{
 			case Rhi::ResourceType::VERTEX_BUFFER:
-				::detail::unmapBuffer(*mExtensions, GL_ARRAY_BUFFER_ARB, GL_ARRAY_BUFFER_BINDING_ARB, static_cast<VertexBuffer&>(resource).getOpenGLArrayBuffer());
+				::detail::unmapBuffer(*mExtensions, GL_ARRAY_BUFFER_ARB, GL_ARRAY_BUFFER_BINDING_ARB, static_cast<VertexBuffer&>(resource).getOpenGLArrayBuffer(), nullptr);
 				break;
 
 			case Rhi::ResourceType::INDEX_BUFFER:
-				::detail::unmapBuffer(*mExtensions, GL_ELEMENT_ARRAY_BUFFER_ARB, GL_ELEMENT_ARRAY_BUFFER_BINDING_ARB, static_cast<IndexBuffer&>(resource).getOpenGLElementArrayBuffer());
+				::detail::unmapBuffer(*mExtensions, GL_ELEMENT_ARRAY_BUFFER_ARB, GL_ELEMENT_ARRAY_BUFFER_BINDING_ARB, static_cast<IndexBuffer&>(resource).getOpenGLElementArrayBuffer(), nullptr);
 				break;
 
 			case Rhi::ResourceType::TEXTURE_BUFFER:
-				::detail::unmapBuffer(*mExtensions, GL_TEXTURE_BUFFER_ARB, GL_TEXTURE_BINDING_BUFFER_ARB, static_cast<TextureBuffer&>(resource).getOpenGLTextureBuffer());
+				::detail::unmapBuffer(*mExtensions, GL_TEXTURE_BUFFER_ARB, GL_TEXTURE_BINDING_BUFFER_ARB, static_cast<TextureBuffer&>(resource).getOpenGLTextureBuffer(), static_cast<TextureBuffer&>(resource).getPersistentlyMappedData());
 				break;
 
 			case Rhi::ResourceType::STRUCTURED_BUFFER:
-				::detail::unmapBuffer(*mExtensions, GL_TEXTURE_BUFFER_ARB, GL_TEXTURE_BINDING_BUFFER_ARB, static_cast<StructuredBuffer&>(resource).getOpenGLStructuredBuffer());
+				::detail::unmapBuffer(*mExtensions, GL_TEXTURE_BUFFER_ARB, GL_TEXTURE_BINDING_BUFFER_ARB, static_cast<StructuredBuffer&>(resource).getOpenGLStructuredBuffer(), nullptr);
 				break;
 
 			case Rhi::ResourceType::INDIRECT_BUFFER:
-				::detail::unmapBuffer(*mExtensions, GL_DRAW_INDIRECT_BUFFER, GL_DRAW_INDIRECT_BUFFER_BINDING, static_cast<IndirectBuffer&>(resource).getOpenGLIndirectBuffer());
+				::detail::unmapBuffer(*mExtensions, GL_DRAW_INDIRECT_BUFFER, GL_DRAW_INDIRECT_BUFFER_BINDING, static_cast<IndirectBuffer&>(resource).getOpenGLIndirectBuffer(), static_cast<IndirectBuffer&>(resource).getPersistentlyMappedData());
 				break;
 
 			case Rhi::ResourceType::UNIFORM_BUFFER:
-				::detail::unmapBuffer(*mExtensions, GL_UNIFORM_BUFFER, GL_UNIFORM_BUFFER_BINDING, static_cast<UniformBuffer&>(resource).getOpenGLUniformBuffer());
+				::detail::unmapBuffer(*mExtensions, GL_UNIFORM_BUFFER, GL_UNIFORM_BUFFER_BINDING, static_cast<UniformBuffer&>(resource).getOpenGLUniformBuffer(), static_cast<UniformBuffer&>(resource).getPersistentlyMappedData());
 				break;
 
 			case Rhi::ResourceType::TEXTURE_1D:
@@ -21038,7 +21220,7 @@ namespace OpenGLRhi
 				const Texture3D& texture3D = static_cast<Texture3D&>(resource);
 				const Rhi::TextureFormat::Enum textureFormat = texture3D.getTextureFormat();
 				const uint32_t openGLPixelUnpackBuffer = texture3D.getOpenGLPixelUnpackBuffer();
-				::detail::unmapBuffer(*mExtensions, GL_PIXEL_UNPACK_BUFFER_ARB, GL_PIXEL_UNPACK_BUFFER_BINDING_ARB, openGLPixelUnpackBuffer);
+				::detail::unmapBuffer(*mExtensions, GL_PIXEL_UNPACK_BUFFER_ARB, GL_PIXEL_UNPACK_BUFFER_BINDING_ARB, openGLPixelUnpackBuffer, nullptr);
 
 				// Backup the currently set alignment and currently bound OpenGL pixel unpack buffer
 				#ifdef RHI_OPENGL_STATE_CLEANUP
@@ -21477,6 +21659,10 @@ namespace OpenGLRhi
 		// We don't support the OpenGL program binaries since those are operation system and graphics driver version dependent, which renders them useless for pre-compiled shaders shipping
 		mCapabilities.shaderBytecode = mExtensions->isGL_ARB_gl_spirv();
 
+		// Persistent mapping of streamed buffers ("GL_ARB_buffer_storage" required), frames are fenced at swap chain present ("GL_ARB_sync" required)
+		mCapabilities.persistentMapping = (mExtensions->isGL_ARB_buffer_storage() && mExtensions->isGL_ARB_sync());
+		mCapabilities.maximumNumberOfFramesInFlight = mCapabilities.persistentMapping ? ::detail::MAXIMUM_NUMBER_OF_FRAMES_IN_FLIGHT : 0u;
+
 		// Is there support for vertex shaders (VS)?
 		mCapabilities.vertexShader = mExtensions->isGL_ARB_vertex_shader();
 
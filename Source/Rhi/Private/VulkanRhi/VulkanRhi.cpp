@@ -151,9 +151,12 @@ PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(4774)	// warning C4774: 'sprintf_s' : format string expected in argument 3 is not a string literal
 	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::_Generic_error_category': move constructor was implicitly defined as deleted
 	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Generic_error_category': move assignment operator was implicitly defined as deleted
+	#include <map>
 	#include <array>
+	#include <mutex>
 	#include <vector>
 	#include <sstream>
+	#include <algorithm>
 PRAGMA_WARNING_POP
 
 
@@ -541,6 +544,8 @@ namespace VulkanRhi
 	class VertexArray;
 	class RootSignature;
 	class VulkanContext;
+	class VulkanUploadQueue;
+	class VulkanDescriptorAllocator;
 	class VulkanRuntimeLinking;
 }
 
@@ -650,6 +655,8 @@ FNPTR(vkDestroySemaphore)
 FNPTR(vkCreateFence)
 FNPTR(vkDestroyFence)
 FNPTR(vkWaitForFences)
+FNPTR(vkResetFences)
+FNPTR(vkGetFenceStatus)
 FNPTR(vkCreateCommandPool)
 FNPTR(vkDestroyCommandPool)
 FNPTR(vkAllocateCommandBuffers)
@@ -664,6 +671,8 @@ FNPTR(vkCreateFramebuffer)
 FNPTR(vkDestroyFramebuffer)
 FNPTR(vkCreatePipelineCache)
 FNPTR(vkDestroyPipelineCache)
+FNPTR(vkGetPipelineCacheData)
+FNPTR(vkMergePipelineCaches)
 FNPTR(vkCreatePipelineLayout)
 FNPTR(vkDestroyPipelineLayout)
 FNPTR(vkCreateGraphicsPipelines)
@@ -675,6 +684,7 @@ FNPTR(vkCreateDescriptorSetLayout)
 FNPTR(vkDestroyDescriptorSetLayout)
 FNPTR(vkAllocateDescriptorSets)
 FNPTR(vkFreeDescriptorSets)
+FNPTR(vkResetDescriptorPool)
 FNPTR(vkUpdateDescriptorSets)
 FNPTR(vkCreateQueryPool)
 FNPTR(vkDestroyQueryPool)
@@ -2005,6 +2015,7 @@ namespace VulkanRhi
 	//[ Friends                                               ]
 	//[-------------------------------------------------------]
 		friend class GraphicsPipelineState;
+		friend class VulkanMemoryAllocator;	// Device memory statistics
 
 
 	//[-------------------------------------------------------]
@@ -2086,6 +2097,42 @@ namespace VulkanRhi
 			return *mVulkanContext;
 		}
 
+		/**
+		*  @brief
+		*    Return the Vulkan upload queue instance
+		*
+		*  @return
+		*    The Vulkan upload queue instance, do not free the memory the reference is pointing to
+		*/
+		[[nodiscard]] inline VulkanUploadQueue& getVulkanUploadQueue() const
+		{
+			return *mVulkanUploadQueue;
+		}
+
+		/**
+		*  @brief
+		*    Return the Vulkan descriptor allocator instance
+		*
+		*  @return
+		*    The Vulkan descriptor allocator instance, do not free the memory the reference is pointing to
+		*/
+		[[nodiscard]] inline VulkanDescriptorAllocator& getVulkanDescriptorAllocator() const
+		{
+			return *mVulkanDescriptorAllocator;
+		}
+
+		/**
+		*  @brief
+		*    Return the Vulkan pipeline cache instance
+		*
+		*  @return
+		*    The Vulkan pipeline cache instance, can be a null handle
+		*/
+		[[nodiscard]] inline VkPipelineCache getVkPipelineCache() const
+		{
+			return mVkPipelineCache;
+		}
+
 		void dispatchCommandBufferInternal(const Rhi::CommandBuffer& commandBuffer);
 
 		//[-------------------------------------------------------]
@@ -2170,6 +2217,12 @@ namespace VulkanRhi
 		//[ Operation                                             ]
 		//[-------------------------------------------------------]
 		virtual void dispatchCommandBuffer(const Rhi::CommandBuffer& commandBuffer) override;
+		//[-------------------------------------------------------]
+		//[ Pipeline cache                                        ]
+		//[-------------------------------------------------------]
+		[[nodiscard]] virtual uint32_t getPipelineCacheData(uint8_t* data, uint32_t numberOfBytes) const override;
+		virtual bool setPipelineCacheData(const uint8_t* data, uint32_t numberOfBytes) override;
+		[[nodiscard]] virtual bool doesPipelineCacheNeedSaving() const override;
 
 
 	//[-------------------------------------------------------]
@@ -2215,6 +2268,10 @@ namespace VulkanRhi
 		VkAllocationCallbacks mVkAllocationCallbacks;	///< Vulkan allocation callbacks
 		VulkanRuntimeLinking* mVulkanRuntimeLinking;	///< Vulkan runtime linking instance, always valid
 		VulkanContext*		  mVulkanContext;			///< Vulkan context instance, always valid
+		VulkanUploadQueue*	  mVulkanUploadQueue;		///< Vulkan upload queue instance, valid if the Vulkan context is initialized
+		VulkanDescriptorAllocator* mVulkanDescriptorAllocator;	///< Vulkan descriptor allocator instance, valid if the Vulkan context is initialized
+		VkPipelineCache		  mVkPipelineCache;			///< Vulkan pipeline cache instance used for all pipeline creations, can be a null handle
+		mutable size_t		  mSavedPipelineCacheSize;	///< Vulkan pipeline cache size in bytes at the time the pipeline cache data was last set or queried, the pipeline cache only grows when new pipelines are compiled
 		Rhi::IShaderLanguage* mShaderLanguageGlsl;		///< GLSL shader language instance (we keep a reference to it), can be a null pointer
 		RootSignature*		  mGraphicsRootSignature;	///< Currently set graphics root signature (we keep a reference to it), can be a null pointer
 		RootSignature*		  mComputeRootSignature;	///< Currently set compute root signature (we keep a reference to it), can be a null pointer
@@ -2437,6 +2494,8 @@ namespace VulkanRhi
 			IMPORT_FUNC(vkCreateFence)
 			IMPORT_FUNC(vkDestroyFence)
 			IMPORT_FUNC(vkWaitForFences)
+			IMPORT_FUNC(vkResetFences)
+			IMPORT_FUNC(vkGetFenceStatus)
 			IMPORT_FUNC(vkCreateCommandPool)
 			IMPORT_FUNC(vkDestroyCommandPool)
 			IMPORT_FUNC(vkAllocateCommandBuffers)
@@ -2451,6 +2510,8 @@ namespace VulkanRhi
 			IMPORT_FUNC(vkDestroyFramebuffer)
 			IMPORT_FUNC(vkCreatePipelineCache)
 			IMPORT_FUNC(vkDestroyPipelineCache)
+			IMPORT_FUNC(vkGetPipelineCacheData)
+			IMPORT_FUNC(vkMergePipelineCaches)
 			IMPORT_FUNC(vkCreatePipelineLayout)
 			IMPORT_FUNC(vkDestroyPipelineLayout)
 			IMPORT_FUNC(vkCreateGraphicsPipelines)
@@ -2462,6 +2523,7 @@ namespace VulkanRhi
 			IMPORT_FUNC(vkDestroyDescriptorSetLayout)
 			IMPORT_FUNC(vkAllocateDescriptorSets)
 			IMPORT_FUNC(vkFreeDescriptorSets)
+			IMPORT_FUNC(vkResetDescriptorPool)
 			IMPORT_FUNC(vkUpdateDescriptorSets)
 			IMPORT_FUNC(vkCreateQueryPool)
 			IMPORT_FUNC(vkDestroyQueryPool)
@@ -2864,16 +2926,62 @@ namespace VulkanRhi
 
 
 	//[-------------------------------------------------------]
-	//[ VulkanRhi/VulkanContext.h                             ]
+	//[ VulkanRhi/VulkanMemoryAllocator.h                     ]
 	//[-------------------------------------------------------]
 	/**
 	*  @brief
-	*    Vulkan context class
+	*    Sub-allocated Vulkan device memory, result of "VulkanRhi::VulkanMemoryAllocator::allocate()"
 	*/
-	class VulkanContext final
+	struct VulkanMemory final
+	{
+		VkDeviceMemory vkDeviceMemory = VK_NULL_HANDLE;	///< Vulkan device memory the sub-allocation lives in, shared with other sub-allocations unless it's a dedicated allocation
+		VkDeviceSize   offset		  = 0;				///< Offset in bytes inside the Vulkan device memory, respects the alignment requirement of the resource
+		VkDeviceSize   numberOfBytes  = 0;				///< Number of bytes of the sub-allocation
+		uint8_t*	   mappedData	  = nullptr;		///< Persistently mapped data already including the offset, null pointer if the memory isn't host visible
+		uint32_t	   blockIndex	  = ~0u;			///< Index of the memory block inside the memory allocator, ~0u for a dedicated allocation
+
+		[[nodiscard]] inline bool isDedicated() const
+		{
+			return (~0u == blockIndex);
+		}
+	};
+
+	/**
+	*  @brief
+	*    Vulkan device memory allocator which sub-allocates resources from large memory blocks
+	*
+	*  @remarks
+	*    Vulkan implementations only guarantee 4096 simultaneous "vkAllocateMemory()"-allocations ("VkPhysicalDeviceLimits::maxMemoryAllocationCount")
+	*    and each allocation is expensive, so resources are placed inside a few large memory blocks instead. Memory blocks are keyed by memory type,
+	*    usage and resource type:
+	*    - Persistent resources (vertex buffers, textures etc.) are placed by using best-fit over the free ranges of a memory block, free ranges are coalesced on free
+	*    - Transient resources (e.g. staging buffers) are placed linearly, the memory block is reset as soon as all of its sub-allocations have been freed
+	*    Buffers and images never share a memory block, this way "VkPhysicalDeviceLimits::bufferImageGranularity" doesn't need to be taken into account.
+	*    Host visible memory blocks are persistently mapped. Resources larger than half a memory block get a dedicated allocation.
+	*
+	*  @note
+	*    - Thread-safe, resources might be created by multiple threads
+	*/
+	class VulkanMemoryAllocator final
 	{
 
 
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		enum class Usage : uint8_t
+		{
+			PERSISTENT,	///< Long living resource, best-fit sub-allocation
+			TRANSIENT	///< Short living resource, linear sub-allocation
+		};
+		enum class ResourceType : uint8_t
+		{
+			BUFFER,
+			IMAGE
+		};
+
+
 	//[-------------------------------------------------------]
 	//[ Public methods                                        ]
 	//[-------------------------------------------------------]
@@ -2884,267 +2992,1512 @@ namespace VulkanRhi
 		*
 		*  @param[in] vulkanRhi
 		*    Owner Vulkan RHI instance
+		*  @param[in] vkPhysicalDevice
+		*    Vulkan physical device to allocate memory from
+		*  @param[in] vkDevice
+		*    Vulkan device to allocate memory from
 		*/
-		explicit VulkanContext(VulkanRhi& vulkanRhi) :
+		VulkanMemoryAllocator(VulkanRhi& vulkanRhi, VkPhysicalDevice vkPhysicalDevice, VkDevice vkDevice) :
 			mVulkanRhi(vulkanRhi),
-			mVkPhysicalDevice(VK_NULL_HANDLE),
-			mVkDevice(VK_NULL_HANDLE),
-			mGraphicsQueueFamilyIndex(~0u),
-			mPresentQueueFamilyIndex(~0u),
-			mGraphicsVkQueue(VK_NULL_HANDLE),
-			mPresentVkQueue(VK_NULL_HANDLE),
-			mVkCommandPool(VK_NULL_HANDLE),
-			mVkCommandBuffer(VK_NULL_HANDLE)
+			mVkDevice(vkDevice),
+			mVkPhysicalDeviceMemoryProperties{},
+			mMaximumNumberOfDeviceMemoryAllocations(0),
+			mNumberOfDeviceMemoryAllocations(0)
 		{
-			const VulkanRuntimeLinking& vulkanRuntimeLinking = mVulkanRhi.getVulkanRuntimeLinking();
-
-			// Get the physical Vulkan device this context should use
-			bool enableDebugMarker = true;	// TODO(co) Make it possible to setup from the outside whether or not the "VK_EXT_debug_marker"-extension should be used (e.g. retail shipped games might not want to have this enabled)
-			bool hasMeshShaderSupport = false;
-			{
-				detail::VkPhysicalDevices vkPhysicalDevices;
-				::detail::enumeratePhysicalDevices(vulkanRhi.getContext(), vulkanRuntimeLinking.getVkInstance(), vkPhysicalDevices);
-				if (!vkPhysicalDevices.empty())
-				{
-					mVkPhysicalDevice = ::detail::selectPhysicalDevice(vulkanRhi.getContext(), vkPhysicalDevices, vulkanRhi.getVulkanRuntimeLinking().isValidationEnabled(), enableDebugMarker, hasMeshShaderSupport);
-				}
-			}
-
-			// Create the logical Vulkan device instance
-			if (VK_NULL_HANDLE != mVkPhysicalDevice)
-			{
-				mVkDevice = ::detail::createVkDevice(mVulkanRhi.getContext(), mVulkanRhi.getVkAllocationCallbacks(), mVkPhysicalDevice, vulkanRuntimeLinking.isValidationEnabled(), enableDebugMarker, hasMeshShaderSupport, mGraphicsQueueFamilyIndex, mPresentQueueFamilyIndex);
-				if (VK_NULL_HANDLE != mVkDevice)
-				{
-					// Load device based instance level Vulkan function pointers
-					if (mVulkanRhi.getVulkanRuntimeLinking().loadDeviceLevelVulkanEntryPoints(mVkDevice, hasMeshShaderSupport))
-					{
-						// Get the Vulkan device graphics queue that command buffers are submitted to
-						vkGetDeviceQueue(mVkDevice, mGraphicsQueueFamilyIndex, 0, &mGraphicsVkQueue);
-						if (VK_NULL_HANDLE != mGraphicsVkQueue)
-						{
-							// Get the Vulkan device present queue
-							vkGetDeviceQueue(mVkDevice, mPresentQueueFamilyIndex, 0, &mPresentVkQueue);
-							if (VK_NULL_HANDLE != mPresentVkQueue)
-							{
-								// Create Vulkan command pool instance
-								mVkCommandPool = ::detail::createVkCommandPool(mVulkanRhi.getContext(), mVulkanRhi.getVkAllocationCallbacks(), mVkDevice, mGraphicsQueueFamilyIndex);
-								if (VK_NULL_HANDLE != mVkCommandPool)
-								{
-									// Create Vulkan command buffer instance
-									mVkCommandBuffer = ::detail::createVkCommandBuffer(mVulkanRhi.getContext(), mVkDevice, mVkCommandPool);
-								}
-								else
-								{
-									// Error!
-									RHI_LOG(vulkanRhi.getContext(), CRITICAL, "Failed to create Vulkan command pool instance")
-								}
-							}
-						}
-						else
-						{
-							// Error!
-							RHI_LOG(vulkanRhi.getContext(), CRITICAL, "Failed to get the Vulkan device graphics queue that command buffers are submitted to")
-						}
-					}
-				}
-			}
+			vkGetPhysicalDeviceMemoryProperties(vkPhysicalDevice, &mVkPhysicalDeviceMemoryProperties);
+			VkPhysicalDeviceProperties vkPhysicalDeviceProperties;
+			vkGetPhysicalDeviceProperties(vkPhysicalDevice, &vkPhysicalDeviceProperties);
+			mMaximumNumberOfDeviceMemoryAllocations = vkPhysicalDeviceProperties.limits.maxMemoryAllocationCount;
 		}
 
 		/**
 		*  @brief
 		*    Destructor
 		*/
-		~VulkanContext()
+		~VulkanMemoryAllocator()
 		{
-			if (VK_NULL_HANDLE != mVkDevice)
+			for (MemoryBlock& memoryBlock : mMemoryBlocks)
 			{
-				if (VK_NULL_HANDLE != mVkCommandPool)
+				if (VK_NULL_HANDLE != memoryBlock.vkDeviceMemory)
 				{
-					if (VK_NULL_HANDLE != mVkCommandBuffer)
-					{
-						vkFreeCommandBuffers(mVkDevice, mVkCommandPool, 1, &mVkCommandBuffer);
-					}
-					vkDestroyCommandPool(mVkDevice, mVkCommandPool, mVulkanRhi.getVkAllocationCallbacks());
+					RHI_ASSERT(mVulkanRhi.getContext(), 0 == memoryBlock.numberOfSubAllocations, "Vulkan memory block is destroyed while there are still sub-allocations inside it")
+					freeMemoryBlock(memoryBlock);
 				}
-				vkDeviceWaitIdle(mVkDevice);
-				vkDestroyDevice(mVkDevice, mVulkanRhi.getVkAllocationCallbacks());
 			}
 		}
 
 		/**
 		*  @brief
-		*    Return whether or not the content is initialized
+		*    Return the index of a Vulkan memory type matching the given requirements
 		*
-		*  @return
-		*    "true" if the context is initialized, else "false"
-		*/
-		[[nodiscard]] inline bool isInitialized() const
-		{
-			return (VK_NULL_HANDLE != mVkCommandBuffer);
-		}
-
-		/**
-		*  @brief
-		*    Return the owner Vulkan RHI instance
+		*  @param[in] memoryTypeBits
+		*    Memory type bits as returned inside "VkMemoryRequirements::memoryTypeBits"
+		*  @param[in] vkMemoryPropertyFlags
+		*    Required Vulkan memory property flags
 		*
 		*  @return
-		*    Owner Vulkan RHI instance
+		*    The memory type index, ~0u on error
 		*/
-		[[nodiscard]] inline VulkanRhi& getVulkanRhi() const
+		[[nodiscard]] uint32_t findMemoryTypeIndex(uint32_t memoryTypeBits, VkMemoryPropertyFlags vkMemoryPropertyFlags) const
 		{
-			return mVulkanRhi;
-		}
+			for (uint32_t i = 0; i < mVkPhysicalDeviceMemoryProperties.memoryTypeCount; ++i)
+			{
+				if ((memoryTypeBits & (1u << i)) && (mVkPhysicalDeviceMemoryProperties.memoryTypes[i].propertyFlags & vkMemoryPropertyFlags) == vkMemoryPropertyFlags)
+				{
+					return i;
+				}
+			}
 
-		/**
-		*  @brief
-		*    Return the Vulkan physical device this context is using
-		*
-		*  @return
-		*    The Vulkan physical device this context is using
-		*/
-		[[nodiscard]] inline VkPhysicalDevice getVkPhysicalDevice() const
-		{
-			return mVkPhysicalDevice;
+			// Error!
+			RHI_LOG(mVulkanRhi.getContext(), CRITICAL, "Failed to find suitable Vulkan memory type")
+			return ~0u;
 		}
 
 		/**
 		*  @brief
-		*    Return the Vulkan device this context is using
+		*    Allocate Vulkan device memory for a resource
+		*
+		*  @param[in] vkMemoryRequirements
+		*    Vulkan memory requirements of the resource
+		*  @param[in] vkMemoryPropertyFlags
+		*    Required Vulkan memory property flags
+		*  @param[in] usage
+		*    Resource usage, decides about the sub-allocation strategy
+		*  @param[in] resourceType
+		*    Resource type
+		*  @param[out] vulkanMemory
+		*    Receives the allocated memory, the resource has to be bound to "VulkanMemory::vkDeviceMemory" at "VulkanMemory::offset"
 		*
 		*  @return
-		*    The Vulkan device this context is using
+		*    "true" if all went fine, else "false"
 		*/
-		[[nodiscard]] inline VkDevice getVkDevice() const
+		[[nodiscard]] bool allocate(const VkMemoryRequirements& vkMemoryRequirements, VkMemoryPropertyFlags vkMemoryPropertyFlags, Usage usage, ResourceType resourceType, VulkanMemory& vulkanMemory)
 		{
-			return mVkDevice;
+			const uint32_t memoryTypeIndex = findMemoryTypeIndex(vkMemoryRequirements.memoryTypeBits, vkMemoryPropertyFlags);
+			if (~0u == memoryTypeIndex)
+			{
+				return false;
+			}
+			const VkDeviceSize alignment = std::max<VkDeviceSize>(vkMemoryRequirements.alignment, 1);
+			const VkDeviceSize memoryBlockSize = getMemoryBlockSize(memoryTypeIndex);
+			std::lock_guard<std::mutex> mutexLock(mMutex);
+
+			// Large resources get a dedicated allocation
+			if (vkMemoryRequirements.size > memoryBlockSize / 2)
+			{
+				uint8_t* mappedData = nullptr;
+				vulkanMemory.vkDeviceMemory = allocateVkDeviceMemory(memoryTypeIndex, vkMemoryRequirements.size, mappedData);
+				if (VK_NULL_HANDLE == vulkanMemory.vkDeviceMemory)
+				{
+					return false;
+				}
+				vulkanMemory.offset		   = 0;
+				vulkanMemory.numberOfBytes = vkMemoryRequirements.size;
+				vulkanMemory.mappedData	   = mappedData;
+				vulkanMemory.blockIndex	   = ~0u;
+				#ifdef RHI_STATISTICS
+					mVulkanRhi.getStatistics().currentNumberOfUsedDeviceMemoryBytes += vkMemoryRequirements.size;
+				#endif
+				return true;
+			}
+
+			// Try to sub-allocate inside one of the existing memory blocks
+			const uint32_t numberOfMemoryBlocks = static_cast<uint32_t>(mMemoryBlocks.size());
+			uint32_t freeMemoryBlockIndex = ~0u;
+			for (uint32_t blockIndex = 0; blockIndex < numberOfMemoryBlocks; ++blockIndex)
+			{
+				MemoryBlock& memoryBlock = mMemoryBlocks[blockIndex];
+				if (VK_NULL_HANDLE == memoryBlock.vkDeviceMemory)
+				{
+					if (~0u == freeMemoryBlockIndex)
+					{
+						freeMemoryBlockIndex = blockIndex;
+					}
+				}
+				else if (memoryBlock.memoryTypeIndex == memoryTypeIndex && memoryBlock.usage == usage && memoryBlock.resourceType == resourceType && subAllocate(memoryBlock, vkMemoryRequirements.size, alignment, vulkanMemory))
+				{
+					vulkanMemory.blockIndex = blockIndex;
+					return true;
+				}
+			}
+
+			// Create a new memory block, reuse a released memory block slot if possible so block indices remain stable
+			uint8_t* mappedData = nullptr;
+			const VkDeviceMemory vkDeviceMemory = allocateVkDeviceMemory(memoryTypeIndex, memoryBlockSize, mappedData);
+			if (VK_NULL_HANDLE == vkDeviceMemory)
+			{
+				return false;
+			}
+			if (~0u == freeMemoryBlockIndex)
+			{
+				freeMemoryBlockIndex = numberOfMemoryBlocks;
+				mMemoryBlocks.emplace_back();
+			}
+			MemoryBlock& memoryBlock = mMemoryBlocks[freeMemoryBlockIndex];
+			memoryBlock.vkDeviceMemory		   = vkDeviceMemory;
+			memoryBlock.numberOfBytes		   = memoryBlockSize;
+			memoryBlock.mappedData			   = mappedData;
+			memoryBlock.memoryTypeIndex		   = memoryTypeIndex;
+			memoryBlock.usage				   = usage;
+			memoryBlock.resourceType		   = resourceType;
+			memoryBlock.numberOfSubAllocations = 0;
+			memoryBlock.linearOffset		   = 0;
+			memoryBlock.freeRangesByOffset.clear();
+			memoryBlock.freeRangesBySize.clear();
+			if (Usage::PERSISTENT == usage)
+			{
+				insertFreeRange(memoryBlock, 0, memoryBlockSize);
+			}
+			[[maybe_unused]] const bool result = subAllocate(memoryBlock, vkMemoryRequirements.size, alignment, vulkanMemory);
+			RHI_ASSERT(mVulkanRhi.getContext(), result, "Failed to sub-allocate inside a new Vulkan memory block")
+			vulkanMemory.blockIndex = freeMemoryBlockIndex;
+			return true;
 		}
 
 		/**
 		*  @brief
-		*    Return the used graphics queue family index
+		*    Free Vulkan device memory previously allocated by "VulkanRhi::VulkanMemoryAllocator::allocate()"
 		*
-		*  @return
-		*    Graphics queue family index, ~0u if invalid
+		*  @param[in, out] vulkanMemory
+		*    Memory to free, reset on return, the resource using it must have been destroyed already
 		*/
-		[[nodiscard]] inline uint32_t getGraphicsQueueFamilyIndex() const
+		void free(VulkanMemory& vulkanMemory)
 		{
-			return mGraphicsQueueFamilyIndex;
+			if (VK_NULL_HANDLE == vulkanMemory.vkDeviceMemory)
+			{
+				return;
+			}
+			std::lock_guard<std::mutex> mutexLock(mMutex);
+			#ifdef RHI_STATISTICS
+				mVulkanRhi.getStatistics().currentNumberOfUsedDeviceMemoryBytes -= vulkanMemory.numberOfBytes;
+			#endif
+			if (vulkanMemory.isDedicated())
+			{
+				freeVkDeviceMemory(vulkanMemory.vkDeviceMemory, vulkanMemory.numberOfBytes);
+			}
+			else
+			{
+				RHI_ASSERT(mVulkanRhi.getContext(), vulkanMemory.blockIndex < mMemoryBlocks.size() && mMemoryBlocks[vulkanMemory.blockIndex].vkDeviceMemory == vulkanMemory.vkDeviceMemory, "Invalid Vulkan memory block")
+				MemoryBlock& memoryBlock = mMemoryBlocks[vulkanMemory.blockIndex];
+				RHI_ASSERT(mVulkanRhi.getContext(), memoryBlock.numberOfSubAllocations > 0, "Invalid number of Vulkan memory block sub-allocations")
+				--memoryBlock.numberOfSubAllocations;
+				#ifdef RHI_STATISTICS
+					--mVulkanRhi.getStatistics().currentNumberOfDeviceMemorySubAllocations;
+				#endif
+				if (Usage::PERSISTENT == memoryBlock.usage)
+				{
+					insertFreeRange(memoryBlock, vulkanMemory.offset, vulkanMemory.numberOfBytes);
+				}
+				else if (0 == memoryBlock.numberOfSubAllocations)
+				{
+					// Linear memory blocks are reset as a whole as soon as the last sub-allocation is gone
+					memoryBlock.linearOffset = 0;
+				}
+
+				// Give empty memory blocks back to the driver, but keep one around per key to avoid allocation ping-pong
+				if (0 == memoryBlock.numberOfSubAllocations && hasOtherEmptyMemoryBlock(memoryBlock))
+				{
+					freeMemoryBlock(memoryBlock);
+				}
+			}
+			vulkanMemory = VulkanMemory();
 		}
 
-		/**
-		*  @brief
-		*    Return the used present queue family index
-		*
-		*  @return
-		*    Present queue family index, ~0u if invalid
-		*/
-		[[nodiscard]] inline uint32_t getPresentQueueFamilyIndex() const
+
+	//[-------------------------------------------------------]
+	//[ Protected methods                                     ]
+	//[-------------------------------------------------------]
+	protected:
+		explicit VulkanMemoryAllocator(const VulkanMemoryAllocator& source) = delete;
+		VulkanMemoryAllocator& operator =(const VulkanMemoryAllocator& source) = delete;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		static constexpr VkDeviceSize DEVICE_LOCAL_MEMORY_BLOCK_SIZE = 64 * 1024 * 1024;	///< Default memory block size of device local memory, 64 MiB
+		static constexpr VkDeviceSize HOST_VISIBLE_MEMORY_BLOCK_SIZE = 16 * 1024 * 1024;	///< Default memory block size of host visible memory, 16 MiB
+
+		typedef std::map<VkDeviceSize, VkDeviceSize> FreeRangesByOffset;		///< Key = free range offset, value = free range number of bytes
+		typedef std::multimap<VkDeviceSize, VkDeviceSize> FreeRangesBySize;	///< Key = free range number of bytes, value = free range offset
+
+		struct MemoryBlock final
+		{
+			VkDeviceMemory	   vkDeviceMemory = VK_NULL_HANDLE;	///< Vulkan device memory, null handle if the memory block slot is unused
+			VkDeviceSize	   numberOfBytes = 0;
+			uint8_t*		   mappedData = nullptr;			///< Persistently mapped data, null pointer if the memory isn't host visible
+			uint32_t		   memoryTypeIndex = ~0u;
+			Usage			   usage = Usage::PERSISTENT;
+			ResourceType	   resourceType = ResourceType::BUFFER;
+			uint32_t		   numberOfSubAllocations = 0;
+			VkDeviceSize	   linearOffset = 0;				///< Next free byte, only used by transient memory blocks
+			FreeRangesByOffset freeRangesByOffset;				///< Only used by persistent memory blocks
+			FreeRangesBySize   freeRangesBySize;				///< Only used by persistent memory blocks, for best-fit lookup
+		};
+		typedef std::vector<MemoryBlock> MemoryBlocks;
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		[[nodiscard]] static inline VkDeviceSize alignUp(VkDeviceSize value, VkDeviceSize alignment)
 		{
-			return mPresentQueueFamilyIndex;
+			// Vulkan alignments are always a power of two
+			return (value + alignment - 1) & ~(alignment - 1);
 		}
 
-		/**
-		*  @brief
-		*    Return the handle to the Vulkan device graphics queue that command buffers are submitted to
-		*
-		*  @return
-		*    Handle to the Vulkan device graphics queue that command buffers are submitted to
-		*/
-		[[nodiscard]] inline VkQueue getGraphicsVkQueue() const
+		[[nodiscard]] VkDeviceSize getMemoryBlockSize(uint32_t memoryTypeIndex) const
 		{
-			return mGraphicsVkQueue;
+			const VkMemoryType& vkMemoryType = mVkPhysicalDeviceMemoryProperties.memoryTypes[memoryTypeIndex];
+			const VkDeviceSize heapSize = mVkPhysicalDeviceMemoryProperties.memoryHeaps[vkMemoryType.heapIndex].size;
+			VkDeviceSize memoryBlockSize = (vkMemoryType.propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) ? HOST_VISIBLE_MEMORY_BLOCK_SIZE : DEVICE_LOCAL_MEMORY_BLOCK_SIZE;
+
+			// Small heaps (e.g. the 256 MiB device local and host visible heap of some GPUs) are not allowed to be eaten up by just a few memory blocks
+			while (memoryBlockSize > 1024 * 1024 && memoryBlockSize > heapSize / 8)
+			{
+				memoryBlockSize /= 2;
+			}
+			return memoryBlockSize;
 		}
 
-		/**
-		*  @brief
-		*    Return the handle to the Vulkan device present queue
-		*
-		*  @return
-		*    Handle to the Vulkan device present queue
-		*/
+		[[nodiscard]] VkDeviceMemory allocateVkDeviceMemory(uint32_t memoryTypeIndex, VkDeviceSize numberOfBytes, uint8_t*& mappedData)
+		{
+			if (mNumberOfDeviceMemoryAllocations >= mMaximumNumberOfDeviceMemoryAllocations)
+			{
+				RHI_LOG(mVulkanRhi.getContext(), CRITICAL, "The maximum number of %u Vulkan device memory allocations has been reached", mMaximumNumberOfDeviceMemoryAllocations)
+				return VK_NULL_HANDLE;
+			}
+			const VkMemoryAllocateInfo vkMemoryAllocateInfo =
+			{
+				VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,	// sType (VkStructureType)
+				nullptr,								// pNext (const void*)
+				numberOfBytes,							// allocationSize (VkDeviceSize)
+				memoryTypeIndex							// memoryTypeIndex (uint32_t)
+			};
+			VkDeviceMemory vkDeviceMemory = VK_NULL_HANDLE;
+			if (vkAllocateMemory(mVkDevice, &vkMemoryAllocateInfo, mVulkanRhi.getVkAllocationCallbacks(), &vkDeviceMemory) != VK_SUCCESS)
+			{
+				RHI_LOG(mVulkanRhi.getContext(), CRITICAL, "Failed to allocate the Vulkan memory")
+				return VK_NULL_HANDLE;
+			}
+
+			// Host visible memory is persistently mapped
+			mappedData = nullptr;
+			if (mVkPhysicalDeviceMemoryProperties.memoryTypes[memoryTypeIndex].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
+			{
+				void* data = nullptr;
+				if (vkMapMemory(mVkDevice, vkDeviceMemory, 0, VK_WHOLE_SIZE, 0, &data) == VK_SUCCESS)
+				{
+					mappedData = static_cast<uint8_t*>(data);
+				}
+				else
+				{
+					RHI_LOG(mVulkanRhi.getContext(), CRITICAL, "Failed to map the Vulkan memory")
+				}
+			}
+
+			// Update the statistics
+			++mNumberOfDeviceMemoryAllocations;
+			#ifdef RHI_STATISTICS
+				Rhi::Statistics& statistics = mVulkanRhi.getStatistics();
+				++statistics.currentNumberOfDeviceMemoryAllocations;
+				++statistics.numberOfCreatedDeviceMemoryAllocations;
+				statistics.currentNumberOfDeviceMemoryBytes += numberOfBytes;
+			#endif
+
+			// Done
+			return vkDeviceMemory;
+		}
+
+		void freeVkDeviceMemory(VkDeviceMemory vkDeviceMemory, [[maybe_unused]] VkDeviceSize numberOfBytes)
+		{
+			// Freeing implicitly unmaps the memory
+			vkFreeMemory(mVkDevice, vkDeviceMemory, mVulkanRhi.getVkAllocationCallbacks());
+			--mNumberOfDeviceMemoryAllocations;
+			#ifdef RHI_STATISTICS
+				Rhi::Statistics& statistics = mVulkanRhi.getStatistics();
+				--statistics.currentNumberOfDeviceMemoryAllocations;
+				statistics.currentNumberOfDeviceMemoryBytes -= numberOfBytes;
+			#endif
+		}
+
+		void freeMemoryBlock(MemoryBlock& memoryBlock)
+		{
+			freeVkDeviceMemory(memoryBlock.vkDeviceMemory, memoryBlock.numberOfBytes);
+			memoryBlock = MemoryBlock();
+		}
+
+		[[nodiscard]] bool hasOtherEmptyMemoryBlock(const MemoryBlock& emptyMemoryBlock) const
+		{
+			for (const MemoryBlock& memoryBlock : mMemoryBlocks)
+			{
+				if (&memoryBlock != &emptyMemoryBlock && VK_NULL_HANDLE != memoryBlock.vkDeviceMemory && 0 == memoryBlock.numberOfSubAllocations &&
+					memoryBlock.memoryTypeIndex == emptyMemoryBlock.memoryTypeIndex && memoryBlock.usage == emptyMemoryBlock.usage && memoryBlock.resourceType == emptyMemoryBlock.resourceType)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		[[nodiscard]] bool subAllocate(MemoryBlock& memoryBlock, VkDeviceSize numberOfBytes, VkDeviceSize alignment, VulkanMemory& vulkanMemory)
+		{
+			VkDeviceSize offset = 0;
+			if (Usage::TRANSIENT == memoryBlock.usage)
+			{
+				// Linear
+				offset = alignUp(memoryBlock.linearOffset, alignment);
+				if (offset + numberOfBytes > memoryBlock.numberOfBytes)
+				{
+					return false;
+				}
+				memoryBlock.linearOffset = offset + numberOfBytes;
+			}
+			else
+			{
+				// Best-fit: Smallest free range the aligned sub-allocation fits into
+				FreeRangesBySize::iterator iterator = memoryBlock.freeRangesBySize.lower_bound(numberOfBytes);
+				const FreeRangesBySize::iterator iteratorEnd = memoryBlock.freeRangesBySize.end();
+				while (iterator != iteratorEnd && alignUp(iterator->second, alignment) + numberOfBytes > iterator->second + iterator->first)
+				{
+					++iterator;
+				}
+				if (iterator == iteratorEnd)
+				{
+					return false;
+				}
+				const VkDeviceSize freeRangeOffset = iterator->second;
+				const VkDeviceSize freeRangeNumberOfBytes = iterator->first;
+				memoryBlock.freeRangesBySize.erase(iterator);
+				memoryBlock.freeRangesByOffset.erase(freeRangeOffset);
+				offset = alignUp(freeRangeOffset, alignment);
+
+				// Give the alignment padding and the remainder back
+				if (offset > freeRangeOffset)
+				{
+					addFreeRange(memoryBlock, freeRangeOffset, offset - freeRangeOffset);
+				}
+				const VkDeviceSize freeRangeEnd = freeRangeOffset + freeRangeNumberOfBytes;
+				if (offset + numberOfBytes < freeRangeEnd)
+				{
+					addFreeRange(memoryBlock, offset + numberOfBytes, freeRangeEnd - (offset + numberOfBytes));
+				}
+			}
+			++memoryBlock.numberOfSubAllocations;
+			#ifdef RHI_STATISTICS
+				++mVulkanRhi.getStatistics().currentNumberOfDeviceMemorySubAllocations;
+				mVulkanRhi.getStatistics().currentNumberOfUsedDeviceMemoryBytes += numberOfBytes;
+			#endif
+
+			// Done
+			vulkanMemory.vkDeviceMemory = memoryBlock.vkDeviceMemory;
+			vulkanMemory.offset			= offset;
+			vulkanMemory.numberOfBytes	= numberOfBytes;
+			vulkanMemory.mappedData		= (nullptr != memoryBlock.mappedData) ? (memoryBlock.mappedData + offset) : nullptr;
+			return true;
+		}
+
+		void addFreeRange(MemoryBlock& memoryBlock, VkDeviceSize offset, VkDeviceSize numberOfBytes)
+		{
+			memoryBlock.freeRangesByOffset.emplace(offset, numberOfBytes);
+			memoryBlock.freeRangesBySize.emplace(numberOfBytes, offset);
+		}
+
+		void removeFreeRange(MemoryBlock& memoryBlock, FreeRangesByOffset::iterator iterator)
+		{
+			std::pair<FreeRangesBySize::iterator, FreeRangesBySize::iterator> range = memoryBlock.freeRangesBySize.equal_range(iterator->second);
+			for (; range.first != range.second; ++range.first)
+			{
+				if (range.first->second == iterator->first)
+				{
+					memoryBlock.freeRangesBySize.erase(range.first);
+					break;
+				}
+			}
+			memoryBlock.freeRangesByOffset.erase(iterator);
+		}
+
+		void insertFreeRange(MemoryBlock& memoryBlock, VkDeviceSize offset, VkDeviceSize numberOfBytes)
+		{
+			// Coalesce with the following free range
+			FreeRangesByOffset::iterator nextIterator = memoryBlock.freeRangesByOffset.lower_bound(offset);
+			if (nextIterator != memoryBlock.freeRangesByOffset.end() && nextIterator->first == offset + numberOfBytes)
+			{
+				numberOfBytes += nextIterator->second;
+				removeFreeRange(memoryBlock, nextIterator);
+				nextIterator = memoryBlock.freeRangesByOffset.lower_bound(offset);
+			}
+
+			// Coalesce with the preceding free range
+			if (nextIterator != memoryBlock.freeRangesByOffset.begin())
+			{
+				FreeRangesByOffset::iterator previousIterator = std::prev(nextIterator);
+				if (previousIterator->first + previousIterator->second == offset)
+				{
+					offset = previousIterator->first;
+					numberOfBytes += previousIterator->second;
+					removeFreeRange(memoryBlock, previousIterator);
+				}
+			}
+			addFreeRange(memoryBlock, offset, numberOfBytes);
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		VulkanRhi&						 mVulkanRhi;								///< Owner Vulkan RHI instance
+		VkDevice						 mVkDevice;									///< Vulkan device to allocate memory from
+		VkPhysicalDeviceMemoryProperties mVkPhysicalDeviceMemoryProperties;
+		uint32_t						 mMaximumNumberOfDeviceMemoryAllocations;	///< "VkPhysicalDeviceLimits::maxMemoryAllocationCount"
+		uint32_t						 mNumberOfDeviceMemoryAllocations;			///< Current number of "vkAllocateMemory()"-allocations, memory blocks and dedicated allocations
+		std::mutex						 mMutex;
+		MemoryBlocks					 mMemoryBlocks;								///< Released memory block slots are reused, so memory block indices are stable
+
+
+	};
+
+
+
+
+	//[-------------------------------------------------------]
+	//[ VulkanRhi/VulkanContext.h                             ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Vulkan context class
+	*/
+	class VulkanContext final
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] vulkanRhi
+		*    Owner Vulkan RHI instance
+		*/
+		explicit VulkanContext(VulkanRhi& vulkanRhi) :
+			mVulkanRhi(vulkanRhi),
+			mVkPhysicalDevice(VK_NULL_HANDLE),
+			mVkDevice(VK_NULL_HANDLE),
+			mGraphicsQueueFamilyIndex(~0u),
+			mPresentQueueFamilyIndex(~0u),
+			mGraphicsVkQueue(VK_NULL_HANDLE),
+			mPresentVkQueue(VK_NULL_HANDLE),
+			mVkCommandPool(VK_NULL_HANDLE),
+			mVkCommandBuffer(VK_NULL_HANDLE),
+			mVulkanMemoryAllocator(nullptr)
+		{
+			const VulkanRuntimeLinking& vulkanRuntimeLinking = mVulkanRhi.getVulkanRuntimeLinking();
+
+			// Get the physical Vulkan device this context should use
+			bool enableDebugMarker = true;	// TODO(co) Make it possible to setup from the outside whether or not the "VK_EXT_debug_marker"-extension should be used (e.g. retail shipped games might not want to have this enabled)
+			bool hasMeshShaderSupport = false;
+			{
+				detail::VkPhysicalDevices vkPhysicalDevices;
+				::detail::enumeratePhysicalDevices(vulkanRhi.getContext(), vulkanRuntimeLinking.getVkInstance(), vkPhysicalDevices);
+				if (!vkPhysicalDevices.empty())
+				{
+					mVkPhysicalDevice = ::detail::selectPhysicalDevice(vulkanRhi.getContext(), vkPhysicalDevices, vulkanRhi.getVulkanRuntimeLinking().isValidationEnabled(), enableDebugMarker, hasMeshShaderSupport);
+				}
+			}
+
+			// Create the logical Vulkan device instance
+			if (VK_NULL_HANDLE != mVkPhysicalDevice)
+			{
+				mVkDevice = ::detail::createVkDevice(mVulkanRhi.getContext(), mVulkanRhi.getVkAllocationCallbacks(), mVkPhysicalDevice, vulkanRuntimeLinking.isValidationEnabled(), enableDebugMarker, hasMeshShaderSupport, mGraphicsQueueFamilyIndex, mPresentQueueFamilyIndex);
+				if (VK_NULL_HANDLE != mVkDevice)
+				{
+					// Load device based instance level Vulkan function pointers
+					if (mVulkanRhi.getVulkanRuntimeLinking().loadDeviceLevelVulkanEntryPoints(mVkDevice, hasMeshShaderSupport))
+					{
+						// Create the Vulkan memory allocator instance
+						mVulkanMemoryAllocator = RHI_NEW(mVulkanRhi.getContext(), VulkanMemoryAllocator)(mVulkanRhi, mVkPhysicalDevice, mVkDevice);
+
+						// Get the Vulkan device graphics queue that command buffers are submitted to
+						vkGetDeviceQueue(mVkDevice, mGraphicsQueueFamilyIndex, 0, &mGraphicsVkQueue);
+						if (VK_NULL_HANDLE != mGraphicsVkQueue)
+						{
+							// Get the Vulkan device present queue
+							vkGetDeviceQueue(mVkDevice, mPresentQueueFamilyIndex, 0, &mPresentVkQueue);
+							if (VK_NULL_HANDLE != mPresentVkQueue)
+							{
+								// Create Vulkan command pool instance
+								mVkCommandPool = ::detail::createVkCommandPool(mVulkanRhi.getContext(), mVulkanRhi.getVkAllocationCallbacks(), mVkDevice, mGraphicsQueueFamilyIndex);
+								if (VK_NULL_HANDLE != mVkCommandPool)
+								{
+									// Create Vulkan command buffer instance
+									mVkCommandBuffer = ::detail::createVkCommandBuffer(mVulkanRhi.getContext(), mVkDevice, mVkCommandPool);
+								}
+								else
+								{
+									// Error!
+									RHI_LOG(vulkanRhi.getContext(), CRITICAL, "Failed to create Vulkan command pool instance")
+								}
+							}
+						}
+						else
+						{
+							// Error!
+							RHI_LOG(vulkanRhi.getContext(), CRITICAL, "Failed to get the Vulkan device graphics queue that command buffers are submitted to")
+						}
+					}
+				}
+			}
+		}
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		~VulkanContext()
+		{
+			if (VK_NULL_HANDLE != mVkDevice)
+			{
+				if (VK_NULL_HANDLE != mVkCommandPool)
+				{
+					if (VK_NULL_HANDLE != mVkCommandBuffer)
+					{
+						vkFreeCommandBuffers(mVkDevice, mVkCommandPool, 1, &mVkCommandBuffer);
+					}
+					vkDestroyCommandPool(mVkDevice, mVkCommandPool, mVulkanRhi.getVkAllocationCallbacks());
+				}
+				{
+					std::lock_guard<std::mutex> vkQueueMutexLock(mVkQueueMutex);
+					vkDeviceWaitIdle(mVkDevice);
+				}
+				if (nullptr != mVulkanMemoryAllocator)
+				{
+					RHI_DELETE(mVulkanRhi.getContext(), VulkanMemoryAllocator, mVulkanMemoryAllocator);
+				}
+				vkDestroyDevice(mVkDevice, mVulkanRhi.getVkAllocationCallbacks());
+			}
+		}
+
+		/**
+		*  @brief
+		*    Return whether or not the content is initialized
+		*
+		*  @return
+		*    "true" if the context is initialized, else "false"
+		*/
+		[[nodiscard]] inline bool isInitialized() const
+		{
+			return (VK_NULL_HANDLE != mVkCommandBuffer);
+		}
+
+		/**
+		*  @brief
+		*    Return the owner Vulkan RHI instance
+		*
+		*  @return
+		*    Owner Vulkan RHI instance
+		*/
+		[[nodiscard]] inline VulkanRhi& getVulkanRhi() const
+		{
+			return mVulkanRhi;
+		}
+
+		/**
+		*  @brief
+		*    Return the Vulkan physical device this context is using
+		*
+		*  @return
+		*    The Vulkan physical device this context is using
+		*/
+		[[nodiscard]] inline VkPhysicalDevice getVkPhysicalDevice() const
+		{
+			return mVkPhysicalDevice;
+		}
+
+		/**
+		*  @brief
+		*    Return the Vulkan device this context is using
+		*
+		*  @return
+		*    The Vulkan device this context is using
+		*/
+		[[nodiscard]] inline VkDevice getVkDevice() const
+		{
+			return mVkDevice;
+		}
+
+		/**
+		*  @brief
+		*    Return the used graphics queue family index
+		*
+		*  @return
+		*    Graphics queue family index, ~0u if invalid
+		*/
+		[[nodiscard]] inline uint32_t getGraphicsQueueFamilyIndex() const
+		{
+			return mGraphicsQueueFamilyIndex;
+		}
+
+		/**
+		*  @brief
+		*    Return the used present queue family index
+		*
+		*  @return
+		*    Present queue family index, ~0u if invalid
+		*/
+		[[nodiscard]] inline uint32_t getPresentQueueFamilyIndex() const
+		{
+			return mPresentQueueFamilyIndex;
+		}
+
+		/**
+		*  @brief
+		*    Return the handle to the Vulkan device graphics queue that command buffers are submitted to
+		*
+		*  @return
+		*    Handle to the Vulkan device graphics queue that command buffers are submitted to
+		*/
+		[[nodiscard]] inline VkQueue getGraphicsVkQueue() const
+		{
+			return mGraphicsVkQueue;
+		}
+
+		/**
+		*  @brief
+		*    Return the handle to the Vulkan device present queue
+		*
+		*  @return
+		*    Handle to the Vulkan device present queue
+		*/
 		[[nodiscard]] inline VkQueue getPresentVkQueue() const
 		{
-			return mPresentVkQueue;
+			return mPresentVkQueue;
+		}
+
+		/**
+		*  @brief
+		*    Return the mutex guarding the Vulkan device queues
+		*
+		*  @return
+		*    Mutex which must be locked while calling "vkQueueSubmit()", "vkQueueWaitIdle()", "vkQueuePresentKHR()" or "vkDeviceWaitIdle()"
+		*
+		*  @note
+		*    - Vulkan queues must be externally synchronized, the upload queue and the swap chain might submit from different threads
+		*    - The graphics and the present queue might be the same Vulkan queue, so one mutex is used for both
+		*/
+		[[nodiscard]] inline std::mutex& getVkQueueMutex() const
+		{
+			return mVkQueueMutex;
+		}
+
+		/**
+		*  @brief
+		*    Return the used Vulkan command buffer pool instance
+		*
+		*  @return
+		*    The used Vulkan command buffer pool instance
+		*/
+		[[nodiscard]] inline VkCommandPool getVkCommandPool() const
+		{
+			return mVkCommandPool;
+		}
+
+		/**
+		*  @brief
+		*    Return the Vulkan command buffer instance
+		*
+		*  @return
+		*    The Vulkan command buffer instance
+		*/
+		[[nodiscard]] inline VkCommandBuffer getVkCommandBuffer() const
+		{
+			return mVkCommandBuffer;
+		}
+
+		/**
+		*  @brief
+		*    Return the Vulkan memory allocator instance
+		*
+		*  @return
+		*    The Vulkan memory allocator instance, do only call this method if the context is initialized
+		*/
+		[[nodiscard]] inline VulkanMemoryAllocator& getVulkanMemoryAllocator() const
+		{
+			RHI_ASSERT(mVulkanRhi.getContext(), nullptr != mVulkanMemoryAllocator, "Invalid Vulkan memory allocator")
+			return *mVulkanMemoryAllocator;
+		}
+
+		[[nodiscard]] inline VkCommandBuffer createVkCommandBuffer() const
+		{
+			return ::detail::createVkCommandBuffer(mVulkanRhi.getContext(), mVkDevice, mVkCommandPool);
+		}
+
+		void destroyVkCommandBuffer(VkCommandBuffer vkCommandBuffer) const
+		{
+			if (VK_NULL_HANDLE != mVkCommandBuffer)
+			{
+				vkFreeCommandBuffers(mVkDevice, mVkCommandPool, 1, &vkCommandBuffer);
+			}
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Protected methods                                     ]
+	//[-------------------------------------------------------]
+	protected:
+		explicit VulkanContext(const VulkanContext& source) = delete;
+		VulkanContext& operator =(const VulkanContext& source) = delete;
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		VulkanRhi&		 mVulkanRhi;				///< Owner Vulkan RHI instance
+		VkPhysicalDevice mVkPhysicalDevice;			///< Vulkan physical device this context is using
+		VkDevice		 mVkDevice;					///< Vulkan device instance this context is using (equivalent of a OpenGL context or Direct3D 11 device)
+		uint32_t		 mGraphicsQueueFamilyIndex;	///< Graphics queue family index, ~0u if invalid
+		uint32_t		 mPresentQueueFamilyIndex;	///< Present queue family index, ~0u if invalid
+		VkQueue			 mGraphicsVkQueue;			///< Handle to the Vulkan device graphics queue that command buffers are submitted to
+		VkQueue			 mPresentVkQueue;			///< Handle to the Vulkan device present queue
+		mutable std::mutex mVkQueueMutex;			///< Guards the Vulkan device queues, see "Rhi::VulkanContext::getVkQueueMutex()"
+		VkCommandPool	 mVkCommandPool;			///< Vulkan command buffer pool instance
+		VkCommandBuffer  mVkCommandBuffer;			///< Vulkan command buffer instance
+		VulkanMemoryAllocator* mVulkanMemoryAllocator;	///< Vulkan memory allocator instance, can be a null pointer
+
+
+	};
+
+
+
+
+	//[-------------------------------------------------------]
+	//[ VulkanRhi/VulkanUploadQueue.h                         ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Vulkan upload queue which batches resource uploads into fenced command buffers
+	*
+	*  @remarks
+	*    Data is copied into a persistently mapped staging ring buffer and the upload commands of many resources are recorded into
+	*    one Vulkan command buffer. The command buffer is submitted to the graphics queue at the latest right before the next frame
+	*    command buffer, so queue submission order guarantees the uploads are visible to rendering. Submitted batches are retired
+	*    asynchronously by polling their fences, the CPU only waits if the staging ring buffer runs full. Uploads larger than the
+	*    ring buffer get a transient staging buffer which is destroyed as soon as its batch is retired.
+	*
+	*  @note
+	*    - Thread-safe, "beginUpload()" locks the upload queue until "endUpload()" is called
+	*/
+	class VulkanUploadQueue final
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public definitions                                    ]
+	//[-------------------------------------------------------]
+	public:
+		struct StagingMemory final
+		{
+			VkBuffer	 vkBuffer;		///< Vulkan staging buffer to copy from
+			VkDeviceSize offset;		///< Offset inside the Vulkan staging buffer
+			uint8_t*	 mappedData;	///< Persistently mapped staging data, already including the offset
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] vulkanRhi
+		*    Owner Vulkan RHI instance, the Vulkan context must be initialized
+		*/
+		explicit VulkanUploadQueue(VulkanRhi& vulkanRhi) :
+			mVulkanRhi(vulkanRhi),
+			mVkDevice(vulkanRhi.getVulkanContext().getVkDevice()),
+			mVkCommandPool(VK_NULL_HANDLE),
+			mRingVkBuffer(VK_NULL_HANDLE),
+			mRingHead(0),
+			mRingTail(0),
+			mRecordingBatchIndex(0),
+			mOldestBatchIndex(0),
+			mNumberOfSubmittedBatches(0)
+		{
+			const VulkanContext& vulkanContext = vulkanRhi.getVulkanContext();
+			const Rhi::Context& context = vulkanRhi.getContext();
+
+			// Create the Vulkan command pool, upload command buffers are recorded by whatever thread creates resources so the command pool of the Vulkan context can't be used
+			mVkCommandPool = ::detail::createVkCommandPool(context, vulkanRhi.getVkAllocationCallbacks(), mVkDevice, vulkanContext.getGraphicsQueueFamilyIndex());
+			if (VK_NULL_HANDLE != mVkCommandPool)
+			{
+				// Create the upload batches
+				static constexpr VkFenceCreateInfo vkFenceCreateInfo =
+				{
+					VK_STRUCTURE_TYPE_FENCE_CREATE_INFO,	// sType (VkStructureType)
+					nullptr,								// pNext (const void*)
+					0										// flags (VkFenceCreateFlags)
+				};
+				for (Batch& batch : mBatches)
+				{
+					batch.vkCommandBuffer = ::detail::createVkCommandBuffer(context, mVkDevice, mVkCommandPool);
+					if (vkCreateFence(mVkDevice, &vkFenceCreateInfo, vulkanRhi.getVkAllocationCallbacks(), &batch.vkFence) != VK_SUCCESS)
+					{
+						// Error!
+						RHI_LOG(context, CRITICAL, "Failed to create Vulkan fence instance")
+					}
+				}
+			}
+			else
+			{
+				// Error!
+				RHI_LOG(context, CRITICAL, "Failed to create Vulkan upload command pool instance")
+			}
+
+			// Create the staging ring buffer
+			createStagingVkBuffer(STAGING_RING_BUFFER_SIZE, VulkanMemoryAllocator::Usage::PERSISTENT, mRingVkBuffer, mRingVulkanMemory);
+		}
+
+		/**
+		*  @brief
+		*    Destructor
+		*/
+		~VulkanUploadQueue()
+		{
+			finish();
+			for (Batch& batch : mBatches)
+			{
+				if (VK_NULL_HANDLE != batch.vkFence)
+				{
+					vkDestroyFence(mVkDevice, batch.vkFence, mVulkanRhi.getVkAllocationCallbacks());
+				}
+				if (VK_NULL_HANDLE != batch.vkCommandBuffer)
+				{
+					vkFreeCommandBuffers(mVkDevice, mVkCommandPool, 1, &batch.vkCommandBuffer);
+				}
+			}
+			if (VK_NULL_HANDLE != mVkCommandPool)
+			{
+				vkDestroyCommandPool(mVkDevice, mVkCommandPool, mVulkanRhi.getVkAllocationCallbacks());
+			}
+			destroyStagingVkBuffer(mRingVkBuffer, mRingVulkanMemory);
+		}
+
+		/**
+		*  @brief
+		*    Begin recording an upload, locks the upload queue until "endUpload()" is called
+		*
+		*  @param[in] numberOfBytes
+		*    Number of staging bytes the upload needs, can be zero
+		*  @param[in] alignment
+		*    Staging memory alignment in bytes, doesn't need to be a power of two (e.g. "VK_FORMAT_R8G8B8_UNORM"-uploads need a multiple of three and four)
+		*  @param[out] stagingMemory
+		*    Receives the staging memory, only valid if "numberOfBytes" is not zero
+		*
+		*  @return
+		*    Vulkan command buffer to record the upload commands into, null handle on error in which case the upload queue isn't locked
+		*/
+		[[nodiscard]] VkCommandBuffer beginUpload(VkDeviceSize numberOfBytes, VkDeviceSize alignment, StagingMemory& stagingMemory)
+		{
+			mMutex.lock();
+			retireFinishedBatches(false);
+
+			// Get the staging memory, this might submit the currently recorded batch so it has to happen before the Vulkan command buffer is picked
+			if (numberOfBytes > 0 && !allocateStagingMemory(numberOfBytes, alignment, stagingMemory))
+			{
+				mMutex.unlock();
+				return VK_NULL_HANDLE;
+			}
+
+			// Begin the Vulkan command buffer of the recording batch, if necessary
+			Batch& batch = mBatches[mRecordingBatchIndex];
+			if (!batch.recording)
+			{
+				static constexpr VkCommandBufferBeginInfo vkCommandBufferBeginInfo =
+				{
+					VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO,	// sType (VkStructureType)
+					nullptr,										// pNext (const void*)
+					VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT,	// flags (VkCommandBufferUsageFlags)
+					nullptr											// pInheritanceInfo (const VkCommandBufferInheritanceInfo*)
+				};
+				if (vkBeginCommandBuffer(batch.vkCommandBuffer, &vkCommandBufferBeginInfo) != VK_SUCCESS)
+				{
+					// Error!
+					RHI_LOG(mVulkanRhi.getContext(), CRITICAL, "Failed to begin Vulkan upload command buffer instance")
+					mMutex.unlock();
+					return VK_NULL_HANDLE;
+				}
+				batch.recording = true;
+			}
+
+			// Done, the upload queue stays locked until "endUpload()"
+			return batch.vkCommandBuffer;
 		}
 
 		/**
 		*  @brief
-		*    Return the used Vulkan command buffer pool instance
+		*    End recording an upload started by a successful "beginUpload()", unlocks the upload queue
+		*/
+		void endUpload()
+		{
+			// Submit early when half of the staging ring buffer is waiting for submission so the GPU can work in parallel to resource loading
+			if (mRingHead - mBatches[mRecordingBatchIndex].ringBegin > STAGING_RING_BUFFER_SIZE / 2)
+			{
+				submitRecordingBatch();
+			}
+			mMutex.unlock();
+		}
+
+		/**
+		*  @brief
+		*    Submit all recorded uploads without waiting for them
+		*
+		*  @note
+		*    - Must be called before submitting Vulkan command buffers which are using uploaded resources
+		*/
+		void flush()
+		{
+			std::lock_guard<std::mutex> mutexLock(mMutex);
+			submitRecordingBatch();
+			retireFinishedBatches(false);
+		}
+
+		/**
+		*  @brief
+		*    Submit all recorded uploads and wait until all of them are finished
+		*
+		*  @note
+		*    - Must be called before destroying resources which might still be referenced by pending uploads
+		*/
+		void finish()
+		{
+			std::lock_guard<std::mutex> mutexLock(mMutex);
+			submitRecordingBatch();
+			retireFinishedBatches(true);
+		}
+
+		/**
+		*  @brief
+		*    Return whether or not there are uploads which are recorded or not retired yet
 		*
 		*  @return
-		*    The used Vulkan command buffer pool instance
+		*    "true" if there are no pending uploads, else "false"
 		*/
-		[[nodiscard]] inline VkCommandPool getVkCommandPool() const
+		[[nodiscard]] bool isIdle()
 		{
-			return mVkCommandPool;
+			std::lock_guard<std::mutex> mutexLock(mMutex);
+			return (!mBatches[mRecordingBatchIndex].recording && 0 == mNumberOfSubmittedBatches);
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Protected methods                                     ]
+	//[-------------------------------------------------------]
+	protected:
+		explicit VulkanUploadQueue(const VulkanUploadQueue& source) = delete;
+		VulkanUploadQueue& operator =(const VulkanUploadQueue& source) = delete;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		static constexpr uint32_t	  NUMBER_OF_BATCHES		   = 4;
+		static constexpr VkDeviceSize STAGING_RING_BUFFER_SIZE = 32 * 1024 * 1024;	///< 32 MiB
+
+		struct TransientStagingBuffer final
+		{
+			VkBuffer	 vkBuffer;
+			VulkanMemory vulkanMemory;
+		};
+		typedef std::vector<TransientStagingBuffer> TransientStagingBuffers;
+
+		struct Batch final
+		{
+			VkCommandBuffer			vkCommandBuffer = VK_NULL_HANDLE;
+			VkFence					vkFence = VK_NULL_HANDLE;
+			bool					recording = false;	///< Vulkan command buffer begun and not submitted yet?
+			uint64_t				ringBegin = 0;		///< Virtual staging ring buffer position at the time the batch started recording
+			uint64_t				ringEnd = 0;		///< Virtual staging ring buffer position at the time the batch was submitted, everything up to it can be reused after retirement
+			TransientStagingBuffers transientStagingBuffers;	///< Staging buffers of uploads which didn't fit into the staging ring buffer
+		};
+
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		void createStagingVkBuffer(VkDeviceSize numberOfBytes, VulkanMemoryAllocator::Usage usage, VkBuffer& vkBuffer, VulkanMemory& vulkanMemory)
+		{
+			const VkBufferCreateInfo vkBufferCreateInfo =
+			{
+				VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO,	// sType (VkStructureType)
+				nullptr,								// pNext (const void*)
+				0,										// flags (VkBufferCreateFlags)
+				numberOfBytes,							// size (VkDeviceSize)
+				VK_BUFFER_USAGE_TRANSFER_SRC_BIT,		// usage (VkBufferUsageFlags)
+				VK_SHARING_MODE_EXCLUSIVE,				// sharingMode (VkSharingMode)
+				0,										// queueFamilyIndexCount (uint32_t)
+				nullptr									// pQueueFamilyIndices (const uint32_t*)
+			};
+			if (vkCreateBuffer(mVkDevice, &vkBufferCreateInfo, mVulkanRhi.getVkAllocationCallbacks(), &vkBuffer) != VK_SUCCESS)
+			{
+				// Error!
+				RHI_LOG(mVulkanRhi.getContext(), CRITICAL, "Failed to create the Vulkan staging buffer")
+				vkBuffer = VK_NULL_HANDLE;
+				return;
+			}
+			VkMemoryRequirements vkMemoryRequirements = {};
+			vkGetBufferMemoryRequirements(mVkDevice, vkBuffer, &vkMemoryRequirements);
+			if (!mVulkanRhi.getVulkanContext().getVulkanMemoryAllocator().allocate(vkMemoryRequirements, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, usage, VulkanMemoryAllocator::ResourceType::BUFFER, vulkanMemory) || nullptr == vulkanMemory.mappedData)
+			{
+				// Error!
+				RHI_LOG(mVulkanRhi.getContext(), CRITICAL, "Failed to allocate the Vulkan staging buffer memory")
+				destroyStagingVkBuffer(vkBuffer, vulkanMemory);
+				return;
+			}
+			vkBindBufferMemory(mVkDevice, vkBuffer, vulkanMemory.vkDeviceMemory, vulkanMemory.offset);
+		}
+
+		void destroyStagingVkBuffer(VkBuffer& vkBuffer, VulkanMemory& vulkanMemory)
+		{
+			if (VK_NULL_HANDLE != vkBuffer)
+			{
+				vkDestroyBuffer(mVkDevice, vkBuffer, mVulkanRhi.getVkAllocationCallbacks());
+				vkBuffer = VK_NULL_HANDLE;
+			}
+			mVulkanRhi.getVulkanContext().getVulkanMemoryAllocator().free(vulkanMemory);
+		}
+
+		[[nodiscard]] bool allocateStagingMemory(VkDeviceSize numberOfBytes, VkDeviceSize alignment, StagingMemory& stagingMemory)
+		{
+			// Uploads which don't fit into the staging ring buffer at all get a transient staging buffer
+			if (numberOfBytes > STAGING_RING_BUFFER_SIZE / 2 || VK_NULL_HANDLE == mRingVkBuffer)
+			{
+				TransientStagingBuffer transientStagingBuffer = { VK_NULL_HANDLE, VulkanMemory() };
+				createStagingVkBuffer(numberOfBytes, VulkanMemoryAllocator::Usage::TRANSIENT, transientStagingBuffer.vkBuffer, transientStagingBuffer.vulkanMemory);
+				if (VK_NULL_HANDLE == transientStagingBuffer.vkBuffer)
+				{
+					return false;
+				}
+				stagingMemory.vkBuffer   = transientStagingBuffer.vkBuffer;
+				stagingMemory.offset	 = 0;
+				stagingMemory.mappedData = transientStagingBuffer.vulkanMemory.mappedData;
+				mBatches[mRecordingBatchIndex].transientStagingBuffers.push_back(transientStagingBuffer);
+				return true;
+			}
+
+			// Sub-allocate inside the staging ring buffer, a sub-allocation never wraps around the end of the ring buffer
+			for (;;)
+			{
+				const VkDeviceSize ringOffset = static_cast<VkDeviceSize>(mRingHead % STAGING_RING_BUFFER_SIZE);
+				VkDeviceSize alignedRingOffset = (ringOffset + alignment - 1) / alignment * alignment;
+				if (alignedRingOffset + numberOfBytes > STAGING_RING_BUFFER_SIZE)
+				{
+					alignedRingOffset = STAGING_RING_BUFFER_SIZE;	// Wrap around, start of the next lap
+				}
+				const uint64_t newRingHead = mRingHead + (alignedRingOffset - ringOffset) + numberOfBytes;
+				if (newRingHead - mRingTail <= STAGING_RING_BUFFER_SIZE)
+				{
+					stagingMemory.vkBuffer   = mRingVkBuffer;
+					stagingMemory.offset	 = alignedRingOffset % STAGING_RING_BUFFER_SIZE;
+					stagingMemory.mappedData = mRingVulkanMemory.mappedData + stagingMemory.offset;
+					mRingHead = newRingHead;
+					return true;
+				}
+
+				// The staging ring buffer is full: Wait for the oldest submitted batch, submit the recording batch first if there's nothing else to wait for
+				if (0 == mNumberOfSubmittedBatches)
+				{
+					if (!mBatches[mRecordingBatchIndex].recording)
+					{
+						// Can't happen since sub-allocations are limited to half of the ring buffer size, but be defensive
+						mRingTail = mRingHead;
+						continue;
+					}
+					submitRecordingBatch();
+				}
+				retireOldestBatch(true);
+			}
+		}
+
+		void submitRecordingBatch()
+		{
+			Batch& batch = mBatches[mRecordingBatchIndex];
+			if (!batch.recording)
+			{
+				return;
+			}
+
+			// End and submit the Vulkan command buffer
+			batch.recording = false;
+			batch.ringEnd = mRingHead;
+			if (vkEndCommandBuffer(batch.vkCommandBuffer) != VK_SUCCESS)
+			{
+				// Error!
+				RHI_LOG(mVulkanRhi.getContext(), CRITICAL, "Failed to end Vulkan upload command buffer instance")
+			}
+			const VkSubmitInfo vkSubmitInfo =
+			{
+				VK_STRUCTURE_TYPE_SUBMIT_INFO,	// sType (VkStructureType)
+				nullptr,						// pNext (const void*)
+				0,								// waitSemaphoreCount (uint32_t)
+				nullptr,						// pWaitSemaphores (const VkSemaphore*)
+				nullptr,						// pWaitDstStageMask (const VkPipelineStageFlags*)
+				1,								// commandBufferCount (uint32_t)
+				&batch.vkCommandBuffer,			// pCommandBuffers (const VkCommandBuffer*)
+				0,								// signalSemaphoreCount (uint32_t)
+				nullptr							// pSignalSemaphores (const VkSemaphore*)
+			};
+			VkResult vkResult = VK_SUCCESS;
+			{
+				const VulkanContext& vulkanContext = mVulkanRhi.getVulkanContext();
+				std::lock_guard<std::mutex> vkQueueMutexLock(vulkanContext.getVkQueueMutex());
+				vkResult = vkQueueSubmit(vulkanContext.getGraphicsVkQueue(), 1, &vkSubmitInfo, batch.vkFence);
+			}
+			if (VK_SUCCESS != vkResult)
+			{
+				// Error! Drop the batch and keep recording into it.
+				RHI_LOG(mVulkanRhi.getContext(), CRITICAL, "Vulkan upload queue submit failed")
+				retireFinishedBatches(true);
+				for (TransientStagingBuffer& transientStagingBuffer : batch.transientStagingBuffers)
+				{
+					destroyStagingVkBuffer(transientStagingBuffer.vkBuffer, transientStagingBuffer.vulkanMemory);
+				}
+				batch.transientStagingBuffers.clear();
+				batch.ringBegin = mRingTail = mRingHead;
+				return;
+			}
+			++mNumberOfSubmittedBatches;
+
+			// Continue with the next batch, if all batches are in flight wait for the oldest one
+			mRecordingBatchIndex = (mRecordingBatchIndex + 1) % NUMBER_OF_BATCHES;
+			if (NUMBER_OF_BATCHES == mNumberOfSubmittedBatches)
+			{
+				retireOldestBatch(true);
+			}
+			mBatches[mRecordingBatchIndex].ringBegin = mRingHead;
+		}
+
+		bool retireOldestBatch(bool wait)
+		{
+			RHI_ASSERT(mVulkanRhi.getContext(), mNumberOfSubmittedBatches > 0, "There's no submitted Vulkan upload batch")
+			Batch& batch = mBatches[mOldestBatchIndex];
+			const VkResult vkResult = wait ? vkWaitForFences(mVkDevice, 1, &batch.vkFence, VK_TRUE, UINT64_MAX) : vkGetFenceStatus(mVkDevice, batch.vkFence);
+			if (VK_SUCCESS != vkResult)
+			{
+				return false;
+			}
+			vkResetFences(mVkDevice, 1, &batch.vkFence);
+			for (TransientStagingBuffer& transientStagingBuffer : batch.transientStagingBuffers)
+			{
+				destroyStagingVkBuffer(transientStagingBuffer.vkBuffer, transientStagingBuffer.vulkanMemory);
+			}
+			batch.transientStagingBuffers.clear();
+			mRingTail = batch.ringEnd;
+			mOldestBatchIndex = (mOldestBatchIndex + 1) % NUMBER_OF_BATCHES;
+			--mNumberOfSubmittedBatches;
+			return true;
+		}
+
+		void retireFinishedBatches(bool wait)
+		{
+			while (mNumberOfSubmittedBatches > 0 && retireOldestBatch(wait))
+			{
+				// Nothing here
+			}
+		}
+
+
+	//[-------------------------------------------------------]
+	//[ Private data                                          ]
+	//[-------------------------------------------------------]
+	private:
+		VulkanRhi&	  mVulkanRhi;					///< Owner Vulkan RHI instance
+		VkDevice	  mVkDevice;
+		VkCommandPool mVkCommandPool;				///< Vulkan command pool the upload command buffers are allocated from
+		VkBuffer	  mRingVkBuffer;				///< Persistently mapped staging ring buffer, can be a null handle
+		VulkanMemory  mRingVulkanMemory;
+		uint64_t	  mRingHead;					///< Virtual staging ring buffer write position, the physical position is "mRingHead % STAGING_RING_BUFFER_SIZE"
+		uint64_t	  mRingTail;					///< Virtual staging ring buffer position up to which the memory has been consumed by the GPU
+		Batch		  mBatches[NUMBER_OF_BATCHES];
+		uint32_t	  mRecordingBatchIndex;			///< Index of the batch new uploads are recorded into
+		uint32_t	  mOldestBatchIndex;			///< Index of the oldest submitted batch
+		uint32_t	  mNumberOfSubmittedBatches;	///< Number of submitted batches which are not retired yet
+		std::mutex	  mMutex;
+
+
+	};
+
+
+
+
+	//[-------------------------------------------------------]
+	//[ VulkanRhi/VulkanDescriptorAllocator.h                 ]
+	//[-------------------------------------------------------]
+	/**
+	*  @brief
+	*    Vulkan descriptor set wrapper, knows the descriptor pool the descriptor set was allocated from
+	*/
+	struct VulkanDescriptorSet final
+	{
+		VkDescriptorSet vkDescriptorSet = VK_NULL_HANDLE;
+		uint32_t		poolIndex = ~0u;	///< Index of the persistent descriptor pool inside the Vulkan descriptor allocator
+	};
+
+	/**
+	*  @brief
+	*    Vulkan descriptor allocator which manages a growable set of descriptor pools
+	*
+	*  @remarks
+	*    Descriptor sets of resource groups are allocated from persistent descriptor pools. If all persistent descriptor pools are exhausted
+	*    a new one is created, each new descriptor pool can hold twice as many descriptor sets as the previous one up to a maximum. Freed
+	*    descriptor sets might still be referenced by a command buffer which is executed by the GPU, so they're handed back to their descriptor
+	*    pool not before the next frames are done. A persistent descriptor pool without any descriptor sets left is reset which gets rid of
+	*    fragmentation.
+	*
+	*  @note
+	*    - Thread-safe
+	*    - "nextFrame()" must be called once per frame after the frame command buffer has been submitted
+	*/
+	class VulkanDescriptorAllocator final
+	{
+
+
+	//[-------------------------------------------------------]
+	//[ Public methods                                        ]
+	//[-------------------------------------------------------]
+	public:
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] vulkanRhi
+		*    Owner Vulkan RHI instance, the Vulkan context must be initialized
+		*/
+		inline explicit VulkanDescriptorAllocator(VulkanRhi& vulkanRhi) :
+			mVulkanRhi(vulkanRhi),
+			mVkDevice(vulkanRhi.getVulkanContext().getVkDevice()),
+			mFrameIndex(0)
+		{
+			// Nothing here
 		}
 
 		/**
 		*  @brief
-		*    Return the Vulkan command buffer instance
+		*    Destructor
+		*
+		*  @note
+		*    - All descriptor sets must have been freed and the GPU must be done with them
+		*/
+		~VulkanDescriptorAllocator()
+		{
+			const VkAllocationCallbacks* vkAllocationCallbacks = mVulkanRhi.getVkAllocationCallbacks();
+			for (const Pool& pool : mPools)
+			{
+				vkDestroyDescriptorPool(mVkDevice, pool.vkDescriptorPool, vkAllocationCallbacks);
+			}
+		}
+
+		/**
+		*  @brief
+		*    Allocate a persistent descriptor set
+		*
+		*  @param[in] vkDescriptorSetLayout
+		*    Vulkan descriptor set layout, must be valid
+		*  @param[out] vulkanDescriptorSet
+		*    Receives the allocated descriptor set, must be freed via "free()"
 		*
 		*  @return
-		*    The Vulkan command buffer instance
+		*    "true" if all went fine, else "false"
 		*/
-		[[nodiscard]] inline VkCommandBuffer getVkCommandBuffer() const
+		bool allocate(VkDescriptorSetLayout vkDescriptorSetLayout, VulkanDescriptorSet& vulkanDescriptorSet)
 		{
-			return mVkCommandBuffer;
+			std::lock_guard<std::mutex> mutexLock(mMutex);
+
+			// Try the existing persistent descriptor pools first, newest first since older ones are more likely to be exhausted
+			const uint32_t numberOfPools = static_cast<uint32_t>(mPools.size());
+			for (uint32_t i = numberOfPools; i > 0; --i)
+			{
+				Pool& pool = mPools[i - 1];
+				if (pool.numberOfAllocatedSets < pool.maximumNumberOfSets && allocateFromPool(pool, vkDescriptorSetLayout, vulkanDescriptorSet.vkDescriptorSet))
+				{
+					vulkanDescriptorSet.poolIndex = i - 1;
+					return true;
+				}
+			}
+
+			// All persistent descriptor pools are exhausted, grow
+			const uint32_t maximumNumberOfSets = mPools.empty() ? MINIMUM_NUMBER_OF_SETS_PER_POOL : std::min(mPools.back().maximumNumberOfSets * 2, MAXIMUM_NUMBER_OF_SETS_PER_POOL);
+			Pool pool;
+			if (createPool(maximumNumberOfSets, pool))
+			{
+				mPools.push_back(pool);
+				if (allocateFromPool(mPools.back(), vkDescriptorSetLayout, vulkanDescriptorSet.vkDescriptorSet))
+				{
+					vulkanDescriptorSet.poolIndex = numberOfPools;
+					return true;
+				}
+			}
+
+			// Error!
+			RHI_LOG(mVulkanRhi.getContext(), CRITICAL, "Failed to allocate the Vulkan descriptor set")
+			vulkanDescriptorSet = VulkanDescriptorSet();
+			return false;
+		}
+
+		/**
+		*  @brief
+		*    Free a persistent descriptor set
+		*
+		*  @param[in, out] vulkanDescriptorSet
+		*    Descriptor set to free, is reset, the descriptor set is recycled as soon as the GPU is done with the current frame
+		*/
+		void free(VulkanDescriptorSet& vulkanDescriptorSet)
+		{
+			if (VK_NULL_HANDLE != vulkanDescriptorSet.vkDescriptorSet)
+			{
+				std::lock_guard<std::mutex> mutexLock(mMutex);
+				mFreedDescriptorSets[mFrameIndex].push_back(vulkanDescriptorSet);
+				vulkanDescriptorSet = VulkanDescriptorSet();
+			}
 		}
 
-		// TODO(co) Trivial implementation to have something to start with. Need to use more clever memory management and stating buffers later on.
-		[[nodiscard]] uint32_t findMemoryTypeIndex(uint32_t typeFilter, VkMemoryPropertyFlags vkMemoryPropertyFlags) const
+		/**
+		*  @brief
+		*    Advance to the next frame, recycles the persistent descriptor sets freed during the frame which is reused now
+		*
+		*  @note
+		*    - The GPU must be done with the frame which is reused now, the swap chain waits for the present queue to be idle so this is given
+		*/
+		void nextFrame()
 		{
-			VkPhysicalDeviceMemoryProperties vkPhysicalDeviceMemoryProperties;
-			vkGetPhysicalDeviceMemoryProperties(mVkPhysicalDevice, &vkPhysicalDeviceMemoryProperties);
-			for (uint32_t i = 0; i < vkPhysicalDeviceMemoryProperties.memoryTypeCount; ++i)
+			std::lock_guard<std::mutex> mutexLock(mMutex);
+			mFrameIndex = (mFrameIndex + 1) % NUMBER_OF_FRAMES;
+			VulkanDescriptorSets& freedDescriptorSets = mFreedDescriptorSets[mFrameIndex];
+
+			// Hand freed persistent descriptor sets back to their descriptor pools
+			for (const VulkanDescriptorSet& vulkanDescriptorSet : freedDescriptorSets)
 			{
-				if ((typeFilter & (1 << i)) && (vkPhysicalDeviceMemoryProperties.memoryTypes[i].propertyFlags & vkMemoryPropertyFlags) == vkMemoryPropertyFlags)
+				Pool& pool = mPools[vulkanDescriptorSet.poolIndex];
+				RHI_ASSERT(mVulkanRhi.getContext(), pool.numberOfAllocatedSets > 0, "Invalid number of allocated Vulkan descriptor sets")
+				--pool.numberOfAllocatedSets;
+				if (0 == pool.numberOfAllocatedSets)
 				{
-					return i;
+					// Resetting an empty descriptor pool gets rid of fragmentation
+					vkResetDescriptorPool(mVkDevice, pool.vkDescriptorPool, 0);
+				}
+				else
+				{
+					vkFreeDescriptorSets(mVkDevice, pool.vkDescriptorPool, 1, &vulkanDescriptorSet.vkDescriptorSet);
 				}
 			}
-
-			// Error!
-			RHI_LOG(mVulkanRhi.getContext(), CRITICAL, "Failed to find suitable Vulkan memory type")
-			return ~0u;
+			freedDescriptorSets.clear();
 		}
 
-		[[nodiscard]] inline VkCommandBuffer createVkCommandBuffer() const
+
+	//[-------------------------------------------------------]
+	//[ Protected methods                                     ]
+	//[-------------------------------------------------------]
+	protected:
+		explicit VulkanDescriptorAllocator(const VulkanDescriptorAllocator& source) = delete;
+		VulkanDescriptorAllocator& operator =(const VulkanDescriptorAllocator& source) = delete;
+
+
+	//[-------------------------------------------------------]
+	//[ Private definitions                                   ]
+	//[-------------------------------------------------------]
+	private:
+		static constexpr uint32_t NUMBER_OF_FRAMES				  = 2;		///< Number of frames freed descriptor sets are kept alive
+		static constexpr uint32_t MINIMUM_NUMBER_OF_SETS_PER_POOL = 256;	///< Maximum number of descriptor sets inside the first descriptor pool
+		static constexpr uint32_t MAXIMUM_NUMBER_OF_SETS_PER_POOL = 4096;	///< Upper limit for the maximum number of descriptor sets of grown descriptor pools
+
+		struct Pool final
 		{
-			return ::detail::createVkCommandBuffer(mVulkanRhi.getContext(), mVkDevice, mVkCommandPool);
-		}
+			VkDescriptorPool vkDescriptorPool = VK_NULL_HANDLE;
+			uint32_t		 maximumNumberOfSets = 0;
+			uint32_t		 numberOfAllocatedSets = 0;
+		};
+		typedef std::vector<Pool>				 Pools;
+		typedef std::vector<VulkanDescriptorSet> VulkanDescriptorSets;
 
-		void destroyVkCommandBuffer(VkCommandBuffer vkCommandBuffer) const
+
+	//[-------------------------------------------------------]
+	//[ Private methods                                       ]
+	//[-------------------------------------------------------]
+	private:
+		[[nodiscard]] bool createPool(uint32_t maximumNumberOfSets, Pool& pool) const
 		{
-			if (VK_NULL_HANDLE != mVkCommandBuffer)
+			// The descriptor pool doesn't know which descriptor set layouts are going to be used, so the number of descriptors per type is an
+			// average per descriptor set, material resource groups are dominated by textures
+			const std::array<VkDescriptorPoolSize, 6> vkDescriptorPoolSizes =
+			{{
+				{ VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, maximumNumberOfSets * 8 },	// type (VkDescriptorType), descriptorCount (uint32_t)
+				{ VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,		 maximumNumberOfSets * 2 },
+				{ VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,		 maximumNumberOfSets * 2 },
+				{ VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER,	 maximumNumberOfSets * 2 },
+				{ VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER,	 maximumNumberOfSets },
+				{ VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,			 maximumNumberOfSets }
+			}};
+			const VkDescriptorPoolCreateInfo vkDescriptorPoolCreateInfo =
 			{
-				vkFreeCommandBuffers(mVkDevice, mVkCommandPool, 1, &vkCommandBuffer);
+				VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,			// sType (VkStructureType)
+				nullptr,												// pNext (const void*)
+				VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT,		// flags (VkDescriptorPoolCreateFlags)
+				maximumNumberOfSets,									// maxSets (uint32_t)
+				static_cast<uint32_t>(vkDescriptorPoolSizes.size()),	// poolSizeCount (uint32_t)
+				vkDescriptorPoolSizes.data()							// pPoolSizes (const VkDescriptorPoolSize*)
+			};
+			if (vkCreateDescriptorPool(mVkDevice, &vkDescriptorPoolCreateInfo, mVulkanRhi.getVkAllocationCallbacks(), &pool.vkDescriptorPool) != VK_SUCCESS)
+			{
+				// Error!
+				RHI_LOG(mVulkanRhi.getContext(), CRITICAL, "Failed to create the Vulkan descriptor pool")
+				return false;
 			}
+			pool.maximumNumberOfSets = maximumNumberOfSets;
+			pool.numberOfAllocatedSets = 0;
+			return true;
 		}
 
+		[[nodiscard]] bool allocateFromPool(Pool& pool, VkDescriptorSetLayout vkDescriptorSetLayout, VkDescriptorSet& vkDescriptorSet) const
+		{
+			const VkDescriptorSetAllocateInfo vkDescriptorSetAllocateInfo =
+			{
+				VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,	// sType (VkStructureType)
+				nullptr,										// pNext (const void*)
+				pool.vkDescriptorPool,							// descriptorPool (VkDescriptorPool)
+				1,												// descriptorSetCount (uint32_t)
+				&vkDescriptorSetLayout							// pSetLayouts (const VkDescriptorSetLayout*)
+			};
 
-	//[-------------------------------------------------------]
-	//[ Protected methods                                     ]
-	//[-------------------------------------------------------]
-	protected:
-		explicit VulkanContext(const VulkanContext& source) = delete;
-		VulkanContext& operator =(const VulkanContext& source) = delete;
+			// "VK_ERROR_OUT_OF_POOL_MEMORY" or "VK_ERROR_FRAGMENTED_POOL" just means we have to try another descriptor pool
+			if (vkAllocateDescriptorSets(mVkDevice, &vkDescriptorSetAllocateInfo, &vkDescriptorSet) == VK_SUCCESS)
+			{
+				++pool.numberOfAllocatedSets;
+				return true;
+			}
+			vkDescriptorSet = VK_NULL_HANDLE;
+			return false;
+		}
 
 
 	//[-------------------------------------------------------]
 	//[ Private data                                          ]
 	//[-------------------------------------------------------]
 	private:
-		VulkanRhi&		 mVulkanRhi;				///< Owner Vulkan RHI instance
-		VkPhysicalDevice mVkPhysicalDevice;			///< Vulkan physical device this context is using
-		VkDevice		 mVkDevice;					///< Vulkan device instance this context is using (equivalent of a OpenGL context or Direct3D 11 device)
-		uint32_t		 mGraphicsQueueFamilyIndex;	///< Graphics queue family index, ~0u if invalid
-		uint32_t		 mPresentQueueFamilyIndex;	///< Present queue family index, ~0u if invalid
-		VkQueue			 mGraphicsVkQueue;			///< Handle to the Vulkan device graphics queue that command buffers are submitted to
-		VkQueue			 mPresentVkQueue;			///< Handle to the Vulkan device present queue
-		VkCommandPool	 mVkCommandPool;			///< Vulkan command buffer pool instance
-		VkCommandBuffer  mVkCommandBuffer;			///< Vulkan command buffer instance
+		VulkanRhi& mVulkanRhi;	///< Owner Vulkan RHI instance
+		VkDevice   mVkDevice;
+		Pools				 mPools;									///< Persistent descriptor pools, the index is stored inside "VulkanDescriptorSet::poolIndex" so descriptor pools are never removed
+		VulkanDescriptorSets mFreedDescriptorSets[NUMBER_OF_FRAMES];	///< Persistent descriptor sets freed during the frame
+		uint32_t			 mFrameIndex;								///< Index of the current frame inside "mFreedDescriptorSets"
+		std::mutex			 mMutex;
 
 
 	};
@@ -3764,17 +5117,20 @@ namespace VulkanRhi
 				0,								// signalSemaphoreCount (uint32_t)
 				nullptr							// pSignalSemaphores (const VkSemaphore*)
 			};
-			if (vkQueueSubmit(vkQueue, 1, &vkSubmitInfo, VK_NULL_HANDLE) != VK_SUCCESS)
-			{
-				// Error!
-				RHI_LOG(vulkanRhi.getContext(), CRITICAL, "Vulkan queue submit failed")
-				return;
-			}
-			if (vkQueueWaitIdle(vkQueue) != VK_SUCCESS)
 			{
-				// Error!
-				RHI_LOG(vulkanRhi.getContext(), CRITICAL, "Vulkan Queue wait idle failed")
-				return;
+				std::lock_guard<std::mutex> vkQueueMutexLock(vulkanContext.getVkQueueMutex());
+				if (vkQueueSubmit(vkQueue, 1, &vkSubmitInfo, VK_NULL_HANDLE) != VK_SUCCESS)
+				{
+					// Error!
+					RHI_LOG(vulkanRhi.getContext(), CRITICAL, "Vulkan queue submit failed")
+					return;
+				}
+				if (vkQueueWaitIdle(vkQueue) != VK_SUCCESS)
+				{
+					// Error!
+					RHI_LOG(vulkanRhi.getContext(), CRITICAL, "Vulkan Queue wait idle failed")
+					return;
+				}
 			}
 
 			// Destroy Vulkan command buffer
@@ -4011,8 +5367,7 @@ namespace VulkanRhi
 		//[-------------------------------------------------------]
 		//[ Buffer                                                ]
 		//[-------------------------------------------------------]
-		// TODO(co) Trivial implementation to have something to start with. Need to use more clever memory management and stating buffers later on.
-		static void createAndAllocateVkBuffer(const VulkanRhi& vulkanRhi, VkBufferUsageFlagBits vkBufferUsageFlagBits, VkMemoryPropertyFlags vkMemoryPropertyFlags, VkDeviceSize numberOfBytes, const void* data, VkBuffer& vkBuffer, VkDeviceMemory& vkDeviceMemory)
+		static void createAndAllocateVkBuffer(const VulkanRhi& vulkanRhi, VkBufferUsageFlagBits vkBufferUsageFlagBits, VkMemoryPropertyFlags vkMemoryPropertyFlags, VkDeviceSize numberOfBytes, const void* data, VkBuffer& vkBuffer, VulkanMemory& vulkanMemory, VulkanMemoryAllocator::Usage usage = VulkanMemoryAllocator::Usage::PERSISTENT)
 		{
 			const VulkanContext& vulkanContext = vulkanRhi.getVulkanContext();
 			const VkDevice vkDevice = vulkanContext.getVkDevice();
@@ -4034,30 +5389,22 @@ namespace VulkanRhi
 				RHI_LOG(vulkanRhi.getContext(), CRITICAL, "Failed to create the Vulkan buffer")
 			}
 
-			// Allocate memory for the Vulkan buffer
+			// Sub-allocate memory for the Vulkan buffer
 			VkMemoryRequirements vkMemoryRequirements = {};
 			vkGetBufferMemoryRequirements(vkDevice, vkBuffer, &vkMemoryRequirements);
-			const VkMemoryAllocateInfo vkMemoryAllocateInfo =
-			{
-				VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,															// sType (VkStructureType)
-				nullptr,																						// pNext (const void*)
-				vkMemoryRequirements.size,																		// allocationSize (VkDeviceSize)
-				vulkanContext.findMemoryTypeIndex(vkMemoryRequirements.memoryTypeBits, vkMemoryPropertyFlags)	// memoryTypeIndex (uint32_t)
-			};
-			if (vkAllocateMemory(vkDevice, &vkMemoryAllocateInfo, vulkanRhi.getVkAllocationCallbacks(), &vkDeviceMemory) != VK_SUCCESS)
+			if (!vulkanContext.getVulkanMemoryAllocator().allocate(vkMemoryRequirements, vkMemoryPropertyFlags, usage, VulkanMemoryAllocator::ResourceType::BUFFER, vulkanMemory))
 			{
 				RHI_LOG(vulkanRhi.getContext(), CRITICAL, "Failed to allocate the Vulkan buffer memory")
+				return;
 			}
 
-			// Bind and fill memory
-			vkBindBufferMemory(vkDevice, vkBuffer, vkDeviceMemory, 0);
+			// Bind and fill memory, host visible memory is persistently mapped by the memory allocator
+			vkBindBufferMemory(vkDevice, vkBuffer, vulkanMemory.vkDeviceMemory, vulkanMemory.offset);
 			if (nullptr != data)
 			{
-				void* mappedData = nullptr;
-				if (vkMapMemory(vkDevice, vkDeviceMemory, 0, vkBufferCreateInfo.size, 0, &mappedData) == VK_SUCCESS)
+				if (nullptr != vulkanMemory.mappedData)
 				{
-					memcpy(mappedData, data, static_cast<size_t>(vkBufferCreateInfo.size));
-					vkUnmapMemory(vkDevice, vkDeviceMemory);
+					memcpy(vulkanMemory.mappedData, data, static_cast<size_t>(vkBufferCreateInfo.size));
 				}
 				else
 				{
@@ -4066,16 +5413,14 @@ namespace VulkanRhi
 			}
 		}
 
-		static void destroyAndFreeVkBuffer(const VulkanRhi& vulkanRhi, VkBuffer& vkBuffer, VkDeviceMemory& vkDeviceMemory)
+		static void destroyAndFreeVkBuffer(const VulkanRhi& vulkanRhi, VkBuffer& vkBuffer, VulkanMemory& vulkanMemory)
 		{
 			if (VK_NULL_HANDLE != vkBuffer)
 			{
-				const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
-				vkDestroyBuffer(vkDevice, vkBuffer, vulkanRhi.getVkAllocationCallbacks());
-				if (VK_NULL_HANDLE != vkDeviceMemory)
-				{
-					vkFreeMemory(vkDevice, vkDeviceMemory, vulkanRhi.getVkAllocationCallbacks());
-				}
+				const VulkanContext& vulkanContext = vulkanRhi.getVulkanContext();
+				vkDestroyBuffer(vulkanContext.getVkDevice(), vkBuffer, vulkanRhi.getVkAllocationCallbacks());
+				vkBuffer = VK_NULL_HANDLE;
+				vulkanContext.getVulkanMemoryAllocator().free(vulkanMemory);
 			}
 		}
 
@@ -4095,8 +5440,7 @@ namespace VulkanRhi
 			return VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
 		}
 
-		// TODO(co) Trivial implementation to have something to start with. Need to use more clever memory management and stating buffers later on.
-		static VkFormat createAndFillVkImage(const VulkanRhi& vulkanRhi, VkImageType vkImageType, VkImageViewType vkImageViewType, const VkExtent3D& vkExtent3D, Rhi::TextureFormat::Enum textureFormat, const void* data, uint32_t textureFlags, uint8_t numberOfMultisamples, VkImage& vkImage, VkDeviceMemory& vkDeviceMemory, VkImageView& vkImageView)
+		static VkFormat createAndFillVkImage(const VulkanRhi& vulkanRhi, VkImageType vkImageType, VkImageViewType vkImageViewType, const VkExtent3D& vkExtent3D, Rhi::TextureFormat::Enum textureFormat, const void* data, uint32_t textureFlags, uint8_t numberOfMultisamples, VkImage& vkImage, VulkanMemory& vulkanMemory, VkImageView& vkImageView)
 		{
 			// Calculate the number of mipmaps
 			const bool dataContainsMipmaps = (textureFlags & Rhi::TextureFlag::DATA_CONTAINS_MIPMAPS);
@@ -4166,7 +5510,7 @@ namespace VulkanRhi
 
 			{ // Create and fill Vulkan image
 				const VkImageCreateFlags vkImageCreateFlags = (VK_IMAGE_VIEW_TYPE_CUBE == vkImageViewType || VK_IMAGE_VIEW_TYPE_CUBE_ARRAY == vkImageViewType) ? VK_IMAGE_CREATE_CUBE_COMPATIBLE_BIT : 0u;
-				createAndAllocateVkImage(vulkanRhi, vkImageCreateFlags, vkImageType, VkExtent3D{vkExtent3D.width, vkExtent3D.height, depth}, numberOfMipmaps, layerCount, vkFormat, vkSampleCountFlagBits, VK_IMAGE_TILING_OPTIMAL, vkImageUsageFlags, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, vkImage, vkDeviceMemory);
+				createAndAllocateVkImage(vulkanRhi, vkImageCreateFlags, vkImageType, VkExtent3D{vkExtent3D.width, vkExtent3D.height, depth}, numberOfMipmaps, layerCount, vkFormat, vkSampleCountFlagBits, VK_IMAGE_TILING_OPTIMAL, vkImageUsageFlags, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, vkImage, vulkanMemory);
 			}
 
 			// Create the Vulkan image view
@@ -4176,22 +5520,28 @@ namespace VulkanRhi
 			}
 
 			// Upload all mipmaps
+			// -> The upload commands are recorded into the current batch of the Vulkan upload queue, which is submitted at the latest before the next frame command buffer
 			if (nullptr != data)
 			{
-				// Create Vulkan staging buffer
-				VkBuffer stagingVkBuffer = VK_NULL_HANDLE;
-				VkDeviceMemory stagingVkDeviceMemory = VK_NULL_HANDLE;
-				createAndAllocateVkBuffer(vulkanRhi, VK_BUFFER_USAGE_TRANSFER_SRC_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, stagingVkBuffer, stagingVkDeviceMemory);
+				// Copy the data into Vulkan staging memory and get the Vulkan upload command buffer
+				// -> 48 = least common multiple of all texel block sizes (1, 2, 3, 4, 8 and 16 bytes) and four, as required by "vkCmdCopyBufferToImage()"
+				VulkanUploadQueue& vulkanUploadQueue = vulkanRhi.getVulkanUploadQueue();
+				VulkanUploadQueue::StagingMemory stagingMemory = {};
+				const VkCommandBuffer vkCommandBuffer = vulkanUploadQueue.beginUpload(numberOfBytes, 48, stagingMemory);
+				if (VK_NULL_HANDLE == vkCommandBuffer)
+				{
+					// Error!
+					RHI_LOG(vulkanRhi.getContext(), CRITICAL, "Failed to begin the Vulkan texture upload")
+					return vkFormat;
+				}
+				memcpy(stagingMemory.mappedData, data, numberOfBytes);
 
 				{ // Upload all mipmaps
 					const uint32_t numberOfUploadedMipmaps = generateMipmaps ? 1 : numberOfMipmaps;
-
-					// Create and begin Vulkan command buffer
-					VkCommandBuffer vkCommandBuffer = beginSingleTimeCommands(vulkanRhi);
 					transitionVkImageLayout(vulkanRhi, vkCommandBuffer, vkImage, vkImageAspectFlags, numberOfUploadedMipmaps, layerCount, VK_IMAGE_LAYOUT_PREINITIALIZED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
 
 					// Upload all mipmaps
-					uint32_t bufferOffset  = 0;
+					VkDeviceSize bufferOffset = stagingMemory.offset;
 					uint32_t currentWidth  = vkExtent3D.width;
 					uint32_t currentHeight = vkExtent3D.height;
 					uint32_t currentDepth  = depth;
@@ -4223,9 +5573,9 @@ namespace VulkanRhi
 					}
 
 					// Copy Vulkan buffer to Vulkan image
-					vkCmdCopyBufferToImage(vkCommandBuffer, stagingVkBuffer, vkImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, static_cast<uint32_t>(vkBufferImageCopyList.size()), vkBufferImageCopyList.data());
+					vkCmdCopyBufferToImage(vkCommandBuffer, stagingMemory.vkBuffer, vkImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, static_cast<uint32_t>(vkBufferImageCopyList.size()), vkBufferImageCopyList.data());
 
-					// End and destroy Vulkan command buffer
+					// Prepare mipmap generation or shader read access
 					if (generateMipmaps)
 					{
 						const VkImageSubresourceRange vkImageSubresourceRange =
@@ -4242,16 +5592,13 @@ namespace VulkanRhi
 					{
 						transitionVkImageLayout(vulkanRhi, vkCommandBuffer, vkImage, vkImageAspectFlags, numberOfUploadedMipmaps, layerCount, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
 					}
-					endSingleTimeCommands(vulkanRhi, vkCommandBuffer);
 				}
 
-				// Destroy Vulkan staging buffer
-				destroyAndFreeVkBuffer(vulkanRhi, stagingVkBuffer, stagingVkDeviceMemory);
-
 				// Generate a complete texture mip-chain at runtime from a base image using image blits and proper image barriers
 				// -> Basing on https://github.com/SaschaWillems/Vulkan/tree/master/examples/texturemipmapgen and "Mipmap generation : Transfers, transition layout" by Antoine MORRIER published January 12, 2017 at http://cpp-rendering.io/mipmap-generation/
 				// -> We copy down the whole mip chain doing a blit from mip-1 to mip. An alternative way would be to always blit from the first mip level and sample that one down.
-				// TODO(co) Some GPUs also offer "asynchronous transfer queues" (check for queue families with only the "VK_QUEUE_TRANSFER_BIT" set) that may be used to speed up such operations
+				// -> Recorded into the same Vulkan upload command buffer as the copy
+				// TODO(co) Some GPUs also offer "asynchronous transfer queues" (check for queue families with only the "VK_QUEUE_TRANSFER_BIT" set) that may be used to speed up such operations, blits would still need the graphics queue
 				if (generateMipmaps)
 				{
 					#ifdef RHI_DEBUG
@@ -4266,9 +5613,6 @@ namespace VulkanRhi
 					}
 					#endif
 
-					// Create and begin Vulkan command buffer
-					VkCommandBuffer vkCommandBuffer = beginSingleTimeCommands(vulkanRhi);
-
 					// Copy down mips from n-1 to n
 					for (uint32_t i = 1; i < numberOfMipmaps; ++i)
 					{
@@ -4325,17 +5669,17 @@ namespace VulkanRhi
 						};
 						transitionVkImageLayout(vulkanRhi, vkCommandBuffer, vkImage, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, vkImageSubresourceRange, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
 					}
-
-					// End and destroy Vulkan command buffer
-					endSingleTimeCommands(vulkanRhi, vkCommandBuffer);
 				}
+
+				// Done recording, no wait in here
+				vulkanUploadQueue.endUpload();
 			}
 
 			// Done
 			return vkFormat;
 		}
 
-		static void createAndAllocateVkImage(const VulkanRhi& vulkanRhi, VkImageCreateFlags vkImageCreateFlags, VkImageType vkImageType, const VkExtent3D& vkExtent3D, uint32_t mipLevels, uint32_t arrayLayers, VkFormat vkFormat, VkSampleCountFlagBits vkSampleCountFlagBits, VkImageTiling vkImageTiling, VkImageUsageFlags vkImageUsageFlags, VkMemoryPropertyFlags vkMemoryPropertyFlags, VkImage& vkImage, VkDeviceMemory& vkDeviceMemory)
+		static void createAndAllocateVkImage(const VulkanRhi& vulkanRhi, VkImageCreateFlags vkImageCreateFlags, VkImageType vkImageType, const VkExtent3D& vkExtent3D, uint32_t mipLevels, uint32_t arrayLayers, VkFormat vkFormat, VkSampleCountFlagBits vkSampleCountFlagBits, VkImageTiling vkImageTiling, VkImageUsageFlags vkImageUsageFlags, VkMemoryPropertyFlags vkMemoryPropertyFlags, VkImage& vkImage, VulkanMemory& vulkanMemory)
 		{
 			const VulkanContext& vulkanContext = vulkanRhi.getVulkanContext();
 			const VkDevice vkDevice = vulkanContext.getVkDevice();
@@ -4365,50 +5709,47 @@ namespace VulkanRhi
 				}
 			}
 
-			{ // Allocate Vulkan memory
+			{ // Sub-allocate Vulkan memory
 				VkMemoryRequirements vkMemoryRequirements = {};
 				vkGetImageMemoryRequirements(vkDevice, vkImage, &vkMemoryRequirements);
-				const VkMemoryAllocateInfo vkMemoryAllocateInfo =
-				{
-					VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO,															// sType (VkStructureType)
-					nullptr,																						// pNext (const void*)
-					vkMemoryRequirements.size,																		// allocationSize (VkDeviceSize)
-					vulkanContext.findMemoryTypeIndex(vkMemoryRequirements.memoryTypeBits, vkMemoryPropertyFlags)	// memoryTypeIndex (uint32_t)
-				};
-				if (vkAllocateMemory(vkDevice, &vkMemoryAllocateInfo, vulkanRhi.getVkAllocationCallbacks(), &vkDeviceMemory) != VK_SUCCESS)
+				if (!vulkanContext.getVulkanMemoryAllocator().allocate(vkMemoryRequirements, vkMemoryPropertyFlags, VulkanMemoryAllocator::Usage::PERSISTENT, VulkanMemoryAllocator::ResourceType::IMAGE, vulkanMemory))
 				{
 					RHI_LOG(vulkanRhi.getContext(), CRITICAL, "Failed to allocate the Vulkan memory")
+					return;
 				}
-				if (vkBindImageMemory(vkDevice, vkImage, vkDeviceMemory, 0) != VK_SUCCESS)
+				if (vkBindImageMemory(vkDevice, vkImage, vulkanMemory.vkDeviceMemory, vulkanMemory.offset) != VK_SUCCESS)
 				{
 					RHI_LOG(vulkanRhi.getContext(), CRITICAL, "Failed to bind the Vulkan image memory")
 				}
 			}
 		}
 
-		static void destroyAndFreeVkImage(const VulkanRhi& vulkanRhi, VkImage& vkImage, VkDeviceMemory& vkDeviceMemory)
+		static void destroyAndFreeVkImage(const VulkanRhi& vulkanRhi, VkImage& vkImage, VulkanMemory& vulkanMemory)
 		{
 			if (VK_NULL_HANDLE != vkImage)
 			{
-				const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
-				vkDestroyImage(vkDevice, vkImage, vulkanRhi.getVkAllocationCallbacks());
-				vkImage = VK_NULL_HANDLE;
-				if (VK_NULL_HANDLE != vkDeviceMemory)
+				// The Vulkan image might still be referenced by a pending upload
+				VulkanUploadQueue& vulkanUploadQueue = vulkanRhi.getVulkanUploadQueue();
+				if (!vulkanUploadQueue.isIdle())
 				{
-					vkFreeMemory(vkDevice, vkDeviceMemory, vulkanRhi.getVkAllocationCallbacks());
-					vkDeviceMemory = VK_NULL_HANDLE;
+					vulkanUploadQueue.finish();
 				}
+
+				const VulkanContext& vulkanContext = vulkanRhi.getVulkanContext();
+				vkDestroyImage(vulkanContext.getVkDevice(), vkImage, vulkanRhi.getVkAllocationCallbacks());
+				vkImage = VK_NULL_HANDLE;
+				vulkanContext.getVulkanMemoryAllocator().free(vulkanMemory);
 			}
 		}
 
-		static void destroyAndFreeVkImage(const VulkanRhi& vulkanRhi, VkImage& vkImage, VkDeviceMemory& vkDeviceMemory, VkImageView& vkImageView)
+		static void destroyAndFreeVkImage(const VulkanRhi& vulkanRhi, VkImage& vkImage, VulkanMemory& vulkanMemory, VkImageView& vkImageView)
 		{
 			if (VK_NULL_HANDLE != vkImageView)
 			{
 				vkDestroyImageView(vulkanRhi.getVulkanContext().getVkDevice(), vkImageView, vulkanRhi.getVkAllocationCallbacks());
 				vkImageView = VK_NULL_HANDLE;
 			}
-			destroyAndFreeVkImage(vulkanRhi, vkImage, vkDeviceMemory);
+			destroyAndFreeVkImage(vulkanRhi, vkImage, vulkanMemory);
 		}
 
 		static void createVkImageView(const VulkanRhi& vulkanRhi, VkImage vkImage, VkImageViewType vkImageViewType, uint32_t levelCount, uint32_t layerCount, VkFormat vkFormat, VkImageAspectFlags vkImageAspectFlags, VkImageView& vkImageView)
@@ -4495,11 +5836,8 @@ namespace VulkanRhi
 		RootSignature(VulkanRhi& vulkanRhi, const Rhi::RootSignature& rootSignature RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IRootSignature(vulkanRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mRootSignature(rootSignature),
-			mVkPipelineLayout(VK_NULL_HANDLE),
-			mVkDescriptorPool(VK_NULL_HANDLE)
+			mVkPipelineLayout(VK_NULL_HANDLE)
 		{
-			static constexpr uint32_t maxSets = 4242;	// TODO(co) We probably need to get this provided from the outside
-
 			// Copy the parameter data
 			const Rhi::Context& context = vulkanRhi.getContext();
 			const uint32_t numberOfRootParameters = mRootSignature.numberOfParameters;
@@ -4535,12 +5873,6 @@ namespace VulkanRhi
 			// Create the Vulkan descriptor set layout
 			const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 			VkDescriptorSetLayouts vkDescriptorSetLayouts;
-			uint32_t numberOfUniformTexelBuffers = 0;	// "VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER"
-			uint32_t numberOfStorageTexelBuffers = 0;	// "VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER"
-			uint32_t numberOfStorageImage = 0;			// "VK_DESCRIPTOR_TYPE_STORAGE_IMAGE"
-			uint32_t numberOfStorageBuffers = 0;		// "VK_DESCRIPTOR_TYPE_STORAGE_BUFFER"
-			uint32_t numberOfUniformBuffers = 0;		// "VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER"
-			uint32_t numberOfCombinedImageSamplers = 0;	// "VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER"
 			if (numberOfRootParameters > 0)
 			{
 				// Fill the Vulkan descriptor set layout bindings
@@ -4571,12 +5903,10 @@ namespace VulkanRhi
 									if (Rhi::DescriptorRangeType::SRV == descriptorRange->rangeType)
 									{
 										vkDescriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER;
-										++numberOfUniformTexelBuffers;
 									}
 									else
 									{
 										vkDescriptorType = VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER;
-										++numberOfStorageTexelBuffers;
 									}
 									break;
 
@@ -4586,13 +5916,11 @@ namespace VulkanRhi
 								case Rhi::ResourceType::INDIRECT_BUFFER:
 									RHI_ASSERT(vulkanRhi.getContext(), Rhi::DescriptorRangeType::SRV == descriptorRange->rangeType || Rhi::DescriptorRangeType::UAV == descriptorRange->rangeType, "Vulkan RHI implementation: Invalid descriptor range type")
 									vkDescriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-									++numberOfStorageBuffers;
 									break;
 
 								case Rhi::ResourceType::UNIFORM_BUFFER:
 									RHI_ASSERT(vulkanRhi.getContext(), Rhi::DescriptorRangeType::UBV == descriptorRange->rangeType || Rhi::DescriptorRangeType::UAV == descriptorRange->rangeType, "Vulkan RHI implementation: Invalid descriptor range type")
 									vkDescriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-									++numberOfUniformBuffers;
 									break;
 
 								case Rhi::ResourceType::TEXTURE_1D:
@@ -4606,12 +5934,10 @@ namespace VulkanRhi
 									if (Rhi::DescriptorRangeType::SRV == descriptorRange->rangeType)
 									{
 										vkDescriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-										++numberOfCombinedImageSamplers;
 									}
 									else
 									{
 										vkDescriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
-										++numberOfStorageImage;
 									}
 									break;
 
@@ -4740,84 +6066,6 @@ namespace VulkanRhi
 				}
 			}
 
-			{ // Create the Vulkan descriptor pool
-				typedef std::array<VkDescriptorPoolSize, 3> VkDescriptorPoolSizes;
-				VkDescriptorPoolSizes vkDescriptorPoolSizes;
-				uint32_t numberOfVkDescriptorPoolSizes = 0;
-
-				// "VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER"
-				if (numberOfCombinedImageSamplers > 0)
-				{
-					VkDescriptorPoolSize& vkDescriptorPoolSize = vkDescriptorPoolSizes[numberOfVkDescriptorPoolSizes];
-					vkDescriptorPoolSize.type			 = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;	// type (VkDescriptorType)
-					vkDescriptorPoolSize.descriptorCount = maxSets * numberOfCombinedImageSamplers;		// descriptorCount (uint32_t)
-					++numberOfVkDescriptorPoolSizes;
-				}
-
-				// "VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER"
-				if (numberOfUniformTexelBuffers > 0)
-				{
-					VkDescriptorPoolSize& vkDescriptorPoolSize = vkDescriptorPoolSizes[numberOfVkDescriptorPoolSizes];
-					vkDescriptorPoolSize.type			 = VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER;	// type (VkDescriptorType)
-					vkDescriptorPoolSize.descriptorCount = maxSets * numberOfUniformTexelBuffers;	// descriptorCount (uint32_t)
-					++numberOfVkDescriptorPoolSizes;
-				}
-
-				// "VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER"
-				if (numberOfStorageTexelBuffers > 0)
-				{
-					VkDescriptorPoolSize& vkDescriptorPoolSize = vkDescriptorPoolSizes[numberOfVkDescriptorPoolSizes];
-					vkDescriptorPoolSize.type			 = VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER;	// type (VkDescriptorType)
-					vkDescriptorPoolSize.descriptorCount = maxSets * numberOfStorageTexelBuffers;	// descriptorCount (uint32_t)
-					++numberOfVkDescriptorPoolSizes;
-				}
-
-				// "VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER"
-				if (numberOfUniformBuffers > 0)
-				{
-					VkDescriptorPoolSize& vkDescriptorPoolSize = vkDescriptorPoolSizes[numberOfVkDescriptorPoolSizes];
-					vkDescriptorPoolSize.type			 = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;	// type (VkDescriptorType)
-					vkDescriptorPoolSize.descriptorCount = maxSets * numberOfUniformBuffers;	// descriptorCount (uint32_t)
-					++numberOfVkDescriptorPoolSizes;
-				}
-
-				// "VK_DESCRIPTOR_TYPE_STORAGE_IMAGE"
-				if (numberOfStorageImage > 0)
-				{
-					VkDescriptorPoolSize& vkDescriptorPoolSize = vkDescriptorPoolSizes[numberOfVkDescriptorPoolSizes];
-					vkDescriptorPoolSize.type			 = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;	// type (VkDescriptorType)
-					vkDescriptorPoolSize.descriptorCount = maxSets * numberOfStorageImage;		// descriptorCount (uint32_t)
-					++numberOfVkDescriptorPoolSizes;
-				}
-
-				// "VK_DESCRIPTOR_TYPE_STORAGE_BUFFER"
-				if (numberOfStorageBuffers > 0)
-				{
-					VkDescriptorPoolSize& vkDescriptorPoolSize = vkDescriptorPoolSizes[numberOfVkDescriptorPoolSizes];
-					vkDescriptorPoolSize.type			 = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;	// type (VkDescriptorType)
-					vkDescriptorPoolSize.descriptorCount = maxSets * numberOfStorageBuffers;	// descriptorCount (uint32_t)
-					++numberOfVkDescriptorPoolSizes;
-				}
-
-				// Create the Vulkan descriptor pool
-				if (numberOfVkDescriptorPoolSizes > 0)
-				{
-					const VkDescriptorPoolCreateInfo VkDescriptorPoolCreateInfo =
-					{
-						VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO,		// sType (VkStructureType)
-						nullptr,											// pNext (const void*)
-						VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT,	// flags (VkDescriptorPoolCreateFlags)
-						maxSets,											// maxSets (uint32_t)
-						numberOfVkDescriptorPoolSizes,						// poolSizeCount (uint32_t)
-						vkDescriptorPoolSizes.data()						// pPoolSizes (const VkDescriptorPoolSize*)
-					};
-					if (vkCreateDescriptorPool(vkDevice, &VkDescriptorPoolCreateInfo, vulkanRhi.getVkAllocationCallbacks(), &mVkDescriptorPool) != VK_SUCCESS)
-					{
-						RHI_LOG(vulkanRhi.getContext(), CRITICAL, "Failed to create the Vulkan descriptor pool")
-					}
-				}
-			}
-
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
 				if (nullptr != vkDebugMarkerSetObjectNameEXT)
@@ -4828,7 +6076,6 @@ namespace VulkanRhi
 						Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_LAYOUT_EXT, (uint64_t)vkDescriptorSetLayout, detailedDebugName);
 					}
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_PIPELINE_LAYOUT_EXT, (uint64_t)mVkPipelineLayout, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_POOL_EXT, (uint64_t)mVkDescriptorPool, detailedDebugName);
 				}
 			#endif
 		}
@@ -4842,12 +6089,6 @@ namespace VulkanRhi
 			const VulkanRhi& vulkanRhi = static_cast<VulkanRhi&>(getRhi());
 			const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 
-			// Destroy the Vulkan descriptor pool
-			if (VK_NULL_HANDLE != mVkDescriptorPool)
-			{
-				vkDestroyDescriptorPool(vkDevice, mVkDescriptorPool, vulkanRhi.getVkAllocationCallbacks());
-			}
-
 			// Destroy the Vulkan pipeline layout
 			if (VK_NULL_HANDLE != mVkPipelineLayout)
 			{
@@ -4904,18 +6145,6 @@ namespace VulkanRhi
 			return mVkPipelineLayout;
 		}
 
-		/**
-		*  @brief
-		*    Return the Vulkan descriptor pool
-		*
-		*  @return
-		*    The Vulkan descriptor pool
-		*/
-		[[nodiscard]] inline VkDescriptorPool getVkDescriptorPool() const
-		{
-			return mVkDescriptorPool;
-		}
-
 
 	//[-------------------------------------------------------]
 	//[ Public virtual Rhi::IRootSignature methods            ]
@@ -4956,7 +6185,6 @@ namespace VulkanRhi
 		Rhi::RootSignature	   mRootSignature;
 		VkDescriptorSetLayouts mVkDescriptorSetLayouts;
 		VkPipelineLayout	   mVkPipelineLayout;
-		VkDescriptorPool	   mVkDescriptorPool;
 
 
 	};
@@ -4997,14 +6225,14 @@ namespace VulkanRhi
 		VertexBuffer(VulkanRhi& vulkanRhi, uint32_t numberOfBytes, const void* data, uint32_t bufferFlags, [[maybe_unused]] Rhi::BufferUsage bufferUsage RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IVertexBuffer(vulkanRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mVkBuffer(VK_NULL_HANDLE),
-			mVkDeviceMemory(VK_NULL_HANDLE)
+			mVulkanMemory()
 		{
 			int vkBufferUsageFlagBits = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
 			if ((bufferFlags & Rhi::BufferFlag::UNORDERED_ACCESS) != 0 || (bufferFlags & Rhi::BufferFlag::SHADER_RESOURCE) != 0)
 			{
 				vkBufferUsageFlagBits |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
 			}
-			Helper::createAndAllocateVkBuffer(vulkanRhi, static_cast<VkBufferUsageFlagBits>(vkBufferUsageFlagBits), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVkDeviceMemory);
+			Helper::createAndAllocateVkBuffer(vulkanRhi, static_cast<VkBufferUsageFlagBits>(vkBufferUsageFlagBits), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVulkanMemory);
 
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -5013,7 +6241,10 @@ namespace VulkanRhi
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "VBO", 6)	// 6 = "VBO: " including terminating zero
 					const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT, (uint64_t)mVkBuffer, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVkDeviceMemory, detailedDebugName);
+					if (mVulkanMemory.isDedicated())
+					{
+						Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVulkanMemory.vkDeviceMemory, detailedDebugName);
+					}
 				}
 			#endif
 		}
@@ -5024,7 +6255,7 @@ namespace VulkanRhi
 		*/
 		inline virtual ~VertexBuffer() override
 		{
-			Helper::destroyAndFreeVkBuffer(static_cast<const VulkanRhi&>(getRhi()), mVkBuffer, mVkDeviceMemory);
+			Helper::destroyAndFreeVkBuffer(static_cast<const VulkanRhi&>(getRhi()), mVkBuffer, mVulkanMemory);
 		}
 
 		/**
@@ -5041,14 +6272,14 @@ namespace VulkanRhi
 
 		/**
 		*  @brief
-		*    Return the Vulkan device memory
+		*    Return the sub-allocated Vulkan memory
 		*
 		*  @return
-		*    The Vulkan device memory
+		*    The sub-allocated Vulkan memory
 		*/
-		[[nodiscard]] inline VkDeviceMemory getVkDeviceMemory() const
+		[[nodiscard]] inline const VulkanMemory& getVulkanMemory() const
 		{
-			return mVkDeviceMemory;
+			return mVulkanMemory;
 		}
 
 
@@ -5075,7 +6306,7 @@ namespace VulkanRhi
 	//[-------------------------------------------------------]
 	private:
 		VkBuffer	   mVkBuffer;		///< Vulkan vertex buffer
-		VkDeviceMemory mVkDeviceMemory;	///< Vulkan vertex memory
+		VulkanMemory mVulkanMemory;	///< Vulkan vertex memory
 
 
 	};
@@ -5119,14 +6350,14 @@ namespace VulkanRhi
 			IIndexBuffer(vulkanRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mVkIndexType(Mapping::getVulkanType(vulkanRhi.getContext(), indexBufferFormat)),
 			mVkBuffer(VK_NULL_HANDLE),
-			mVkDeviceMemory(VK_NULL_HANDLE)
+			mVulkanMemory()
 		{
 			int vkBufferUsageFlagBits = VK_BUFFER_USAGE_INDEX_BUFFER_BIT;
 			if ((bufferFlags & Rhi::BufferFlag::UNORDERED_ACCESS) != 0 || (bufferFlags & Rhi::BufferFlag::SHADER_RESOURCE) != 0)
 			{
 				vkBufferUsageFlagBits |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
 			}
-			Helper::createAndAllocateVkBuffer(vulkanRhi, static_cast<VkBufferUsageFlagBits>(vkBufferUsageFlagBits), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVkDeviceMemory);
+			Helper::createAndAllocateVkBuffer(vulkanRhi, static_cast<VkBufferUsageFlagBits>(vkBufferUsageFlagBits), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVulkanMemory);
 
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -5135,7 +6366,10 @@ namespace VulkanRhi
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "IBO", 6)	// 6 = "IBO: " including terminating zero
 					const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT, (uint64_t)mVkBuffer, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVkDeviceMemory, detailedDebugName);
+					if (mVulkanMemory.isDedicated())
+					{
+						Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVulkanMemory.vkDeviceMemory, detailedDebugName);
+					}
 				}
 			#endif
 		}
@@ -5146,7 +6380,7 @@ namespace VulkanRhi
 		*/
 		inline virtual ~IndexBuffer() override
 		{
-			Helper::destroyAndFreeVkBuffer(static_cast<const VulkanRhi&>(getRhi()), mVkBuffer, mVkDeviceMemory);
+			Helper::destroyAndFreeVkBuffer(static_cast<const VulkanRhi&>(getRhi()), mVkBuffer, mVulkanMemory);
 		}
 
 		/**
@@ -5175,14 +6409,14 @@ namespace VulkanRhi
 
 		/**
 		*  @brief
-		*    Return the Vulkan device memory
+		*    Return the sub-allocated Vulkan memory
 		*
 		*  @return
-		*    The Vulkan device memory
+		*    The sub-allocated Vulkan memory
 		*/
-		[[nodiscard]] inline VkDeviceMemory getVkDeviceMemory() const
+		[[nodiscard]] inline const VulkanMemory& getVulkanMemory() const
 		{
-			return mVkDeviceMemory;
+			return mVulkanMemory;
 		}
 
 
@@ -5210,7 +6444,7 @@ namespace VulkanRhi
 	private:
 		VkIndexType	   mVkIndexType;	///< Vulkan vertex type
 		VkBuffer	   mVkBuffer;		///< Vulkan vertex buffer
-		VkDeviceMemory mVkDeviceMemory;	///< Vulkan vertex memory
+		VulkanMemory mVulkanMemory;	///< Vulkan vertex memory
 
 
 	};
@@ -5452,7 +6686,7 @@ namespace VulkanRhi
 		TextureBuffer(VulkanRhi& vulkanRhi, uint32_t numberOfBytes, const void* data, uint32_t bufferFlags, [[maybe_unused]] Rhi::BufferUsage bufferUsage, Rhi::TextureFormat::Enum textureFormat RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			ITextureBuffer(vulkanRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mVkBuffer(VK_NULL_HANDLE),
-			mVkDeviceMemory(VK_NULL_HANDLE),
+			mVulkanMemory(),
 			mVkBufferView(VK_NULL_HANDLE)
 		{
 			// Sanity check
@@ -5468,7 +6702,7 @@ namespace VulkanRhi
 			{
 				vkBufferUsageFlagBits |= VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT;
 			}
-			Helper::createAndAllocateVkBuffer(vulkanRhi, static_cast<VkBufferUsageFlagBits>(vkBufferUsageFlagBits), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVkDeviceMemory);
+			Helper::createAndAllocateVkBuffer(vulkanRhi, static_cast<VkBufferUsageFlagBits>(vkBufferUsageFlagBits), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVulkanMemory);
 
 			// Create Vulkan buffer view
 			if ((bufferFlags & Rhi::BufferFlag::SHADER_RESOURCE) != 0 || (bufferFlags & Rhi::BufferFlag::UNORDERED_ACCESS) != 0)
@@ -5496,7 +6730,10 @@ namespace VulkanRhi
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "TBO", 6)	// 6 = "TBO: " including terminating zero
 					const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT, (uint64_t)mVkBuffer, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVkDeviceMemory, detailedDebugName);
+					if (mVulkanMemory.isDedicated())
+					{
+						Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVulkanMemory.vkDeviceMemory, detailedDebugName);
+					}
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_VIEW_EXT, (uint64_t)mVkBufferView, detailedDebugName);
 				}
 			#endif
@@ -5513,7 +6750,7 @@ namespace VulkanRhi
 			{
 				vkDestroyBufferView(vulkanRhi.getVulkanContext().getVkDevice(), mVkBufferView, vulkanRhi.getVkAllocationCallbacks());
 			}
-			Helper::destroyAndFreeVkBuffer(vulkanRhi, mVkBuffer, mVkDeviceMemory);
+			Helper::destroyAndFreeVkBuffer(vulkanRhi, mVkBuffer, mVulkanMemory);
 		}
 
 		/**
@@ -5530,14 +6767,14 @@ namespace VulkanRhi
 
 		/**
 		*  @brief
-		*    Return the Vulkan device memory
+		*    Return the sub-allocated Vulkan memory
 		*
 		*  @return
-		*    The Vulkan device memory
+		*    The sub-allocated Vulkan memory
 		*/
-		[[nodiscard]] inline VkDeviceMemory getVkDeviceMemory() const
+		[[nodiscard]] inline const VulkanMemory& getVulkanMemory() const
 		{
-			return mVkDeviceMemory;
+			return mVulkanMemory;
 		}
 
 		/**
@@ -5576,7 +6813,7 @@ namespace VulkanRhi
 	//[-------------------------------------------------------]
 	private:
 		VkBuffer	   mVkBuffer;		///< Vulkan uniform texel buffer
-		VkDeviceMemory mVkDeviceMemory;	///< Vulkan uniform texel memory
+		VulkanMemory mVulkanMemory;	///< Vulkan uniform texel memory
 		VkBufferView   mVkBufferView;	///< Vulkan buffer view
 
 
@@ -5618,14 +6855,14 @@ namespace VulkanRhi
 		StructuredBuffer(VulkanRhi& vulkanRhi, uint32_t numberOfBytes, const void* data, [[maybe_unused]] Rhi::BufferUsage bufferUsage, [[maybe_unused]] uint32_t numberOfStructureBytes RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IStructuredBuffer(vulkanRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mVkBuffer(VK_NULL_HANDLE),
-			mVkDeviceMemory(VK_NULL_HANDLE)
+			mVulkanMemory()
 		{
 			// Sanity checks
 			RHI_ASSERT(vulkanRhi.getContext(), (numberOfBytes % numberOfStructureBytes) == 0, "The Vulkan structured buffer size must be a multiple of the given number of structure bytes")
 			RHI_ASSERT(vulkanRhi.getContext(), (numberOfBytes % (sizeof(float) * 4)) == 0, "Performance: The Vulkan structured buffer should be aligned to a 128-bit stride, see \"Understanding Structured Buffer Performance\" by Evan Hart, posted Apr 17 2015 at 11:33AM - https://developer.nvidia.com/content/understanding-structured-buffer-performance")
 
 			// Create the structured buffer
-			Helper::createAndAllocateVkBuffer(vulkanRhi, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVkDeviceMemory);
+			Helper::createAndAllocateVkBuffer(vulkanRhi, VK_BUFFER_USAGE_STORAGE_BUFFER_BIT, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVulkanMemory);
 
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -5634,7 +6871,10 @@ namespace VulkanRhi
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "SBO", 6)	// 6 = "SBO: " including terminating zero
 					const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT, (uint64_t)mVkBuffer, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVkDeviceMemory, detailedDebugName);
+					if (mVulkanMemory.isDedicated())
+					{
+						Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVulkanMemory.vkDeviceMemory, detailedDebugName);
+					}
 				}
 			#endif
 		}
@@ -5645,7 +6885,7 @@ namespace VulkanRhi
 		*/
 		virtual ~StructuredBuffer() override
 		{
-			Helper::destroyAndFreeVkBuffer(static_cast<const VulkanRhi&>(getRhi()), mVkBuffer, mVkDeviceMemory);
+			Helper::destroyAndFreeVkBuffer(static_cast<const VulkanRhi&>(getRhi()), mVkBuffer, mVulkanMemory);
 		}
 
 		/**
@@ -5662,14 +6902,14 @@ namespace VulkanRhi
 
 		/**
 		*  @brief
-		*    Return the Vulkan device memory
+		*    Return the sub-allocated Vulkan memory
 		*
 		*  @return
-		*    The Vulkan device memory
+		*    The sub-allocated Vulkan memory
 		*/
-		[[nodiscard]] inline VkDeviceMemory getVkDeviceMemory() const
+		[[nodiscard]] inline const VulkanMemory& getVulkanMemory() const
 		{
-			return mVkDeviceMemory;
+			return mVulkanMemory;
 		}
 
 
@@ -5696,7 +6936,7 @@ namespace VulkanRhi
 	//[-------------------------------------------------------]
 	private:
 		VkBuffer	   mVkBuffer;		///< Vulkan uniform texel buffer
-		VkDeviceMemory mVkDeviceMemory;	///< Vulkan uniform texel memory
+		VulkanMemory mVulkanMemory;	///< Vulkan uniform texel memory
 
 
 	};
@@ -5737,7 +6977,7 @@ namespace VulkanRhi
 		IndirectBuffer(VulkanRhi& vulkanRhi, uint32_t numberOfBytes, const void* data, uint32_t indirectBufferFlags, [[maybe_unused]] Rhi::BufferUsage bufferUsage RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IIndirectBuffer(vulkanRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mVkBuffer(VK_NULL_HANDLE),
-			mVkDeviceMemory(VK_NULL_HANDLE)
+			mVulkanMemory()
 		{
 			// Sanity checks
 			RHI_ASSERT(vulkanRhi.getContext(), (indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_ARGUMENTS) != 0 || (indirectBufferFlags & Rhi::IndirectBufferFlag::DRAW_INDEXED_ARGUMENTS) != 0, "Invalid Vulkan flags, indirect buffer element type specification \"DRAW_ARGUMENTS\" or \"DRAW_INDEXED_ARGUMENTS\" is missing")
@@ -5751,7 +6991,7 @@ namespace VulkanRhi
 			{
 				vkBufferUsageFlagBits |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
 			}
-			Helper::createAndAllocateVkBuffer(vulkanRhi, static_cast<VkBufferUsageFlagBits>(vkBufferUsageFlagBits), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVkDeviceMemory);
+			Helper::createAndAllocateVkBuffer(vulkanRhi, static_cast<VkBufferUsageFlagBits>(vkBufferUsageFlagBits), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVulkanMemory);
 
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -5760,7 +7000,10 @@ namespace VulkanRhi
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "IndirectBufferObject", 23)	// 23 = "IndirectBufferObject: " including terminating zero
 					const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT, (uint64_t)mVkBuffer, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVkDeviceMemory, detailedDebugName);
+					if (mVulkanMemory.isDedicated())
+					{
+						Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVulkanMemory.vkDeviceMemory, detailedDebugName);
+					}
 				}
 			#endif
 		}
@@ -5771,7 +7014,7 @@ namespace VulkanRhi
 		*/
 		inline virtual ~IndirectBuffer() override
 		{
-			Helper::destroyAndFreeVkBuffer(static_cast<const VulkanRhi&>(getRhi()), mVkBuffer, mVkDeviceMemory);
+			Helper::destroyAndFreeVkBuffer(static_cast<const VulkanRhi&>(getRhi()), mVkBuffer, mVulkanMemory);
 		}
 
 		/**
@@ -5788,14 +7031,14 @@ namespace VulkanRhi
 
 		/**
 		*  @brief
-		*    Return the Vulkan device memory
+		*    Return the sub-allocated Vulkan memory
 		*
 		*  @return
-		*    The Vulkan device memory
+		*    The sub-allocated Vulkan memory
 		*/
-		[[nodiscard]] inline VkDeviceMemory getVkDeviceMemory() const
+		[[nodiscard]] inline const VulkanMemory& getVulkanMemory() const
 		{
-			return mVkDeviceMemory;
+			return mVulkanMemory;
 		}
 
 
@@ -5832,7 +7075,7 @@ namespace VulkanRhi
 	//[-------------------------------------------------------]
 	private:
 		VkBuffer	   mVkBuffer;		///< Vulkan indirect buffer
-		VkDeviceMemory mVkDeviceMemory;	///< Vulkan indirect memory
+		VulkanMemory mVulkanMemory;	///< Vulkan indirect memory
 
 
 	};
@@ -5871,9 +7114,9 @@ namespace VulkanRhi
 		UniformBuffer(VulkanRhi& vulkanRhi, uint32_t numberOfBytes, const void* data, [[maybe_unused]] Rhi::BufferUsage bufferUsage RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IUniformBuffer(vulkanRhi RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mVkBuffer(VK_NULL_HANDLE),
-			mVkDeviceMemory(VK_NULL_HANDLE)
+			mVulkanMemory()
 		{
-			Helper::createAndAllocateVkBuffer(vulkanRhi, static_cast<VkBufferUsageFlagBits>(VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVkDeviceMemory);
+			Helper::createAndAllocateVkBuffer(vulkanRhi, static_cast<VkBufferUsageFlagBits>(VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT), VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT, numberOfBytes, data, mVkBuffer, mVulkanMemory);
 
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -5882,7 +7125,10 @@ namespace VulkanRhi
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "UBO", 6)	// 6 = "UBO: " including terminating zero
 					const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT, (uint64_t)mVkBuffer, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVkDeviceMemory, detailedDebugName);
+					if (mVulkanMemory.isDedicated())
+					{
+						Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVulkanMemory.vkDeviceMemory, detailedDebugName);
+					}
 				}
 			#endif
 		}
@@ -5893,7 +7139,7 @@ namespace VulkanRhi
 		*/
 		inline virtual ~UniformBuffer() override
 		{
-			Helper::destroyAndFreeVkBuffer(static_cast<const VulkanRhi&>(getRhi()), mVkBuffer, mVkDeviceMemory);
+			Helper::destroyAndFreeVkBuffer(static_cast<const VulkanRhi&>(getRhi()), mVkBuffer, mVulkanMemory);
 		}
 
 		/**
@@ -5910,14 +7156,14 @@ namespace VulkanRhi
 
 		/**
 		*  @brief
-		*    Return the Vulkan device memory
+		*    Return the sub-allocated Vulkan memory
 		*
 		*  @return
-		*    The Vulkan device memory
+		*    The sub-allocated Vulkan memory
 		*/
-		[[nodiscard]] inline VkDeviceMemory getVkDeviceMemory() const
+		[[nodiscard]] inline const VulkanMemory& getVulkanMemory() const
 		{
-			return mVkDeviceMemory;
+			return mVulkanMemory;
 		}
 
 
@@ -5944,7 +7190,7 @@ namespace VulkanRhi
 	//[-------------------------------------------------------]
 	private:
 		VkBuffer	   mVkBuffer;		///< Vulkan uniform buffer
-		VkDeviceMemory mVkDeviceMemory;	///< Vulkan uniform memory
+		VulkanMemory mVulkanMemory;	///< Vulkan uniform memory
 
 
 	};
@@ -6130,10 +7376,10 @@ namespace VulkanRhi
 			ITexture1D(vulkanRhi, width RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mVkImage(VK_NULL_HANDLE),
 			mVkImageLayout(Helper::getVkImageLayoutByTextureFlags(textureFlags)),
-			mVkDeviceMemory(VK_NULL_HANDLE),
+			mVulkanMemory(),
 			mVkImageView(VK_NULL_HANDLE)
 		{
-			Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_1D, VK_IMAGE_VIEW_TYPE_1D, { width, 1, 1 }, textureFormat, data, textureFlags, 1, mVkImage, mVkDeviceMemory, mVkImageView);
+			Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_1D, VK_IMAGE_VIEW_TYPE_1D, { width, 1, 1 }, textureFormat, data, textureFlags, 1, mVkImage, mVulkanMemory, mVkImageView);
 
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -6142,7 +7388,10 @@ namespace VulkanRhi
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "1D texture", 13)	// 13 = "1D texture: " including terminating zero
 					const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT, (uint64_t)mVkImage, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVkDeviceMemory, detailedDebugName);
+					if (mVulkanMemory.isDedicated())
+					{
+						Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVulkanMemory.vkDeviceMemory, detailedDebugName);
+					}
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_VIEW_EXT, (uint64_t)mVkImageView, detailedDebugName);
 				}
 			#endif
@@ -6154,7 +7403,7 @@ namespace VulkanRhi
 		*/
 		inline virtual ~Texture1D() override
 		{
-			Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mVkImage, mVkDeviceMemory, mVkImageView);
+			Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mVkImage, mVulkanMemory, mVkImageView);
 		}
 
 		/**
@@ -6206,7 +7455,7 @@ namespace VulkanRhi
 	private:
 		VkImage		   mVkImage;
 		VkImageLayout  mVkImageLayout;
-		VkDeviceMemory mVkDeviceMemory;
+		VulkanMemory mVulkanMemory;
 		VkImageView	   mVkImageView;
 
 
@@ -6251,9 +7500,9 @@ namespace VulkanRhi
 			ITexture1DArray(vulkanRhi, width, numberOfSlices RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mVkImage(VK_NULL_HANDLE),
 			mVkImageLayout(Helper::getVkImageLayoutByTextureFlags(textureFlags)),
-			mVkDeviceMemory(VK_NULL_HANDLE),
+			mVulkanMemory(),
 			mVkImageView(VK_NULL_HANDLE),
-			mVkFormat(Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_1D, VK_IMAGE_VIEW_TYPE_1D_ARRAY, { width, 1, numberOfSlices }, textureFormat, data, textureFlags, 1, mVkImage, mVkDeviceMemory, mVkImageView))
+			mVkFormat(Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_1D, VK_IMAGE_VIEW_TYPE_1D_ARRAY, { width, 1, numberOfSlices }, textureFormat, data, textureFlags, 1, mVkImage, mVulkanMemory, mVkImageView))
 		{
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -6262,7 +7511,10 @@ namespace VulkanRhi
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "1D texture array", 19)	// 19 = "1D texture array: " including terminating zero
 					const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT, (uint64_t)mVkImage, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVkDeviceMemory, detailedDebugName);
+					if (mVulkanMemory.isDedicated())
+					{
+						Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVulkanMemory.vkDeviceMemory, detailedDebugName);
+					}
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_VIEW_EXT, (uint64_t)mVkImageView, detailedDebugName);
 				}
 			#endif
@@ -6274,7 +7526,7 @@ namespace VulkanRhi
 		*/
 		inline virtual ~Texture1DArray() override
 		{
-			Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mVkImage, mVkDeviceMemory, mVkImageView);
+			Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mVkImage, mVulkanMemory, mVkImageView);
 		}
 
 		/**
@@ -6338,7 +7590,7 @@ namespace VulkanRhi
 	private:
 		VkImage		   mVkImage;
 		VkImageLayout  mVkImageLayout;
-		VkDeviceMemory mVkDeviceMemory;
+		VulkanMemory mVulkanMemory;
 		VkImageView	   mVkImageView;
 		VkFormat	   mVkFormat;
 
@@ -6407,10 +7659,10 @@ namespace VulkanRhi
 			ITexture2D(vulkanRhi, width, height RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mVrVulkanTextureData{},
 			mVkImageLayout(Helper::getVkImageLayoutByTextureFlags(textureFlags)),
-			mVkDeviceMemory(VK_NULL_HANDLE),
+			mVulkanMemory(),
 			mVkImageView(VK_NULL_HANDLE)
 		{
-			mVrVulkanTextureData.m_nFormat = Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_2D, VK_IMAGE_VIEW_TYPE_2D, { width, height, 1 }, textureFormat, data, textureFlags, numberOfMultisamples, mVrVulkanTextureData.m_nImage, mVkDeviceMemory, mVkImageView);
+			mVrVulkanTextureData.m_nFormat = Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_2D, VK_IMAGE_VIEW_TYPE_2D, { width, height, 1 }, textureFormat, data, textureFlags, numberOfMultisamples, mVrVulkanTextureData.m_nImage, mVulkanMemory, mVkImageView);
 
 			// Fill the rest of the "VRVulkanTextureData_t"-structure
 			const VulkanContext& vulkanContext = vulkanRhi.getVulkanContext();
@@ -6433,7 +7685,10 @@ namespace VulkanRhi
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "2D texture", 13)	// 13 = "2D texture: " including terminating zero
 					const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT, (uint64_t)mVrVulkanTextureData.m_nImage, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVkDeviceMemory, detailedDebugName);
+					if (mVulkanMemory.isDedicated())
+					{
+						Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVulkanMemory.vkDeviceMemory, detailedDebugName);
+					}
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_VIEW_EXT, (uint64_t)mVkImageView, detailedDebugName);
 				}
 			#endif
@@ -6445,7 +7700,7 @@ namespace VulkanRhi
 		*/
 		inline virtual ~Texture2D() override
 		{
-			Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mVrVulkanTextureData.m_nImage, mVkDeviceMemory, mVkImageView);
+			Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mVrVulkanTextureData.m_nImage, mVulkanMemory, mVkImageView);
 		}
 
 		/**
@@ -6533,7 +7788,7 @@ namespace VulkanRhi
 	private:
 		VRVulkanTextureData_t mVrVulkanTextureData;
 		VkImageLayout		  mVkImageLayout;
-		VkDeviceMemory		  mVkDeviceMemory;
+		VulkanMemory		  mVulkanMemory;
 		VkImageView			  mVkImageView;
 
 
@@ -6580,9 +7835,9 @@ namespace VulkanRhi
 			ITexture2DArray(vulkanRhi, width, height, numberOfSlices RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mVkImage(VK_NULL_HANDLE),
 			mVkImageLayout(Helper::getVkImageLayoutByTextureFlags(textureFlags)),
-			mVkDeviceMemory(VK_NULL_HANDLE),
+			mVulkanMemory(),
 			mVkImageView(VK_NULL_HANDLE),
-			mVkFormat(Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_2D, VK_IMAGE_VIEW_TYPE_2D_ARRAY, { width, height, numberOfSlices }, textureFormat, data, textureFlags, 1, mVkImage, mVkDeviceMemory, mVkImageView))
+			mVkFormat(Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_2D, VK_IMAGE_VIEW_TYPE_2D_ARRAY, { width, height, numberOfSlices }, textureFormat, data, textureFlags, 1, mVkImage, mVulkanMemory, mVkImageView))
 		{
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -6591,7 +7846,10 @@ namespace VulkanRhi
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "2D texture array", 19)	// 19 = "2D texture array: " including terminating zero
 					const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT, (uint64_t)mVkImage, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVkDeviceMemory, detailedDebugName);
+					if (mVulkanMemory.isDedicated())
+					{
+						Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVulkanMemory.vkDeviceMemory, detailedDebugName);
+					}
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_VIEW_EXT, (uint64_t)mVkImageView, detailedDebugName);
 				}
 			#endif
@@ -6603,7 +7861,7 @@ namespace VulkanRhi
 		*/
 		inline virtual ~Texture2DArray() override
 		{
-			Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mVkImage, mVkDeviceMemory, mVkImageView);
+			Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mVkImage, mVulkanMemory, mVkImageView);
 		}
 
 		/**
@@ -6667,7 +7925,7 @@ namespace VulkanRhi
 	private:
 		VkImage		   mVkImage;
 		VkImageLayout  mVkImageLayout;
-		VkDeviceMemory mVkDeviceMemory;
+		VulkanMemory mVulkanMemory;
 		VkImageView	   mVkImageView;
 		VkFormat	   mVkFormat;
 
@@ -6715,10 +7973,10 @@ namespace VulkanRhi
 			ITexture3D(vulkanRhi, width, height, depth RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mVkImage(VK_NULL_HANDLE),
 			mVkImageLayout(Helper::getVkImageLayoutByTextureFlags(textureFlags)),
-			mVkDeviceMemory(VK_NULL_HANDLE),
+			mVulkanMemory(),
 			mVkImageView(VK_NULL_HANDLE)
 		{
-			Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_3D, VK_IMAGE_VIEW_TYPE_3D, { width, height, depth }, textureFormat, data, textureFlags, 1, mVkImage, mVkDeviceMemory, mVkImageView);
+			Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_3D, VK_IMAGE_VIEW_TYPE_3D, { width, height, depth }, textureFormat, data, textureFlags, 1, mVkImage, mVulkanMemory, mVkImageView);
 
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -6727,7 +7985,10 @@ namespace VulkanRhi
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "3D texture", 13)	// 13 = "3D texture: " including terminating zero
 					const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT, (uint64_t)mVkImage, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVkDeviceMemory, detailedDebugName);
+					if (mVulkanMemory.isDedicated())
+					{
+						Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVulkanMemory.vkDeviceMemory, detailedDebugName);
+					}
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_VIEW_EXT, (uint64_t)mVkImageView, detailedDebugName);
 				}
 			#endif
@@ -6739,7 +8000,7 @@ namespace VulkanRhi
 		*/
 		inline virtual ~Texture3D() override
 		{
-			Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mVkImage, mVkDeviceMemory, mVkImageView);
+			Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mVkImage, mVulkanMemory, mVkImageView);
 		}
 
 		/**
@@ -6791,7 +8052,7 @@ namespace VulkanRhi
 	private:
 		VkImage		   mVkImage;
 		VkImageLayout  mVkImageLayout;
-		VkDeviceMemory mVkDeviceMemory;
+		VulkanMemory mVulkanMemory;
 		VkImageView	   mVkImageView;
 
 
@@ -6834,10 +8095,10 @@ namespace VulkanRhi
 			ITextureCube(vulkanRhi, width RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mVkImage(VK_NULL_HANDLE),
 			mVkImageLayout(Helper::getVkImageLayoutByTextureFlags(textureFlags)),
-			mVkDeviceMemory(VK_NULL_HANDLE),
+			mVulkanMemory(),
 			mVkImageView(VK_NULL_HANDLE)
 		{
-			Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_2D, VK_IMAGE_VIEW_TYPE_CUBE, { width, width, 6 }, textureFormat, data, textureFlags, 1, mVkImage, mVkDeviceMemory, mVkImageView);
+			Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_2D, VK_IMAGE_VIEW_TYPE_CUBE, { width, width, 6 }, textureFormat, data, textureFlags, 1, mVkImage, mVulkanMemory, mVkImageView);
 
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -6846,7 +8107,10 @@ namespace VulkanRhi
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "Cube texture", 15)	// 15 = "Cube texture: " including terminating zero
 					const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT, (uint64_t)mVkImage, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVkDeviceMemory, detailedDebugName);
+					if (mVulkanMemory.isDedicated())
+					{
+						Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVulkanMemory.vkDeviceMemory, detailedDebugName);
+					}
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_VIEW_EXT, (uint64_t)mVkImageView, detailedDebugName);
 				}
 			#endif
@@ -6858,7 +8122,7 @@ namespace VulkanRhi
 		*/
 		inline virtual ~TextureCube() override
 		{
-			Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mVkImage, mVkDeviceMemory, mVkImageView);
+			Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mVkImage, mVulkanMemory, mVkImageView);
 		}
 
 		/**
@@ -6910,7 +8174,7 @@ namespace VulkanRhi
 	private:
 		VkImage		   mVkImage;
 		VkImageLayout  mVkImageLayout;
-		VkDeviceMemory mVkDeviceMemory;
+		VulkanMemory mVulkanMemory;
 		VkImageView	   mVkImageView;
 
 
@@ -6955,10 +8219,10 @@ namespace VulkanRhi
 			ITextureCubeArray(vulkanRhi, width, numberOfSlices RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mVkImage(VK_NULL_HANDLE),
 			mVkImageLayout(Helper::getVkImageLayoutByTextureFlags(textureFlags)),
-			mVkDeviceMemory(VK_NULL_HANDLE),
+			mVulkanMemory(),
 			mVkImageView(VK_NULL_HANDLE)
 		{
-			Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_2D, VK_IMAGE_VIEW_TYPE_CUBE_ARRAY, { width, width, numberOfSlices * 6 }, textureFormat, data, textureFlags, 1, mVkImage, mVkDeviceMemory, mVkImageView);
+			Helper::createAndFillVkImage(vulkanRhi, VK_IMAGE_TYPE_2D, VK_IMAGE_VIEW_TYPE_CUBE_ARRAY, { width, width, numberOfSlices * 6 }, textureFormat, data, textureFlags, 1, mVkImage, mVulkanMemory, mVkImageView);
 
 			// Assign a default name to the resource for debugging purposes
 			#ifdef RHI_DEBUG
@@ -6967,7 +8231,10 @@ namespace VulkanRhi
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "Cube texture array", 21)	// 21 = "Cube texture array: " including terminating zero
 					const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT, (uint64_t)mVkImage, detailedDebugName);
-					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVkDeviceMemory, detailedDebugName);
+					if (mVulkanMemory.isDedicated())
+					{
+						Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT, (uint64_t)mVulkanMemory.vkDeviceMemory, detailedDebugName);
+					}
 					Helper::setDebugObjectName(vkDevice, VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_VIEW_EXT, (uint64_t)mVkImageView, detailedDebugName);
 				}
 			#endif
@@ -6979,7 +8246,7 @@ namespace VulkanRhi
 		*/
 		inline virtual ~TextureCubeArray() override
 		{
-			Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mVkImage, mVkDeviceMemory, mVkImageView);
+			Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mVkImage, mVulkanMemory, mVkImageView);
 		}
 
 		/**
@@ -7031,7 +8298,7 @@ namespace VulkanRhi
 	private:
 		VkImage		   mVkImage;
 		VkImageLayout  mVkImageLayout;
-		VkDeviceMemory mVkDeviceMemory;
+		VulkanMemory mVulkanMemory;
 		VkImageView	   mVkImageView;
 
 
@@ -7823,7 +9090,7 @@ namespace VulkanRhi
 			// Depth render target related
 			mDepthVkFormat(Mapping::getVulkanFormat(static_cast<RenderPass&>(renderPass).getDepthStencilAttachmentTextureFormat())),
 			mDepthVkImage(VK_NULL_HANDLE),
-			mDepthVkDeviceMemory(VK_NULL_HANDLE),
+			mDepthVulkanMemory(),
 			mDepthVkImageView(VK_NULL_HANDLE)
 		{
 			// Create the Vulkan presentation surface instance depending on the operation system
@@ -8042,6 +9309,9 @@ namespace VulkanRhi
 			const VulkanRhi& vulkanRhi = static_cast<VulkanRhi&>(getRhi());
 			const VulkanContext& vulkanContext = vulkanRhi.getVulkanContext();
 
+			// Submit pending resource uploads, the same queue is used so the submission order ensures they're done before the frame uses the resources
+			vulkanRhi.getVulkanUploadQueue().flush();
+
 			{ // Queue submit
 				const VkPipelineStageFlags waitDstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
 				const VkCommandBuffer vkCommandBuffer = vulkanContext.getVkCommandBuffer();
@@ -8057,6 +9327,7 @@ namespace VulkanRhi
 					1,								// signalSemaphoreCount (uint32_t)
 					&mRenderingFinishedVkSemaphore	// pSignalSemaphores (const VkSemaphore*)
 				};
+				std::lock_guard<std::mutex> vkQueueMutexLock(vulkanContext.getVkQueueMutex());
 				if (vkQueueSubmit(vulkanContext.getGraphicsVkQueue(), 1, &vkSubmitInfo, VK_NULL_HANDLE) != VK_SUCCESS)
 				{
 					// Error!
@@ -8065,6 +9336,9 @@ namespace VulkanRhi
 				}
 			}
 
+			// The frame is submitted, recycle the descriptor sets of the previous frame which was done when it was presented
+			vulkanRhi.getVulkanDescriptorAllocator().nextFrame();
+
 			{ // Queue present
 				const VkPresentInfoKHR vkPresentInfoKHR =
 				{
@@ -8077,9 +9351,11 @@ namespace VulkanRhi
 					&mCurrentImageIndex,				// pImageIndices (const uint32_t*)
 					nullptr								// pResults (VkResult*)
 				};
+				std::unique_lock<std::mutex> vkQueueMutexLock(vulkanContext.getVkQueueMutex());
 				const VkResult vkResult = vkQueuePresentKHR(vulkanContext.getPresentVkQueue(), &vkPresentInfoKHR);
 				if (VK_SUCCESS != vkResult)
 				{
+					vkQueueMutexLock.unlock();
 					if (VK_ERROR_OUT_OF_DATE_KHR == vkResult || VK_SUBOPTIMAL_KHR == vkResult)
 					{
 						// Recreate the Vulkan swap chain
@@ -8153,8 +9429,10 @@ namespace VulkanRhi
 			RHI_ASSERT(context, VK_NULL_HANDLE != vkPhysicalDevice, "Invalid physical Vulkan device")
 			RHI_ASSERT(context, VK_NULL_HANDLE != vkDevice, "Invalid Vulkan device")
 
-			// Wait for the Vulkan device to become idle
-			vkDeviceWaitIdle(vkDevice);
+			{ // Wait for the Vulkan device to become idle
+				std::lock_guard<std::mutex> vkQueueMutexLock(vulkanContext.getVkQueueMutex());
+				vkDeviceWaitIdle(vkDevice);
+			}
 
 			// Get Vulkan surface capabilities
 			VkSurfaceCapabilitiesKHR vkSurfaceCapabilitiesKHR;
@@ -8308,7 +9586,10 @@ namespace VulkanRhi
 			{
 				const VulkanRhi& vulkanRhi = static_cast<VulkanRhi&>(getRhi());
 				const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
-				vkDeviceWaitIdle(vkDevice);
+				{
+					std::lock_guard<std::mutex> vkQueueMutexLock(vulkanRhi.getVulkanContext().getVkQueueMutex());
+					vkDeviceWaitIdle(vkDevice);
+				}
 				if (VK_NULL_HANDLE != mVkRenderPass)
 				{
 					vkDestroyRenderPass(vkDevice, mVkRenderPass, vulkanRhi.getVkAllocationCallbacks());
@@ -8371,7 +9652,7 @@ namespace VulkanRhi
 			if (VK_FORMAT_UNDEFINED != mDepthVkFormat)
 			{
 				const VulkanRhi& vulkanRhi = static_cast<VulkanRhi&>(getRhi());
-				Helper::createAndAllocateVkImage(vulkanRhi, 0, VK_IMAGE_TYPE_2D, { vkExtent2D.width, vkExtent2D.height, 1 }, 1, 1, mDepthVkFormat, static_cast<RenderPass&>(getRenderPass()).getVkSampleCountFlagBits(), VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, mDepthVkImage, mDepthVkDeviceMemory);
+				Helper::createAndAllocateVkImage(vulkanRhi, 0, VK_IMAGE_TYPE_2D, { vkExtent2D.width, vkExtent2D.height, 1 }, 1, 1, mDepthVkFormat, static_cast<RenderPass&>(getRenderPass()).getVkSampleCountFlagBits(), VK_IMAGE_TILING_OPTIMAL, VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, mDepthVkImage, mDepthVulkanMemory);
 				Helper::createVkImageView(vulkanRhi, mDepthVkImage, VK_IMAGE_VIEW_TYPE_2D, 1, 1, mDepthVkFormat, VK_IMAGE_ASPECT_DEPTH_BIT, mDepthVkImageView);
 				// TODO(co) File "unrimp\source\rhi\private\vulkanrhi\vulkanrhi.cpp" | Line 1036 | Critical: Vulkan debug report callback: Object type: "VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT" Object: "103612336" Location: "0" Message code: "461375810" Layer prefix: "Validation" Message: " [ VUID-vkCmdPipelineBarrier-pMemoryBarriers-01185 ] Object: 0x62cffb0 (Type = 6) | vkCmdPipelineBarrier(): pImageMemBarriers[0].dstAccessMask (0x600) is not supported by dstStageMask (0x1). The spec valid usage text states 'Each element of pMemoryBarriers, pBufferMemoryBarriers and pImageMemoryBarriers must not have any access flag included in its dstAccessMask member if that bit is not supported by any of the pipeline stages in dstStageMask, as specified in the table of supported access types.' (https://www.khronos.org/registry/vulkan/specs/1.0/html/vkspec.html#VUID-vkCmdPipelineBarrier-pMemoryBarriers-01185)" 
 				//Helper::transitionVkImageLayout(vulkanRhi, mDepthVkImage, VK_IMAGE_ASPECT_DEPTH_BIT, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL);
@@ -8382,9 +9663,9 @@ namespace VulkanRhi
 		{
 			if (VK_NULL_HANDLE != mDepthVkImage)
 			{
-				RHI_ASSERT(getRhi().getContext(), VK_NULL_HANDLE != mDepthVkDeviceMemory, "Invalid Vulkan depth device memory")
+				RHI_ASSERT(getRhi().getContext(), VK_NULL_HANDLE != mDepthVulkanMemory.vkDeviceMemory, "Invalid Vulkan depth device memory")
 				RHI_ASSERT(getRhi().getContext(), VK_NULL_HANDLE != mDepthVkImageView, "Invalid Vulkan depth image view")
-				Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mDepthVkImage, mDepthVkDeviceMemory, mDepthVkImageView);
+				Helper::destroyAndFreeVkImage(static_cast<VulkanRhi&>(getRhi()), mDepthVkImage, mDepthVulkanMemory, mDepthVkImageView);
 			}
 		}
 
@@ -8421,7 +9702,7 @@ namespace VulkanRhi
 		// Depth render target related
 		VkFormat		mDepthVkFormat;	///< Can be "VK_FORMAT_UNDEFINED" if no depth stencil buffer is needed
 		VkImage			mDepthVkImage;
-		VkDeviceMemory  mDepthVkDeviceMemory;
+		VulkanMemory	mDepthVulkanMemory;
 		VkImageView		mDepthVkImageView;
 
 
@@ -10617,7 +11898,7 @@ namespace VulkanRhi
 				VK_NULL_HANDLE,														// basePipelineHandle (VkPipeline)
 				0																	// basePipelineIndex (int32_t)
 			};
-			if (vkCreateGraphicsPipelines(vulkanRhi.getVulkanContext().getVkDevice(), VK_NULL_HANDLE, 1, &vkGraphicsPipelineCreateInfo, vulkanRhi.getVkAllocationCallbacks(), &mVkPipeline) == VK_SUCCESS)
+			if (vkCreateGraphicsPipelines(vulkanRhi.getVulkanContext().getVkDevice(), vulkanRhi.getVkPipelineCache(), 1, &vkGraphicsPipelineCreateInfo, vulkanRhi.getVkAllocationCallbacks(), &mVkPipeline) == VK_SUCCESS)
 			{
 				// Assign a default name to the resource for debugging purposes
 				#ifdef RHI_DEBUG
@@ -10759,7 +12040,7 @@ namespace VulkanRhi
 				VK_NULL_HANDLE,															// basePipelineHandle (VkPipeline)
 				0																		// basePipelineIndex (int32_t)
 			};
-			if (vkCreateComputePipelines(vulkanRhi.getVulkanContext().getVkDevice(), VK_NULL_HANDLE, 1, &vkComputePipelineCreateInfo, vulkanRhi.getVkAllocationCallbacks(), &mVkPipeline) == VK_SUCCESS)
+			if (vkCreateComputePipelines(vulkanRhi.getVulkanContext().getVkDevice(), vulkanRhi.getVkPipelineCache(), 1, &vkComputePipelineCreateInfo, vulkanRhi.getVkAllocationCallbacks(), &mVkPipeline) == VK_SUCCESS)
 			{
 				// Assign a default name to the resource for debugging purposes
 				#ifdef RHI_DEBUG
@@ -10865,8 +12146,8 @@ namespace VulkanRhi
 		*    Root signature
 		*  @param[in] rootParameterIndex
 		*    Root parameter index
-		*  @param[in] vkDescriptorSet
-		*    Wrapped Vulkan descriptor set
+		*  @param[in] vulkanDescriptorSet
+		*    Wrapped Vulkan descriptor set, the resource group takes over the ownership
 		*  @param[in] numberOfResources
 		*    Number of resources, having no resources is invalid
 		*  @param[in] resources
@@ -10874,10 +12155,10 @@ namespace VulkanRhi
 		*  @param[in] samplerStates
 		*    If not a null pointer at least "numberOfResources" sampler state pointers, must be valid if there's at least one texture resource, the resource group will keep a reference to the sampler states
 		*/
-		ResourceGroup(RootSignature& rootSignature, uint32_t rootParameterIndex, VkDescriptorSet vkDescriptorSet, uint32_t numberOfResources, Rhi::IResource** resources, Rhi::ISamplerState** samplerStates RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
+		ResourceGroup(RootSignature& rootSignature, uint32_t rootParameterIndex, const VulkanDescriptorSet& vulkanDescriptorSet, uint32_t numberOfResources, Rhi::IResource** resources, Rhi::ISamplerState** samplerStates RHI_RESOURCE_DEBUG_NAME_PARAMETER) :
 			IResourceGroup(rootSignature.getRhi() RHI_RESOURCE_DEBUG_PASS_PARAMETER),
 			mRootSignature(rootSignature),
-			mVkDescriptorSet(vkDescriptorSet),
+			mVulkanDescriptorSet(vulkanDescriptorSet),
 			mNumberOfResources(numberOfResources),
 			mResources(RHI_MALLOC_TYPED(rootSignature.getRhi().getContext(), Rhi::IResource*, mNumberOfResources)),
 			mSamplerStates(nullptr)
@@ -10887,6 +12168,7 @@ namespace VulkanRhi
 			// Process all resources and add our reference to the RHI resource
 			const VulkanRhi& vulkanRhi = static_cast<VulkanRhi&>(getRhi());
 			const VkDevice vkDevice = vulkanRhi.getVulkanContext().getVkDevice();
+			const VkDescriptorSet vkDescriptorSet = mVulkanDescriptorSet.vkDescriptorSet;
 			if (nullptr != samplerStates)
 			{
 				mSamplerStates = RHI_MALLOC_TYPED(vulkanRhi.getContext(), Rhi::ISamplerState*, mNumberOfResources);
@@ -10923,7 +12205,7 @@ namespace VulkanRhi
 						{
 							VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,		// sType (VkStructureType)
 							nullptr,									// pNext (const void*)
-							mVkDescriptorSet,							// dstSet (VkDescriptorSet)
+							vkDescriptorSet,							// dstSet (VkDescriptorSet)
 							resourceIndex,								// dstBinding (uint32_t)
 							0,											// dstArrayElement (uint32_t)
 							1,											// descriptorCount (uint32_t)
@@ -10948,7 +12230,7 @@ namespace VulkanRhi
 						{
 							VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,		// sType (VkStructureType)
 							nullptr,									// pNext (const void*)
-							mVkDescriptorSet,							// dstSet (VkDescriptorSet)
+							vkDescriptorSet,							// dstSet (VkDescriptorSet)
 							resourceIndex,								// dstBinding (uint32_t)
 							0,											// dstArrayElement (uint32_t)
 							1,											// descriptorCount (uint32_t)
@@ -10970,7 +12252,7 @@ namespace VulkanRhi
 						{
 							VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,																												// sType (VkStructureType)
 							nullptr,																																			// pNext (const void*)
-							mVkDescriptorSet,																																	// dstSet (VkDescriptorSet)
+							vkDescriptorSet,																																	// dstSet (VkDescriptorSet)
 							resourceIndex,																																		// dstBinding (uint32_t)
 							0,																																					// dstArrayElement (uint32_t)
 							1,																																					// descriptorCount (uint32_t)
@@ -10997,7 +12279,7 @@ namespace VulkanRhi
 						{
 							VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,	// sType (VkStructureType)
 							nullptr,								// pNext (const void*)
-							mVkDescriptorSet,						// dstSet (VkDescriptorSet)
+							vkDescriptorSet,						// dstSet (VkDescriptorSet)
 							resourceIndex,							// dstBinding (uint32_t)
 							0,										// dstArrayElement (uint32_t)
 							1,										// descriptorCount (uint32_t)
@@ -11022,7 +12304,7 @@ namespace VulkanRhi
 						{
 							VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,		// sType (VkStructureType)
 							nullptr,									// pNext (const void*)
-							mVkDescriptorSet,							// dstSet (VkDescriptorSet)
+							vkDescriptorSet,							// dstSet (VkDescriptorSet)
 							resourceIndex,								// dstBinding (uint32_t)
 							0,											// dstArrayElement (uint32_t)
 							1,											// descriptorCount (uint32_t)
@@ -11047,7 +12329,7 @@ namespace VulkanRhi
 						{
 							VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,	// sType (VkStructureType)
 							nullptr,								// pNext (const void*)
-							mVkDescriptorSet,						// dstSet (VkDescriptorSet)
+							vkDescriptorSet,						// dstSet (VkDescriptorSet)
 							resourceIndex,							// dstBinding (uint32_t)
 							0,										// dstArrayElement (uint32_t)
 							1,										// descriptorCount (uint32_t)
@@ -11172,7 +12454,7 @@ namespace VulkanRhi
 						{
 							VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET,																		// sType (VkStructureType)
 							nullptr,																									// pNext (const void*)
-							mVkDescriptorSet,																							// dstSet (VkDescriptorSet)
+							vkDescriptorSet,																							// dstSet (VkDescriptorSet)
 							resourceIndex,																								// dstBinding (uint32_t)
 							0,																											// dstArrayElement (uint32_t)
 							1,																											// descriptorCount (uint32_t)
@@ -11217,7 +12499,7 @@ namespace VulkanRhi
 				if (nullptr != vkDebugMarkerSetObjectNameEXT)
 				{
 					RHI_DECORATED_DEBUG_NAME(debugName, detailedDebugName, "Resource group", 17)	// 17 = "Resource group: " including terminating zero
-					Helper::setDebugObjectName(vulkanRhi.getVulkanContext().getVkDevice(), VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT, (uint64_t)mVkDescriptorSet, detailedDebugName);
+					Helper::setDebugObjectName(vulkanRhi.getVulkanContext().getVkDevice(), VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT, (uint64_t)vkDescriptorSet, detailedDebugName);
 				}
 			#endif
 		}
@@ -11249,10 +12531,7 @@ namespace VulkanRhi
 			RHI_FREE(context, mResources);
 
 			// Free Vulkan descriptor set
-			if (VK_NULL_HANDLE != mVkDescriptorSet)
-			{
-				vkFreeDescriptorSets(static_cast<VulkanRhi&>(mRootSignature.getRhi()).getVulkanContext().getVkDevice(), mRootSignature.getVkDescriptorPool(), 1, &mVkDescriptorSet);
-			}
+			static_cast<VulkanRhi&>(mRootSignature.getRhi()).getVulkanDescriptorAllocator().free(mVulkanDescriptorSet);
 			mRootSignature.releaseReference();
 		}
 
@@ -11265,7 +12544,7 @@ namespace VulkanRhi
 		*/
 		[[nodiscard]] inline VkDescriptorSet getVkDescriptorSet() const
 		{
-			return mVkDescriptorSet;
+			return mVulkanDescriptorSet.vkDescriptorSet;
 		}
 
 
@@ -11292,7 +12571,7 @@ namespace VulkanRhi
 	//[-------------------------------------------------------]
 	private:
 		RootSignature&		 mRootSignature;		///< Root signature
-		VkDescriptorSet		 mVkDescriptorSet;		///< "mVkDescriptorPool" of the root signature is the owner which manages the memory, can be a null handle (e.g. for a sampler resource group)
+		VulkanDescriptorSet	 mVulkanDescriptorSet;	///< The Vulkan descriptor allocator is the owner which manages the memory, can be a null handle (e.g. for a sampler resource group)
 		uint32_t			 mNumberOfResources;	///< Number of resources this resource group groups together
 		Rhi::IResource**	 mResources;			///< RHI resource, we keep a reference to it
 		Rhi::ISamplerState** mSamplerStates;		///< Sampler states, we keep a reference to it
@@ -11307,31 +12586,21 @@ namespace VulkanRhi
 		const Rhi::Context& context = vulkanRhi.getContext();
 
 		// Sanity checks
-		RHI_ASSERT(context, VK_NULL_HANDLE != mVkDescriptorPool, "The Vulkan descriptor pool instance must be valid")
 		RHI_ASSERT(context, rootParameterIndex < mVkDescriptorSetLayouts.size(), "The Vulkan root parameter index is out-of-bounds")
 		RHI_ASSERT(context, numberOfResources > 0, "The number of Vulkan resources must not be zero")
 		RHI_ASSERT(context, nullptr != resources, "The Vulkan resource pointers must be valid")
 
 		// Allocate Vulkan descriptor set
-		VkDescriptorSet vkDescriptorSet = VK_NULL_HANDLE;
+		VulkanDescriptorSet vulkanDescriptorSet;
 		if ((*resources)->getResourceType() != Rhi::ResourceType::SAMPLER_STATE)
 		{
-			const VkDescriptorSetAllocateInfo vkDescriptorSetAllocateInfo =
-			{
-				VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO,	// sType (VkStructureType)
-				nullptr,										// pNext (const void*)
-				mVkDescriptorPool,								// descriptorPool (VkDescriptorPool)
-				1,												// descriptorSetCount (uint32_t)
-				&mVkDescriptorSetLayouts[rootParameterIndex]	// pSetLayouts (const VkDescriptorSetLayout*)
-			};
-			if (vkAllocateDescriptorSets(vulkanRhi.getVulkanContext().getVkDevice(), &vkDescriptorSetAllocateInfo, &vkDescriptorSet) != VK_SUCCESS)
-			{
-				RHI_LOG(context, CRITICAL, "Failed to allocate the Vulkan descriptor set")
-			}
+			// Error handling is done inside the Vulkan descriptor allocator
+			RHI_ASSERT(context, VK_NULL_HANDLE != mVkDescriptorSetLayouts[rootParameterIndex], "The Vulkan descriptor set layout must be valid")
+			vulkanRhi.getVulkanDescriptorAllocator().allocate(mVkDescriptorSetLayouts[rootParameterIndex], vulkanDescriptorSet);
 		}
 
 		// Create resource group
-		return RHI_NEW(context, ResourceGroup)(*this, rootParameterIndex, vkDescriptorSet, numberOfResources, resources, samplerStates RHI_RESOURCE_DEBUG_PASS_PARAMETER);
+		return RHI_NEW(context, ResourceGroup)(*this, rootParameterIndex, vulkanDescriptorSet, numberOfResources, resources, samplerStates RHI_RESOURCE_DEBUG_PASS_PARAMETER);
 	}
 
 
@@ -11379,6 +12648,35 @@ namespace
 			reinterpret_cast<Rhi::IAllocator*>(pUserData)->reallocate(pMemory, 0, 0, 1);
 		}
 
+		[[nodiscard]] VkPipelineCache createVkPipelineCache(const VulkanRhi::VulkanRhi& vulkanRhi, const uint8_t* initialData, uint32_t numberOfBytes)
+		{
+			const VkPipelineCacheCreateInfo vkPipelineCacheCreateInfo =
+			{
+				VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO,	// sType (VkStructureType)
+				nullptr,										// pNext (const void*)
+				0,												// flags (VkPipelineCacheCreateFlags)
+				numberOfBytes,									// initialDataSize (size_t)
+				initialData										// pInitialData (const void*)
+			};
+			VkPipelineCache vkPipelineCache = VK_NULL_HANDLE;
+			if (vkCreatePipelineCache(vulkanRhi.getVulkanContext().getVkDevice(), &vkPipelineCacheCreateInfo, vulkanRhi.getVkAllocationCallbacks(), &vkPipelineCache) != VK_SUCCESS)
+			{
+				RHI_LOG(vulkanRhi.getContext(), CRITICAL, "Failed to create the Vulkan pipeline cache")
+				vkPipelineCache = VK_NULL_HANDLE;
+			}
+			return vkPipelineCache;
+		}
+
+		[[nodiscard]] size_t getVkPipelineCacheSize(const VulkanRhi::VulkanRhi& vulkanRhi, VkPipelineCache vkPipelineCache)
+		{
+			size_t numberOfBytes = 0;
+			if (VK_NULL_HANDLE != vkPipelineCache && vkGetPipelineCacheData(vulkanRhi.getVulkanContext().getVkDevice(), vkPipelineCache, &numberOfBytes, nullptr) != VK_SUCCESS)
+			{
+				numberOfBytes = 0;
+			}
+			return numberOfBytes;
+		}
+
 		namespace ImplementationDispatch
 		{
 
@@ -11718,6 +13016,10 @@ namespace VulkanRhi
 		mVkAllocationCallbacks{&context.getAllocator(), &::detail::vkAllocationFunction, &::detail::vkReallocationFunction, &::detail::vkFreeFunction, nullptr, nullptr},
 		mVulkanRuntimeLinking(nullptr),
 		mVulkanContext(nullptr),
+		mVulkanUploadQueue(nullptr),
+		mVulkanDescriptorAllocator(nullptr),
+		mVkPipelineCache(VK_NULL_HANDLE),
+		mSavedPipelineCacheSize(0),
 		mShaderLanguageGlsl(nullptr),
 		mGraphicsRootSignature(nullptr),
 		mComputeRootSignature(nullptr),
@@ -11744,6 +13046,16 @@ namespace VulkanRhi
 			// Is the Vulkan context initialized?
 			if (mVulkanContext->isInitialized())
 			{
+				// Create the Vulkan upload queue instance
+				mVulkanUploadQueue = RHI_NEW(mContext, VulkanUploadQueue)(*this);
+
+				// Create the Vulkan descriptor allocator instance
+				mVulkanDescriptorAllocator = RHI_NEW(mContext, VulkanDescriptorAllocator)(*this);
+
+				// Create the empty Vulkan pipeline cache instance, the renderer might provide its content from a previous run via "Rhi::IRhi::setPipelineCacheData()"
+				mVkPipelineCache = ::detail::createVkPipelineCache(*this, nullptr, 0);
+				mSavedPipelineCacheSize = ::detail::getVkPipelineCacheSize(*this, mVkPipelineCache);
+
 				// Initialize the capabilities
 				initializeCapabilities();
 
@@ -11815,6 +13127,24 @@ namespace VulkanRhi
 			mShaderLanguageGlsl->releaseReference();
 		}
 
+		// Destroy the Vulkan pipeline cache instance, in case we have one
+		if (VK_NULL_HANDLE != mVkPipelineCache)
+		{
+			vkDestroyPipelineCache(mVulkanContext->getVkDevice(), mVkPipelineCache, getVkAllocationCallbacks());
+		}
+
+		// Destroy the Vulkan descriptor allocator instance, in case we have one
+		if (nullptr != mVulkanDescriptorAllocator)
+		{
+			RHI_DELETE(mContext, VulkanDescriptorAllocator, mVulkanDescriptorAllocator);
+		}
+
+		// Destroy the Vulkan upload queue instance, in case we have one
+		if (nullptr != mVulkanUploadQueue)
+		{
+			RHI_DELETE(mContext, VulkanUploadQueue, mVulkanUploadQueue);
+		}
+
 		// Destroy the Vulkan context instance
 		RHI_DELETE(mContext, VulkanContext, mVulkanContext);
 
@@ -11825,8 +13155,7 @@ namespace VulkanRhi
 	void VulkanRhi::dispatchCommandBufferInternal(const Rhi::CommandBuffer& commandBuffer)
 	{
 		// Loop through all commands
-		const uint8_t* commandPacketBuffer = commandBuffer.getCommandPacketBuffer();
-		Rhi::ConstCommandPacket constCommandPacket = commandPacketBuffer;
+		Rhi::ConstCommandPacket constCommandPacket = commandBuffer.getFirstCommandPacket();
 		while (nullptr != constCommandPacket)
 		{
 			{ // Dispatch command packet
@@ -11836,8 +13165,7 @@ namespace VulkanRhi
 			}
 
 			{ // Next command
-				const uint32_t nextCommandPacketByteIndex = Rhi::CommandPacketHelper::getNextCommandPacketByteIndex(constCommandPacket);
-				constCommandPacket = (~0u != nextCommandPacketByteIndex) ? &commandPacketBuffer[nextCommandPacketByteIndex] : nullptr;
+				constCommandPacket = Rhi::CommandPacketHelper::getNextCommandPacket(constCommandPacket);
 			}
 		}
 	}
@@ -12568,42 +13896,48 @@ namespace VulkanRhi
 			{
 				mappedSubresource.rowPitch   = 0;
 				mappedSubresource.depthPitch = 0;
-				return (vkMapMemory(getVulkanContext().getVkDevice(), static_cast<VertexBuffer&>(resource).getVkDeviceMemory(), 0, VK_WHOLE_SIZE, 0, &mappedSubresource.data) == VK_SUCCESS);
+				mappedSubresource.data		 = static_cast<VertexBuffer&>(resource).getVulkanMemory().mappedData;
+				return (nullptr != mappedSubresource.data);
 			}
 
 			case Rhi::ResourceType::INDEX_BUFFER:
 			{
 				mappedSubresource.rowPitch   = 0;
 				mappedSubresource.depthPitch = 0;
-				return (vkMapMemory(getVulkanContext().getVkDevice(), static_cast<IndexBuffer&>(resource).getVkDeviceMemory(), 0, VK_WHOLE_SIZE, 0, &mappedSubresource.data) == VK_SUCCESS);
+				mappedSubresource.data		 = static_cast<IndexBuffer&>(resource).getVulkanMemory().mappedData;
+				return (nullptr != mappedSubresource.data);
 			}
 
 			case Rhi::ResourceType::TEXTURE_BUFFER:
 			{
 				mappedSubresource.rowPitch   = 0;
 				mappedSubresource.depthPitch = 0;
-				return (vkMapMemory(getVulkanContext().getVkDevice(), static_cast<TextureBuffer&>(resource).getVkDeviceMemory(), 0, VK_WHOLE_SIZE, 0, &mappedSubresource.data) == VK_SUCCESS);
+				mappedSubresource.data		 = static_cast<TextureBuffer&>(resource).getVulkanMemory().mappedData;
+				return (nullptr != mappedSubresource.data);
 			}
 
 			case Rhi::ResourceType::STRUCTURED_BUFFER:
 			{
 				mappedSubresource.rowPitch   = 0;
 				mappedSubresource.depthPitch = 0;
-				return (vkMapMemory(getVulkanContext().getVkDevice(), static_cast<StructuredBuffer&>(resource).getVkDeviceMemory(), 0, VK_WHOLE_SIZE, 0, &mappedSubresource.data) == VK_SUCCESS);
+				mappedSubresource.data		 = static_cast<StructuredBuffer&>(resource).getVulkanMemory().mappedData;
+				return (nullptr != mappedSubresource.data);
 			}
 
 			case Rhi::ResourceType::INDIRECT_BUFFER:
 			{
 				mappedSubresource.rowPitch   = 0;
 				mappedSubresource.depthPitch = 0;
-				return (vkMapMemory(getVulkanContext().getVkDevice(), static_cast<IndirectBuffer&>(resource).getVkDeviceMemory(), 0, VK_WHOLE_SIZE, 0, &mappedSubresource.data) == VK_SUCCESS);
+				mappedSubresource.data		 = static_cast<IndirectBuffer&>(resource).getVulkanMemory().mappedData;
+				return (nullptr != mappedSubresource.data);
 			}
 
 			case Rhi::ResourceType::UNIFORM_BUFFER:
 			{
 				mappedSubresource.rowPitch   = 0;
 				mappedSubresource.depthPitch = 0;
-				return (vkMapMemory(getVulkanContext().getVkDevice(), static_cast<UniformBuffer&>(resource).getVkDeviceMemory(), 0, VK_WHOLE_SIZE, 0, &mappedSubresource.data) == VK_SUCCESS);
+				mappedSubresource.data		 = static_cast<UniformBuffer&>(resource).getVulkanMemory().mappedData;
+				return (nullptr != mappedSubresource.data);
 			}
 
 			case Rhi::ResourceType::TEXTURE_1D:
@@ -12685,37 +14019,37 @@ namespace VulkanRhi
 		{
 			case Rhi::ResourceType::VERTEX_BUFFER:
 			{
-				vkUnmapMemory(getVulkanContext().getVkDevice(), static_cast<VertexBuffer&>(resource).getVkDeviceMemory());
+				// Nothing to do in here, host visible memory is persistently mapped and coherent
 				break;
 			}
 
 			case Rhi::ResourceType::INDEX_BUFFER:
 			{
-				vkUnmapMemory(getVulkanContext().getVkDevice(), static_cast<IndexBuffer&>(resource).getVkDeviceMemory());
+				// Nothing to do in here, host visible memory is persistently mapped and coherent
 				break;
 			}
 
 			case Rhi::ResourceType::TEXTURE_BUFFER:
 			{
-				vkUnmapMemory(getVulkanContext().getVkDevice(), static_cast<TextureBuffer&>(resource).getVkDeviceMemory());
+				// Nothing to do in here, host visible memory is persistently mapped and coherent
 				break;
 			}
 
 			case Rhi::ResourceType::STRUCTURED_BUFFER:
 			{
-				vkUnmapMemory(getVulkanContext().getVkDevice(), static_cast<StructuredBuffer&>(resource).getVkDeviceMemory());
+				// Nothing to do in here, host visible memory is persistently mapped and coherent
 				break;
 			}
 
 			case Rhi::ResourceType::INDIRECT_BUFFER:
 			{
-				vkUnmapMemory(getVulkanContext().getVkDevice(), static_cast<IndirectBuffer&>(resource).getVkDeviceMemory());
+				// Nothing to do in here, host visible memory is persistently mapped and coherent
 				break;
 			}
 
 			case Rhi::ResourceType::UNIFORM_BUFFER:
 			{
-				vkUnmapMemory(getVulkanContext().getVkDevice(), static_cast<UniformBuffer&>(resource).getVkDeviceMemory());
+				// Nothing to do in here, host visible memory is persistently mapped and coherent
 				break;
 			}
 
@@ -12889,6 +14223,84 @@ namespace VulkanRhi
 	}
 
 
+	//[-------------------------------------------------------]
+	//[ Pipeline cache                                        ]
+	//[-------------------------------------------------------]
+	uint32_t VulkanRhi::getPipelineCacheData(uint8_t* data, uint32_t numberOfBytes) const
+	{
+		if (VK_NULL_HANDLE == mVkPipelineCache)
+		{
+			return 0;
+		}
+		size_t pipelineCacheSize = ::detail::getVkPipelineCacheSize(*this, mVkPipelineCache);
+		if (nullptr != data)
+		{
+			// The pipeline cache might have grown in between, in this case "VK_INCOMPLETE" is returned and the data is still valid
+			pipelineCacheSize = std::min(pipelineCacheSize, static_cast<size_t>(numberOfBytes));
+			const VkResult vkResult = vkGetPipelineCacheData(mVulkanContext->getVkDevice(), mVkPipelineCache, &pipelineCacheSize, data);
+			if (VK_SUCCESS != vkResult && VK_INCOMPLETE != vkResult)
+			{
+				// Error!
+				RHI_LOG(mContext, CRITICAL, "Failed to get the Vulkan pipeline cache data")
+				return 0;
+			}
+			mSavedPipelineCacheSize = pipelineCacheSize;
+		}
+		return static_cast<uint32_t>(pipelineCacheSize);
+	}
+
+	bool VulkanRhi::setPipelineCacheData(const uint8_t* data, uint32_t numberOfBytes)
+	{
+		if (VK_NULL_HANDLE == mVkPipelineCache || nullptr == data)
+		{
+			return false;
+		}
+
+		// Validate the pipeline cache header against the physical device and driver, some drivers don't handle foreign data gracefully
+		// -> Layout as defined by "VK_PIPELINE_CACHE_HEADER_VERSION_ONE": Header length, header version, vendor ID, device ID, pipeline cache UUID
+		{
+			static constexpr uint32_t HEADER_NUMBER_OF_BYTES = sizeof(uint32_t) * 4 + VK_UUID_SIZE;
+			if (numberOfBytes < HEADER_NUMBER_OF_BYTES)
+			{
+				return false;
+			}
+			uint32_t header[4] = {};
+			memcpy(header, data, sizeof(header));
+			VkPhysicalDeviceProperties vkPhysicalDeviceProperties;
+			vkGetPhysicalDeviceProperties(mVulkanContext->getVkPhysicalDevice(), &vkPhysicalDeviceProperties);
+			if (header[0] < HEADER_NUMBER_OF_BYTES || header[0] > numberOfBytes || VK_PIPELINE_CACHE_HEADER_VERSION_ONE != header[1] || vkPhysicalDeviceProperties.vendorID != header[2] || vkPhysicalDeviceProperties.deviceID != header[3] ||
+				memcmp(vkPhysicalDeviceProperties.pipelineCacheUUID, data + sizeof(header), VK_UUID_SIZE) != 0)
+			{
+				RHI_LOG(mContext, INFORMATION, "The Vulkan pipeline cache data was created by another device or driver version and is ignored")
+				return false;
+			}
+		}
+
+		// Create the new Vulkan pipeline cache and merge in everything compiled so far
+		const VkPipelineCache vkPipelineCache = ::detail::createVkPipelineCache(*this, data, numberOfBytes);
+		if (VK_NULL_HANDLE == vkPipelineCache)
+		{
+			return false;
+		}
+		const VkDevice vkDevice = mVulkanContext->getVkDevice();
+		if (vkMergePipelineCaches(vkDevice, vkPipelineCache, 1, &mVkPipelineCache) != VK_SUCCESS)
+		{
+			RHI_LOG(mContext, WARNING, "Failed to merge Vulkan pipeline caches")
+		}
+		vkDestroyPipelineCache(vkDevice, mVkPipelineCache, getVkAllocationCallbacks());
+		mVkPipelineCache = vkPipelineCache;
+		mSavedPipelineCacheSize = ::detail::getVkPipelineCacheSize(*this, mVkPipelineCache);
+
+		// Done
+		return true;
+	}
+
+	bool VulkanRhi::doesPipelineCacheNeedSaving() const
+	{
+		return (VK_NULL_HANDLE != mVkPipelineCache && ::detail::getVkPipelineCacheSize(*this, mVkPipelineCache) != mSavedPipelineCacheSize);
+	}
+
+
 	//[-------------------------------------------------------]
 	//[ Private methods                                       ]
 	//[-------------------------------------------------------]
@@ -12986,6 +14398,10 @@ namespace VulkanRhi
 		// Vulkan has shader bytecode support
 		mCapabilities.shaderBytecode = false;	// TODO(co) Vulkan has shader bytecode support, set "mCapabilities.shaderBytecode" to true later on
 
+		// Vulkan buffers live in persistently mapped host visible coherent memory, swap chain present waits until the queue is idle so there are no frames in flight
+		mCapabilities.persistentMapping = true;
+		mCapabilities.maximumNumberOfFramesInFlight = 0;
+
 		// Is there support for vertex shaders (VS)?
 		mCapabilities.vertexShader = true;
 
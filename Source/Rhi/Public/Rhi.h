@@ -238,12 +238,16 @@
 PRAGMA_WARNING_PUSH
 	PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'return': conversion from 'int' to 'std::char_traits<wchar_t>::int_type', signed/unsigned mismatch
 	PRAGMA_WARNING_DISABLE_MSVC(4574)	// warning C4574: '_HAS_ITERATOR_DEBUGGING' is defined to be '0': did you mean to use '#if _HAS_ITERATOR_DEBUGGING'?
+	PRAGMA_WARNING_DISABLE_MSVC(4623)	// warning C4623: 'std::_List_node<_Ty,std::_Default_allocator_traits<_Alloc>::void_pointer>': default constructor was implicitly defined as deleted
 	PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::codecvt_base': copy constructor was implicitly defined as deleted
 	PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::codecvt_base': assignment operator was implicitly defined as deleted
 	PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
 	PRAGMA_WARNING_DISABLE_MSVC(4987)	// warning C4987: nonstandard extension used: 'throw (...)'
+	PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::atomic_flag': move constructor was implicitly defined as deleted (compiling source file E:\private\unrimp\Source\Rhi\Private\Direct3D10Rhi\Direct3D10Rhi.cpp)
+	PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Compressed_pair<glslang::pool_allocator<char>,std::_String_val<std::_Simple_types<_Ty>>,false>': move assignment operator was implicitly defined as deleted
 	#include <new>			// For placement new
 	#include <cmath>
+	#include <atomic>		// For "std::atomic<>"
 	#include <string.h>		// For "strcpy()"
 	#include <inttypes.h>	// For uint32_t, uint64_t etc.
 PRAGMA_WARNING_POP
@@ -285,19 +289,6 @@ PRAGMA_WARNING_POP
 	*/
 	#define RHI_RESOURCE_DEBUG_PASS_PARAMETER
 #endif
-#ifdef RHI_STATISTICS
-	// Disable warnings in external headers, we can't fix them
-	PRAGMA_WARNING_PUSH
-		PRAGMA_WARNING_DISABLE_MSVC(4365)	// warning C4365: 'return': conversion from 'int' to 'std::char_traits<wchar_t>::int_type', signed/unsigned mismatch
-		PRAGMA_WARNING_DISABLE_MSVC(4623)	// warning C4623: 'std::_List_node<_Ty,std::_Default_allocator_traits<_Alloc>::void_pointer>': default constructor was implicitly defined as deleted
-		PRAGMA_WARNING_DISABLE_MSVC(4625)	// warning C4625: 'std::_Ptr_base<_Ty>': copy constructor was implicitly defined as deleted
-		PRAGMA_WARNING_DISABLE_MSVC(4626)	// warning C4626: 'std::_Compressed_pair<glslang::pool_allocator<char>,std::_String_val<std::_Simple_types<_Ty>>,false>': assignment operator was implicitly defined as deleted
-		PRAGMA_WARNING_DISABLE_MSVC(4668)	// warning C4668: '_M_HYBRID_X86_ARM64' is not defined as a preprocessor macro, replacing with '0' for '#if/#elif'
-		PRAGMA_WARNING_DISABLE_MSVC(5026)	// warning C5026: 'std::atomic_flag': move constructor was implicitly defined as deleted (compiling source file E:\private\unrimp\Source\Rhi\Private\Direct3D10Rhi\Direct3D10Rhi.cpp)
-		PRAGMA_WARNING_DISABLE_MSVC(5027)	// warning C5027: 'std::_Compressed_pair<glslang::pool_allocator<char>,std::_String_val<std::_Simple_types<_Ty>>,false>': move assignment operator was implicitly defined as deleted
-		#include <atomic>	// For "std::atomic<>"
-	PRAGMA_WARNING_POP
-#endif
 #ifdef _WIN32
 	#include <intrin.h>	// For "__nop()"
 #endif
@@ -3392,6 +3383,7 @@ namespace Rhi
 	*
 	*  @note
 	*    - Initially the reference counter is 0
+	*    - Thread-safe, for example a render thread might change reference counters while dispatching a command buffer and the calling thread is already building the next frame
 	*/
 	template <class AType>
 	class RefCount
@@ -3447,11 +3439,8 @@ namespace Rhi
 		*/
 		FORCEINLINE uint32_t addReference()
 		{
-			// Increment reference count
-			++mRefCount;
-
-			// Return current reference count
-			return mRefCount;
+			// Increment reference count and return current reference count
+			return ++mRefCount;
 		}
 
 		/**
@@ -3467,22 +3456,23 @@ namespace Rhi
 		FORCEINLINE uint32_t releaseReference()
 		{
 			// Decrement reference count
-			if (mRefCount > 1)
+			// -> Compare and swap so the last reference is never released by two threads at the same time
+			uint32_t refCount = mRefCount.load(std::memory_order_relaxed);
+			while (refCount > 1)
 			{
-				--mRefCount;
-
-				// Return current reference count
-				return mRefCount;
+				if (mRefCount.compare_exchange_weak(refCount, refCount - 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+				{
+					// Return current reference count
+					return refCount - 1;
+				}
 			}
 
 			// Destroy object when no references are left
-			else
-			{
-				selfDestruct();
+			std::atomic_thread_fence(std::memory_order_acquire);
+			selfDestruct();
 
-				// This object is no longer
-				return 0;
-			}
+			// This object is no longer
+			return 0;
 		}
 
 		/**
@@ -3508,7 +3498,7 @@ namespace Rhi
 
 	// Private data
 	private:
-		uint32_t mRefCount; ///< Reference count
+		std::atomic<uint32_t> mRefCount; ///< Reference count
 
 	};
 
@@ -3803,6 +3793,8 @@ namespace Rhi
 		bool				baseVertex;										///< Base vertex supported for draw calls?
 		bool				nativeMultithreading;							///< Does the RHI support native multithreading? For example Direct3D 11 does meaning we can also create RHI resources asynchronous while for OpenGL we have to create an separate OpenGL context (less efficient, more complex to implement).
 		bool				shaderBytecode;									///< Shader bytecode supported?
+		bool				persistentMapping;								///< Are texture, indirect and uniform buffers created with "Rhi::BufferUsage::STREAM_DRAW" persistently mapped? If so, "Rhi::IRhi::map()" always returns the same address without discarding and "Rhi::IRhi::unmap()" does nothing, meaning the user must not overwrite data of the last "maximumNumberOfFramesInFlight" frames.
+		uint8_t				maximumNumberOfFramesInFlight;					///< Maximum number of presented frames the GPU might still be working on, only relevant for persistent mapping: Buffer data used in frame n can be overwritten in frame n + maximumNumberOfFramesInFlight + 1
 		// Graphics
 		bool				vertexShader;									///< Is there support for vertex shaders (VS)?
 		uint32_t			maximumNumberOfPatchVertices;					///< Tessellation-control-shader (TCS) stage and tessellation-evaluation-shader (TES) stage: Maximum number of vertices per patch (usually 0 for no tessellation support or 32 which is the maximum number of supported vertices per patch)
@@ -3842,6 +3834,8 @@ namespace Rhi
 			baseVertex(false),
 			nativeMultithreading(false),
 			shaderBytecode(false),
+			persistentMapping(false),
+			maximumNumberOfFramesInFlight(0),
 			vertexShader(false),
 			maximumNumberOfPatchVertices(0),
 			maximumNumberOfGsOutputVertices(0),
@@ -3954,6 +3948,12 @@ namespace Rhi
 			std::atomic<uint32_t> numberOfCreatedMeshShaders;					///< Number of created mesh shader (MS) instances
 			std::atomic<uint32_t> currentNumberOfComputeShaders;				///< Current number of compute shader (CS) instances
 			std::atomic<uint32_t> numberOfCreatedComputeShaders;				///< Number of created compute shader (CS) instances
+			// Device memory, only gathered by RHI implementations which manage device memory on their own (e.g. Vulkan), not part of "getNumberOfCurrentResources()"
+			std::atomic<uint32_t> currentNumberOfDeviceMemoryAllocations;		///< Current number of device memory allocations (memory blocks and dedicated allocations)
+			std::atomic<uint32_t> numberOfCreatedDeviceMemoryAllocations;		///< Number of created device memory allocations
+			std::atomic<uint32_t> currentNumberOfDeviceMemorySubAllocations;	///< Current number of resources sub-allocated inside device memory blocks
+			std::atomic<uint64_t> currentNumberOfDeviceMemoryBytes;				///< Current number of allocated device memory bytes
+			std::atomic<uint64_t> currentNumberOfUsedDeviceMemoryBytes;			///< Current number of device memory bytes used by resources, the difference to "currentNumberOfDeviceMemoryBytes" is unused memory block space
 
 		// Public methods
 		public:
@@ -4030,7 +4030,13 @@ namespace Rhi
 				currentNumberOfMeshShaders(0),
 				numberOfCreatedMeshShaders(0),
 				currentNumberOfComputeShaders(0),
-				numberOfCreatedComputeShaders(0)
+				numberOfCreatedComputeShaders(0),
+				// Device memory
+				currentNumberOfDeviceMemoryAllocations(0),
+				numberOfCreatedDeviceMemoryAllocations(0),
+				currentNumberOfDeviceMemorySubAllocations(0),
+				currentNumberOfDeviceMemoryBytes(0),
+				currentNumberOfUsedDeviceMemoryBytes(0)
 			{}
 
 			/**
@@ -4152,6 +4158,11 @@ namespace Rhi
 				RHI_LOG(context, INFORMATION, "Mesh shaders: %u", currentNumberOfMeshShaders.load())
 				RHI_LOG(context, INFORMATION, "Compute shaders: %u", currentNumberOfComputeShaders.load())
 
+				// Device memory
+				RHI_LOG(context, INFORMATION, "Device memory allocations: %u", currentNumberOfDeviceMemoryAllocations.load())
+				RHI_LOG(context, INFORMATION, "Device memory sub-allocations: %u", currentNumberOfDeviceMemorySubAllocations.load())
+				RHI_LOG(context, INFORMATION, "Device memory: %llu bytes, %llu bytes used", static_cast<unsigned long long>(currentNumberOfDeviceMemoryBytes.load()), static_cast<unsigned long long>(currentNumberOfUsedDeviceMemoryBytes.load()))
+
 				// End
 				RHI_LOG(context, INFORMATION, "***************************************************")
 			}
@@ -4632,6 +4643,61 @@ namespace Rhi
 		*/
 		virtual void dispatchCommandBuffer(const CommandBuffer& commandBuffer) = 0;
 
+		//[-------------------------------------------------------]
+		//[ Pipeline cache                                        ]
+		//[-------------------------------------------------------]
+		/**
+		*  @brief
+		*    Return the RHI implementation specific pipeline cache data (e.g. the content of a Vulkan pipeline cache)
+		*
+		*  @param[out] data
+		*    Receives the pipeline cache data, can be a null pointer to just query the number of bytes
+		*  @param[in] numberOfBytes
+		*    Number of bytes "data" is able to hold, ignored if "data" is a null pointer
+		*
+		*  @return
+		*    The number of pipeline cache data bytes, 0 if the RHI implementation has no pipeline cache
+		*
+		*  @note
+		*    - The data is opaque, store it as it is and give it back to "Rhi::IRhi::setPipelineCacheData()" on the next run
+		*/
+		[[nodiscard]] virtual uint32_t getPipelineCacheData(uint8_t*, uint32_t) const
+		{
+			return 0;
+		}
+
+		/**
+		*  @brief
+		*    Set RHI implementation specific pipeline cache data previously returned by "Rhi::IRhi::getPipelineCacheData()"
+		*
+		*  @param[in] data
+		*    Pipeline cache data, the RHI implementation doesn't keep a reference to it
+		*  @param[in] numberOfBytes
+		*    Number of pipeline cache data bytes
+		*
+		*  @return
+		*    "true" if the data was accepted, "false" if it was rejected (e.g. created by another device or driver) or if the RHI implementation has no pipeline cache
+		*
+		*  @note
+		*    - Should be called before pipeline states are created, pipeline state data which is already inside the pipeline cache is kept
+		*/
+		virtual bool setPipelineCacheData(const uint8_t*, uint32_t)
+		{
+			return false;
+		}
+
+		/**
+		*  @brief
+		*    Return whether or not the pipeline cache has changed since it was last set or queried
+		*
+		*  @return
+		*    "true" if the pipeline cache needs saving, else "false"
+		*/
+		[[nodiscard]] virtual bool doesPipelineCacheNeedSaving() const
+		{
+			return false;
+		}
+
 		//[-------------------------------------------------------]
 		//[ RHI implementation specific                           ]
 		//[-------------------------------------------------------]
@@ -8817,29 +8883,30 @@ namespace Rhi
 	// Global functions
 	namespace CommandPacketHelper
 	{
-		static constexpr uint32_t OFFSET_NEXT_COMMAND_PACKET_BYTE_INDEX		= 0u;
-		static constexpr uint32_t OFFSET_IMPLEMENTATION_DISPATCH_FUNCTION	= OFFSET_NEXT_COMMAND_PACKET_BYTE_INDEX + sizeof(uint32_t);
-		static constexpr uint32_t OFFSET_COMMAND							= OFFSET_IMPLEMENTATION_DISPATCH_FUNCTION + sizeof(uint32_t);	// Don't use "sizeof(CommandDispatchFunctionIndex)" instead of "sizeof(uint32_t)" so we have a known alignment
+		static constexpr uint32_t COMMAND_PACKET_ALIGNMENT					= 8u;	// Command packets are aligned so commands holding pointers or 64 bit values are naturally aligned
+		static constexpr uint32_t OFFSET_NEXT_COMMAND_PACKET				= 0u;
+		static constexpr uint32_t OFFSET_IMPLEMENTATION_DISPATCH_FUNCTION	= OFFSET_NEXT_COMMAND_PACKET + sizeof(CommandPacket);
+		static constexpr uint32_t OFFSET_COMMAND							= (OFFSET_IMPLEMENTATION_DISPATCH_FUNCTION + sizeof(uint32_t) + COMMAND_PACKET_ALIGNMENT - 1) & ~(COMMAND_PACKET_ALIGNMENT - 1);	// Don't use "sizeof(CommandDispatchFunctionIndex)" instead of "sizeof(uint32_t)" so we have a known alignment
 
 		template <typename T>
 		[[nodiscard]] inline uint32_t getNumberOfBytes(uint32_t numberOfAuxiliaryBytes)
 		{
-			return OFFSET_COMMAND + sizeof(T) + numberOfAuxiliaryBytes;
+			return (OFFSET_COMMAND + static_cast<uint32_t>(sizeof(T)) + numberOfAuxiliaryBytes + COMMAND_PACKET_ALIGNMENT - 1) & ~(COMMAND_PACKET_ALIGNMENT - 1);
 		}
 
-		[[nodiscard]] inline uint32_t getNextCommandPacketByteIndex(const CommandPacket commandPacket)
+		[[nodiscard]] inline CommandPacket getNextCommandPacket(const CommandPacket commandPacket)
 		{
-			return *reinterpret_cast<const uint32_t*>(reinterpret_cast<const uint8_t*>(commandPacket) + OFFSET_NEXT_COMMAND_PACKET_BYTE_INDEX);
+			return *reinterpret_cast<const CommandPacket*>(reinterpret_cast<const uint8_t*>(commandPacket) + OFFSET_NEXT_COMMAND_PACKET);
 		}
 
-		[[nodiscard]] inline uint32_t getNextCommandPacketByteIndex(const ConstCommandPacket constCommandPacket)
+		[[nodiscard]] inline ConstCommandPacket getNextCommandPacket(const ConstCommandPacket constCommandPacket)
 		{
-			return *reinterpret_cast<const uint32_t*>(reinterpret_cast<const uint8_t*>(constCommandPacket) + OFFSET_NEXT_COMMAND_PACKET_BYTE_INDEX);
+			return *reinterpret_cast<const ConstCommandPacket*>(reinterpret_cast<const uint8_t*>(constCommandPacket) + OFFSET_NEXT_COMMAND_PACKET);
 		}
 
-		inline void storeNextCommandPacketByteIndex(const CommandPacket commandPacket, uint32_t nextPacketByteIndex)
+		inline void storeNextCommandPacket(const CommandPacket commandPacket, const CommandPacket nextCommandPacket)
 		{
-			*reinterpret_cast<uint32_t*>(reinterpret_cast<uint8_t*>(commandPacket) + OFFSET_NEXT_COMMAND_PACKET_BYTE_INDEX) = nextPacketByteIndex;
+			*reinterpret_cast<CommandPacket*>(reinterpret_cast<uint8_t*>(commandPacket) + OFFSET_NEXT_COMMAND_PACKET) = nextCommandPacket;
 		}
 
 		[[nodiscard]] inline CommandDispatchFunctionIndex* getCommandDispatchFunctionIndex(const CommandPacket commandPacket)
@@ -8885,7 +8952,7 @@ namespace Rhi
 
 		/**
 		*  @brief
-		*    Return auxiliary memory address of the given command; returned memory address is considered unstable and might change as soon as another command is added
+		*    Return auxiliary memory address of the given command; returned memory address stays valid until the command buffer is cleared
 		*/
 		template <typename T>
 		[[nodiscard]] inline uint8_t* getAuxiliaryMemory(T* command)
@@ -8895,7 +8962,7 @@ namespace Rhi
 
 		/**
 		*  @brief
-		*    Return auxiliary memory address of the given command; returned memory address is considered unstable and might change as soon as another command is added
+		*    Return auxiliary memory address of the given command; returned memory address stays valid until the command buffer is cleared
 		*/
 		template <typename T>
 		[[nodiscard]] inline const uint8_t* getAuxiliaryMemory(const T* command)
@@ -8919,7 +8986,7 @@ namespace Rhi
 	*    batching and instancing. Also the memory management is much simplified to be cache friendly.
 	*
 	*  @note
-	*    - The commands are stored as a flat contiguous array to be cache friendly
+	*    - The commands are stored as flat contiguous arrays inside recycled chunks to be cache friendly, growing never copies already recorded commands
 	*    - Each command can have an additional auxiliary buffer, e.g. to store uniform buffer data to dispatch to the RHI
 	*    - It's valid to record a command buffer only once, and dispatch it multiple times to the RHI
 	*/
@@ -8930,13 +8997,25 @@ namespace Rhi
 	public:
 		/**
 		*  @brief
-		*    Default constructor
+		*    Default constructor, command packet chunks are allocated from the heap
 		*/
 		inline CommandBuffer() :
-			mCommandPacketBufferNumberOfBytes(0),
-			mCommandPacketBuffer(nullptr),
-			mPreviousCommandPacketByteIndex(~0u),
-			mCurrentCommandPacketByteIndex(0)
+			CommandBuffer(nullptr)
+		{}
+
+		/**
+		*  @brief
+		*    Constructor
+		*
+		*  @param[in] allocator
+		*    Allocator to allocate the command packet chunks with, if null pointer the chunks are allocated from the heap, the allocator instance must stay valid as long as the command buffer instance exists
+		*/
+		inline explicit CommandBuffer(IAllocator* allocator) :
+			mAllocator(allocator),
+			mFirstChunk(nullptr),
+			mCurrentChunk(nullptr),
+			mFirstCommandPacket(nullptr),
+			mPreviousCommandPacket(nullptr)
 			#ifdef RHI_STATISTICS
 				, mNumberOfCommands(0)
 			#endif
@@ -8948,7 +9027,13 @@ namespace Rhi
 		*/
 		inline ~CommandBuffer()
 		{
-			delete [] mCommandPacketBuffer;
+			Chunk* chunk = mFirstChunk;
+			while (nullptr != chunk)
+			{
+				Chunk* nextChunk = chunk->nextChunk;
+				destroyChunk(*chunk);
+				chunk = nextChunk;
+			}
 		}
 
 		/**
@@ -8960,7 +9045,7 @@ namespace Rhi
 		*/
 		[[nodiscard]] inline bool isEmpty() const
 		{
-			return (~0u == mPreviousCommandPacketByteIndex);
+			return (nullptr == mPreviousCommandPacket);
 		}
 
 		#ifdef RHI_STATISTICS
@@ -8982,27 +9067,39 @@ namespace Rhi
 
 		/**
 		*  @brief
-		*    Return the command packet buffer
+		*    Return the first command packet
 		*
 		*  @return
-		*    The command packet buffer, can be a null pointer, don't destroy the instance
+		*    The first command packet, null pointer if the command buffer is empty, use "Rhi::CommandPacketHelper::getNextCommandPacket()" to iterate through the command packets, don't destroy the instance
 		*
 		*  @note
 		*    - Internal, don't access the method if you don't have to
 		*/
-		[[nodiscard]] inline const uint8_t* getCommandPacketBuffer() const
+		[[nodiscard]] inline ConstCommandPacket getFirstCommandPacket() const
 		{
-			return (~0u != mPreviousCommandPacketByteIndex) ? mCommandPacketBuffer : nullptr;
+			return mFirstCommandPacket;
 		}
 
 		/**
 		*  @brief
 		*    Clear the command buffer
+		*
+		*  @note
+		*    - The command packet chunks are kept and recycled when recording the next time, so a command buffer which is recorded once per frame doesn't allocate memory after the first frames
 		*/
 		inline void clear()
 		{
-			mPreviousCommandPacketByteIndex = ~0u;
-			mCurrentCommandPacketByteIndex = 0;
+			if (nullptr != mCurrentChunk)
+			{
+				for (Chunk* chunk = mFirstChunk; chunk != mCurrentChunk; chunk = chunk->nextChunk)
+				{
+					chunk->numberOfUsedBytes = 0;
+				}
+				mCurrentChunk->numberOfUsedBytes = 0;
+				mCurrentChunk = nullptr;
+			}
+			mFirstCommandPacket = nullptr;
+			mPreviousCommandPacket = nullptr;
 			#ifdef RHI_STATISTICS
 				mNumberOfCommands = 0;
 			#endif
@@ -9024,41 +9121,21 @@ namespace Rhi
 			// How many command package buffer bytes are consumed by the command to add?
 			const uint32_t numberOfCommandBytes = CommandPacketHelper::getNumberOfBytes<U>(numberOfAuxiliaryBytes);
 
-			// 4294967295 is the maximum value of an "uint32_t"-type: Check for overflow
-			// -> We use the magic number here to avoid "std::numeric_limits::max()" usage
-			ASSERT((static_cast<uint64_t>(mCurrentCommandPacketByteIndex) + numberOfCommandBytes) < 4294967295u, "Invalid current command packet byte index")
-
-			// Grow command packet buffer, if required
-			if (mCommandPacketBufferNumberOfBytes < mCurrentCommandPacketByteIndex + numberOfCommandBytes)
-			{
-				// Allocate new memory, grow using a known value but do also add the number of bytes consumed by the current command to add (many auxiliary bytes might be requested)
-				const uint32_t newCommandPacketBufferNumberOfBytes = mCommandPacketBufferNumberOfBytes + NUMBER_OF_BYTES_TO_GROW + numberOfCommandBytes;
-				uint8_t* newCommandPacketBuffer = new uint8_t[newCommandPacketBufferNumberOfBytes];
-
-				// Copy over current command package buffer content and free it, if required
-				if (nullptr != mCommandPacketBuffer)
-				{
-					memcpy(newCommandPacketBuffer, mCommandPacketBuffer, mCommandPacketBufferNumberOfBytes);
-					delete [] mCommandPacketBuffer;
-				}
-
-				// Finalize
-				mCommandPacketBuffer = newCommandPacketBuffer;
-				mCommandPacketBufferNumberOfBytes = newCommandPacketBufferNumberOfBytes;
-			}
-
 			// Get command package for the new command
-			CommandPacket commandPacket = &mCommandPacketBuffer[mCurrentCommandPacketByteIndex];
+			CommandPacket commandPacket = allocateCommandPackets(numberOfCommandBytes);
 
 			// Setup previous and current command package
-			if (~0u != mPreviousCommandPacketByteIndex)
+			if (nullptr != mPreviousCommandPacket)
 			{
-				CommandPacketHelper::storeNextCommandPacketByteIndex(&mCommandPacketBuffer[mPreviousCommandPacketByteIndex], mCurrentCommandPacketByteIndex);
+				CommandPacketHelper::storeNextCommandPacket(mPreviousCommandPacket, commandPacket);
 			}
-			CommandPacketHelper::storeNextCommandPacketByteIndex(commandPacket, ~0u);
+			else
+			{
+				mFirstCommandPacket = commandPacket;
+			}
+			CommandPacketHelper::storeNextCommandPacket(commandPacket, nullptr);
 			CommandPacketHelper::storeImplementationDispatchFunctionIndex(commandPacket, U::COMMAND_DISPATCH_FUNCTION_INDEX);
-			mPreviousCommandPacketByteIndex = mCurrentCommandPacketByteIndex;
-			mCurrentCommandPacketByteIndex += numberOfCommandBytes;
+			mPreviousCommandPacket = commandPacket;
 
 			// Done
 			#ifdef RHI_STATISTICS
@@ -9108,55 +9185,45 @@ namespace Rhi
 			ASSERT(this != &commandBuffer, "Can't append a command buffer to itself")
 			ASSERT(!isEmpty(), "Can't append empty command buffers")
 
-			// How many command package buffer bytes are consumed by the command to add?
-			const uint32_t numberOfCommandBytes = mCurrentCommandPacketByteIndex;
-
-			// 4294967295 is the maximum value of an "uint32_t"-type: Check for overflow
-			// -> We use the magic number here to avoid "std::numeric_limits::max()" usage
-			ASSERT((static_cast<uint64_t>(commandBuffer.mCurrentCommandPacketByteIndex) + numberOfCommandBytes) < 4294967295u, "Invalid current command packet byte index")
-
-			// Grow command packet buffer, if required
-			if (commandBuffer.mCommandPacketBufferNumberOfBytes < commandBuffer.mCurrentCommandPacketByteIndex + numberOfCommandBytes)
+			// The used chunks are the ones from the first chunk up to and including the current chunk, each one is copied over in one burst
+			for (const Chunk* chunk = mFirstChunk; ; chunk = chunk->nextChunk)
 			{
-				// Allocate new memory, grow using a known value but do also add the number of bytes consumed by the current command to add (many auxiliary bytes might be requested)
-				const uint32_t newCommandPacketBufferNumberOfBytes = commandBuffer.mCommandPacketBufferNumberOfBytes + NUMBER_OF_BYTES_TO_GROW + numberOfCommandBytes;
-				uint8_t* newCommandPacketBuffer = new uint8_t[newCommandPacketBufferNumberOfBytes];
+				const uint8_t* sourceCommandPackets = chunk->getCommandPackets();
+				const uint32_t numberOfCommandBytes = chunk->numberOfUsedBytes;
+				uint8_t* destinationCommandPackets = commandBuffer.allocateCommandPackets(numberOfCommandBytes);
+				memcpy(destinationCommandPackets, sourceCommandPackets, numberOfCommandBytes);
 
-				// Copy over current command package buffer content and free it, if required
-				if (nullptr != commandBuffer.mCommandPacketBuffer)
+				// Setup previous command package
+				if (nullptr != commandBuffer.mPreviousCommandPacket)
 				{
-					memcpy(newCommandPacketBuffer, commandBuffer.mCommandPacketBuffer, commandBuffer.mCommandPacketBufferNumberOfBytes);
-					delete [] commandBuffer.mCommandPacketBuffer;
+					CommandPacketHelper::storeNextCommandPacket(commandBuffer.mPreviousCommandPacket, destinationCommandPackets);
+				}
+				else
+				{
+					commandBuffer.mFirstCommandPacket = destinationCommandPackets;
 				}
 
-				// Finalize
-				commandBuffer.mCommandPacketBuffer = newCommandPacketBuffer;
-				commandBuffer.mCommandPacketBufferNumberOfBytes = newCommandPacketBufferNumberOfBytes;
-			}
-
-			// Copy over the command buffer in one burst
-			memcpy(&commandBuffer.mCommandPacketBuffer[commandBuffer.mCurrentCommandPacketByteIndex], mCommandPacketBuffer, mCurrentCommandPacketByteIndex);
-
-			// Setup previous command package
-			if (~0u != commandBuffer.mPreviousCommandPacketByteIndex)
-			{
-				CommandPacketHelper::storeNextCommandPacketByteIndex(&commandBuffer.mCommandPacketBuffer[commandBuffer.mPreviousCommandPacketByteIndex], commandBuffer.mCurrentCommandPacketByteIndex);
-			}
+				// Update command package links, the last command package of the chunk is linked by the next chunk
+				CommandPacket commandPacket = destinationCommandPackets;
+				const uint8_t* nextSourceCommandPacket = static_cast<const uint8_t*>(CommandPacketHelper::getNextCommandPacket(commandPacket));
+				while (nextSourceCommandPacket >= sourceCommandPackets && nextSourceCommandPacket < sourceCommandPackets + numberOfCommandBytes)
+				{
+					CommandPacket nextCommandPacket = destinationCommandPackets + (nextSourceCommandPacket - sourceCommandPackets);
+					CommandPacketHelper::storeNextCommandPacket(commandPacket, nextCommandPacket);
+					commandPacket = nextCommandPacket;
+					nextSourceCommandPacket = static_cast<const uint8_t*>(CommandPacketHelper::getNextCommandPacket(commandPacket));
+				}
+				CommandPacketHelper::storeNextCommandPacket(commandPacket, nullptr);
+				commandBuffer.mPreviousCommandPacket = commandPacket;
 
-			// Update command package indices
-			CommandPacket commandPacket = &commandBuffer.mCommandPacketBuffer[commandBuffer.mCurrentCommandPacketByteIndex];
-			uint32_t nextCommandPacketByteIndex = CommandPacketHelper::getNextCommandPacketByteIndex(commandPacket);
-			while (~0u != nextCommandPacketByteIndex)
-			{
-				nextCommandPacketByteIndex = commandBuffer.mCurrentCommandPacketByteIndex + nextCommandPacketByteIndex;
-				CommandPacketHelper::storeNextCommandPacketByteIndex(commandPacket, nextCommandPacketByteIndex);
-				commandPacket = &commandBuffer.mCommandPacketBuffer[nextCommandPacketByteIndex];
-				nextCommandPacketByteIndex = CommandPacketHelper::getNextCommandPacketByteIndex(commandPacket);
+				// Done?
+				if (chunk == mCurrentChunk)
+				{
+					break;
+				}
 			}
 
 			// Finalize
-			commandBuffer.mPreviousCommandPacketByteIndex = commandBuffer.mCurrentCommandPacketByteIndex + mPreviousCommandPacketByteIndex;
-			commandBuffer.mCurrentCommandPacketByteIndex += mCurrentCommandPacketByteIndex;
 			#ifdef RHI_STATISTICS
 				commandBuffer.mNumberOfCommands += mNumberOfCommands;
 			#endif
@@ -9177,16 +9244,111 @@ namespace Rhi
 
 	// Private definitions
 	private:
-		static constexpr uint32_t NUMBER_OF_BYTES_TO_GROW = 8192;
+		static constexpr uint32_t NUMBER_OF_BYTES_PER_CHUNK = 64 * 1024;	///< Default command packet chunk size, bigger chunks are only allocated for command packets with many auxiliary bytes
+
+		/**
+		*  @brief
+		*    Command packet chunk header, the command packets are directly following the header
+		*/
+		struct alignas(CommandPacketHelper::COMMAND_PACKET_ALIGNMENT) Chunk final
+		{
+			Chunk*	 nextChunk;
+			uint32_t numberOfBytes;		///< Number of command packet bytes the chunk can hold
+			uint32_t numberOfUsedBytes;	///< Number of command packet bytes currently in use
+
+			[[nodiscard]] inline uint8_t* getCommandPackets()
+			{
+				return reinterpret_cast<uint8_t*>(this) + sizeof(Chunk);
+			}
+
+			[[nodiscard]] inline const uint8_t* getCommandPackets() const
+			{
+				return reinterpret_cast<const uint8_t*>(this) + sizeof(Chunk);
+			}
+		};
+
+	// Private methods
+	private:
+		explicit CommandBuffer(const CommandBuffer&) = delete;
+		CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+		/**
+		*  @brief
+		*    Allocate command packet memory
+		*
+		*  @param[in] numberOfBytes
+		*    Number of bytes to allocate, must be a multiple of "Rhi::CommandPacketHelper::COMMAND_PACKET_ALIGNMENT"
+		*
+		*  @return
+		*    Contiguous command packet memory, don't destroy the memory
+		*
+		*  @note
+		*    - Memory which has already been handed out is never moved, in case the current chunk is full the next recycled chunk is used or a new chunk is allocated
+		*/
+		[[nodiscard]] inline uint8_t* allocateCommandPackets(uint32_t numberOfBytes)
+		{
+			if (nullptr == mCurrentChunk || mCurrentChunk->numberOfUsedBytes + numberOfBytes > mCurrentChunk->numberOfBytes)
+			{
+				// Use the next recycled chunk, if there's one which is large enough, else create a new chunk and insert it after the current chunk
+				Chunk* nextChunk = (nullptr != mCurrentChunk) ? mCurrentChunk->nextChunk : mFirstChunk;
+				if (nullptr == nextChunk || nextChunk->numberOfBytes < numberOfBytes)
+				{
+					Chunk* newChunk = createChunk((numberOfBytes > NUMBER_OF_BYTES_PER_CHUNK) ? numberOfBytes : NUMBER_OF_BYTES_PER_CHUNK);
+					newChunk->nextChunk = nextChunk;
+					if (nullptr != mCurrentChunk)
+					{
+						mCurrentChunk->nextChunk = newChunk;
+					}
+					else
+					{
+						mFirstChunk = newChunk;
+					}
+					nextChunk = newChunk;
+				}
+				mCurrentChunk = nextChunk;
+			}
+
+			// Hand out the command packet memory
+			uint8_t* commandPackets = mCurrentChunk->getCommandPackets() + mCurrentChunk->numberOfUsedBytes;
+			mCurrentChunk->numberOfUsedBytes += numberOfBytes;
+			return commandPackets;
+		}
+
+		[[nodiscard]] inline Chunk* createChunk(uint32_t numberOfBytes)
+		{
+			// 4294967295 is the maximum value of an "uint32_t"-type: Check for overflow
+			// -> We use the magic number here to avoid "std::numeric_limits::max()" usage
+			ASSERT((static_cast<uint64_t>(sizeof(Chunk)) + numberOfBytes) < 4294967295u, "Invalid number of command packet chunk bytes")
+			const size_t numberOfChunkBytes = sizeof(Chunk) + numberOfBytes;
+			void* memory = (nullptr != mAllocator) ? mAllocator->reallocate(nullptr, 0, numberOfChunkBytes, alignof(Chunk)) : new uint8_t[numberOfChunkBytes];
+			Chunk* chunk = new (memory) Chunk();
+			chunk->nextChunk = nullptr;
+			chunk->numberOfBytes = numberOfBytes;
+			chunk->numberOfUsedBytes = 0;
+			return chunk;
+		}
+
+		inline void destroyChunk(Chunk& chunk)
+		{
+			if (nullptr != mAllocator)
+			{
+				mAllocator->reallocate(&chunk, 0, 0, alignof(Chunk));
+			}
+			else
+			{
+				delete [] reinterpret_cast<uint8_t*>(&chunk);
+			}
+		}
 
 	// Private data
 	private:
+		IAllocator*	  mAllocator;				///< Allocator for the command packet chunks, can be a null pointer, don't destroy the instance
 		// Memory
-		uint32_t mCommandPacketBufferNumberOfBytes;
-		uint8_t* mCommandPacketBuffer;
+		Chunk*		  mFirstChunk;				///< First command packet chunk, the chunks after the current chunk are recycled ones, can be a null pointer
+		Chunk*		  mCurrentChunk;			///< Chunk command packets are currently added to, null pointer if no chunk is in use
 		// Current state
-		uint32_t mPreviousCommandPacketByteIndex;
-		uint32_t mCurrentCommandPacketByteIndex;
+		CommandPacket mFirstCommandPacket;		///< Can be a null pointer
+		CommandPacket mPreviousCommandPacket;	///< Can be a null pointer
 		#ifdef RHI_STATISTICS
 			uint32_t mNumberOfCommands;
 		#endif